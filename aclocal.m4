@@ -0,0 +1,124 @@
+m4_include([m4/00gnulib.m4])
+m4_include([m4/__inline.m4])
+m4_include([m4/absolute-header.m4])
+m4_include([m4/acl.m4])
+m4_include([m4/alloca.m4])
+m4_include([m4/builtin-expect.m4])
+m4_include([m4/byteswap.m4])
+m4_include([m4/canonicalize.m4])
+m4_include([m4/clock_time.m4])
+m4_include([m4/close-stream.m4])
+m4_include([m4/copy-file-range.m4])
+m4_include([m4/count-leading-zeros.m4])
+m4_include([m4/count-one-bits.m4])
+m4_include([m4/count-trailing-zeros.m4])
+m4_include([m4/d-type.m4])
+m4_include([m4/dirent_h.m4])
+m4_include([m4/dirfd.m4])
+m4_include([m4/double-slash-root.m4])
+m4_include([m4/dup2.m4])
+m4_include([m4/eealloc.m4])
+m4_include([m4/environ.m4])
+m4_include([m4/errno_h.m4])
+m4_include([m4/euidaccess.m4])
+m4_include([m4/execinfo.m4])
+m4_include([m4/explicit_bzero.m4])
+m4_include([m4/extensions.m4])
+m4_include([m4/extern-inline.m4])
+m4_include([m4/faccessat.m4])
+m4_include([m4/fcntl.m4])
+m4_include([m4/fcntl_h.m4])
+m4_include([m4/fdopendir.m4])
+m4_include([m4/filemode.m4])
+m4_include([m4/flexmember.m4])
+m4_include([m4/fpending.m4])
+m4_include([m4/fpieee.m4])
+m4_include([m4/fstatat.m4])
+m4_include([m4/fsusage.m4])
+m4_include([m4/fsync.m4])
+m4_include([m4/getdtablesize.m4])
+m4_include([m4/getgroups.m4])
+m4_include([m4/getloadavg.m4])
+m4_include([m4/getopt.m4])
+m4_include([m4/gettime.m4])
+m4_include([m4/gettimeofday.m4])
+m4_include([m4/glibc21.m4])
+m4_include([m4/gnulib-common.m4])
+m4_include([m4/gnulib-comp.m4])
+m4_include([m4/group-member.m4])
+m4_include([m4/ieee754-h.m4])
+m4_include([m4/include_next.m4])
+m4_include([m4/inttypes.m4])
+m4_include([m4/largefile.m4])
+m4_include([m4/limits-h.m4])
+m4_include([m4/localtime-buffer.m4])
+m4_include([m4/longlong.m4])
+m4_include([m4/lstat.m4])
+m4_include([m4/malloca.m4])
+m4_include([m4/manywarnings.m4])
+m4_include([m4/mbstate_t.m4])
+m4_include([m4/md5.m4])
+m4_include([m4/memmem.m4])
+m4_include([m4/mempcpy.m4])
+m4_include([m4/memrchr.m4])
+m4_include([m4/minmax.m4])
+m4_include([m4/mkostemp.m4])
+m4_include([m4/mktime.m4])
+m4_include([m4/mode_t.m4])
+m4_include([m4/multiarch.m4])
+m4_include([m4/nocrash.m4])
+m4_include([m4/nstrftime.m4])
+m4_include([m4/off_t.m4])
+m4_include([m4/open-cloexec.m4])
+m4_include([m4/open-slash.m4])
+m4_include([m4/open.m4])
+m4_include([m4/pathmax.m4])
+m4_include([m4/pipe2.m4])
+m4_include([m4/pkg.m4])
+m4_include([m4/pselect.m4])
+m4_include([m4/pthread_sigmask.m4])
+m4_include([m4/putenv.m4])
+m4_include([m4/readlink.m4])
+m4_include([m4/readlinkat.m4])
+m4_include([m4/regex.m4])
+m4_include([m4/sha1.m4])
+m4_include([m4/sha256.m4])
+m4_include([m4/sha512.m4])
+m4_include([m4/sig2str.m4])
+m4_include([m4/signal_h.m4])
+m4_include([m4/socklen.m4])
+m4_include([m4/ssize_t.m4])
+m4_include([m4/st_dm_mode.m4])
+m4_include([m4/stat-time.m4])
+m4_include([m4/std-gnu11.m4])
+m4_include([m4/stdalign.m4])
+m4_include([m4/stddef_h.m4])
+m4_include([m4/stdint.m4])
+m4_include([m4/stdio_h.m4])
+m4_include([m4/stdlib_h.m4])
+m4_include([m4/stpcpy.m4])
+m4_include([m4/string_h.m4])
+m4_include([m4/strnlen.m4])
+m4_include([m4/strtoimax.m4])
+m4_include([m4/strtoll.m4])
+m4_include([m4/symlink.m4])
+m4_include([m4/sys_select_h.m4])
+m4_include([m4/sys_socket_h.m4])
+m4_include([m4/sys_stat_h.m4])
+m4_include([m4/sys_time_h.m4])
+m4_include([m4/sys_types_h.m4])
+m4_include([m4/tempname.m4])
+m4_include([m4/time_h.m4])
+m4_include([m4/time_r.m4])
+m4_include([m4/time_rz.m4])
+m4_include([m4/timegm.m4])
+m4_include([m4/timer_time.m4])
+m4_include([m4/timespec.m4])
+m4_include([m4/tm_gmtoff.m4])
+m4_include([m4/unistd_h.m4])
+m4_include([m4/unlocked-io.m4])
+m4_include([m4/utimens.m4])
+m4_include([m4/utimes.m4])
+m4_include([m4/vararrays.m4])
+m4_include([m4/warnings.m4])
+m4_include([m4/wchar_t.m4])
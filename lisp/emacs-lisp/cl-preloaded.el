@@ -64,7 +64,7 @@ cl--typeof-types
     (buffer atom) (char-table array sequence atom)
     (bool-vector array sequence atom)
     (frame atom) (hash-table atom) (terminal atom)
-    (thread atom) (mutex atom) (condvar atom)
+    (thread atom) (mutex atom) (condvar atom) (regexp atom)
     (font-spec atom) (font-entity atom) (font-object atom)
     (vector array sequence atom)
     (user-ptr atom)
@@ -0,0 +1,113 @@
+;;; regexp-profile.el --- find out which regexps are slow  -*- lexical-binding: t -*-
+
+;; Copyright (C) 2021 Free Software Foundation, Inc.
+
+;; Keywords: lisp, maint
+
+;; This file is part of GNU Emacs.
+
+;; GNU Emacs is free software: you can redistribute it and/or modify
+;; it under the terms of the GNU General Public License as published by
+;; the Free Software Foundation, either version 3 of the License, or
+;; (at your option) any later version.
+
+;; GNU Emacs is distributed in the hope that it will be useful,
+;; but WITHOUT ANY WARRANTY; without even the implied warranty of
+;; MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+;; GNU General Public License for more details.
+
+;; You should have received a copy of the GNU General Public License
+;; along with GNU Emacs.  If not, see <https://www.gnu.org/licenses/>.
+
+;;; Commentary:
+
+;; When font-lock or `syntax-propertize' is slow, the culprit is
+;; often a single regexp that scans or backtracks far more than it
+;; should.  Type M-x regexp-profile-start, do whatever is slow, and
+;; then type M-x regexp-profile-report to see, for each regexp, how
+;; often it was used, how many bytes it looked at, how often the
+;; matcher backtracked, how deep its backtracking stack grew and how
+;; much time it took.  The statistics are gathered by the regexp
+;; matcher itself while `regexp-profiling' is non-nil.
+
+;;; Code:
+
+(require 'tabulated-list)
+
+(defvar regexp-profile--columns
+  ;; Name, width, index into the entries of `regexp-profile-data'.
+  '(("Seconds" 10 5) ("Calls" 9 1) ("Bytes" 12 2) ("Backtracks" 11 3)
+    ("Stack" 8 4))
+  "Numeric columns shown by `regexp-profile-report'.")
+
+;;;###autoload
+(defun regexp-profile-start ()
+  "Start gathering statistics about regexp searches and matches.
+Statistics gathered earlier are discarded."
+  (interactive)
+  (regexp-profile-reset)
+  (setq regexp-profiling t)
+  (message "Regexp profiling started"))
+
+;;;###autoload
+(defun regexp-profile-stop ()
+  "Stop gathering statistics about regexp searches and matches."
+  (interactive)
+  (setq regexp-profiling nil)
+  (message "Regexp profiling stopped"))
+
+(defun regexp-profile--sorter (index)
+  "Return a predicate comparing table entries by their INDEXth value."
+  (lambda (a b)
+    (< (nth index (car a)) (nth index (car b)))))
+
+(define-derived-mode regexp-profile-report-mode tabulated-list-mode
+  "Regexp-Profile"
+  "Major mode for the report shown by `regexp-profile-report'."
+  (setq tabulated-list-format
+        (vconcat
+         (mapcar (lambda (col)
+                   (list (car col) (nth 1 col)
+                         (regexp-profile--sorter (nth 2 col))
+                         :right-align t))
+                 regexp-profile--columns)
+         [("Regexp" 0 t)]))
+  (setq tabulated-list-sort-key (cons "Seconds" t))
+  (add-hook 'tabulated-list-revert-hook #'regexp-profile--refresh nil t)
+  (tabulated-list-init-header))
+
+(defun regexp-profile--refresh ()
+  "Recompute the entries of the current regexp profile report."
+  (setq tabulated-list-entries
+        (mapcar (lambda (data)
+                  (list data
+                        (vconcat
+                         (mapcar (lambda (col)
+                                   (let ((val (nth (nth 2 col) data)))
+                                     (if (floatp val)
+                                         (format "%.4f" val)
+                                       (number-to-string val))))
+                                 regexp-profile--columns)
+                         (vector (let ((print-escape-newlines t))
+                                   (prin1-to-string (car data)))))))
+                (regexp-profile-data))))
+
+;;;###autoload
+(defun regexp-profile-report ()
+  "Display the statistics gathered since `regexp-profile-start'.
+Each line describes one regexp: the total time spent searching and
+matching with it, the number of searches and matches, the number of
+bytes they looked at, the number of times the matcher backtracked,
+and the largest number of slots used in its backtracking stack.
+Type \\<tabulated-list-mode-map>\\[tabulated-list-sort] on a column \
+to sort by it, and \\[revert-buffer] to update the report."
+  (interactive)
+  (with-current-buffer (get-buffer-create "*Regexp Profile*")
+    (regexp-profile-report-mode)
+    (regexp-profile--refresh)
+    (tabulated-list-print)
+    (pop-to-buffer (current-buffer))))
+
+(provide 'regexp-profile)
+
+;;; regexp-profile.el ends here
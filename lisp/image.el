@@ -741,6 +741,50 @@ defimage
   `(defvar ,symbol (find-image ',specs) ,doc))
 
 
+;;; Deferred loading of images
+
+(declare-function image-load-deferred "image.c" (&optional frame))
+(defvar image-deferred-frames)
+
+(defvar image-load-deferred-timer nil
+  "Idle timer that loads images whose loading redisplay deferred.
+It runs while `image-load-time-budget' is a number.")
+
+(defun image-load-deferred-images ()
+  "Load the images whose loading redisplay deferred, and redisplay.
+Load them on the frames in `image-deferred-frames', a part at a
+time with `image-load-deferred', redisplaying after each part, until
+they are all loaded or input arrives."
+  (while (and image-deferred-frames
+              (not (input-pending-p)))
+    (let ((frames image-deferred-frames))
+      (setq image-deferred-frames nil)
+      (dolist (frame frames)
+        (when (and (frame-live-p frame)
+                   (image-load-deferred frame))
+          (push frame image-deferred-frames)))
+      (redisplay))))
+
+(defun image--watch-load-time-budget (_symbol newval _operation _where)
+  "Run `image-load-deferred-timer' if NEWVAL is a number."
+  (cond
+   ((numberp newval)
+    (unless image-load-deferred-timer
+      (setq image-load-deferred-timer
+            (run-with-idle-timer 0 t #'image-load-deferred-images))))
+   (image-load-deferred-timer
+    (cancel-timer image-load-deferred-timer)
+    (setq image-load-deferred-timer nil)
+    ;; Redisplay won't defer loading images any more, but load those
+    ;; it already deferred.
+    (when image-deferred-frames
+      (run-with-idle-timer 0 nil #'image-load-deferred-images)))))
+
+(when (fboundp 'image-load-deferred)
+  (add-variable-watcher 'image-load-time-budget
+                        #'image--watch-load-time-budget))
+
+
 ;;; Animated image API
 
 (defvar image-default-frame-delay 0.1
@@ -173,6 +173,9 @@ jit-lock-context-timer
 (defvar jit-lock-defer-timer nil
   "Timer for deferred fontification in Just-in-time Lock mode.")
 
+(defvar jit-lock-deferred-windows-timer nil
+  "Timer for redisplaying windows whose fontification redisplay deferred.")
+
 (defvar jit-lock-defer-buffers nil
   "List of buffers with pending deferred fontification.")
 (defvar jit-lock-stealth-buffers nil
@@ -254,6 +257,14 @@ jit-lock-mode
             (run-with-idle-timer jit-lock-defer-time t
                                  'jit-lock-deferred-fontify)))
 
+    ;; Init the timer for windows whose fontification redisplay
+    ;; deferred because of `fontification-time-budget'.
+    (when (and (numberp fontification-time-budget)
+               (> fontification-time-budget 0)
+               (null jit-lock-deferred-windows-timer))
+      (setq jit-lock-deferred-windows-timer
+            (run-with-idle-timer 0 t 'jit-lock-redisplay-deferred-windows)))
+
     ;; Initialize contextual fontification if requested.
     (when (eq jit-lock-contextually t)
       (unless jit-lock-context-timer
@@ -274,7 +285,7 @@ jit-lock-mode
    (t
     ;; Cancel our idle timers.
     (when (and (or jit-lock-stealth-timer jit-lock-defer-timer
-                   jit-lock-context-timer)
+                   jit-lock-context-timer jit-lock-deferred-windows-timer)
                ;; Only if there's no other buffer using them.
                (not (catch 'found
                       (dolist (buf (buffer-list))
@@ -288,7 +299,10 @@ jit-lock-mode
         (setq jit-lock-context-timer nil))
       (when jit-lock-defer-timer
         (cancel-timer jit-lock-defer-timer)
-        (setq jit-lock-defer-timer nil)))
+        (setq jit-lock-defer-timer nil))
+      (when jit-lock-deferred-windows-timer
+        (cancel-timer jit-lock-deferred-windows-timer)
+        (setq jit-lock-deferred-windows-timer nil)))
 
     ;; Remove hooks.
     (remove-hook 'after-change-functions 'jit-lock-after-change t)
@@ -622,6 +636,29 @@ jit-lock-deferred-fontify
       ;; (message "Jit-Defer Done")
       )))
 
+(defun jit-lock-redisplay-deferred-windows (&optional force)
+  "Redisplay the windows in `fontification-deferred-windows'.
+Do it one redisplay cycle at a time, each of which spends at most
+`fontification-time-budget' seconds fontifying, until there's
+nothing left to fontify or input arrives.
+If FORCE is non-nil, don't stop when input arrives."
+  (let ((preempted nil))
+    (while (and fontification-deferred-windows
+                (not memory-full)
+                (not preempted)
+                (or force (not (input-pending-p))))
+      (let ((windows fontification-deferred-windows))
+        (setq fontification-deferred-windows nil)
+        (dolist (window windows)
+          (when (window-live-p window)
+            (force-window-update window)))
+        (unless (redisplay force)
+          ;; Input preempted redisplay; try again when next idle.
+          (dolist (window windows)
+            (unless (memq window fontification-deferred-windows)
+              (push window fontification-deferred-windows)))
+          (setq preempted t))))))
+
 
 (defun jit-lock-context-fontify ()
   "Refresh fontification to take new context into account."
@@ -0,0 +1,2 @@
+;;; ja-dic.el --- stub
+(provide 'ja-dic)
@@ -0,0 +1,12583 @@
+;; Quail package `chinese-b5-tsangchi'
+;;   Generated by the command `miscdic-convert'
+;;   Source dictionary file: cangjie-table.b5
+;;   Copyright notice of the source file
+;;------------------------------------------------------
+;; # Copyright 2001 Christian Wittern <wittern@iis.sinica.edu.tw>
+;; #
+;; # Permission to copy and distribute both modified and
+;; # unmodified versions is granted without royalty provided
+;; # this notice is preserved.
+;;------------------------------------------------------
+
+;;; Code:
+
+(require 'quail)
+(quail-define-package "chinese-b5-tsangchi" "Chinese-BIG5" "倉B" t
+"中文輸入【倉頡】BIG5
+
+	漢語倉頡輸入鍵盤
+
+   [Q 手] [W 田] [E 水] [R 口] [T 廿] [Y 卜] [U 山] [I 戈] [O 人] [P 心]
+
+    [A 日] [S 尸] [D 木] [F 火] [G 土] [H 竹] [J 十] [L 中]
+
+      [Z  ] [X 難] [C 金] [V 女] [B 月] [N 弓] [M 一]
+
+\\<quail-translation-docstring>"
+  '(("." . quail-next-translation-block)
+   ("," . quail-prev-translation-block))
+  nil nil)
+
+(quail-define-rules
+("a"	"日曰")
+("aa"	"昌昍")
+("aaa"	"晶")
+("aamh"	"暘")
+("aaph"	"晹")
+("aapv"	"暍")
+("aate"	"曝")
+("aayf"	"暻")
+("ab"	"明")
+("abac"	"暝")
+("abbe"	"曖")
+("abbt"	"盟")
+("abhaf"	"鷳")
+("abik"	"猒")
+("abjcm"	"曌")
+("abjj"	"暉暈")
+("abme"	"暖")
+("abms"	"勗")
+("abof"	"暩")
+("abu"	"冒")
+("abuu"	"晛")
+("acim"	"暡")
+("acnh"	"晜")
+("acsh"	"昐")
+("ad"	"杲")
+("adhaf"	"鷴")
+("adhl"	"晰")
+("admq"	"暐")
+("adwf"	"暕")
+("aenl"	"鄤")
+("af"	"炅炚")
+("afbf"	"曭")
+("afdq"	"暽")
+("aff"	"晱")
+("afhhh"	"影")
+("afmbc"	"顥顯")
+("afmu"	"晃")
+("afno"	"歞")
+("agbt"	"曀")
+("agdi"	"時")
+("aggu"	"曉")
+("ahbr"	"晌晑")
+("ahbu"	"眉")
+("ahe"	"昄")
+("ahgf"	"曛")
+("ahhl"	"昴")
+("ahln"	"剔")
+("ahml"	"昕")
+("ahog"	"暀")
+("ahoo"	"暰")
+("ahor"	"晷")
+("ahqm"	"星")
+("ahqo"	"昳")
+("ahs"	"昨昈")
+("ahsk"	"曒")
+("aht"	"昇")
+("ahvl"	"昂")
+("ahxu"	"晲")
+("aice"	"晙")
+("aihs"	"晟")
+("aijb"	"晡")
+("aimvu"	"既")
+("aine"	"昹")
+("aisl"	"即")
+("aitc"	"曠")
+("aj"	"早")
+("ajbj"	"暔")
+("ajd"	"昧")
+("ajii"	"暷")
+("ajka"	"暑")
+("ajmm"	"暄")
+("ajmu"	"晥")
+("ajnu"	"晼")
+("ajv"	"晏")
+("ak"	"旲")
+("akcf"	"暸")
+("akkb"	"晞")
+("akll"	"昦")
+("aklu"	"晻")
+("akms"	"晇")
+("akn"	"旯")
+("albk"	"映")
+("alg"	"堲")
+("alln"	"昲")
+("almo"	"晁")
+("alnc"	"曊")
+("am"	"旦")
+("amam"	"晅")
+("ambb"	"曘")
+("ambc"	"暊")
+("ambg"	"曤")
+("ambi"	"曇")
+("amcw"	"晒")
+("amd"	"旴")
+("amg"	"旺")
+("amhaf"	"鴠")
+("amhqu"	"毾")
+("ami"	"戥")
+("amig"	"晊")
+("amj"	"旱旰")
+("amk"	"昊")
+("amks"	"昮")
+("ammk"	"晸")
+("ammp"	"曬")
+("ammr"	"晤")
+("ammv"	"晨")
+("amo"	"昃")
+("amob"	"昺")
+("amsh"	"昜")
+("amtb"	"曞")
+("amwg"	"量")
+("amwj"	"曋")
+("amyo"	"是")
+("an"	"門")
+("ana"	"間")
+("anaa"	"閶")
+("anasm"	"闒")
+("anau"	"冕晚")
+("anayk"	"閺")
+("anb"	"閒")
+("anbbe"	"閿")
+("anbue"	"闅")
+("anbuk"	"闃")
+("ancru"	"閱")
+("and"	"閑")
+("andh"	"閉")
+("andmq"	"闈")
+("andwf"	"闌")
+("anehr"	"闊")
+("anf"	"焛")
+("anfbg"	"闛")
+("anfbw"	"闣")
+("angg"	"閨")
+("angit"	"闔")
+("anhe"	"昅")
+("anher"	"閣")
+("anhpa"	"閽")
+("anhqu"	"閐")
+("anhud"	"闑")
+("anhx"	"閰")
+("aniav"	"閬")
+("anirm"	"閾")
+("anit"	"閞")
+("anjbc"	"闐")
+("anjka"	"闍")
+("anki"	"閎")
+("anklu"	"閹")
+("anlmc"	"闠")
+("anlmi"	"閩")
+("anm"	"閂")
+("anmfj"	"閛")
+("anmg"	"閏")
+("anmj"	"閈")
+("anmjk"	"闞")
+("anmmm"	"閆")
+("anmnr"	"閜")
+("anmt"	"開")
+("anmwg"	"闉")
+("annhx"	"閻")
+("annkg"	"閮")
+("annok"	"闋")
+("ano"	"閃欥")
+("anog"	"閵")
+("anoi"	"閥")
+("anok"	"暌")
+("anomm"	"闟")
+("anomr"	"閤")
+("anp"	"悶")
+("anph"	"閟")
+("anqou"	"闚")
+("anr"	"問")
+("anrhr"	"閭")
+("anrrj"	"闡")
+("anrrr"	"闆")
+("ansj"	"聞")
+("ansqf"	"闖")
+("ansrj"	"闢")
+("antcu"	"闀")
+("antuo"	"闕")
+("anumt"	"闓")
+("anvit"	"關")
+("anwd"	"閫")
+("anwl"	"閘")
+("anwlv"	"闤")
+("anygq"	"闥")
+("anyhn"	"閌")
+("anyhs"	"閍")
+("anyk"	"閔")
+("anymr"	"誾")
+("anysy"	"閼")
+("anyta"	"闇")
+("anyvo"	"閡")
+("aodmq"	"韙")
+("aofh"	"尟")
+("aohaf"	"鶗")
+("aoii"	"昤")
+("aoin"	"昑")
+("aombc"	"題")
+("aop"	"匙")
+("aowy"	"晦")
+("aphh"	"易昒")
+("api"	"旳")
+("apim"	"昀")
+("app"	"昆")
+("apr"	"昫")
+("apu"	"旽")
+("apvo"	"曷")
+("aqka"	"暙")
+("aqmb"	"晴")
+("arf"	"照煦")
+("armd"	"冔")
+("arrj"	"暺")
+("arrk"	"曮")
+("arye"	"暇")
+("asf"	"煝")
+("ashr"	"昭")
+("asje"	"最")
+("asmg"	"曜")
+("asp"	"昵")
+("astr"	"暱")
+("atak"	"暯")
+("atbc"	"晪")
+("atbo"	"曚")
+("atce"	"暴")
+("atcr"	"謈")
+("atgs"	"曦")
+("atlb"	"暪")
+("atlf"	"曣")
+("atlo"	"暵")
+("atmj"	"曄")
+("au"	"巴旵")
+("auam"	"暨")
+("aug"	"塈")
+("auhqu"	"毷")
+("auks"	"勖")
+("aumt"	"暟")
+("aunl"	"郿")
+("aunwf"	"鱀")
+("auu"	"岊昢")
+("av"	"艮")
+("avhaf"	"鶡鷃鷐")
+("avhl"	"曏")
+("avhqu"	"毼")
+("avno"	"歇")
+("awla"	"曙")
+("awle"	"曼")
+("aybp"	"曨")
+("aydk"	"暾")
+("ayhs"	"昉")
+("ayk"	"旼旻")
+("ayoj"	"晬")
+("ayrb"	"暠")
+("ayrf"	"景晾")
+("ayrv"	"曩")
+("aysd"	"暆")
+("ayt"	"昱")
+("ayta"	"暗")
+("aytg"	"曈")
+("aytj"	"暲")
+("ayvi"	"昡")
+("b"	"月")
+("bahm"	"腥")
+("bamh"	"腸")
+("bau"	"肥")
+("bayc"	"冥")
+("bb"	"朋")
+("bbb"	"骨")
+("bbbr"	"腡")
+("bbbuu"	"覶")
+("bbdhe"	"骳")
+("bbdi"	"脟")
+("bbe"	"受")
+("bbggu"	"髐")
+("bbhaf"	"鶻")
+("bbher"	"骼")
+("bbhf"	"鵬")
+("bbhhj"	"髀")
+("bbhne"	"骰")
+("bbibi"	"髆")
+("bbijc"	"髍")
+("bbjhr"	"髂")
+("bbjmc"	"髕")
+("bbjr"	"骷")
+("bbjti"	"髖")
+("bbkms"	"骻")
+("bbkni"	"骫")
+("bbln"	"剮")
+("bblwv"	"髏")
+("bbmbc"	"顝")
+("bbmj"	"骭")
+("bbmlk"	"骾")
+("bbmr"	"胴")
+("bbnd"	"脬")
+("bbnq"	"舜")
+("bboll"	"骱")
+("bbpe"	"愛")
+("bbr"	"咼")
+("bbtmt"	"髒")
+("bbtqm"	"髊")
+("bbtwt"	"體")
+("bbu"	"亂")
+("bbug"	"臞")
+("bbul"	"鼏")
+("bbuu"	"覓")
+("bbwd"	"髁")
+("bbwli"	"髑")
+("bbyck"	"骹")
+("bbyhn"	"骯")
+("bbykb"	"髓")
+("bbymp"	"骴")
+("bbyrb"	"髇")
+("bbytj"	"辭")
+("bbyvo"	"骸")
+("bcabu"	"賵")
+("bcaph"	"賜")
+("bcbcc"	"贔")
+("bcbcd"	"賝")
+("bcbgr"	"賙")
+("bcbjj"	"賱")
+("bcbuc"	"賏")
+("bcbuu"	"覭")
+("bccwa"	"贈")
+("bcdh"	"財")
+("bcff"	"賧")
+("bcgwc"	"贖")
+("bchaf"	"鵙")
+("bche"	"販")
+("bcher"	"賂")
+("bchio"	"貶")
+("bchpm"	"貾")
+("bchqm"	"貹")
+("bcibi"	"賻")
+("bcii"	"賤")
+("bciih"	"贂")
+("bcij"	"賊")
+("bcije"	"賕")
+("bcikk"	"贆")
+("bcims"	"贓")
+("bcir"	"貽")
+("bcj"	"肸")
+("bcjir"	"賳")
+("bcjka"	"賭")
+("bcjmn"	"貯")
+("bckb"	"賄")
+("bcll"	"賗")
+("bclmt"	"贐")
+("bcln"	"則")
+("bcmj"	"罕")
+("bcmmv"	"賑")
+("bcmpm"	"賦")
+("bcmvn"	"甖")
+("bcmwj"	"贉")
+("bcncr"	"贍")
+("bcnl"	"郥鄍")
+("bcoju"	"罌")
+("bcok"	"敗")
+("bcomf"	"賒")
+("bcpd"	"貤")
+("bcqka"	"賰")
+("bcr"	"冏")
+("bcrhu"	"貺")
+("bcrl"	"腳")
+("bcru"	"脫")
+("bcrxu"	"鼆")
+("bcsmv"	"賬")
+("bctbc"	"賟")
+("bctct"	"賹")
+("bcttb"	"購")
+("bctxc"	"賺")
+("bcv"	"嬰")
+("bcyhn"	"貥")
+("bcymr"	"譻")
+("bcyoj"	"賥")
+("bcyr"	"貼")
+("bcytr"	"賠")
+("bcyvo"	"賅")
+("bd"	"采")
+("bdhhh"	"彩")
+("bdi"	"肘")
+("bdnl"	"郛")
+("bdoe"	"膝")
+("bdu"	"乳")
+("beee"	"腏")
+("behaf"	"鶢")
+("bf"	"炙")
+("bfbg"	"膛")
+("bfcb"	"膌")
+("bfd"	"冞")
+("bfdq"	"膦")
+("bfhvf"	"縣")
+("bfmu"	"胱")
+("bfp"	"懸")
+("bfq"	"胖")
+("bfqc"	"賸")
+("bfqe"	"滕")
+("bfqf"	"騰縢")
+("bfqg"	"塍")
+("bfqi"	"螣")
+("bfqr"	"謄")
+("bfqs"	"勝")
+("bfqu"	"腃")
+("bfqv"	"媵")
+("bfu"	"乿")
+("bg"	"肚")
+("bggu"	"膮")
+("bghqu"	"氍")
+("bgi"	"胠")
+("bgr"	"周")
+("bgte"	"臌")
+("bgth"	"膨")
+("bha"	"胉")
+("bhae"	"腺")
+("bhbue"	"貜")
+("bhbvk"	"貕")
+("bhdh"	"豺")
+("bhdv"	"腇")
+("bhdw"	"膰")
+("bher"	"胳")
+("bhgf"	"臐")
+("bhhau"	"貌")
+("bhher"	"貉")
+("bhhh"	"肜")
+("bhhhj"	"貏")
+("bhhj"	"脾")
+("bhhv"	"脈")
+("bhhwp"	"貔")
+("bhjc"	"貁")
+("bhje"	"腶")
+("bhjg"	"腫")
+("bhjm"	"腄")
+("bhju"	"腯")
+("bhlq"	"貄")
+("bhlwv"	"貗")
+("bhma"	"貊")
+("bhmam"	"貆")
+("bhmj"	"豻")
+("bhml"	"肵")
+("bhn"	"冗肌")
+("bhne"	"股")
+("bhob"	"豽")
+("bhod"	"貅")
+("bhomn"	"貐")
+("bhon"	"胻")
+("bhpi"	"豹")
+("bhpm"	"胝")
+("bhqm"	"胜")
+("bhqo"	"胅")
+("bhrrj"	"貚")
+("bhrye"	"貑")
+("bhs"	"胙")
+("bhshr"	"貂")
+("bhsrr"	"貙")
+("bhtak"	"貘")
+("bhtw"	"貓")
+("bhuc"	"臢")
+("bhumb"	"貒")
+("bhuu"	"貀膬")
+("bhvo"	"胍")
+("bhwg"	"貍")
+("bhwp"	"膍")
+("bhx"	"舀")
+("bhxo"	"腴")
+("bibi"	"膊")
+("bice"	"朘脧")
+("bijb"	"脯")
+("bije"	"脙")
+("bikk"	"胈")
+("bioi"	"腑")
+("bipc"	"膩")
+("bipf"	"臕")
+("bir"	"胎")
+("biypu"	"虢")
+("bjb"	"肺")
+("bjbd"	"脖")
+("bjbj"	"腩")
+("bjcg"	"膣")
+("bjcm"	"腔")
+("bjdhe"	"皸")
+("bje"	"肢")
+("bjhaf"	"鶤")
+("bjii"	"膞")
+("bjlmi"	"蠈")
+("bjmbc"	"顐")
+("bjmc"	"臏")
+("bjmu"	"脘")
+("bjnl"	"鄆")
+("bjnu"	"腕")
+("bjtc"	"膹")
+("bjti"	"臗")
+("bjv"	"胺")
+("bjwj"	"軍")
+("bkcf"	"膫")
+("bkcor"	"谿")
+("bkf"	"然")
+("bkhaf"	"鶪")
+("bki"	"肱")
+("bkk"	"网")
+("bklu"	"腌")
+("bkms"	"胯")
+("bkn"	"胰")
+("bkni"	"肒")
+("bknl"	"郹")
+("bkog"	"雞")
+("bkoo"	"脥")
+("bks"	"肋")
+("blbk"	"胦")
+("blln"	"胇")
+("blmo"	"朓脁")
+("blmy"	"腓")
+("bln"	"刖")
+("blwl"	"胂")
+("blwv"	"膢")
+("blxh"	"胏")
+("bm"	"且肛囗")
+("bmbb"	"臑")
+("bmbg"	"臛")
+("bmbl"	"胹")
+("bmfm"	"胚")
+("bmig"	"胵")
+("bmj"	"肝")
+("bmke"	"爰")
+("bmks"	"助")
+("bmln"	"刞")
+("bmmc"	"具")
+("bmmo"	"冢")
+("bmmu"	"朊")
+("bmmv"	"脤")
+("bmog"	"雎")
+("bmr"	"同")
+("bmrb"	"膈")
+("bmrt"	"脰")
+("bmrw"	"腷")
+("bmso"	"豚")
+("bmui"	"冠")
+("bmvm"	"脛")
+("bmwf"	"膘")
+("bmwv"	"腰")
+("bn"	"肊")
+("bnau"	"脕")
+("bncr"	"膽")
+("bnd"	"孚")
+("bnii"	"膙")
+("bnkg"	"脡")
+("bnkq"	"腱")
+("bnlii"	"蠫")
+("bnmu"	"脆")
+("bnui"	"冤")
+("boae"	"腹")
+("bob"	"肭")
+("bobo"	"朒")
+("bodi"	"胕")
+("bog"	"脽")
+("bogf"	"膲")
+("bogs"	"臇")
+("bohh"	"胗")
+("boin"	"肣")
+("boip"	"腍")
+("boma"	"膾")
+("bommf"	"祭")
+("bomn"	"腧")
+("bomo"	"臉")
+("bomrt"	"豋")
+("bon"	"肐")
+("boog"	"脞")
+("bopd"	"胣")
+("botf"	"膴")
+("bowy"	"脢")
+("bpa"	"脂")
+("bpr"	"朐胊")
+("bpru"	"胞")
+("bpu"	"肫")
+("bpuk"	"胸")
+("bq"	"用")
+("bqkk"	"腠")
+("bqmf"	"膆")
+("bqu"	"甩")
+("brc"	"胑")
+("brhaf"	"鵰")
+("brhg"	"脭")
+("brhhh"	"彫")
+("bri"	"戙")
+("brog"	"雕")
+("brrd"	"臊")
+("brsmm"	"翢")
+("bsd"	"爭")
+("bsef"	"鵩")
+("bshh"	"豸")
+("bshi"	"肕")
+("bsjr"	"腒")
+("bsle"	"服")
+("bsmg"	"腛")
+("bsmh"	"膠")
+("bsmv"	"脹")
+("bss"	"凸")
+("bt"	"冊皿")
+("bta"	"腊")
+("btab"	"冪")
+("btak"	"膜")
+("btbc"	"腆")
+("btbo"	"朦")
+("btct"	"膉")
+("btgr"	"膳")
+("btis"	"臟")
+("btk"	"朕")
+("btlf"	"臙")
+("btlk"	"朠")
+("btln"	"刪")
+("btmbc"	"頯")
+("btmd"	"腜")
+("btoe"	"臒")
+("btt"	"胼")
+("btu"	"岡")
+("btwv"	"膿")
+("btyj"	"膵")
+("btyv"	"罔")
+("bu"	"目")
+("buamj"	"睅")
+("buamo"	"睼")
+("buana"	"瞷")
+("buank"	"矙")
+("buav"	"眼")
+("bubac"	"瞑")
+("bubbq"	"瞬")
+("bubd"	"睬")
+("bubgr"	"睭")
+("bubsd"	"睜")
+("bubuk"	"瞁")
+("bubuu"	"睍覞")
+("buc"	"貝")
+("buce"	"朡")
+("bucim"	"瞈")
+("bucms"	"盻")
+("bucnh"	"睇")
+("bucsh"	"盼")
+("budoo"	"睞")
+("bufb"	"睄")
+("bufbf"	"矘")
+("bufbg"	"瞠")
+("bufd"	"眯")
+("bufdq"	"瞵")
+("buff"	"睒")
+("bufh"	"眇")
+("bufqu"	"睠")
+("bugce"	"睖")
+("bugcg"	"睦")
+("bugg"	"眭")
+("bugit"	"瞌")
+("buhaf"	"鷂瞗")
+("buhdf"	"瞅")
+("buhe"	"眅")
+("buhgf"	"矄")
+("buhhj"	"睥")
+("buhhv"	"眽")
+("buhio"	"眨")
+("buhjm"	"睡")
+("buhju"	"瞃")
+("buhml"	"盺")
+("buhni"	"颻")
+("buhok"	"覹")
+("buhoo"	"瞛")
+("buhpa"	"睧")
+("buhqi"	"睋")
+("buhqo"	"眣")
+("buhqu"	"眊")
+("buhsk"	"睙")
+("buhu"	"見")
+("buhus"	"矏")
+("buhvf"	"繇")
+("buhxe"	"瞍")
+("buhxu"	"睨")
+("buihq"	"眸")
+("buik"	"狊")
+("buir"	"眙")
+("buitc"	"矌")
+("buiv"	"眓")
+("bujbc"	"瞋")
+("bujd"	"眛")
+("bujka"	"睹")
+("bujlo"	"睫")
+("bujmc"	"瞚矉")
+("bujmn"	"眝")
+("bujmu"	"睆")
+("bujnu"	"睕")
+("bujqr"	"瞎")
+("bukcf"	"瞭")
+("bukkb"	"睎")
+("bukn"	"眱")
+("bulbu"	"眈")
+("bullp"	"瞣")
+("bulmc"	"瞶")
+("bulmi"	"蜰")
+("bulmo"	"眺")
+("buln"	"剛")
+("bulwl"	"眒")
+("bulwv"	"瞜")
+("bumbg"	"矐")
+("bumd"	"盱")
+("bumgg"	"睚")
+("bumj"	"盰")
+("bumjk"	"瞰")
+("bumls"	"眄")
+("bummi"	"眃")
+("bumn"	"盯")
+("bumwf"	"瞟")
+("bumwj"	"瞫")
+("bumym"	"眐")
+("bunau"	"睌")
+("bunbe"	"矎")
+("buncr"	"瞻")
+("bunhb"	"瞲")
+("bunin"	"眵")
+("bunir"	"眳")
+("bunok"	"睽")
+("bunot"	"瞪")
+("buog"	"睢瞿膗")
+("buoge"	"矍")
+("buogf"	"瞧")
+("buohh"	"眕")
+("buoma"	"瞺")
+("buomb"	"睔")
+("buomn"	"睮")
+("buomo"	"瞼")
+("buon"	"盵")
+("buotf"	"瞴")
+("bupa"	"眴")
+("bupim"	"盷")
+("bupu"	"盹")
+("buqmb"	"睛")
+("buqou"	"瞡")
+("burb"	"睊")
+("burrd"	"矂")
+("burvp"	"眠")
+("bushr"	"眧")
+("busj"	"眲")
+("busmg"	"眶")
+("busyi"	"矚")
+("butak"	"瞙")
+("butbo"	"矇")
+("butco"	"瞨")
+("butk"	"眹")
+("butlb"	"瞞")
+("butmj"	"瞱")
+("butq"	"眻")
+("butrg"	"矔")
+("butw"	"瞄")
+("buu"	"朏胐")
+("buvfb"	"矊")
+("buvis"	"眑")
+("buvml"	"鼎")
+("buvne"	"睩")
+("buwd"	"睏")
+("buybp"	"矓")
+("buyfd"	"瞇")
+("buyoj"	"睟")
+("buytg"	"瞳")
+("buytj"	"瞕")
+("buyub"	"瞝")
+("buyv"	"盳")
+("buyvi"	"眩")
+("bv"	"妥")
+("bvg"	"墾")
+("bvhaf"	"鸚")
+("bvhl"	"膷")
+("bvik"	"奚")
+("bvnl"	"郻")
+("bvno"	"腞")
+("bvp"	"懇")
+("bvvv"	"臘")
+("bvvw"	"腦")
+("bwim"	"膕")
+("bwk"	"胭")
+("bwl"	"胛")
+("bwlb"	"腢")
+("bwli"	"爵臅")
+("bwmv"	"腲")
+("bwot"	"膃")
+("bwp"	"腮")
+("by"	"丹")
+("byav"	"腿")
+("bybb"	"膼")
+("bybp"	"朧")
+("bybs"	"膀")
+("byhaf"	"鴅")
+("byhhh"	"彤")
+("byhn"	"肮")
+("byhr"	"膇")
+("byhs"	"肪")
+("byia"	"膱")
+("byij"	"膟")
+("byln"	"刐")
+("byoj"	"脺")
+("byok"	"腋")
+("bypo"	"臄")
+("bypt"	"臚")
+("byrn"	"脝")
+("byta"	"腤")
+("bytg"	"朣膧")
+("bytoe"	"雘")
+("bytp"	"臆")
+("byvg"	"臃")
+("byvi"	"胘")
+("byvo"	"胲")
+("bywm"	"膻")
+("byx"	"臍")
+("c"	"金")
+("ca"	"鈤")
+("caa"	"錩")
+("cafu"	"鎤")
+("cam"	"鉭")
+("camh"	"鍚")
+("camj"	"銲")
+("camo"	"鍉")
+("camvn"	"甑")
+("can"	"鍆")
+("canl"	"鄫")
+("canw"	"鑭")
+("caph"	"錫")
+("capp"	"鋼")
+("capv"	"鍻")
+("casm"	"鎉")
+("cate"	"鑤")
+("cau"	"鈀")
+("cav"	"銀")
+("cawe"	"鏝")
+("cb"	"鈅")
+("cbb"	"錋")
+("cbbe"	"鑀")
+("cbbr"	"鍋")
+("cbcn"	"鍘")
+("cbdi"	"鋝")
+("cbgr"	"錭")
+("cbjj"	"鍕")
+("cbm"	"鉏")
+("cbme"	"鍰")
+("cbmr"	"銅")
+("cbms"	"鋤")
+("cbsd"	"錚")
+("cbu"	"鉬")
+("cbuc"	"鋇")
+("cbue"	"钁")
+("cbuu"	"鋧")
+("ccc"	"鑫")
+("cci"	"鈆")
+("ccnh"	"銻")
+("ccor"	"鋊")
+("ccr"	"鉛")
+("ccru"	"銳")
+("ccsh"	"鈖")
+("cdh"	"釮")
+("cdhe"	"鈹")
+("cdk"	"鈌")
+("cdl"	"鋉")
+("cdmq"	"鍏")
+("cdoo"	"錸")
+("cdwf"	"鍊")
+("cea"	"錔")
+("ceah"	"鐋")
+("ceed"	"鎟")
+("ceee"	"錣")
+("cehv"	"鎃")
+("cei"	"釵")
+("cf"	"鈥")
+("cfb"	"銷")
+("cfbc"	"鎖")
+("cfbd"	"鏿")
+("cfbf"	"钂")
+("cfbg"	"鏜")
+("cfbr"	"鋿")
+("cfbu"	"鎲")
+("cfbw"	"鐺")
+("cfd"	"銤")
+("cfdq"	"鏻")
+("cff"	"錟")
+("cffd"	"鑅")
+("cffs"	"鐒")
+("cfh"	"鈔")
+("cfmu"	"銧")
+("cfq"	"鉡")
+("cfqu"	"錈")
+("cg"	"釷")
+("cgce"	"錂")
+("cgcg"	"錴")
+("cgg"	"銈")
+("cggu"	"鐃")
+("cgi"	"鉣")
+("cgit"	"鎑")
+("cgni"	"鑄")
+("cgp"	"鋕")
+("cgr"	"銡")
+("cgrv"	"鎱")
+("cha"	"鉑")
+("chab"	"錦")
+("chag"	"鍠")
+("chd"	"鉌")
+("chdb"	"鏼")
+("chdf"	"鍬")
+("chdh"	"銹")
+("chdn"	"鋓")
+("chdw"	"鐇")
+("che"	"鈑")
+("chej"	"鋒")
+("cher"	"鉻")
+("chey"	"鉖")
+("chgi"	"銩")
+("chgr"	"鋯")
+("chgu"	"銑")
+("chhaf"	"鳻鵜")
+("chhe"	"鑗")
+("chhh"	"釤")
+("chhj"	"錍")
+("chhl"	"鉚")
+("chhw"	"鎦")
+("chjd"	"銖")
+("chje"	"鍛")
+("chjg"	"鍾")
+("chjm"	"錘")
+("chjr"	"銛")
+("chju"	"鍎")
+("chjx"	"鍤")
+("chlc"	"鑕")
+("chln"	"剃")
+("chlo"	"釽")
+("chmbc"	"頒")
+("chml"	"釿")
+("chmr"	"銗")
+("chni"	"釩")
+("chnl"	"邠")
+("chok"	"攽")
+("choo"	"鏦")
+("chpa"	"錉")
+("chqi"	"鋨")
+("chqm"	"鉎")
+("chrf"	"鎢")
+("chuc"	"鑽")
+("chud"	"鎳")
+("chup"	"鎴")
+("chvo"	"鈲")
+("chwp"	"鎞")
+("chxe"	"鎪")
+("chxh"	"銵")
+("ci"	"公")
+("ciav"	"鋃")
+("cibi"	"鎛")
+("cice"	"鋑")
+("cihf"	"鏚")
+("cihm"	"銊")
+("cihq"	"鉾")
+("cihr"	"鍼")
+("cihs"	"鋮")
+("cihu"	"鈗")
+("cii"	"錢")
+("ciih"	"鏒")
+("ciil"	"鎯")
+("cijb"	"鋪")
+("cijc"	"鉥")
+("cije"	"銶")
+("cikk"	"鈸")
+("cilb"	"鏞")
+("cile"	"鏮")
+("cill"	"銂")
+("cilr"	"鎕")
+("cimbc"	"頌")
+("cimn"	"瓮")
+("cine"	"銢")
+("cip"	"釴")
+("cipf"	"鑣")
+("cipm"	"鉽")
+("cipp"	"鋱")
+("cir"	"鈶")
+("cism"	"翁")
+("citc"	"鐮")
+("cite"	"鍍")
+("citf"	"鏣")
+("civ"	"鉞")
+("cixp"	"鏕")
+("cj"	"針")
+("cjbc"	"鎮")
+("cjbd"	"鋍")
+("cjbf"	"鎍")
+("cjcr"	"鎔")
+("cjig"	"鐵")
+("cjii"	"鏄")
+("cjip"	"鏸")
+("cjka"	"鍺")
+("cjki"	"鋐")
+("cjkp"	"銠")
+("cjks"	"銬")
+("cjmc"	"鏔鑌")
+("cjmf"	"錝")
+("cjmm"	"鍹")
+("cjmo"	"錠鎵")
+("cjmu"	"鋎")
+("cjnu"	"鋺")
+("cjp"	"鉈")
+("cjpn"	"鑏")
+("cjr"	"鈷")
+("cjrr"	"錧")
+("cjtc"	"鐼")
+("cjto"	"鑳")
+("cjv"	"銨")
+("ck"	"父釱")
+("ckau"	"爸")
+("ckb"	"銪")
+("ckce"	"鎩")
+("ckcf"	"鐐")
+("ckgg"	"鍷")
+("ckhml"	"斧")
+("cki"	"鈦鈜")
+("ckjt"	"錛")
+("cklb"	"鈽")
+("ckld"	"銌")
+("ckmf"	"錼")
+("ckmgc"	"釜")
+("ckmr"	"錡")
+("ckms"	"銙")
+("ckn"	"釚銕")
+("cknin"	"爹")
+("ckoo"	"鋏")
+("cksjl"	"爺")
+("clbk"	"鉠")
+("clbu"	"鈂")
+("clll"	"釧")
+("clmc"	"鐀")
+("clmo"	"銚")
+("cln"	"釗")
+("clnc"	"鐨")
+("clw"	"鈾")
+("clwv"	"鏤")
+("clx"	"鏽")
+("cm"	"釭")
+("cma"	"銆")
+("cmbb"	"鑐")
+("cmbc"	"顉")
+("cmbw"	"鐳")
+("cmd"	"釪")
+("cmfb"	"鑈")
+("cmfe"	"鋄")
+("cmfj"	"銔")
+("cmgi"	"鈺")
+("cmgr"	"鑩")
+("cmhaf"	"鶲")
+("cmig"	"銍")
+("cmj"	"釬")
+("cmlm"	"錏")
+("cmmr"	"鋙")
+("cmms"	"釫")
+("cmmv"	"鋠")
+("cmn"	"釘")
+("cmnr"	"鈳")
+("cmp"	"憌")
+("cmr"	"鉐")
+("cmrb"	"鎘")
+("cmrt"	"鋀")
+("cmt"	"鈃")
+("cmtn"	"鉶")
+("cmua"	"鐕")
+("cmvi"	"鎒")
+("cmvm"	"鋞")
+("cmvs"	"兮")
+("cmwf"	"鏢")
+("cmwj"	"鐔")
+("cmym"	"鉦")
+("cmys"	"鈣")
+("cn"	"釔")
+("cnao"	"鐌")
+("cnau"	"銫")
+("cnd"	"釨")
+("cndt"	"錳")
+("cng"	"鈕")
+("cnhb"	"鐍")
+("cnhd"	"鍒")
+("cnhe"	"鈒")
+("cnhs"	"釢")
+("cnhx"	"錎")
+("cni"	"釸")
+("cnii"	"鏹")
+("cnin"	"鉹")
+("cnir"	"銘")
+("cnkg"	"鋌")
+("cnkm"	"鋋")
+("cnkq"	"鍵")
+("cnl"	"弚鈏")
+("cnlh"	"弟鐊")
+("cnlr"	"錒")
+("cnn"	"釕")
+("cno"	"欽")
+("cnoe"	"鏺")
+("cnot"	"鐙")
+("cnri"	"鑱")
+("coae"	"鍑")
+("cob"	"鈉")
+("cod"	"銝")
+("cog"	"錐")
+("cogd"	"鏶")
+("cogf"	"鐎")
+("cogj"	"鎨")
+("cogs"	"鐫")
+("cohg"	"銋")
+("coii"	"鈴")
+("coim"	"鑯")
+("coin"	"鈐")
+("coir"	"鎗鋡")
+("colb"	"鉓")
+("colh"	"鎀")
+("colmi"	"螸")
+("comb"	"鑰錀")
+("comg"	"銓")
+("como"	"鐱")
+("comr"	"鉿")
+("con"	"釳")
+("cond"	"鎎")
+("conk"	"鍭")
+("coog"	"銼")
+("cop"	"慾")
+("cor"	"谷")
+("cowy"	"鋂")
+("cp"	"鈊")
+("cph"	"鉍")
+("cpi"	"釣")
+("cpim"	"鈞")
+("cpou"	"鋾")
+("cpp"	"鈚")
+("cppa"	"鍇")
+("cpr"	"鉤")
+("cpru"	"鉋")
+("cptd"	"鍱")
+("cpu"	"鈍")
+("cpyr"	"鍧")
+("cqd"	"銇")
+("cqhk"	"鍥")
+("cqjm"	"鏏")
+("cqmb"	"錆")
+("cqmv"	"錶")
+("cqo"	"鈇")
+("cr"	"釦")
+("crb"	"鋗")
+("crhaf"	"鵒")
+("crhr"	"鋁")
+("crhu"	"兌")
+("crjcm"	"谾")
+("crki"	"谹")
+("crmjk"	"豃")
+("crnl"	"郤")
+("crno"	"欲")
+("crnq"	"谻")
+("croir"	"谽")
+("crp"	"懖")
+("crrd"	"鐰")
+("crrs"	"鍔")
+("crsl"	"卻")
+("crsmh"	"豂")
+("crtc"	"谼")
+("cruc"	"鐉")
+("crvk"	"鋘")
+("crvp"	"鈱")
+("crybp"	"豅")
+("crye"	"鍜")
+("cseg"	"鏗")
+("csh"	"分")
+("cshc"	"貧")
+("cshf"	"炃")
+("cshg"	"坌")
+("cshp"	"忿")
+("cshr"	"鉊")
+("csht"	"盆弅")
+("cshu"	"岔")
+("csit"	"鑑")
+("csj"	"鉺")
+("csje"	"鋷")
+("csjj"	"鑷")
+("csjr"	"鋸")
+("cslb"	"鉔")
+("csme"	"鋟")
+("csmh"	"鏐")
+("csmr"	"鉰")
+("csmv"	"鋹")
+("csp"	"鈮")
+("csqf"	"鎷")
+("csrr"	"鏂")
+("css"	"鉅")
+("cssr"	"鋦")
+("csyi"	"钃")
+("cta"	"錯")
+("ctak"	"鏌")
+("ctbc"	"錪")
+("ctbk"	"鏾")
+("ctca"	"鐠")
+("ctco"	"鏷")
+("ctct"	"鎰")
+("ctei"	"鑮")
+("ctgi"	"鑆")
+("ctgk"	"鎂")
+("ctgt"	"鑉")
+("ctgu"	"錓")
+("ctis"	"鑶")
+("ctm"	"鉗")
+("ctmc"	"錤")
+("ctmj"	"鏵")
+("ctmv"	"鍖")
+("ctoe"	"鑊")
+("ctop"	"錵")
+("ctor"	"鎝")
+("ctpd"	"鐷")
+("ctqm"	"鎈")
+("ctrg"	"鑵")
+("ctsr"	"鍣")
+("ctt"	"鉼")
+("ctub"	"鎙")
+("ctvi"	"鎡")
+("ctw"	"錨")
+("ctwi"	"鐏")
+("ctxc"	"鎌")
+("ctyj"	"鑝")
+("ctyv"	"鋩")
+("cu"	"釓")
+("cuce"	"鍐")
+("cuhqu"	"毤")
+("cumj"	"錌")
+("cumt"	"鎧")
+("cuob"	"鑴")
+("cuog"	"鏙")
+("cuok"	"敓")
+("cv"	"釹")
+("cvfr"	"鐑")
+("cvid"	"鑠")
+("cvii"	"鐖")
+("cvio"	"鉯")
+("cvmi"	"鏘")
+("cvne"	"錄")
+("cvr"	"銣")
+("cvvv"	"鑞")
+("cvvw"	"錙")
+("cw"	"鈿")
+("cwa"	"曾")
+("cwd"	"錁")
+("cwg"	"鋰")
+("cwjr"	"錮")
+("cwk"	"銦")
+("cwl"	"鉀")
+("cwlg"	"鑼")
+("cwli"	"鐲")
+("cwlj"	"鐸")
+("cwlv"	"鐶")
+("cwmv"	"鍡")
+("cwp"	"鍶")
+("cwtj"	"鏎")
+("cwvf"	"鏍")
+("cwwg"	"鑸")
+("cwyi"	"鉧")
+("cy"	"釙")
+("cybb"	"鍗鐹")
+("cybc"	"鍞")
+("cybk"	"钀")
+("cybp"	"鑨")
+("cybs"	"鎊")
+("cycb"	"鏑")
+("cyck"	"鉸")
+("cydk"	"鐓")
+("cye"	"鈙")
+("cyg"	"鉒")
+("cygq"	"鐽")
+("cyhm"	"鏟")
+("cyhn"	"鈧")
+("cyhr"	"鎚")
+("cyhs"	"鈁")
+("cyhv"	"銥")
+("cyib"	"錥")
+("cyiu"	"銃")
+("cyj"	"鈄")
+("cyjj"	"鏈")
+("cylb"	"鈰")
+("cymb"	"錹")
+("cymh"	"鐬")
+("cymy"	"鉲")
+("cypd"	"鏬")
+("cypo"	"鐻")
+("cypp"	"鑢")
+("cyps"	"鐪")
+("cypt"	"鑪")
+("cyr"	"鉆")
+("cyrb"	"鎬")
+("cyrd"	"錞")
+("cyrv"	"鑲")
+("cysk"	"鏃")
+("cyso"	"鏇")
+("cytg"	"鐘")
+("cytj"	"鋅")
+("cyto"	"鐩")
+("cytp"	"鐿")
+("cytu"	"鏡")
+("cyvi"	"鉉")
+("cywi"	"鏀")
+("cyx"	"鑇")
+("d"	"木")
+("da"	"杳")
+("dafu"	"榥")
+("dagi"	"榯")
+("dahu"	"楣")
+("dail"	"楖")
+("daiu"	"概")
+("dam"	"查柦")
+("damh"	"楊")
+("damj"	"桿")
+("dang"	"橍")
+("danr"	"櫚")
+("danw"	"欄")
+("dapp"	"棍")
+("dapv"	"楬")
+("dasm"	"榻")
+("dau"	"杷")
+("dav"	"根")
+("dawe"	"槾")
+("db"	"朿")
+("dbac"	"榠")
+("dbb"	"棚")
+("dbbb"	"榾")
+("dbcd"	"棎")
+("dbcv"	"櫻")
+("dbd"	"棌")
+("dbdb"	"棘棗")
+("dbgr"	"椆")
+("dbhx"	"槄")
+("dbjj"	"楎")
+("dbkf"	"橪")
+("dbln"	"刺")
+("dbm"	"柤")
+("dbmc"	"椇")
+("dbme"	"楥")
+("dbmr"	"桐")
+("dbnd"	"桴")
+("dbo"	"僰")
+("dbou"	"榣")
+("dbsd"	"棦")
+("dbse"	"棴")
+("dbt"	"柵")
+("dbtu"	"棡")
+("dbu"	"相")
+("dbuc"	"梖")
+("dbug"	"欋")
+("dbv"	"桵")
+("dbvk"	"榽")
+("dc"	"朳")
+("dcav"	"檭")
+("dchd"	"椕")
+("dci"	"松")
+("dcip"	"棇")
+("dcms"	"枍")
+("dcnh"	"梯")
+("dcru"	"梲")
+("dcsh"	"枌")
+("dcwa"	"橧")
+("dd"	"林")
+("ddam"	"楂")
+("ddb"	"栜")
+("ddbuh"	"鬱")
+("ddcsh"	"棼")
+("ddd"	"森")
+("dddo"	"檚")
+("ddec"	"櫇")
+("ddf"	"焚")
+("ddg"	"埜")
+("ddh"	"材")
+("ddhe"	"柀")
+("ddhh"	"彬")
+("ddhni"	"梵檒")
+("ddi"	"村")
+("ddixp"	"麓")
+("ddj"	"枺")
+("ddk"	"樊")
+("ddkli"	"蠜")
+("ddkmr"	"礬")
+("ddkq"	"攀")
+("ddl"	"梀")
+("ddln"	"楋")
+("ddlo"	"樕")
+("ddmmf"	"禁")
+("ddmq"	"椲")
+("ddnl"	"郴")
+("ddnyo"	"楚")
+("ddoin"	"棽")
+("ddoo"	"棶")
+("ddp"	"懋")
+("ddv"	"婪")
+("ddw"	"棟瑍")
+("ddwf"	"楝")
+("deee"	"棳")
+("defh"	"桫")
+("dei"	"杈")
+("deid"	"樑")
+("dembc"	"頗")
+("demj"	"皯")
+("depru"	"皰")
+("df"	"杰")
+("dfb"	"梢")
+("dfbd"	"橖")
+("dfbf"	"欓")
+("dfbg"	"樘")
+("dfbh"	"橕")
+("dfbw"	"檔")
+("dfdq"	"橉")
+("dff"	"棪")
+("dffn"	"橩")
+("dffs"	"橯")
+("dfh"	"杪")
+("dfle"	"隸")
+("dfmu"	"桄")
+("dfq"	"柈")
+("dfqu"	"棬")
+("dg"	"杜")
+("dgb"	"柟")
+("dgce"	"棱")
+("dgg"	"桂")
+("dggi"	"槸")
+("dggu"	"橈")
+("dgit"	"榼")
+("dgni"	"檮")
+("dgov"	"樾")
+("dgow"	"檣")
+("dgr"	"桔")
+("dgrg"	"檯")
+("dgrv"	"榬")
+("dgti"	"樹")
+("dgwc"	"櫝")
+("dh"	"才")
+("dha"	"柏")
+("dhab"	"棉")
+("dhag"	"楻")
+("dhaj"	"槔")
+("dhal"	"櫛")
+("dhbul"	"鼒")
+("dhcq"	"櫸")
+("dhdf"	"楸")
+("dhdw"	"橎")
+("dhe"	"皮板")
+("dhej"	"桻")
+("dher"	"格")
+("dhey"	"柊")
+("dhge"	"檓")
+("dhgr"	"梏")
+("dhhaf"	"鸉")
+("dhhh"	"杉")
+("dhhi"	"榭")
+("dhhj"	"椑")
+("dhhl"	"柳")
+("dhhw"	"榴")
+("dhi"	"槐")
+("dhij"	"櫆")
+("dhio"	"柉")
+("dhja"	"櫡")
+("dhjd"	"株")
+("dhje"	"椴")
+("dhjm"	"棰")
+("dhjr"	"栝")
+("dhju"	"楯")
+("dhkb"	"橋")
+("dhlb"	"楀")
+("dhlc"	"櫍")
+("dhml"	"析")
+("dhmu"	"梔")
+("dhmy"	"柝")
+("dhn"	"机")
+("dhne"	"杸")
+("dhni"	"楓杋")
+("dhon"	"桁椼")
+("dhoo"	"樅")
+("dhpa"	"棔橁")
+("dhpm"	"柢")
+("dhqo"	"柣")
+("dhqu"	"枆")
+("dhs"	"柞")
+("dhsb"	"楄")
+("dhsk"	"檄")
+("dhsu"	"槴")
+("dhuc"	"欑")
+("dhus"	"櫋")
+("dhuu"	"橇")
+("dhvo"	"柧")
+("dhxo"	"楰")
+("dhyg"	"樦")
+("dhyu"	"榹")
+("di"	"寸")
+("diav"	"桹")
+("dibi"	"榑")
+("dice"	"梭")
+("digi"	"櫥")
+("dihf"	"槭")
+("dihr"	"椷")
+("dii"	"棧")
+("diih"	"槮")
+("diil"	"榔")
+("dije"	"梂")
+("dikk"	"柭")
+("dilb"	"槦")
+("dill"	"栦")
+("diln"	"刌")
+("dilr"	"榶")
+("dimo"	"栨")
+("dine"	"櫠")
+("ding"	"榳")
+("dip"	"杙")
+("dipc"	"樲")
+("dipm"	"栻")
+("dirm"	"棫")
+("dit"	"械")
+("dj"	"末")
+("djbc"	"槙")
+("djbd"	"桲")
+("djbj"	"楠")
+("djbm"	"植")
+("djc"	"柼")
+("djcm"	"椌")
+("djcr"	"榕")
+("djcs"	"榨")
+("dje"	"枝")
+("djhr"	"楁")
+("djii"	"槫")
+("djip"	"橞")
+("djji"	"橶")
+("djk"	"杖")
+("djka"	"楮")
+("djkp"	"栳")
+("djks"	"栲")
+("djlv"	"棲")
+("djmc"	"檳")
+("djmf"	"棕")
+("djmm"	"楦")
+("djmo"	"椗")
+("djmu"	"梡")
+("djp"	"柁")
+("djpa"	"榰")
+("djpn"	"檸")
+("djr"	"枯")
+("djrb"	"楜")
+("djrj"	"橭")
+("djrr"	"棺")
+("djtc"	"橨")
+("djv"	"桉")
+("dk"	"夬杕")
+("dkb"	"栯")
+("dkce"	"樧")
+("dkcf"	"橑")
+("dkgg"	"楏")
+("dkhaf"	"鷘")
+("dkhf"	"梑")
+("dkkb"	"桸")
+("dkkk"	"樉")
+("dkld"	"栫")
+("dkmr"	"椅")
+("dkms"	"桍")
+("dkmym"	"整")
+("dkn"	"朹桋")
+("dkok"	"槉")
+("dkoo"	"梜")
+("dkp"	"憖")
+("dks"	"朸")
+("dkso"	"槬")
+("dksr"	"枷檶")
+("dl"	"束")
+("dlbk"	"柍")
+("dlbu"	"枕")
+("dld"	"梊")
+("dle"	"棣")
+("dlksf"	"鶒")
+("dllmi"	"蜤")
+("dlln"	"剌柫")
+("dlmc"	"樻")
+("dlmo"	"桃")
+("dlmy"	"棑")
+("dlno"	"欶")
+("dlok"	"敕")
+("dlp"	"惁")
+("dlshc"	"賴")
+("dlw"	"柚")
+("dlwl"	"柛")
+("dlws"	"梬")
+("dlwv"	"樓")
+("dlx"	"橚")
+("dlxl"	"棩")
+("dm"	"本杠")
+("dmam"	"桓")
+("dmbb"	"檽")
+("dmbc"	"槓")
+("dmbe"	"櫌")
+("dmbl"	"栭")
+("dmbm"	"欞")
+("dmbr"	"櫺")
+("dmbs"	"樗")
+("dmbw"	"檑")
+("dmcw"	"栖")
+("dmd"	"杅")
+("dmdm"	"櫪")
+("dmem"	"極")
+("dmf"	"杯")
+("dmfb"	"檷")
+("dmfj"	"枰")
+("dmfm"	"柸")
+("dmfn"	"檦")
+("dmfr"	"桮")
+("dmg"	"枉")
+("dmgr"	"櫮")
+("dmgt"	"梇")
+("dmhf"	"榞")
+("dmia"	"榗")
+("dmig"	"桎")
+("dmj"	"杆")
+("dmjk"	"橄")
+("dmlk"	"梗")
+("dmlm"	"椏")
+("dmmf"	"柰")
+("dmmi"	"枟")
+("dmmp"	"欐")
+("dmmr"	"梧")
+("dmms"	"杇")
+("dmmu"	"杬")
+("dmmv"	"桭")
+("dmn"	"朾")
+("dmnl"	"桏")
+("dmnn"	"栵")
+("dmnr"	"柯")
+("dmob"	"柄")
+("dmr"	"柘")
+("dmrq"	"韋")
+("dmrt"	"梪")
+("dmrw"	"楅")
+("dmsmm"	"翉")
+("dmso"	"椓")
+("dmsu"	"枙")
+("dmt"	"枅")
+("dmto"	"橛")
+("dmu"	"杌")
+("dmue"	"榎")
+("dmvh"	"枒")
+("dmvm"	"枑桱")
+("dmvs"	"朽")
+("dmvvq"	"舝")
+("dmwc"	"檟")
+("dmwf"	"標槱")
+("dmwj"	"橝")
+("dmwm"	"橿")
+("dnao"	"橡")
+("dnbg"	"桷")
+("dnbj"	"槲")
+("dnbq"	"檞")
+("dncr"	"檐")
+("dnd"	"李杍")
+("dndf"	"槂")
+("dnfd"	"櫯")
+("dng"	"杻")
+("dnhb"	"橘")
+("dnhd"	"楙楺")
+("dnhe"	"极")
+("dnib"	"桶")
+("dnin"	"杼栘")
+("dnkg"	"梃")
+("dnkm"	"梴")
+("dnkq"	"楗")
+("dnlb"	"橢")
+("dnlw"	"樄")
+("dnmu"	"桅")
+("dno"	"杴")
+("dnob"	"楈")
+("dnok"	"楑")
+("dnot"	"橙")
+("dnq"	"揧")
+("dnqd"	"榤")
+("dnri"	"欃")
+("dnst"	"楹")
+("dnwa"	"櫓")
+("dob"	"枘")
+("dobg"	"榷")
+("dobuc"	"賚")
+("doby"	"栴")
+("dodi"	"柎")
+("doe"	"桼")
+("dog"	"椎")
+("dogf"	"樵")
+("dogj"	"榫")
+("dogs"	"檇")
+("dohaf"	"鶆")
+("doii"	"柃")
+("doik"	"猌")
+("doim"	"櫼")
+("doin"	"枔")
+("doip"	"棯")
+("doir"	"槍梒")
+("doj"	"杵")
+("dok"	"枚")
+("dokr"	"椥")
+("dolb"	"樇")
+("doma"	"檜")
+("domb"	"棆")
+("domd"	"梌")
+("domg"	"栓")
+("domk"	"楩")
+("domn"	"榆")
+("domo"	"檢")
+("don"	"杚")
+("donl"	"郲")
+("doo"	"來")
+("doog"	"桽")
+("dop"	"杹")
+("dopd"	"柂")
+("dowy"	"梅")
+("doyb"	"檎")
+("dp"	"朼杺")
+("dpa"	"栒栺")
+("dpd"	"杝")
+("dpfd"	"椈")
+("dph"	"柲")
+("dpht"	"榓")
+("dpi"	"杓构")
+("dpim"	"枃")
+("dpp"	"枇")
+("dppa"	"楷")
+("dppg"	"梐")
+("dpr"	"枸")
+("dpru"	"枹")
+("dpt"	"枻")
+("dptd"	"楪")
+("dpu"	"杶")
+("dq"	"杽")
+("dqbhx"	"韜")
+("dqbjj"	"韗")
+("dqdj"	"韎")
+("dqgwc"	"韥")
+("dqhaj"	"韟")
+("dqhk"	"楔")
+("dqikk"	"韍")
+("dqjl"	"梆")
+("dqjm"	"槥")
+("dqka"	"椿")
+("dqkd"	"榛")
+("dqkk"	"楱")
+("dqkq"	"棒")
+("dqkx"	"樁")
+("dqmb"	"棈")
+("dqmc"	"樍")
+("dqmf"	"榡")
+("dqnhd"	"韖")
+("dqnl"	"郼")
+("dqo"	"枎")
+("dqomr"	"韐")
+("dqou"	"槻")
+("dqptd"	"韘")
+("dqshi"	"韌")
+("dqsmv"	"韔")
+("dqtmj"	"韡")
+("dqttb"	"韝")
+("dqwli"	"韣")
+("dqwot"	"韞")
+("dqyrd"	"韕")
+("dr"	"杏")
+("drb"	"梋")
+("drc"	"枳")
+("drhg"	"桯")
+("drhr"	"梠")
+("drhs"	"柺")
+("drhu"	"柷")
+("drms"	"枵")
+("drrd"	"橾")
+("drrj"	"樿")
+("drsh"	"枴")
+("drsj"	"楫")
+("drye"	"椵")
+("dsav"	"椻")
+("dsfb"	"榍")
+("dsit"	"檻")
+("dsj"	"栮")
+("dsje"	"棷")
+("dsjl"	"椰")
+("dsjr"	"椐")
+("dskr"	"桾")
+("dslc"	"櫃")
+("dsly"	"榧")
+("dsma"	"槢")
+("dsme"	"梫")
+("dsmg"	"框櫂")
+("dsmh"	"樛")
+("dsmm"	"栩")
+("dsmr"	"柌")
+("dsmv"	"棖")
+("dsnd"	"樼")
+("dsno"	"柩")
+("dsp"	"柅")
+("dsqf"	"榪")
+("dsql"	"梛")
+("dsrg"	"檉")
+("dsrr"	"樞")
+("dss"	"柜")
+("dssr"	"梮")
+("dstv"	"榐")
+("dsu"	"杞")
+("dswu"	"欖")
+("dsyi"	"欘")
+("dsyq"	"樨")
+("dta"	"棤")
+("dtak"	"模")
+("dtaw"	"欗")
+("dtbo"	"檬")
+("dtc"	"栱")
+("dtce"	"欉")
+("dtco"	"樸")
+("dtcw"	"楢")
+("dtei"	"欂")
+("dtge"	"樣")
+("dtgf"	"榚")
+("dtgi"	"檥")
+("dtgo"	"檨")
+("dtgr"	"橏")
+("dthj"	"樥")
+("dtjr"	"楛")
+("dtk"	"栚")
+("dtkr"	"楉")
+("dtlb"	"樠")
+("dtlm"	"槿")
+("dtlx"	"櫹")
+("dtm"	"柑")
+("dtmc"	"棋橫")
+("dtmj"	"樺")
+("dtmv"	"椹")
+("dtoe"	"檴")
+("dtor"	"榙")
+("dtpa"	"槆")
+("dtqm"	"槎")
+("dtrg"	"權")
+("dtsj"	"榵")
+("dtsr"	"櫙")
+("dtt"	"栟")
+("dttb"	"構")
+("dttc"	"椪")
+("dtwa"	"槽")
+("dtwi"	"樽")
+("dtxc"	"槏")
+("du"	"札")
+("duch"	"梤")
+("dulmi"	"蚻")
+("dumb"	"椯")
+("dumt"	"榿")
+("duob"	"欈")
+("duon"	"梣")
+("dup"	"想")
+("duu"	"柮")
+("duvif"	"紮")
+("dvfo"	"櫞")
+("dvid"	"櫟")
+("dvii"	"機")
+("dvis"	"柪")
+("dvl"	"朻")
+("dvmg"	"梉")
+("dvno"	"椽")
+("dvoi"	"欚")
+("dvvd"	"樔")
+("dvvw"	"椔")
+("dw"	"東")
+("dwc"	"柶")
+("dwd"	"梱棵")
+("dwf"	"柬")
+("dwg"	"梩")
+("dwhaf"	"鶇")
+("dwhd"	"棞")
+("dwim"	"槶")
+("dwjr"	"棝")
+("dwl"	"柙")
+("dwlg"	"欏")
+("dwlj"	"檡")
+("dwls"	"楞")
+("dwly"	"檌")
+("dwmv"	"椳")
+("dwp"	"楒")
+("dwvf"	"樏")
+("dww"	"榃")
+("dwwf"	"欙")
+("dwww"	"櫑")
+("dy"	"朴")
+("dyaj"	"棹")
+("dybb"	"楴檛")
+("dybc"	"楨")
+("dybp"	"櫳")
+("dybs"	"榜")
+("dycb"	"樀")
+("dyck"	"校")
+("dydk"	"橔")
+("dydl"	"槨")
+("dydu"	"櫬")
+("dyfe"	"椒")
+("dyg"	"柱")
+("dyhh"	"楌")
+("dyhn"	"杭")
+("dyhr"	"槌")
+("dyhs"	"枋")
+("dyia"	"樴")
+("dyiu"	"梳")
+("dyj"	"枓")
+("dyjj"	"槤")
+("dylb"	"柿")
+("dymh"	"檅")
+("dymu"	"櫏")
+("dynv"	"橠")
+("dyoj"	"椊")
+("dypk"	"榩")
+("dypm"	"樝")
+("dypt"	"櫨")
+("dyr"	"枮")
+("dyra"	"櫧")
+("dyrb"	"槁")
+("dyrf"	"椋")
+("dyrn"	"楟")
+("dyro"	"檺")
+("dyrv"	"欀")
+("dysd"	"椸")
+("dysr"	"檹")
+("dysy"	"棜")
+("dyt"	"柆")
+("dytg"	"橦")
+("dytj"	"梓樟")
+("dyto"	"檖")
+("dytp"	"檍")
+("dytr"	"棓")
+("dytu"	"樈檤")
+("dytv"	"椄")
+("dyub"	"樆")
+("dyut"	"橀")
+("dyvo"	"核")
+("dywd"	"檁")
+("dywm"	"檀")
+("dywv"	"榱櫰")
+("dyx"	"櫅")
+("e"	"水")
+("ea"	"汨汩沓")
+("eaa"	"淐")
+("eafc"	"灝灦")
+("eafu"	"滉")
+("eag"	"涅")
+("eagi"	"溾")
+("eahm"	"湦")
+("eahu"	"湄")
+("eaiu"	"溉")
+("eam"	"泹")
+("eamh"	"湯")
+("eami"	"淂")
+("eamj"	"涆")
+("eamk"	"淏")
+("eamo"	"湜")
+("eana"	"澗")
+("eand"	"澖")
+("eane"	"灁")
+("eang"	"潤")
+("eanj"	"灛")
+("eank"	"潣")
+("eanw"	"瀾")
+("eapp"	"混")
+("eapv"	"渴")
+("eate"	"瀑")
+("eavf"	"濕")
+("eawe"	"漫")
+("eayf"	"澋")
+("ebac"	"溟")
+("ebau"	"淝")
+("ebb"	"淜")
+("ebbb"	"滑")
+("ebbr"	"渦")
+("ebbu"	"漞")
+("ebcd"	"深")
+("ebci"	"濺")
+("ebcn"	"測")
+("ebcr"	"浻")
+("ebcv"	"瀴")
+("ebgr"	"淍")
+("ebhg"	"淫")
+("ebhu"	"沉")
+("ebhx"	"滔")
+("ebjj"	"渾")
+("ebkf"	"鸂")
+("ebm"	"沮")
+("ebme"	"湲")
+("ebmp"	"濦")
+("ebmr"	"洞")
+("ebnd"	"浮")
+("ebof"	"漈")
+("ebp"	"懣懘")
+("ebr"	"泂")
+("ebsd"	"淨")
+("ebuc"	"浿")
+("ebug"	"濉灈")
+("ebuh"	"渺")
+("ebuk"	"湨")
+("ebul"	"濎")
+("ebuu"	"涀")
+("ebv"	"浽")
+("ebvk"	"溪")
+("ebwi"	"灂")
+("ebyh"	"浵")
+("ec"	"淦汃")
+("ecc"	"鍙")
+("ecnh"	"涕")
+("ecor"	"浴")
+("ecr"	"沿")
+("ecru"	"涗")
+("ecsh"	"汾")
+("ecst"	"湓")
+("ecwa"	"潧")
+("ed"	"沐")
+("edam"	"渣")
+("edbt"	"盓")
+("edbu"	"湘")
+("edci"	"淞")
+("edd"	"淋")
+("eddf"	"澿")
+("eddg"	"漜")
+("eddh"	"灪")
+("eddn"	"滼")
+("eddo"	"濋")
+("edg"	"塗")
+("edgg"	"溦")
+("edhe"	"波")
+("edhl"	"淅")
+("edj"	"沫")
+("edk"	"決")
+("edl"	"涑")
+("edlc"	"瀨")
+("edlo"	"漱")
+("edm"	"泍")
+("edmbc"	"顙")
+("edmf"	"渿")
+("edmq"	"湋")
+("edoe"	"漆")
+("edoo"	"淶")
+("edw"	"涷")
+("edwf"	"湅")
+("ee"	"沝")
+("eea"	"涾")
+("eee"	"淼")
+("eeed"	"桑")
+("eeeee"	"敪")
+("eeeef"	"鵽")
+("eeeen"	"剟")
+("eeeeo"	"欼")
+("eeeeu"	"毲")
+("eei"	"汊")
+("eeii"	"溞")
+("eemr"	"碆")
+("eetb"	"濷")
+("eev"	"婆")
+("efb"	"消")
+("efbg"	"漟")
+("efbk"	"潎")
+("efbr"	"淌")
+("efbw"	"澢")
+("efdc"	"瀵")
+("efdq"	"潾")
+("eff"	"淡")
+("effe"	"濴")
+("efff"	"瀠")
+("effg"	"瀅")
+("effr"	"瀯")
+("effs"	"澇")
+("efh"	"沙")
+("efhu"	"渻")
+("efmu"	"洸")
+("efq"	"泮")
+("efqf"	"潫")
+("eg"	"圣")
+("egce"	"淩")
+("egcg"	"淕")
+("egde"	"濲瀔")
+("egfe"	"瀫")
+("egg"	"洼塣")
+("eggu"	"澆")
+("egi"	"法")
+("egit"	"溘")
+("egj"	"準")
+("eglc"	"浾")
+("egni"	"濤")
+("egow"	"濇")
+("egr"	"洁")
+("egrv"	"滍")
+("egsk"	"滶")
+("egth"	"澎")
+("egti"	"澍")
+("egtj"	"涬")
+("egwc"	"瀆")
+("eha"	"泊")
+("ehag"	"湟")
+("ehal"	"瀄")
+("ehar"	"澔")
+("ehbk"	"澳")
+("ehbn"	"淛")
+("ehbt"	"洫盪")
+("ehbu"	"洎灚")
+("ehby"	"洀")
+("ehcn"	"瀏")
+("ehdb"	"潲")
+("ehde"	"潻")
+("ehdf"	"湫")
+("ehdn"	"浰")
+("ehdp"	"溒")
+("ehdw"	"潘")
+("ehe"	"汳")
+("eheq"	"洚")
+("eher"	"洛")
+("ehet"	"瀊")
+("ehf"	"燙")
+("ehgr"	"浩")
+("ehgu"	"洗")
+("ehhl"	"泖")
+("ehhv"	"派")
+("ehhw"	"溜")
+("ehio"	"泛")
+("ehjd"	"洙")
+("ehjg"	"湩")
+("ehjr"	"活")
+("ehk"	"沃")
+("ehkp"	"添")
+("ehlq"	"潷")
+("ehmgi"	"璗")
+("ehml"	"沂")
+("ehmo"	"澨")
+("ehmr"	"洉硰")
+("ehmy"	"泝")
+("ehni"	"汎渢")
+("ehnn"	"洬")
+("ehnwf"	"鯊")
+("ehoe"	"澓")
+("ehon"	"洐")
+("ehoo"	"漇漎")
+("ehpa"	"涽")
+("ehpm"	"泜")
+("ehq"	"挲")
+("ehqi"	"涐")
+("ehqj"	"湃")
+("ehqm"	"泩")
+("ehqo"	"泆")
+("ehrb"	"溎")
+("ehsd"	"淭")
+("ehsk"	"淚激")
+("ehsu"	"滬")
+("ehuc"	"瀩灒")
+("ehuk"	"溴")
+("ehul"	"濞")
+("ehv"	"娑")
+("ehvo"	"泒")
+("ehvp"	"汦")
+("ehxf"	"潟")
+("ehxu"	"淣")
+("ehyhv"	"裟")
+("ei"	"叉")
+("eiav"	"浪")
+("eibi"	"溥")
+("eice"	"浚")
+("eid"	"梁")
+("eidy"	"灖")
+("eifd"	"粱")
+("eihf"	"滅")
+("eihq"	"洠")
+("eihr"	"減")
+("eihu"	"沇")
+("eii"	"淺")
+("eiih"	"滲")
+("eijb"	"浦")
+("eijc"	"沭")
+("eik"	"汱")
+("eikf"	"溈")
+("eikk"	"沷")
+("eiku"	"沋")
+("eilb"	"滽")
+("eile"	"漮")
+("eill"	"洲")
+("eilmi"	"蚤")
+("eilr"	"溏")
+("eine"	"泳")
+("eioc"	"澬")
+("eiok"	"涘")
+("eipf"	"瀌")
+("eir"	"治")
+("eirm"	"淢")
+("eirp"	"澸")
+("eitc"	"濂瀇")
+("eite"	"渡")
+("eiv"	"泧")
+("eiwg"	"瀍")
+("eixp"	"漉")
+("ej"	"汁")
+("ejb"	"沛")
+("ejbc"	"滇")
+("ejbd"	"浡")
+("ejbj"	"湳")
+("ejbm"	"淔")
+("ejbv"	"灢")
+("ejc"	"泬")
+("ejcb"	"潸")
+("ejck"	"湥")
+("ejcm"	"涳")
+("ejco"	"溛")
+("ejcr"	"溶")
+("ejd"	"沬浨")
+("ejds"	"渤")
+("eje"	"汥")
+("ejhf"	"瀉")
+("ejhq"	"浶")
+("ejhw"	"瀋")
+("ejic"	"瀻")
+("ejii"	"漙")
+("ejik"	"涋")
+("ejip"	"潓")
+("ejir"	"渽")
+("ejjb"	"潮")
+("ejjj"	"澣濣")
+("ejjl"	"漸")
+("ejjm"	"瀚")
+("ejjn"	"漧")
+("ejka"	"渚")
+("ejkd"	"涍")
+("ejki"	"浤")
+("ejks"	"洘")
+("ejlv"	"淒")
+("ejmc"	"演濱")
+("ejme"	"滱")
+("ejmf"	"淙")
+("ejmm"	"渲")
+("ejmn"	"泞")
+("ejmo"	"淀")
+("ejmu"	"浣")
+("ejnu"	"涴")
+("ejp"	"沱")
+("ejpn"	"濘")
+("ejpu"	"滵")
+("ejqp"	"瀗")
+("ejr"	"沽")
+("ejrb"	"湖")
+("ejrr"	"涫")
+("ejtc"	"濆")
+("ejv"	"洝")
+("ejye"	"漃")
+("ejyj"	"滓")
+("ek"	"汏")
+("ekb"	"洧")
+("ekc"	"鋈")
+("ekcf"	"潦")
+("ekf"	"洃")
+("ekhr"	"漪")
+("eki"	"汰汯")
+("ekjt"	"渀")
+("ekkb"	"淆浠")
+("ekkk"	"漺")
+("ekld"	"洊")
+("eklu"	"淹")
+("ekms"	"洿")
+("ekn"	"氿洟")
+("ekni"	"汍")
+("ekoo"	"浹")
+("ekpb"	"滯")
+("eks"	"氻")
+("eksr"	"泇")
+("el"	"沖")
+("elbk"	"泱")
+("elbu"	"沈")
+("elg"	"垽")
+("elgm"	"澅")
+("elhi"	"魙")
+("elim"	"渱灗")
+("elll"	"汌沜")
+("elln"	"沸")
+("ellp"	"漶")
+("elmc"	"潰")
+("elmo"	"洮")
+("elmt"	"濜")
+("elq"	"津")
+("elvu"	"湚")
+("elw"	"油")
+("elwp"	"洩")
+("elws"	"涄")
+("elwv"	"漊")
+("elx"	"潚")
+("elxh"	"泲")
+("elxl"	"淵")
+("em"	"江")
+("emam"	"洹")
+("embb"	"濡灞")
+("embe"	"瀀")
+("embg"	"瀖")
+("embi"	"澐澪瀜")
+("embk"	"渜")
+("embl"	"洏")
+("embu"	"灀")
+("emcw"	"酒洒")
+("emd"	"汙")
+("emdm"	"瀝")
+("emfb"	"濔")
+("emfj"	"泙")
+("emg"	"汪")
+("emgg"	"涯")
+("emgh"	"濏")
+("emhf"	"源鴻")
+("emia"	"滏")
+("emig"	"洷")
+("emj"	"汗")
+("emjk"	"澉")
+("emlk"	"浭")
+("emls"	"沔")
+("emmc"	"澒")
+("emmf"	"沶")
+("emmi"	"沄")
+("emmp"	"灑")
+("emmr"	"浯")
+("emms"	"污")
+("emmu"	"沅")
+("emn"	"汀")
+("emnn"	"洌")
+("emnr"	"河")
+("emoa"	"瀦")
+("emr"	"沰")
+("emrb"	"滆")
+("emrr"	"滒")
+("emrt"	"浢")
+("emrw"	"湢")
+("emso"	"涿")
+("emt"	"汧")
+("emtb"	"濿")
+("emua"	"潛")
+("emub"	"灊")
+("emvb"	"漘")
+("emvg"	"溼")
+("emvi"	"溽")
+("emvm"	"沍涇")
+("emwd"	"溧")
+("emwf"	"漂")
+("emwg"	"湮湹")
+("emwj"	"潭")
+("emwl"	"湎")
+("emyf"	"漹")
+("enao"	"潒")
+("enau"	"浼")
+("enbk"	"渙")
+("enbq"	"澥")
+("enbs"	"湧")
+("encr"	"澹")
+("end"	"染")
+("ene"	"沒")
+("enhb"	"潏")
+("enhe"	"汲")
+("enhx"	"淊")
+("eni"	"汐泓")
+("enib"	"涌")
+("enii"	"漒")
+("enin"	"沀")
+("enir"	"洺")
+("enj"	"汛")
+("enkm"	"涎")
+("enkq"	"湕")
+("enlb"	"瀡")
+("enlc"	"濻")
+("enld"	"滁")
+("enls"	"泐")
+("enmb"	"瀰")
+("enmm"	"溺")
+("enmu"	"洈")
+("ennc"	"澦")
+("enob"	"湑")
+("enoe"	"潑")
+("enok"	"湀")
+("enot"	"澄")
+("enqd"	"滘")
+("enri"	"瀺")
+("ensj"	"渳")
+("ensv"	"漲")
+("enue"	"涵")
+("enwf"	"漁")
+("eoah"	"漡")
+("eob"	"汭")
+("eobt"	"盜")
+("eodi"	"泭")
+("eodk"	"漵")
+("eog"	"淮")
+("eogd"	"潗")
+("eogf"	"潐")
+("eohh"	"沴")
+("eoii"	"泠")
+("eoik"	"洑")
+("eoim"	"瀸")
+("eoip"	"淰")
+("eoir"	"滄")
+("eoj"	"汻")
+("eokf"	"瀿")
+("eolb"	"滫潃")
+("eold"	"滌")
+("eolk"	"浟")
+("eoma"	"澮")
+("eomb"	"淪瀹")
+("eomd"	"涂")
+("eomm"	"潝")
+("eomn"	"汽渝")
+("eomo"	"澰")
+("eomr"	"洽涻")
+("eomt"	"渰")
+("eon"	"汔")
+("eond"	"溙")
+("eoob"	"溍")
+("eook"	"瀲")
+("eop"	"沎")
+("eora"	"潪")
+("eosk"	"洢")
+("eotf"	"潕")
+("eoto"	"濮")
+("eowy"	"海")
+("ep"	"沁")
+("epa"	"洵")
+("epd"	"池柒")
+("epfd"	"淗")
+("eph"	"泌")
+("ephh"	"沕")
+("ephp"	"淴")
+("ephr"	"湉")
+("epi"	"汋")
+("epl"	"浺")
+("epou"	"淘")
+("epp"	"沘")
+("eppa"	"湝")
+("epr"	"泃")
+("epru"	"泡")
+("epsh"	"沏")
+("ept"	"泄")
+("eptd"	"渫")
+("epu"	"沌")
+("epuk"	"洶")
+("epyr"	"渹")
+("eqg"	"堻")
+("eqhf"	"潔")
+("eqhl"	"浙")
+("eqjr"	"湱")
+("eqka"	"湷")
+("eqkd"	"溱")
+("eqke"	"溰")
+("eqkk"	"湊")
+("eqmb"	"清")
+("eqmc"	"漬")
+("eqmf"	"溹")
+("eqor"	"湁")
+("er"	"呇")
+("erau"	"浥")
+("erb"	"涓")
+("erbc"	"滜")
+("erhg"	"浧")
+("erhu"	"況")
+("erji"	"濈")
+("ermr"	"潞")
+("erp"	"惉")
+("erpa"	"湣")
+("errd"	"澡")
+("errj"	"潬")
+("ersj"	"湒")
+("eru"	"汜")
+("eruc"	"潠")
+("ervk"	"洖")
+("ervp"	"泯")
+("erxu"	"澠")
+("eryo"	"浞")
+("esbn"	"涮")
+("esce"	"澱")
+("esd"	"渠")
+("eshr"	"沼")
+("eshu"	"浘")
+("esim"	"澀")
+("esip"	"涊")
+("esit"	"濫")
+("esj"	"洱")
+("esja"	"潳")
+("esjj"	"灄")
+("esjr"	"涺")
+("eskr"	"涒")
+("esll"	"洍")
+("esmb"	"漏")
+("esmc"	"瀷")
+("esme"	"浸")
+("esmg"	"渥濯洭")
+("esmh"	"漻")
+("esmi"	"潯")
+("esmj"	"濢")
+("esmr"	"泀")
+("esnd"	"潺")
+("esp"	"泥")
+("esqf"	"溲")
+("esrj"	"澼")
+("esrr"	"漚")
+("ess"	"洰")
+("esu"	"氾")
+("esuu"	"淈")
+("eswu"	"灠")
+("esyi"	"灟")
+("etak"	"漠")
+("etaw"	"灡")
+("etbc"	"淟")
+("etbn"	"湔")
+("etbo"	"濛")
+("etc"	"洪")
+("etca"	"潽")
+("etcd"	"澲")
+("etcf"	"濝")
+("etcl"	"澌")
+("etct"	"溢")
+("etcu"	"港")
+("etge"	"漾")
+("etgf"	"溔")
+("etgi"	"濧")
+("etgk"	"渼")
+("etgt"	"濭")
+("etif"	"瀳")
+("etit"	"漭")
+("etk"	"浂")
+("etkr"	"渃")
+("etlb"	"滿")
+("etlk"	"渶")
+("etlo"	"漢")
+("etlx"	"瀟")
+("etm"	"泔")
+("etmc"	"淇潢")
+("etmj"	"澕")
+("etmr"	"渮")
+("etmv"	"湛")
+("etoe"	"濩")
+("etog"	"灘")
+("etov"	"瀁")
+("etpp"	"濍")
+("etq"	"洋")
+("etqm"	"溠")
+("etrg"	"灌")
+("etst"	"灆")
+("ett"	"汫洴")
+("ettb"	"溝")
+("ettc"	"湴")
+("etub"	"溯")
+("etvi"	"滋")
+("etvp"	"濨")
+("etw"	"浀渵")
+("etwa"	"漕")
+("etwb"	"澫")
+("etwi"	"瀎")
+("etwt"	"澧")
+("etwv"	"濃")
+("etxc"	"溓")
+("etym"	"淽")
+("etys"	"淓")
+("eu"	"汕")
+("eubb"	"漰")
+("euc"	"鎏鍌")
+("eugk"	"澂")
+("eujt"	"灃")
+("eumb"	"湍")
+("eumf"	"湠")
+("euog"	"漼")
+("euon"	"涔")
+("eutt"	"灩")
+("euu"	"泏")
+("ev"	"汝")
+("evfd"	"灤")
+("evfg"	"濰")
+("evfn"	"灣")
+("evid"	"濼")
+("evis"	"泑")
+("evne"	"淥")
+("evr"	"洳")
+("evug"	"灉")
+("evvd"	"漅")
+("evvw"	"淄")
+("ew"	"沺")
+("ewb"	"渭")
+("ewc"	"泗")
+("ewd"	"涃淉")
+("ewdq"	"潿")
+("ewfq"	"滃")
+("ewg"	"浬")
+("ewgf"	"潶")
+("ewim"	"漍")
+("ewjr"	"涸")
+("ewk"	"洇")
+("ewlb"	"湡")
+("ewli"	"濁")
+("ewlj"	"澤")
+("ewln"	"瀱")
+("ewlo"	"潀")
+("ewlv"	"澴")
+("ewml"	"淠")
+("ewmo"	"溷")
+("ewmv"	"渨")
+("ewno"	"歠")
+("ewo"	"泅")
+("ewot"	"溫")
+("ewr"	"洄")
+("ewtc"	"潩")
+("ewtj"	"滭")
+("ewvf"	"漯")
+("ewwg"	"灅")
+("eyaj"	"淖")
+("eybb"	"渧濄")
+("eybc"	"湞")
+("eybg"	"灕")
+("eybk"	"澈")
+("eybp"	"瀧")
+("eybs"	"滂")
+("eybu"	"濬")
+("eycb"	"滴")
+("eyck"	"洨")
+("eycv"	"滾")
+("eydk"	"潡")
+("eydl"	"漷")
+("eydu"	"瀙")
+("eyed"	"澯")
+("eyem"	"瀣")
+("eyfe"	"淑")
+("eyg"	"注")
+("eyhc"	"瀕")
+("eyhm"	"滻")
+("eyhn"	"沆")
+("eyhs"	"汸")
+("eyib"	"淯")
+("eyiu"	"流")
+("eyjc"	"灨")
+("eyjj"	"漣")
+("eyk"	"汶")
+("eylc"	"瀢")
+("eylh"	"涉")
+("eylm"	"沚")
+("eymh"	"濊")
+("eymp"	"泚")
+("eyoj"	"淬")
+("eyok"	"液")
+("eypd"	"滹")
+("eypk"	"澞")
+("eypo"	"澽")
+("eypp"	"濾")
+("eypt"	"瀘")
+("eypu"	"淲")
+("eyr"	"沾")
+("eyrb"	"滈")
+("eyrd"	"淳")
+("eyrf"	"涼")
+("eyrj"	"滸")
+("eyrn"	"瀛渟")
+("eyro"	"濠")
+("eyru"	"湸")
+("eyrv"	"瀼")
+("eysd"	"游湤")
+("eyso"	"漩")
+("eysy"	"淤")
+("eyt"	"泣")
+("eyta"	"湆")
+("eytb"	"湇")
+("eytg"	"潼")
+("eytj"	"漳")
+("eytp"	"澺")
+("eytr"	"涪")
+("eyub"	"漓")
+("eyuh"	"滮")
+("eyv"	"汒")
+("eyvg"	"澭")
+("eyvi"	"泫")
+("eyvw"	"滀")
+("eywi"	"滷")
+("eywm"	"澶")
+("eywv"	"滖瀤")
+("eyx"	"濟")
+("eyy"	"汴")
+("f"	"火")
+("fab"	"焨")
+("fafu"	"熀")
+("faht"	"焺")
+("fahu"	"溗")
+("fam"	"炟")
+("famh"	"煬")
+("famj"	"焊")
+("fank"	"燘")
+("fanp"	"燜")
+("fanw"	"爛")
+("fanx"	"爓")
+("fapp"	"焜")
+("fate"	"爆")
+("fawe"	"熳")
+("fayt"	"煜")
+("fb"	"肖")
+("fbac"	"熐")
+("fbbe"	"燰")
+("fbhaf"	"鶺")
+("fbjj"	"溤")
+("fbkf"	"燃")
+("fbln"	"削")
+("fbme"	"煖")
+("fbmr"	"烔")
+("fbnd"	"烰")
+("fbok"	"敝敞")
+("fbr"	"尚炯")
+("fbrbc"	"賞")
+("fbrd"	"棠")
+("fbrg"	"堂")
+("fbrhu"	"党")
+("fbrlb"	"常")
+("fbrmh"	"牚")
+("fbrmn"	"瑐瓽")
+("fbrpa"	"嘗")
+("fbrq"	"掌")
+("fbrw"	"當")
+("fbrwf"	"黨")
+("fbryv"	"裳")
+("fbwi"	"爝")
+("fbyh"	"烿")
+("fcb"	"脊")
+("fci"	"炂")
+("fcnh"	"焍")
+("fcor"	"焀")
+("fd"	"米炑")
+("fdamg"	"糧")
+("fdau"	"粑")
+("fdbm"	"粗")
+("fdbmr"	"粡")
+("fdbt"	"粣")
+("fdbuu"	"粯")
+("fdcsh"	"粉")
+("fddh"	"爩")
+("fddi"	"籿")
+("fddj"	"粖")
+("fdeii"	"糔")
+("fdha"	"粕")
+("fdhe"	"粄")
+("fdhhj"	"粺")
+("fdhj"	"粁")
+("fdhoa"	"糌")
+("fdhqu"	"粍")
+("fdhuk"	"糗")
+("fdibi"	"糐")
+("fdig"	"粧")
+("fdiih"	"糝")
+("fdile"	"糠")
+("fdilr"	"糖")
+("fdixp"	"麊")
+("fdj"	"籵")
+("fdjk"	"粀")
+("fdjmf"	"粽")
+("fdjrb"	"糊")
+("fdk"	"炔")
+("fdma"	"粨")
+("fdmbb"	"糯")
+("fdmcw"	"粞")
+("fdmlk"	"粳")
+("fdmq"	"溿")
+("fdmtb"	"糲")
+("fdnd"	"籽")
+("fdng"	"粈")
+("fdnhd"	"糅")
+("fdnii"	"糨")
+("fdnj"	"籸")
+("fdnl"	"粌")
+("fdnmm"	"糑")
+("fdnob"	"糈")
+("fdok"	"敉")
+("fdon"	"籺")
+("fdphh"	"粅")
+("fdqmb"	"精")
+("fdsit"	"糮")
+("fdsmv"	"粻")
+("fdss"	"粔")
+("fdtak"	"糢")
+("fdtaw"	"糷")
+("fdtbn"	"糋")
+("fdtgf"	"糕")
+("fdthb"	"糒")
+("fdtwa"	"糟")
+("fdv"	"籹")
+("fdwd"	"粿")
+("fdwf"	"煉")
+("fdwg"	"粴")
+("fdwji"	"糰")
+("fdwla"	"糬")
+("fdwtc"	"糞")
+("fdy"	"烞")
+("fdyhr"	"糙")
+("fdyj"	"料")
+("fdyoj"	"粹")
+("fdyr"	"粘")
+("fdyt"	"粒")
+("ff"	"炎")
+("ffbb"	"膋")
+("ffbbu"	"覮")
+("ffbc"	"鎣")
+("ffbd"	"榮")
+("ffbe"	"滎")
+("ffbf"	"熒爣")
+("ffbg"	"塋")
+("ffbhf"	"鶯")
+("ffbhq"	"犖")
+("ffbks"	"勞")
+("ffbli"	"螢")
+("ffbmf"	"禜")
+("ffbmg"	"瑩")
+("ffbmn"	"甇")
+("ffbmw"	"醟")
+("ffbnj"	"溮")
+("ffbou"	"罃")
+("ffbrr"	"營")
+("ffbuu"	"覢")
+("ffbv"	"嫈")
+("ffbvf"	"縈")
+("ffbyr"	"謍")
+("ffbyv"	"褮")
+("ffdq"	"燐")
+("ffe"	"燮")
+("fff"	"焱")
+("fffd"	"燊爃")
+("ffff"	"燚")
+("ffh"	"炒")
+("ffln"	"剡")
+("ffmbc"	"顃纇")
+("ffnl"	"郯")
+("ffno"	"欻")
+("ffye"	"敥")
+("ffypu"	"虩")
+("ffyr"	"溡")
+("fg"	"灶")
+("fgg"	"烓")
+("fggu"	"燒")
+("fgit"	"熆")
+("fgni"	"燽")
+("fh"	"少")
+("fhag"	"煌")
+("fhbk"	"燠")
+("fhbt"	"烅")
+("fhbu"	"省")
+("fhdf"	"煂")
+("fhdn"	"熪")
+("fhdw"	"燔")
+("fhej"	"烽")
+("fher"	"烙")
+("fhey"	"炵")
+("fhge"	"燬")
+("fhgf"	"燻")
+("fhgu"	"烍")
+("fhjg"	"煡")
+("fhkb"	"燆")
+("fhks"	"劣")
+("fhlo"	"焮")
+("fhml"	"炘")
+("fhon"	"烆")
+("fhs"	"炸")
+("fhsb"	"煇")
+("fhsm"	"煽")
+("fhsu"	"熩")
+("fhup"	"熄")
+("fhwp"	"熜")
+("fiav"	"烺")
+("fice"	"焌")
+("fihr"	"煠")
+("fijb"	"烳")
+("filii"	"蠽")
+("filr"	"煻")
+("fipf"	"爊")
+("fipm"	"烒")
+("fitc"	"爌")
+("fixp"	"熝")
+("fjcm"	"焢")
+("fjcr"	"熔")
+("fjhp"	"烢")
+("fjks"	"烤")
+("fjmu"	"烷")
+("fjnu"	"焥")
+("fk"	"尖")
+("fkb"	"烠")
+("fkbu"	"瞥")
+("fkcf"	"燎")
+("fkgg"	"煁")
+("fkhaf"	"鷩")
+("fkhqu"	"氅")
+("fkik"	"獘")
+("fkkb"	"烯")
+("fklb"	"幣")
+("fklmi"	"蟞")
+("fkmbc"	"類")
+("fkmnp"	"斃")
+("fkn"	"彆")
+("fknwf"	"鱉")
+("fkp"	"憋")
+("fkrau"	"鄨")
+("fkryo"	"蹩")
+("fksb"	"熁")
+("fksc"	"燲")
+("fkt"	"弊")
+("fkv"	"嫳")
+("flbk"	"炴")
+("flii"	"爞")
+("flmo"	"烑")
+("flmt"	"燼")
+("flwv"	"熡")
+("flx"	"熽")
+("fm"	"灴")
+("fmam"	"烜")
+("fmbb"	"燸")
+("fmbc"	"煩")
+("fmbm"	"爧")
+("fmmr"	"焐")
+("fmob"	"炳")
+("fmso"	"烼")
+("fmu"	"光")
+("fmua"	"熸")
+("fmvm"	"烴")
+("fmwf"	"熛")
+("fmwg"	"煙")
+("fmwj"	"燂")
+("fmym"	"炡")
+("fnbk"	"煥")
+("fng"	"炄")
+("fnhb"	"燏")
+("fnhd"	"溳")
+("fnhx"	"焰")
+("fnkg"	"烶")
+("fnkm"	"烻")
+("fnkq"	"煒")
+("fno"	"炊")
+("fnot"	"燈")
+("fnq"	"揱")
+("fo"	"尐")
+("fog"	"雀")
+("fogf"	"燋")
+("foii"	"炩")
+("foir"	"焓熗")
+("foma"	"燴")
+("fomb"	"爚")
+("fomg"	"烇")
+("fomr"	"烚")
+("fond"	"熂")
+("fowy"	"烸")
+("fpd"	"灺")
+("fpi"	"灼")
+("fpru"	"炮")
+("fptd"	"滐")
+("fpu"	"炖")
+("fq"	"半")
+("fqbu"	"眷")
+("fqdmq"	"韏")
+("fqhe"	"叛")
+("fqhq"	"牶")
+("fqlb"	"帣")
+("fqln"	"判")
+("fqmbc"	"頖")
+("fqmso"	"豢")
+("fqmvn"	"甐")
+("fqn"	"弮")
+("fqnbg"	"觠")
+("fqnl"	"鄰")
+("fqq"	"拳")
+("fqsh"	"券")
+("fqsmm"	"翷")
+("fqsu"	"卷")
+("fqu"	"亃")
+("fqvif"	"絭")
+("fqvv"	"粼")
+("fqymu"	"齤")
+("frb"	"焆")
+("frbc"	"熉")
+("frhu"	"炾")
+("frrd"	"燥")
+("frrj"	"燀")
+("frrr"	"煢")
+("frye"	"煆")
+("fseg"	"熞")
+("fsh"	"灱")
+("fshr"	"炤")
+("fsit"	"爁")
+("fsma"	"熠")
+("fsmg"	"燿")
+("fsmi"	"燖")
+("fsmt"	"熤")
+("fsrr"	"熰")
+("fss"	"炬")
+("fssr"	"焗")
+("fswu"	"爦")
+("fta"	"焟")
+("ftc"	"烘烡")
+("ftcw"	"煔")
+("ftgi"	"燨")
+("ftgs"	"爔")
+("ftlj"	"煣")
+("ftlk"	"煸")
+("ftlo"	"熯")
+("ftmc"	"熿")
+("ftmd"	"煤")
+("ftmj"	"燁")
+("ftmv"	"滊")
+("ftq"	"烊")
+("ftrg"	"爟")
+("ftwb"	"燤")
+("ftwi"	"燇")
+("fubjj"	"輝")
+("fumb"	"煪")
+("fusmg"	"耀")
+("fvid"	"爍")
+("fwb"	"煲")
+("fwgg"	"爅")
+("fwli"	"燭")
+("fwlj"	"燡")
+("fwmbc"	"顲")
+("fwmv"	"煨")
+("fwot"	"熅")
+("fwtc"	"熼")
+("fwtj"	"熚")
+("fyaj"	"焯")
+("fycb"	"熵")
+("fydk"	"燉")
+("fyed"	"燦")
+("fyg"	"炷")
+("fyhn"	"炕")
+("fyia"	"熾")
+("fyj"	"炓")
+("fyk"	"炆")
+("fynb"	"熥")
+("fyoj"	"焠")
+("fyok"	"焲")
+("fypt"	"爐")
+("fyrb"	"熇")
+("fyrd"	"焞")
+("fyrv"	"爙")
+("fyto"	"燧")
+("fytp"	"燱")
+("fytr"	"焙")
+("fyvi"	"炫")
+("fyvo"	"烗")
+("g"	"土")
+("gagi"	"塒")
+("gahu"	"堳")
+("gam"	"坦")
+("gamh"	"場")
+("gamo"	"堤")
+("ganx"	"壛")
+("gaph"	"埸")
+("gapv"	"堨")
+("gasm"	"塌")
+("gav"	"垠")
+("gawe"	"墁")
+("gb"	"冉")
+("gbac"	"塓")
+("gbb"	"堋")
+("gbbr"	"堝")
+("gbcd"	"堔")
+("gbd"	"埰")
+("gbdi"	"埒")
+("gbhne"	"觳")
+("gblm"	"壺")
+("gbmc"	"埧")
+("gbmm"	"壼")
+("gbmo"	"塚")
+("gbmr"	"垌")
+("gbmt"	"壹")
+("gbnd"	"垺")
+("gbr"	"坰")
+("gbsd"	"埩")
+("gbtu"	"堈")
+("gby"	"坍")
+("gcbuu"	"覿")
+("gcdhe"	"皾")
+("gcg"	"坴")
+("gcglc"	"赫")
+("gche"	"夌")
+("gcilr"	"赯")
+("gcim"	"塕")
+("gcjka"	"赭")
+("gclmi"	"赨")
+("gcnau"	"赩")
+("gcnl"	"郝")
+("gcok"	"赦")
+("gcrxu"	"鼀")
+("gcrye"	"赮")
+("gcsh"	"坋")
+("gcsle"	"赧")
+("gcwa"	"增")
+("gcybc"	"赬")
+("gdhe"	"坡")
+("gdhne"	"穀榖")
+("gdi"	"寺")
+("gdw"	"埬")
+("gdwf"	"堜")
+("gebu"	"瞽")
+("gec"	"鏧")
+("gee"	"漀")
+("geeii"	"鼜")
+("gefbg"	"鼞")
+("gehda"	"馨")
+("gehey"	"鼕")
+("gehhj"	"鼙")
+("gehkb"	"毊")
+("gehor"	"鼛")
+("gelmi"	"螜")
+("gelxl"	"鼘")
+("gemr"	"磬")
+("geoju"	"罄")
+("gep"	"愨")
+("gesj"	"聲")
+("gesmv"	"鼚")
+("geymr"	"謦")
+("geyta"	"韾")
+("gfcb"	"塉")
+("gff"	"埮")
+("gfhne"	"縠鷇")
+("gfmu"	"垙")
+("gfno"	"款")
+("gfq"	"坢")
+("gfqu"	"埢")
+("gg"	"圭")
+("ggce"	"堎")
+("ggdi"	"封")
+("ggff"	"燅")
+("ggg"	"垚")
+("gggu"	"堯墝")
+("gghaf"	"鵱")
+("ggkni"	"埶")
+("ggln"	"刲")
+("ggni"	"壔")
+("ggnl"	"邽")
+("ggow"	"墻")
+("ggp"	"恚")
+("ggy"	"卦")
+("ghag"	"堭")
+("ghbk"	"墺")
+("ghdw"	"墦")
+("ghfd"	"垀")
+("ghgf"	"壎")
+("ghhj"	"埤")
+("ghhw"	"塯")
+("ghi"	"塊")
+("ghjg"	"堹")
+("ghjm"	"埵")
+("ghml"	"圻")
+("ghmr"	"垢")
+("ghmvn"	"甏")
+("ghmy"	"坼")
+("ghnd"	"垛")
+("ghni"	"堸")
+("ghpm"	"坻")
+("ghrf"	"塢")
+("ghrj"	"埠")
+("ghsk"	"墽")
+("ghvp"	"坁")
+("ghxu"	"堄")
+("gi"	"去")
+("giapv"	"朅")
+("giav"	"埌")
+("gibt"	"盍")
+("gibuc"	"贄")
+("gid"	"槷")
+("gif"	"熱")
+("gig"	"墊")
+("gihab"	"幫")
+("gihaf"	"鷙")
+("gihq"	"煓")
+("gihr"	"堿")
+("gihs"	"城")
+("giih"	"墋")
+("gijb"	"埔")
+("giks"	"劫勢")
+("gilb"	"墉")
+("gilmi"	"蟄")
+("gilr"	"塘")
+("ginl"	"邿")
+("ginn"	"垿")
+("giok"	"埃")
+("gip"	"慹")
+("giq"	"摯摰")
+("girm"	"域")
+("girxu"	"鼁")
+("gismm"	"翿")
+("gisqf"	"騺")
+("gitc"	"壙")
+("gitlj"	"鞤")
+("givif"	"縶")
+("gixp"	"塶")
+("giymr"	"謺")
+("gjbc"	"填")
+("gjbm"	"埴")
+("gjcr"	"塎")
+("gjhne"	"轂")
+("gjhp"	"垞")
+("gjhvo"	"瑗")
+("gjii"	"塼")
+("gjjn"	"墘")
+("gjka"	"堵")
+("gjkni"	"執")
+("gjmu"	"垸")
+("gjp"	"坨")
+("gjsle"	"報")
+("gjtc"	"墳")
+("gjv"	"垵")
+("gkbt"	"盩")
+("gkbuc"	"贅")
+("gkc"	"鏊")
+("gkf"	"熬")
+("gkik"	"獒")
+("gkkk"	"塽")
+("gklmi"	"螫螯")
+("gkmb"	"堶")
+("gkmr"	"埼")
+("gkms"	"垮")
+("gknwf"	"鰲")
+("gkpb"	"墆")
+("gkq"	"摮")
+("gkrxu"	"鼇")
+("gksj"	"聱")
+("gksqf"	"驁")
+("gkymr"	"謷")
+("glbk"	"坱")
+("gle"	"埭")
+("glll"	"圳")
+("glln"	"坲")
+("glmo"	"垗")
+("glnc"	"赤")
+("glq"	"垏")
+("glwl"	"坤")
+("glwv"	"塿")
+("gmam"	"垣")
+("gmbb"	"壩壖")
+("gmbk"	"堧")
+("gmc"	"鋆")
+("gmd"	"圩")
+("gmdm"	"壢")
+("gmf"	"坏")
+("gmfj"	"坪")
+("gmfm"	"坯")
+("gmgg"	"堐")
+("gmig"	"垤")
+("gmlk"	"埂")
+("gmlm"	"埡")
+("gmms"	"圬")
+("gmn"	"圢")
+("gmnr"	"坷")
+("gmrb"	"塥")
+("gmrw"	"堛")
+("gmwd"	"塛")
+("gmwf"	"墂")
+("gmwg"	"堙")
+("gnbg"	"埆")
+("gnhe"	"圾")
+("gnhne"	"殼彀")
+("gnhx"	"埳")
+("gnib"	"埇")
+("gnkm"	"埏")
+("gnmf"	"燾")
+("gnmi"	"壽")
+("gnmu"	"垝")
+("gno"	"坎")
+("gnot"	"墱")
+("gnui"	"堍")
+("goamj"	"趕")
+("goamo"	"趧")
+("gobm"	"趄")
+("goc"	"趛")
+("godk"	"赽")
+("gofb"	"趙")
+("gofbr"	"趟")
+("gofh"	"赻")
+("gog"	"堆")
+("goggu"	"趬")
+("gogr"	"趌")
+("gohjd"	"趎")
+("gohjr"	"趏")
+("gohkb"	"趫")
+("gohnd"	"趓")
+("gohne"	"豰")
+("gohuc"	"趲")
+("goii"	"坽")
+("goik"	"垘")
+("goimo"	"趑")
+("goin"	"坅")
+("goiv"	"越")
+("goks"	"赲")
+("golmo"	"趒")
+("golxh"	"趀")
+("gom"	"坵")
+("gomj"	"赶")
+("gomn"	"堬")
+("gomnn"	"趔")
+("gomr"	"垥")
+("gon"	"圪")
+("gonin"	"趍")
+("gonk"	"堠")
+("goog"	"趡")
+("googf"	"趭")
+("goohh"	"趁")
+("gooog"	"趖")
+("gopfd"	"趜")
+("gopim"	"赹")
+("gopuu"	"趨")
+("gorrd"	"趮")
+("goru"	"起")
+("goshr"	"超")
+("gosje"	"趣")
+("gosmg"	"趯")
+("gosmm"	"趐")
+("gotcw"	"趥")
+("gotmc"	"趪")
+("gou"	"赸")
+("gouu"	"趉")
+("govl"	"赳")
+("gowr"	"嗇")
+("goy"	"赴")
+("goyaj"	"趠")
+("gp"	"志")
+("gpbuu"	"覟")
+("gpd"	"地")
+("gpi"	"圴")
+("gpim"	"均")
+("gpmm"	"堩")
+("gptd"	"堞")
+("gpu"	"坉")
+("gqjl"	"垹")
+("gqkq"	"埲")
+("gqmb"	"埥")
+("gr"	"吉")
+("grbc"	"塤")
+("grbg"	"臺")
+("grgrr"	"囍")
+("grhaf"	"鴶")
+("grhg"	"埕")
+("grhne"	"嗀嗀")
+("grhv"	"袁")
+("grks"	"劼")
+("grmbc"	"頡")
+("grmfr"	"嚭")
+("grno"	"欯歖")
+("grrj"	"墠")
+("grrk"	"壧")
+("grrs"	"堮")
+("grrv"	"喪")
+("grt"	"壴")
+("grtf"	"熹")
+("grtr"	"喜嘉")
+("gru"	"圯")
+("grye"	"敼")
+("gsav"	"堰")
+("gsit"	"壏")
+("gsjt"	"壣")
+("gsmb"	"埽")
+("gsme"	"埐")
+("gsok"	"敖")
+("gsp"	"坭")
+("gsu"	"圮")
+("gsuu"	"堀")
+("gsyq"	"墀")
+("gtak"	"塻")
+("gtco"	"墣")
+("gtcp"	"塨")
+("gtdi"	"尌")
+("gtgr"	"墡")
+("gtgt"	"壒")
+("gthhh"	"彭")
+("gtiop"	"懿")
+("gtj"	"幸")
+("gtje"	"鼓")
+("gtlm"	"墐")
+("gtm"	"坩")
+("gtmv"	"堪")
+("gtor"	"塔")
+("gtq"	"垟")
+("gtss"	"壾")
+("gtu"	"亄")
+("gtvs"	"墈")
+("gtwi"	"墫壿")
+("gu"	"圠")
+("gubb"	"塴")
+("guhne"	"瞉")
+("gumbc"	"顤")
+("gumt"	"塏")
+("guog"	"墔")
+("guon"	"埁")
+("gusmm"	"翹")
+("gvis"	"坳")
+("gwd"	"堁")
+("gwg"	"埋")
+("gwj"	"毐")
+("gwjr"	"堌")
+("gwlb"	"堣")
+("gwlc"	"賣")
+("gwlj"	"墿")
+("gwlm"	"堽")
+("gwot"	"塭")
+("gwyi"	"坶")
+("gybs"	"塝")
+("gycb"	"墑")
+("gydk"	"墩")
+("gydl"	"墎")
+("gyfe"	"埱")
+("gyhn"	"坑")
+("gyhs"	"坊")
+("gyib"	"堉")
+("gylc"	"壝")
+("gylm"	"址")
+("gyo"	"走")
+("gyoj"	"埣")
+("gypm"	"墟")
+("gypo"	"壉")
+("gypt"	"壚")
+("gyr"	"坫")
+("gyrb"	"塙")
+("gyrd"	"埻")
+("gyro"	"壕")
+("gyrv"	"壤")
+("gyt"	"垃")
+("gyta"	"堷")
+("gytg"	"墥")
+("gytj"	"垶墇")
+("gytr"	"培")
+("gytu"	"境")
+("gyvo"	"垓")
+("gywd"	"壈")
+("gywm"	"壇")
+("gywv"	"壞")
+("h"	"竹")
+("ha"	"白")
+("habwi"	"皭")
+("hae"	"泉")
+("hahaa"	"皛馫")
+("hahaj"	"皞")
+("hahdw"	"皤")
+("hahe"	"皈")
+("hahgr"	"皓")
+("hahi"	"魄")
+("hahqi"	"皒")
+("hahsk"	"皦")
+("hail"	"節")
+("haipf"	"皫")
+("haj"	"皁")
+("hajbd"	"馞")
+("hajmu"	"皖")
+("hakj"	"皋")
+("haklu"	"馣")
+("halb"	"帛")
+("halmy"	"馡")
+("ham"	"笪")
+("hamg"	"皇")
+("hamj"	"筸")
+("hana"	"簡")
+("hank"	"簢")
+("hanw"	"籣")
+("haoae"	"馥")
+("haoii"	"皊")
+("hap"	"皂")
+("haph"	"馝")
+("hapi"	"的")
+("hasp"	"馜")
+("hatt"	"皏")
+("hatxc"	"馦")
+("hau"	"笆癿")
+("haumt"	"皚")
+("havid"	"皪")
+("havt"	"簋")
+("hawot"	"馧")
+("hayck"	"皎")
+("hayd"	"梟")
+("hayf"	"鳥")
+("haymp"	"皉")
+("hayrb"	"皜")
+("hayu"	"島")
+("hayv"	"裊")
+("hbbm"	"舋")
+("hbbuu"	"覺")
+("hbddf"	"爨")
+("hbe"	"澩")
+("hbf"	"燢爂")
+("hbfe"	"籐")
+("hbg"	"壆")
+("hbhaf"	"鵳鶣鷮鷽")
+("hbhgr"	"嚳")
+("hbk"	"奧")
+("hbks"	"筋")
+("hbln"	"制")
+("hbmbc"	"顅")
+("hbmch"	"釁")
+("hbmgi"	"璺")
+("hbmr"	"筒礐")
+("hbmvn"	"甂")
+("hbnbg"	"觷")
+("hbnd"	"學")
+("hbnl"	"鄅")
+("hbnwf"	"鱟")
+("hbok"	"敿")
+("hbq"	"甪")
+("hbr"	"向")
+("hbsd"	"箏")
+("hbse"	"箙")
+("hbsmm"	"翩")
+("hbt"	"血")
+("hbtmc"	"黌")
+("hbu"	"自嶨")
+("hbuf"	"纂")
+("hbuh"	"篎")
+("hbui"	"篡")
+("hbut"	"算")
+("hbuu"	"筧篹")
+("hbyi"	"舟")
+("hchaf"	"鸒")
+("hchg"	"籦")
+("hcii"	"籛")
+("hcjwj"	"轝")
+("hcln"	"劉劗")
+("hcmr"	"礜")
+("hcnl"	"鄮酇")
+("hcno"	"歟")
+("hcq"	"舉")
+("hcv"	"嬃")
+("hcve"	"籙")
+("hcymr"	"譽")
+("hd"	"禾")
+("hda"	"香")
+("hdaiu"	"穊")
+("hdamj"	"稈")
+("hdb"	"策")
+("hdbgb"	"稱")
+("hdbgr"	"稠")
+("hdbhx"	"稻")
+("hdbm"	"租")
+("hdbmp"	"穩")
+("hdbnd"	"稃")
+("hdbof"	"穄")
+("hdbt"	"盉")
+("hdbu"	"箱")
+("hdbwi"	"穱")
+("hdcnh"	"稊")
+("hdcru"	"稅")
+("hdcsh"	"秎")
+("hdd"	"箖")
+("hddj"	"秣")
+("hddmq"	"稦")
+("hdf"	"秋")
+("hdfb"	"稍")
+("hdfh"	"秒")
+("hdgce"	"稜")
+("hdgcg"	"稑")
+("hdggu"	"穘")
+("hdgow"	"穡")
+("hdgr"	"秸")
+("hdhaf"	"鴸鷍")
+("hdhah"	"穆")
+("hdhd"	"秝")
+("hdhhj"	"稗")
+("hdhjg"	"種")
+("hdhkb"	"穚")
+("hdhne"	"毇")
+("hdhp"	"秅")
+("hdhpm"	"秪")
+("hdhqo"	"秩")
+("hdhqu"	"秏")
+("hdhsb"	"稨")
+("hdhu"	"禿")
+("hdhvp"	"秖")
+("hdi"	"私")
+("hdiav"	"稂")
+("hdice"	"稄")
+("hdiih"	"穇")
+("hdijc"	"秫")
+("hdipf"	"穮")
+("hdir"	"秮")
+("hdirm"	"稢")
+("hditc"	"穬")
+("hdiua"	"稽")
+("hdiuu"	"嵇")
+("hdjbc"	"稹")
+("hdjbm"	"稙")
+("hdjhp"	"秺")
+("hdjip"	"穗")
+("hdjmo"	"稼")
+("hdkkb"	"稀")
+("hdl"	"秉种")
+("hdlbk"	"秧")
+("hdlc"	"籟")
+("hdln"	"利剁")
+("hdlo"	"簌")
+("hdlp"	"乘")
+("hdlw"	"釉秞")
+("hdlxh"	"秭")
+("hdm"	"笨")
+("hdmfj"	"秤")
+("hdmfm"	"秠")
+("hdmig"	"秷")
+("hdmrw"	"稫")
+("hdmvn"	"甈")
+("hdnd"	"季")
+("hdnhs"	"秀")
+("hdnin"	"移")
+("hdnl"	"邾鄡")
+("hdnmu"	"臲")
+("hdnob"	"稰")
+("hdnwa"	"穭")
+("hdoe"	"黍")
+("hdog"	"稚")
+("hdogf"	"穛")
+("hdoip"	"稔")
+("hdomb"	"稐")
+("hdomd"	"稌")
+("hdoo"	"箂")
+("hdp"	"悉")
+("hdph"	"秘")
+("hdpp"	"秕")
+("hdqmc"	"積")
+("hdr"	"和")
+("hdrhg"	"程")
+("hdsmh"	"穋")
+("hdsp"	"秜")
+("hdss"	"秬")
+("hdta"	"稓")
+("hdtmc"	"稘穔")
+("hdtoe"	"穫")
+("hdtwv"	"穠")
+("hdu"	"秈")
+("hduce"	"稯")
+("hdv"	"委")
+("hdvii"	"穖")
+("hdw"	"番")
+("hdwce"	"稷")
+("hdwd"	"稞")
+("hdwhd"	"稛")
+("hdwjr"	"稒")
+("hdwlj"	"釋")
+("hdyj"	"科")
+("hdymh"	"穢")
+("hdyrb"	"稿")
+("hdyrd"	"稕")
+("hdyrv"	"穰")
+("hdytg"	"穜")
+("hdyto"	"穟")
+("hdyx"	"穧")
+("he"	"反")
+("heag"	"篞")
+("heah"	"簜")
+("hebt"	"盤")
+("hed"	"槃")
+("heg"	"垼")
+("heha"	"箔")
+("hehee"	"灥")
+("hehw"	"籓")
+("heii"	"簿")
+("heir"	"箈")
+("helb"	"幋")
+("hemr"	"磐")
+("henl"	"鄋")
+("hep"	"慇")
+("heq"	"搫")
+("heqj"	"夆")
+("her"	"各")
+("hesu"	"笵")
+("hetc"	"篊")
+("hetlj"	"鞶")
+("hev"	"媻")
+("hevif"	"縏")
+("hey"	"冬")
+("heyhv"	"褩")
+("heyli"	"螽")
+("heyr"	"黏")
+("heyub"	"黐")
+("hfaht"	"鵿")
+("hfate"	"鸔")
+("hfb"	"筲")
+("hfbn"	"箾")
+("hfbw"	"簹")
+("hfd"	"乎釆")
+("hfdk"	"鴃")
+("hffs"	"簩")
+("hfhaf"	"鶖")
+("hfhn"	"鳧")
+("hfhrb"	"鶳")
+("hfhu"	"箵")
+("hfhyu"	"鷈")
+("hfice"	"鵔")
+("hfjc"	"鴥")
+("hfjp"	"鴕")
+("hfks"	"勳")
+("hflmi"	"蝵")
+("hfmvn"	"甃")
+("hfn"	"鳦")
+("hfnl"	"鄔")
+("hfno"	"歍")
+("hfog"	"鵻")
+("hfomd"	"鵌")
+("hfp"	"愁")
+("hfq"	"揫")
+("hfsqf"	"鷌")
+("hftgi"	"鸃")
+("hftmc"	"鶀")
+("hfv"	"媝")
+("hfydk"	"鷻")
+("hg"	"壬")
+("hgcr"	"簭")
+("hgdi"	"等")
+("hgea"	"濌")
+("hgf"	"熏")
+("hgfmu"	"皝")
+("hgg"	"筀")
+("hghne"	"毀")
+("hghu"	"先")
+("hgi"	"丟")
+("hgit"	"篕")
+("hgks"	"動")
+("hgmbc"	"顧")
+("hgni"	"籌")
+("hgpm"	"筠")
+("hgr"	"告")
+("hgrg"	"籉")
+("hgrly"	"靠")
+("hhag"	"篁")
+("hhail"	"卿")
+("hhbuc"	"貿")
+("hhdi"	"射")
+("hhdn"	"筣簃")
+("hhfbr"	"躺")
+("hhffs"	"軂")
+("hhgr"	"筶")
+("hhgu"	"筅")
+("hhhaf"	"鵹")
+("hhhj"	"箄")
+("hhhnd"	"躲")
+("hhj"	"卑")
+("hhjm"	"箠")
+("hhjmc"	"軉")
+("hhjr"	"筈")
+("hhk"	"笑")
+("hhkb"	"簥")
+("hhlo"	"笊")
+("hhmbc"	"須")
+("hhn"	"躬")
+("hhnwf"	"鯬")
+("hhoe"	"黎")
+("hhol"	"篽")
+("hhoo"	"簁")
+("hhqm"	"笙")
+("hhrb"	"篩")
+("hhs"	"笮")
+("hhsav"	"躽")
+("hhsb"	"篇")
+("hhsl"	"卯")
+("hhslc"	"贕")
+("hhsld"	"孵")
+("hhsle"	"毈")
+("hhsli"	"卵")
+("hhsrr"	"軀")
+("hhuc"	"籫")
+("hhw"	"留")
+("hhwgf"	"黧")
+("hhwp"	"篦")
+("hhxc"	"籅")
+("hhyu"	"篪")
+("hi"	"么鬼")
+("hiav"	"筤")
+("hibt"	"簠")
+("hibtv"	"魍")
+("hifb"	"魈")
+("hihaf"	"鵝")
+("hihml"	"鬿")
+("hihq"	"犩")
+("hihr"	"箴")
+("hii"	"箋")
+("hiih"	"篸")
+("hiikk"	"魃")
+("hiirm"	"魊")
+("hiiv"	"魆")
+("hijd"	"魅")
+("hije"	"鬾")
+("himlb"	"魎")
+("himwf"	"魒")
+("hino"	"乏")
+("hiog"	"魋")
+("hir"	"笞")
+("hit"	"笲")
+("hitc"	"簾")
+("hitmc"	"魌")
+("hivii"	"魕")
+("hixp"	"簏")
+("hiyj"	"魁")
+("hiypm"	"魖")
+("hiyub"	"魑")
+("hj"	"千")
+("hjbu"	"盾")
+("hjcm"	"箜")
+("hjd"	"朱")
+("hjhaf"	"鵯")
+("hjhne"	"段")
+("hjhx"	"臿")
+("hjii"	"篿簙")
+("hjjj"	"簳")
+("hjjo"	"簐")
+("hjju"	"範")
+("hjka"	"箸")
+("hjlo"	"箑")
+("hjlp"	"乖")
+("hjmbc"	"顊")
+("hjmk"	"簆")
+("hjmu"	"筦")
+("hjnl"	"郫")
+("hjr"	"舌")
+("hjrr"	"管")
+("hjsmm"	"翱")
+("hjtm"	"垂")
+("hjwg"	"重")
+("hk"	"夭")
+("hka"	"昋")
+("hkcf"	"簝")
+("hkd"	"棨")
+("hkhaf"	"鸄")
+("hkk"	"笅")
+("hklmi"	"蚕")
+("hklq"	"肇")
+("hkoo"	"筴")
+("hkp"	"忝懲")
+("hkr"	"吞")
+("hkrbr"	"喬")
+("hks"	"竻")
+("hksr"	"笳")
+("hku"	"嶴")
+("hkvif"	"綮")
+("hkymr"	"譥")
+("hlapv"	"齃")
+("hlbi"	"禹")
+("hlbuc"	"質")
+("hlha"	"皙")
+("hljbv"	"齉")
+("hlkn"	"鼽")
+("hlle"	"齂")
+("hllj"	"簰")
+("hlln"	"劓笰")
+("hlmbc"	"頎")
+("hlmc"	"簣")
+("hlmj"	"鼾")
+("hlmmf"	"禦")
+("hlmo"	"筄")
+("hlmvn"	"齀")
+("hlno"	"欣")
+("hlo"	"爪")
+("hlpr"	"齁")
+("hlq"	"筆")
+("hltwv"	"齈")
+("hlvk"	"籔")
+("hlvvu"	"齆")
+("hlw"	"笛")
+("hlwli"	"斶")
+("hlwv"	"簍")
+("hlx"	"簫")
+("hlxh"	"笫")
+("hlypm"	"齇")
+("hm"	"笁")
+("hmbc"	"篢")
+("hmbg"	"籗")
+("hmbu"	"眚")
+("hmd"	"竽")
+("hmgn"	"箌籈")
+("hmgt"	"筭")
+("hmhaf"	"鴟鷎")
+("hmhqm"	"甡")
+("hmj"	"竿")
+("hml"	"斤")
+("hmm"	"竺")
+("hmmu"	"笎")
+("hmmvn"	"甀")
+("hmnd"	"築")
+("hmnj"	"筑")
+("hmnl"	"邸郵筇")
+("hmnq"	"篫")
+("hmnr"	"笴")
+("hmoo"	"筮")
+("hmr"	"后")
+("hmrg"	"垕")
+("hmsl"	"笻")
+("hmsmb"	"歸")
+("hmsu"	"卮")
+("hmt"	"笄")
+("hmua"	"簪")
+("hmwd"	"篥")
+("hmwf"	"篻")
+("hmwj"	"簟")
+("hmwks"	"甥")
+("hmy"	"斥")
+("hn"	"几")
+("hnamh"	"颺")
+("hnbmc"	"颶")
+("hncr"	"簷")
+("hnd"	"朵梨")
+("hndo"	"箛")
+("hne"	"殳")
+("hnef"	"篜")
+("hneii"	"颾")
+("hnhag"	"凰")
+("hnhe"	"笈")
+("hnhhh"	"颩")
+("hnhhw"	"飀")
+("hnhjr"	"颳")
+("hnhli"	"風")
+("hnhq"	"犁")
+("hnhxe"	"颼")
+("hni"	"凡")
+("hnib"	"筩")
+("hnir"	"颱")
+("hnkcf"	"飉")
+("hnkg"	"筳")
+("hnkm"	"筵")
+("hnld"	"篨")
+("hnlh"	"第")
+("hnmaf"	"鳳")
+("hnmgh"	"飋")
+("hnmm"	"篛")
+("hnmni"	"夙")
+("hnmnn"	"颲")
+("hnmvh"	"颬")
+("hnot"	"簦")
+("hnp"	"愆")
+("hnpru"	"颮")
+("hnq"	"掣")
+("hnryo"	"躗")
+("hnsmh"	"飂")
+("hnwp"	"颸")
+("hnyhv"	"製")
+("hnymr"	"讆")
+("hnyr"	"颭")
+("ho"	"八彳")
+("hoa"	"昝")
+("hoami"	"得")
+("hoamo"	"徥")
+("hoau"	"爬")
+("hoaue"	"忁")
+("hoav"	"很")
+("hobc"	"籲")
+("hobg"	"篧")
+("hobgn"	"衢")
+("hobgr"	"徟")
+("hobm"	"徂")
+("hobou"	"徭")
+("hobrn"	"衕")
+("hobvk"	"徯")
+("hoci"	"彸")
+("hocmn"	"銜")
+("hodhe"	"彼")
+("hodi"	"符")
+("hodmq"	"徫")
+("hodoo"	"徠")
+("hodqn"	"衛")
+("hoemn"	"衍")
+("hof"	"熧")
+("hofbk"	"徶")
+("hofbr"	"徜")
+("hogdi"	"待")
+("hoggn"	"街")
+("hogyo"	"徒")
+("hohaf"	"鴔鴩")
+("hohag"	"徨")
+("hohgn"	"衝")
+("hohju"	"循")
+("hohne"	"役")
+("hohpm"	"彽")
+("hohqo"	"瓞")
+("hohs"	"筰")
+("hohsk"	"徼")
+("hoi"	"筏")
+("hoicn"	"術")
+("hoii"	"笭")
+("hoim"	"籤")
+("hoin"	"笒")
+("hojmf"	"徖")
+("hojrn"	"衚")
+("hojwp"	"德")
+("hokmr"	"徛")
+("hoks"	"劮")
+("hold"	"篠")
+("holii"	"瓥")
+("holk"	"筱")
+("holln"	"彿")
+("holmy"	"徘")
+("holq"	"律")
+("homb"	"籥")
+("homcw"	"徆")
+("homd"	"筡")
+("homg"	"筌")
+("homjn"	"衎")
+("homk"	"箯")
+("hommn"	"行")
+("homo"	"簽")
+("homr"	"答")
+("homrn"	"衙")
+("homvm"	"徑")
+("homym"	"征")
+("honhe"	"彶")
+("honk"	"篌")
+("honkn"	"衡")
+("hooae"	"復")
+("hooii"	"彾")
+("hooma"	"徻")
+("hoomd"	"徐")
+("hooml"	"御")
+("hoooo"	"從")
+("hop"	"慫")
+("hopa"	"徇")
+("hopi"	"彴瓝")
+("hopru"	"瓟")
+("hoqb"	"篟")
+("hor"	"咎")
+("horye"	"徦")
+("hosj"	"聳")
+("hosyq"	"徲")
+("hotcn"	"衖")
+("hotq"	"徉")
+("houfk"	"徽黴鰴")
+("hougk"	"徵")
+("hourk"	"徾")
+("houuk"	"微")
+("hovie"	"後")
+("howr"	"徊")
+("hoybk"	"徹")
+("hoybp"	"徿")
+("hoybs"	"徬")
+("hoyg"	"往")
+("hoyhs"	"彷")
+("hoyin"	"衒")
+("hoyj"	"斞")
+("hoylo"	"徙")
+("hoyrv"	"忀")
+("hp"	"乇")
+("hpa"	"昏筍")
+("hpdk"	"筷")
+("hphaf"	"鵖")
+("hphh"	"笏")
+("hpim"	"笉")
+("hpln"	"剩")
+("hpm"	"氐")
+("hpnl"	"鄎")
+("hpp"	"笓")
+("hpr"	"笱")
+("hpru"	"笣")
+("hpsl"	"印")
+("hpuu"	"篘")
+("hq"	"牛")
+("hqate"	"犦")
+("hqbmc"	"犋")
+("hqbtu"	"犅")
+("hqbu"	"看")
+("hqbuk"	"煟")
+("hqda"	"籍")
+("hqfqu"	"犈")
+("hqg"	"牡")
+("hqgdi"	"特")
+("hqgwc"	"犢")
+("hqhdj"	"煐")
+("hqhgr"	"牿")
+("hqhkb"	"犞")
+("hqhpm"	"牴")
+("hqhq"	"牪")
+("hqhqm"	"牲")
+("hqhw"	"籀")
+("hqi"	"我")
+("hqipf"	"犥")
+("hqiuh"	"牻")
+("hqjbm"	"犆")
+("hqjm"	"篲")
+("hqjnd"	"牸")
+("hqjqr"	"犗")
+("hqjr"	"牯")
+("hqkmr"	"犄")
+("hqks"	"牞")
+("hqlw"	"牰")
+("hqlxh"	"牬")
+("hqm"	"生")
+("hqmb"	"箐")
+("hqmc"	"簀")
+("hqmmr"	"牾")
+("hqmqj"	"拜")
+("hqmtb"	"犡")
+("hqmvm"	"牼")
+("hqnbg"	"觕")
+("hqnkq"	"煋")
+("hqo"	"失")
+("hqok"	"牧")
+("hqomg"	"牷")
+("hqp"	"牝")
+("hqpd"	"牠")
+("hqphh"	"物")
+("hqpuu"	"犓")
+("hqr"	"筘")
+("hqrye"	"煰")
+("hqsb"	"箍")
+("hqshi"	"牣")
+("hqta"	"簎")
+("hqtb"	"簼")
+("hqtce"	"犪")
+("hqtgs"	"犧")
+("hqthb"	"犕")
+("hqtm"	"箝")
+("hqu"	"毛")
+("hqvvv"	"犣")
+("hqwj"	"籜")
+("hqwlp"	"犤")
+("hqwyi"	"牳")
+("hqyrb"	"犒")
+("hqyrd"	"犉")
+("hqytg"	"犝")
+("hrbc"	"篔")
+("hrff"	"舕")
+("hrgb"	"舑")
+("hrhaf"	"鵠鴰鵅鴭")
+("hrhkp"	"舔")
+("hrhpm"	"錕迣煘鬳")
+("hrhr"	"筥")
+("hrhvp"	"舐")
+("hrj"	"阜")
+("hrks"	"勂")
+("hrlb"	"帥")
+("hrlmi"	"蛗")
+("hrln"	"刮劄")
+("hrmbc"	"頧")
+("hrmlb"	"師")
+("hrmr"	"簬")
+("hrnl"	"郈郜")
+("hrog"	"雒")
+("hrok"	"啟")
+("hrrj"	"簞")
+("hrtm"	"甜")
+("hru"	"峊")
+("hruc"	"簨")
+("hrvp"	"笢")
+("hryf"	"烏")
+("hs"	"戶乍")
+("hsb"	"肩")
+("hsbr"	"扃")
+("hsbt"	"扁")
+("hsff"	"扊")
+("hshml"	"所")
+("hshne"	"殷")
+("hshr"	"笤")
+("hsik"	"戾")
+("hsit"	"籃")
+("hsko"	"篋")
+("hslmy"	"扉")
+("hsly"	"篚")
+("hsmg"	"筐籊")
+("hsmr"	"笥")
+("hsog"	"雇")
+("hsp"	"怎")
+("hsqf"	"篤")
+("hsr"	"笸")
+("hsrau"	"扈")
+("hsru"	"戺")
+("hssmm"	"扇")
+("hsyhs"	"房")
+("hsyhv"	"扆")
+("hsyj"	"戽")
+("hsyr"	"扂")
+("ht"	"升")
+("htbn"	"箭")
+("htce"	"簸")
+("htcg"	"簊")
+("hthaf"	"鷑")
+("htkr"	"箬")
+("htmc"	"箕簧")
+("htmf"	"衃")
+("htng"	"衄")
+("htsj"	"衈")
+("htsl"	"卹")
+("httb"	"篝")
+("httwi"	"衊")
+("hubuc"	"贊")
+("hud"	"臬")
+("huff"	"毯")
+("huhaf"	"鵚鶂鶞")
+("huhgu"	"毨兟")
+("huhuu"	"毳")
+("huij"	"毧")
+("huije"	"毬")
+("huik"	"臭")
+("huikk"	"瞂")
+("hulmc"	"穨")
+("humbc"	"頹")
+("humcw"	"毢")
+("hunkq"	"毽")
+("hunl"	"郋郳")
+("huno"	"歋")
+("hunwa"	"氌")
+("huooo"	"臮")
+("hup"	"息憩")
+("hutak"	"氁")
+("hutca"	"氆")
+("huwml"	"鼻")
+("huwp"	"毸")
+("huytr"	"毰")
+("hvbjj"	"鼲")
+("hvbu"	"覣")
+("hvbuc"	"鼰")
+("hvbuk"	"鼳")
+("hvbuu"	"覛")
+("hvbvk"	"鼷")
+("hvcsh"	"鼢")
+("hve"	"笯")
+("hvfi"	"箹")
+("hvgdi"	"鼭")
+("hvhey"	"鼨")
+("hvhi"	"魏")
+("hvhqm"	"鼪")
+("hvhu"	"兜")
+("hvhyu"	"鼶")
+("hvif"	"系")
+("hvik"	"鼣")
+("hvikk"	"鼥")
+("hvil"	"籪")
+("hvio"	"瓜")
+("hvjck"	"鼵")
+("hvlw"	"鼬")
+("hvmmr"	"鼯")
+("hvmr"	"鼫")
+("hvmvn"	"瑏")
+("hvnkg"	"鼮")
+("hvno"	"篆")
+("hvp"	"氏")
+("hvpr"	"鼩")
+("hvqmb"	"鼱")
+("hvr"	"筎")
+("hvsav"	"鼴")
+("hvsl"	"卬")
+("hvtxc"	"鼸")
+("hvyk"	"鼤")
+("hwe"	"笝")
+("hwgti"	"睾")
+("hwhaf"	"鶹鷭")
+("hwhd"	"箘")
+("hwim"	"簂")
+("hwjr"	"箇")
+("hwk"	"囟")
+("hwkk"	"囪")
+("hwks"	"勫")
+("hwl"	"笚")
+("hwlg"	"籮")
+("hwli"	"篾")
+("hwml"	"箅")
+("hwmvs"	"粵")
+("hwnl"	"鄱")
+("hwsmm"	"翻")
+("hwtj"	"篳")
+("hx"	"臼")
+("hxbc"	"興")
+("hxbt"	"盥")
+("hxh"	"身")
+("hxhu"	"兒")
+("hxjc"	"輿")
+("hxlb"	"帠")
+("hxle"	"叟")
+("hxno"	"歃")
+("hxo"	"臾")
+("hxt"	"舁")
+("hxvyv"	"鼠")
+("hxwks"	"舅")
+("hxyc"	"與")
+("hxyf"	"舄")
+("hyabu"	"艒")
+("hyau"	"舥")
+("hybb"	"簻")
+("hybg"	"籬")
+("hybnd"	"艀")
+("hybp"	"籠")
+("hybs"	"篣")
+("hyck"	"筊")
+("hycr"	"船")
+("hyfb"	"艄")
+("hyfbw"	"艡")
+("hyha"	"舶")
+("hyhaf"	"鵃")
+("hyhag"	"艎")
+("hyhe"	"舨")
+("hyhej"	"艂")
+("hyheq"	"舽")
+("hyhj"	"篷")
+("hyhlo"	"艞")
+("hyhm"	"簅")
+("hyhn"	"笐")
+("hyhne"	"般")
+("hyhr"	"簉")
+("hyhs"	"舴籩")
+("hyhsb"	"艑")
+("hyhxe"	"艘")
+("hyjp"	"舵")
+("hykms"	"舿")
+("hykpb"	"艜")
+("hyl"	"舯")
+("hylw"	"舳")
+("hylwv"	"艛")
+("hym"	"舡")
+("hymnr"	"舸")
+("hymo"	"篴")
+("hyndt"	"艋")
+("hynkg"	"艇")
+("hynri"	"艬")
+("hyoge"	"艭")
+("hyoii"	"舲")
+("hyoir"	"艙")
+("hyoj"	"箤")
+("hyomd"	"艅")
+("hypt"	"籚")
+("hyptd"	"艓")
+("hypu"	"虒箎")
+("hyr"	"笘")
+("hyrb"	"篙")
+("hyrl"	"篰")
+("hyrn"	"籯")
+("hyro"	"籇")
+("hysd"	"箷")
+("hysh"	"舠")
+("hyshu"	"艉")
+("hysit"	"艦")
+("hysk"	"簇")
+("hysy"	"箊")
+("hyt"	"笠")
+("hytbo"	"艨")
+("hytc"	"舼")
+("hytct"	"艗")
+("hytgi"	"艤")
+("hythu"	"艏")
+("hytqm"	"艖")
+("hytwa"	"艚")
+("hyu"	"舢")
+("hyub"	"篱")
+("hyuce"	"艐")
+("hyv"	"笀")
+("hywl"	"舺")
+("hywv"	"簑")
+("hyybs"	"艕")
+("hyyhn"	"航")
+("hyyhs"	"舫")
+("hyyo"	"籧")
+("hyyps"	"艣")
+("hyypt"	"艫")
+("hyytg"	"艟")
+("hyyvi"	"舷")
+("hyyx"	"艩")
+("i"	"戈")
+("iaie"	"廄")
+("iav"	"良")
+("ib"	"禸")
+("ibcn"	"廁")
+("ibcv"	"廮")
+("ibdi"	"尃")
+("ibg"	"塱")
+("ibhaf"	"鵏鷛")
+("ibnl"	"鄘郙")
+("ibpp"	"能")
+("icnl"	"鄺")
+("icno"	"廞")
+("icp"	"怷")
+("id"	"床")
+("idbu"	"廂")
+("idfd"	"糜")
+("idg"	"塺")
+("idhd"	"穈")
+("idhi"	"魔")
+("idhq"	"犘")
+("idhqu"	"麾")
+("idjtc"	"黂")
+("idlmy"	"靡")
+("idlyf"	"爢")
+("idmr"	"磨")
+("idoo"	"庲")
+("idq"	"摩")
+("idsje"	"黀")
+("idvi"	"麼")
+("idvif"	"縻")
+("iea"	"昶")
+("iebt"	"盚")
+("iedhe"	"皴")
+("ieln"	"剫")
+("ieok"	"救")
+("ieyhv"	"裘")
+("ifamh"	"禓")
+("ifamo"	"禔")
+("ifasm"	"禢")
+("ifbbr"	"禍")
+("ifbgr"	"禂")
+("ifbjj"	"禈")
+("ifbk"	"廠")
+("ifbm"	"祖")
+("ifbme"	"禐")
+("ifbuu"	"視")
+("ifdmq"	"禕")
+("iffkc"	"禷")
+("ifg"	"社")
+("ifgi"	"祛")
+("ifgni"	"禱")
+("ifgrr"	"禧")
+("ifhaf"	"鷓")
+("ifhgr"	"祰")
+("ifhjd"	"祩")
+("ifhk"	"祅")
+("ifhml"	"祈")
+("ifhne"	"祋")
+("ifhpm"	"祗")
+("ifhqo"	"祑")
+("ifhs"	"祚")
+("ifhuc"	"禶")
+("ifhvp"	"祇")
+("ifhyu"	"禠")
+("ifikk"	"祓")
+("ifit"	"祴")
+("ifjbc"	"禛")
+("ifjr"	"祜")
+("ifkr"	"祐")
+("ifl"	"祌")
+("iflmo"	"祧")
+("iflwl"	"神")
+("ifmbc"	"顣")
+("ifmfb"	"禰")
+("ifmk"	"祆")
+("ifmmv"	"祳")
+("ifmr"	"祏")
+("ifmrw"	"福")
+("ifmtb"	"禲")
+("ifmwg"	"禋")
+("ifmwj"	"禫")
+("ifnhs"	"礽")
+("ifnl"	"祁鄬")
+("ifnmu"	"祪")
+("ifodi"	"祔")
+("ifohv"	"祣")
+("ifoll"	"祄")
+("ifoma"	"禬")
+("ifomb"	"禴")
+("ifomr"	"祫")
+("ifp"	"慼憑")
+("ifpd"	"祂")
+("ifph"	"祕")
+("ifpi"	"礿")
+("ifpou"	"祹")
+("ifqhk"	"禊")
+("ifrhu"	"祝")
+("ifrrj"	"禪")
+("ifru"	"祀")
+("ifryo"	"蹙")
+("ifshr"	"祒")
+("ifsme"	"祲")
+("ifsmm"	"祤")
+("ifsmr"	"祠")
+("ifsqf"	"禡")
+("iftgf"	"禚")
+("iftmc"	"祺")
+("iftmd"	"禖")
+("iftq"	"祥")
+("iftwt"	"禮")
+("ifvii"	"禨")
+("ifvne"	"祿")
+("ifvno"	"禒")
+("ifwd"	"祼")
+("ifwlm"	"禤")
+("ifwp"	"禗")
+("ifybb"	"禘")
+("ifybc"	"禎")
+("ifyhs"	"祊")
+("ifylm"	"祉")
+("ifyoj"	"祽")
+("ifyrv"	"禳")
+("ifyto"	"禭")
+("ig"	"庄")
+("igb"	"膺")
+("igce"	"庱")
+("igdi"	"庤")
+("ighaf"	"鷹")
+("igit"	"廅")
+("igow"	"廧")
+("igp"	"應")
+("igsk"	"廒")
+("igti"	"廚")
+("ih"	"戊")
+("ihhi"	"螷蠯")
+("ihhj"	"庳")
+("ihhqu"	"毿")
+("ihhw"	"廇")
+("ihi"	"戍廆")
+("ihln"	"剼")
+("ihm"	"戌")
+("ihml"	"庍")
+("ihmr"	"咸")
+("ihmv"	"威")
+("ihpm"	"底")
+("ihq"	"牟")
+("ihs"	"成")
+("ihu"	"允")
+("ihxe"	"廋")
+("ihxo"	"庾")
+("ihymf"	"戚")
+("ii"	"戔")
+("iib"	"朗")
+("iibt"	"盞")
+("iiif"	"絫")
+("iiih"	"參")
+("iiil"	"廊")
+("iiln"	"剆")
+("iinl"	"郎")
+("iino"	"欴")
+("iiobo"	"腐")
+("iiuh"	"庬")
+("iixp"	"廘")
+("ij"	"戎")
+("ijb"	"甫")
+("ijc"	"朮")
+("ijcc"	"麻")
+("ije"	"求庋")
+("ijjb"	"廟")
+("ijkd"	"庨")
+("ijwj"	"庫")
+("ik"	"犬")
+("ikbuc"	"貵")
+("ikhni"	"飆")
+("ikikk"	"猋")
+("ikjwj"	"軬")
+("ikk"	"犮")
+("iklu"	"庵")
+("iknf"	"為")
+("ikno"	"欸")
+("ikp"	"慦")
+("ikpb"	"廗")
+("ikrm"	"彧")
+("iku"	"尤")
+("ikw"	"畚")
+("ilb"	"庸")
+("ile"	"康")
+("ilil"	"州")
+("ilmo"	"庣")
+("iln"	"划")
+("ilo"	"庚")
+("iloc"	"賡")
+("ilr"	"唐")
+("ilwv"	"廔")
+("imbgr"	"凋")
+("imbsd"	"凈")
+("imc"	"凎剢")
+("imcw"	"庮")
+("imdw"	"凍")
+("ime"	"冰")
+("imgce"	"凌")
+("imhgu"	"冼")
+("imig"	"庢")
+("imikk"	"冹")
+("imir"	"冶")
+("imjlv"	"凄")
+("immnn"	"冽")
+("immp"	"廲")
+("immvm"	"冱")
+("immwg"	"凐")
+("imno"	"次")
+("imog"	"准")
+("imoii"	"冷")
+("imoir"	"凔")
+("imomr"	"冾")
+("imp"	"惑")
+("impko"	"凝")
+("imqmb"	"凊")
+("imsll"	"臧")
+("imsqf"	"馮")
+("imsuf"	"凞")
+("imtcl"	"凘")
+("imue"	"廈")
+("imuog"	"凗")
+("imvh"	"庌")
+("imwjr"	"凅")
+("imywd"	"凜")
+("inbq"	"廨")
+("ine"	"永")
+("infq"	"廯")
+("inin"	"序")
+("inkg"	"庭")
+("inli"	"廕")
+("ino"	"之")
+("inoe"	"廢")
+("io"	"庂")
+("iobuc"	"資")
+("iod"	"庥栥")
+("iodi"	"府")
+("iofd"	"粢")
+("iohaf"	"鶊")
+("iohd"	"秶")
+("ioin"	"庈")
+("iok"	"矣")
+("ioma"	"廥")
+("iomvn"	"瓷")
+("ioog"	"座")
+("iooiv"	"餈")
+("iop"	"恣")
+("ior"	"咨")
+("iord"	"楶")
+("iotf"	"廡")
+("iov"	"姿")
+("ip"	"弋庀")
+("ipbm"	"麆")
+("ipbuc"	"貣")
+("ipc"	"鏖")
+("ipf"	"熊麃")
+("ipfd"	"麋")
+("ipfdq"	"麟")
+("ipg"	"塵")
+("iphaf"	"鳶")
+("iphd"	"麇")
+("iphhi"	"麝")
+("iphn"	"麂")
+("iphor"	"麔")
+("iphxu"	"麑")
+("ipihr"	"麙")
+("ipipp"	"麤")
+("iplmi"	"螚")
+("ipm"	"式")
+("ipmc"	"廎")
+("ipmmc"	"貳")
+("ipmmv"	"麎")
+("ipmwd"	"麜")
+("ipmwm"	"麠")
+("ipnl"	"鄜")
+("ipnsj"	"麛")
+("ipog"	"隿")
+("ipp"	"庇態忒麀")
+("ipru"	"庖")
+("iprvk"	"麌")
+("iprye"	"麚")
+("iptmc"	"麒")
+("ipu"	"庉")
+("ipyg"	"麈")
+("ipyiu"	"麍")
+("ipyx"	"麡")
+("iqhaf"	"鴾")
+("iqhf"	"緳")
+("iqje"	"庪")
+("ir"	"台")
+("ird"	"枲")
+("irf"	"炱")
+("irhaf"	"鶶")
+("irm"	"或")
+("irmbc"	"顑")
+("irmvn"	"瓵")
+("irnbg"	"觱")
+("irnl"	"邰")
+("irp"	"怠感")
+("isbt"	"盛")
+("isgp"	"廳")
+("isja"	"廜")
+("ismh"	"廖")
+("isnl"	"郕")
+("isok"	"敷")
+("isrj"	"廦")
+("it"	"弁戒")
+("ita"	"庴")
+("itcl"	"廝")
+("ite"	"度")
+("itf"	"庶")
+("ithaf"	"鴘")
+("itlb"	"席")
+("itlm"	"廑")
+("itmc"	"廣")
+("itq"	"庠")
+("itso"	"庹")
+("itt"	"庰")
+("itxc"	"廉")
+("iuhhh"	"尨")
+("iv"	"戉")
+("ivug"	"廱")
+("iwcg"	"廛")
+("iwtc"	"廙")
+("ixe"	"慶")
+("ixf"	"廌")
+("ixp"	"鹿")
+("iybp"	"龐")
+("iydl"	"廓")
+("iyln"	"劘")
+("iymp"	"庛")
+("iypt"	"廬")
+("iyr"	"店")
+("iywd"	"廩")
+("j"	"十")
+("jaf"	"煮")
+("jamo"	"寔")
+("janl"	"都")
+("jasmm"	"翥")
+("jav"	"宴")
+("jb"	"巿")
+("jbd"	"寀")
+("jbhaf"	"鶦")
+("jbhod"	"櫜")
+("jblli"	"蟗")
+("jbm"	"宜")
+("jbmc"	"真")
+("jbmm"	"直")
+("jbmrd"	"橐")
+("jbmri"	"蠹")
+("jbnd"	"孛")
+("jbof"	"察")
+("jbrrv"	"囊")
+("jbtj"	"南")
+("jbvif"	"索")
+("jbwno"	"疐")
+("jc"	"穴")
+("jcbbr"	"窩")
+("jcbu"	"窅")
+("jcegg"	"窪漥")
+("jcemd"	"窏")
+("jcfdj"	"窲")
+("jcgfo"	"窾")
+("jcgg"	"窐")
+("jcgwc"	"竇")
+("jchaf"	"窵鷏")
+("jchdb"	"竊")
+("jchdp"	"窸")
+("jchgr"	"窖")
+("jchhl"	"窌")
+("jchhn"	"窮")
+("jchio"	"窆")
+("jchk"	"穾")
+("jchoo"	"窳")
+("jchs"	"窄")
+("jchsk"	"竅")
+("jchuu"	"竁")
+("jchvo"	"窊")
+("jchwk"	"窗")
+("jchxv"	"竄")
+("jci"	"戭")
+("jcik"	"突")
+("jcirm"	"窢")
+("jcjbc"	"窴")
+("jcjkd"	"窙")
+("jckn"	"究")
+("jclb"	"帘")
+("jclmo"	"窕")
+("jclwv"	"窶")
+("jcm"	"空")
+("jcmbc"	"顛")
+("jcmd"	"穻")
+("jcmig"	"窒")
+("jcmmu"	"竀")
+("jcmob"	"窉")
+("jcmvh"	"穿")
+("jcn"	"穹穵")
+("jcnhx"	"窞")
+("jcni"	"穸")
+("jcnlm"	"窿")
+("jcno"	"歕")
+("jcold"	"窱")
+("jcomn"	"窬")
+("jcor"	"容")
+("jcpru"	"窇")
+("jcpu"	"窀")
+("jcqhk"	"窫")
+("jcqou"	"窺")
+("jcsjl"	"窷")
+("jcskr"	"窘")
+("jcsmm"	"翸")
+("jcsuu"	"窟")
+("jctgf"	"窯")
+("jcuu"	"窋")
+("jcvis"	"窈")
+("jcwd"	"窠")
+("jcyck"	"窔")
+("jcyoj"	"窣")
+("jcyta"	"窨")
+("jd"	"未宋")
+("jdhaf"	"鵓")
+("jdi"	"守")
+("jdks"	"勃")
+("jdnl"	"郣")
+("jdok"	"教")
+("je"	"支")
+("jed"	"檕")
+("jeg"	"墼")
+("jehaf"	"鳷")
+("jejwj"	"轚")
+("jelmi"	"蟿")
+("jembc"	"頍")
+("jeoju"	"罊")
+("jeq"	"擊")
+("jese"	"寖")
+("jesmi"	"攳")
+("jesmm"	"翅")
+("jevif"	"繫")
+("jfb"	"宵")
+("jhdw"	"審")
+("jher"	"客")
+("jhk"	"宎")
+("jhoo"	"寙")
+("jhp"	"宅")
+("jhq"	"牢")
+("jhqu"	"宒")
+("jhxf"	"寫")
+("jibi"	"博")
+("jid"	"栽")
+("jidi"	"專")
+("jihaf"	"鷒")
+("jihs"	"宬")
+("jijwj"	"載")
+("jikf"	"寪")
+("jilmi"	"蛓")
+("jiln"	"剸")
+("jimcw"	"酨")
+("jimig"	"臷")
+("jinl"	"鄟")
+("jiobo"	"胾")
+("jiog"	"截")
+("jip"	"惠")
+("jir"	"哉")
+("jiwtc"	"戴")
+("jiyhv"	"裁")
+("jj"	"廾")
+("jjapp"	"輥")
+("jjapv"	"輵")
+("jjb"	"朝")
+("jjbb"	"輣")
+("jjbc"	"寘")
+("jjbgr"	"輖")
+("jjbtv"	"輞")
+("jjcor"	"輍")
+("jjdmq"	"韓")
+("jjeee"	"輟")
+("jjfb"	"輎")
+("jjfdq"	"轔")
+("jjgce"	"輘")
+("jjgow"	"轖")
+("jjgrv"	"轅")
+("jjhby"	"輈")
+("jjhdw"	"轓")
+("jjher"	"輅")
+("jjhg"	"軠")
+("jjhju"	"輴")
+("jjhkb"	"轎")
+("jjhml"	"斬")
+("jjhne"	"軗")
+("jjhni"	"軓")
+("jjhpm"	"軧")
+("jjhqo"	"軼")
+("jjhqu"	"軞")
+("jjhsn"	"軶")
+("jjhvo"	"軱")
+("jjhvp"	"軝")
+("jjhxu"	"輗")
+("jji"	"戟")
+("jjii"	"輚")
+("jjijb"	"輔")
+("jjikk"	"軷")
+("jjipm"	"軾")
+("jjir"	"軩")
+("jjirp"	"轗")
+("jjixp"	"轆")
+("jjjii"	"轉")
+("jjjjj"	"轟")
+("jjjmu"	"輐")
+("jjjqr"	"轄")
+("jjjtc"	"轒")
+("jjk"	"軑")
+("jjkcf"	"轑")
+("jjkn"	"軌")
+("jjlbk"	"軮")
+("jjlo"	"寁")
+("jjlw"	"軸")
+("jjmbl"	"輀")
+("jjmdm"	"轣")
+("jjmfj"	"軯")
+("jjmig"	"輊")
+("jjmj"	"軒")
+("jjmlb"	"輛")
+("jjmnr"	"軻")
+("jjmrw"	"輻")
+("jjmsu"	"軛")
+("jjmu"	"軏")
+("jjmvm"	"輕")
+("jjnau"	"輓")
+("jjnhd"	"輮")
+("jjno"	"軟")
+("jjoae"	"輹")
+("jjob"	"軜")
+("jjod"	"榦")
+("jjodi"	"軵")
+("jjohf"	"鶾")
+("jjohh"	"軫")
+("jjoii"	"軨")
+("jjoin"	"軡")
+("jjoli"	"螒")
+("jjomb"	"輪")
+("jjomg"	"輇")
+("jjomj"	"幹")
+("jjomn"	"輸")
+("jjon"	"乾")
+("jjoog"	"雗")
+("jjosm"	"翰")
+("jjoyj"	"斡")
+("jjpr"	"軥")
+("jjpu"	"軘")
+("jjpyr"	"輷")
+("jjqkd"	"轃")
+("jjqkk"	"輳")
+("jjqmb"	"輤")
+("jjrc"	"軹")
+("jjrhu"	"軦")
+("jjrsj"	"輯")
+("jjshi"	"軔")
+("jjshr"	"軺")
+("jjsit"	"轞")
+("jjsju"	"輒")
+("jjskr"	"輑")
+("jjsmh"	"轇")
+("jjsnd"	"轏")
+("jjstv"	"輾")
+("jjtav"	"轕")
+("jjtc"	"輁")
+("jjtco"	"轐")
+("jjtcw"	"輶")
+("jjtgi"	"轙轛")
+("jjtt"	"軿")
+("jju"	"軋")
+("jjumb"	"輲")
+("jjvid"	"轢")
+("jjvvd"	"轈")
+("jjvvw"	"輜")
+("jjwd"	"輠")
+("jjwlv"	"轘")
+("jjwot"	"轀")
+("jjwww"	"轠")
+("jjybk"	"轍")
+("jjyck"	"較")
+("jjyg"	"軴")
+("jjyjj"	"轋")
+("jjypt"	"轤")
+("jjyrf"	"輬")
+("jjyvo"	"輆")
+("jk"	"丈")
+("jka"	"者")
+("jkb"	"宥")
+("jkcf"	"寮")
+("jkhaf"	"鶟")
+("jki"	"宏")
+("jkmdo"	"斄")
+("jkme"	"漦")
+("jkmhq"	"犛")
+("jkmhu"	"氂")
+("jkmnd"	"孷")
+("jkmr"	"寄")
+("jkmsh"	"剺")
+("jkmv"	"嫠")
+("jkmwg"	"釐")
+("jkn"	"宄")
+("jknd"	"孝")
+("jkp"	"老")
+("jkpr"	"耇")
+("jkss"	"協")
+("jkys"	"考")
+("jla"	"暫")
+("jlc"	"鏨")
+("jld"	"槧")
+("jlg"	"塹")
+("jlk"	"吏")
+("jlln"	"事")
+("jlmo"	"宨")
+("jlmr"	"磛")
+("jlryo"	"蹔")
+("jlv"	"妻")
+("jlw"	"宙")
+("jlwv"	"寠")
+("jlyo"	"疌")
+("jm"	"士")
+("jmam"	"宣")
+("jmc"	"鑋")
+("jmch"	"寡")
+("jmd"	"宇")
+("jmhc"	"賓")
+("jmig"	"室")
+("jmjmm"	"矗")
+("jmlc"	"寅")
+("jmmc"	"賨")
+("jmmf"	"宗")
+("jmmu"	"完")
+("jmmv"	"宸")
+("jmn"	"宁")
+("jmr"	"宕")
+("jmrw"	"富")
+("jmso"	"家")
+("jmuc"	"寶")
+("jmue"	"寇")
+("jmyo"	"定")
+("jnd"	"字")
+("jngi"	"麮")
+("jnhaf"	"鸋")
+("jnihq"	"麰")
+("jniu"	"宛")
+("jnln"	"剚")
+("jnmwl"	"麵")
+("jnon"	"麧")
+("jnpfd"	"麴")
+("jnpru"	"麭")
+("jnqo"	"麩")
+("jnujt"	"麷")
+("jnup"	"惌")
+("jnyub"	"麶")
+("jogs"	"寯")
+("joma"	"宿")
+("jombc"	"顁")
+("joni"	"麥")
+("jose"	"寑")
+("jp"	"它")
+("jpa"	"耆")
+("jpbn"	"寧")
+("jpbq"	"甯")
+("jpbt"	"寍")
+("jph"	"宓")
+("jphi"	"蜜")
+("jphqu"	"耄")
+("jphu"	"密")
+("jpko"	"寲")
+("jpmig"	"耋")
+("jqmp"	"憲")
+("jqmr"	"害")
+("jr"	"古")
+("jrb"	"胡")
+("jrbhf"	"鶘")
+("jrcor"	"豁")
+("jrhaf"	"鴣鶷")
+("jrhne"	"毄")
+("jrhr"	"宮")
+("jrhu"	"克")
+("jrln"	"割")
+("jrlr"	"官")
+("jrmbc"	"額")
+("jrok"	"故")
+("jrrp"	"悹")
+("jrrye"	"嘏")
+("jrytj"	"辜")
+("jskr"	"宭")
+("jsll"	"宦宧")
+("jsmh"	"寥")
+("jt"	"卉")
+("jtak"	"寞")
+("jtbc"	"賁")
+("jtbi"	"寬")
+("jtcc"	"賽")
+("jtcd"	"寨")
+("jtcf"	"騫鶱")
+("jtcg"	"塞")
+("jtco"	"蹇")
+("jtcq"	"搴")
+("jtcr"	"謇")
+("jtcu"	"寋")
+("jtcv"	"褰")
+("jtcy"	"寒")
+("jtge"	"鼖")
+("ju"	"七")
+("juhaf"	"鵷")
+("jujru"	"兢")
+("juks"	"勀")
+("juln"	"剋剜")
+("jv"	"安")
+("jvd"	"案")
+("jvhaf"	"鴳鶈")
+("jvmb"	"寎")
+("jvmbc"	"頞")
+("jvmd"	"寐寱")
+("jvme"	"寢")
+("jvmr"	"寤寣")
+("jvnl"	"郪")
+("jwbuu"	"覾")
+("jwj"	"車")
+("jwjc"	"實")
+("jwlb"	"寓")
+("jwlv"	"寰")
+("jybc"	"寊")
+("jybp"	"寵")
+("jyfe"	"寂")
+("jytj"	"宰")
+("k"	"大乂")
+("kam"	"疸")
+("kamh"	"瘍")
+("kanb"	"癇")
+("karrj"	"奲")
+("kau"	"疤")
+("kav"	"痕")
+("kb"	"有冇")
+("kbb"	"痭")
+("kbbr"	"瘑")
+("kbcv"	"癭")
+("kbhaf"	"鵗")
+("kbhne"	"殽")
+("kbhqu"	"毻")
+("kbirm"	"戫")
+("kbm"	"疽")
+("kbmr"	"痌")
+("kbmvn"	"瓻")
+("kbnl"	"郁郗郩")
+("kbno"	"欷")
+("kbof"	"瘵")
+("kcano"	"閷")
+("kchne"	"殺")
+("kcipm"	"弒")
+("kcln"	"剎")
+("kdd"	"痳")
+("kdhe"	"疲")
+("kdlc"	"癩")
+("kdln"	"瘌")
+("ke"	"友")
+("kefh"	"痧")
+("keii"	"瘙")
+("kell"	"奫")
+("kf"	"灰疢")
+("kfb"	"痟")
+("kfbt"	"盔")
+("kfcb"	"瘠")
+("kff"	"痰")
+("kffs"	"癆")
+("kfhaf"	"鷯")
+("kfp"	"悐")
+("kgdi"	"痔")
+("kgg"	"奎")
+("kghaf"	"鵟")
+("kgp"	"痣")
+("khaa"	"猖")
+("khahm"	"猩")
+("khal"	"癤")
+("kham"	"狚")
+("khapp"	"猑")
+("khapv"	"猲")
+("khav"	"狠")
+("khawe"	"獌")
+("khbbb"	"猾")
+("khbbr"	"猧")
+("khbm"	"狙")
+("khbmr"	"狪")
+("khbn"	"痸")
+("khbou"	"牏")
+("khbsd"	"猙")
+("khbtt"	"狦")
+("khbuc"	"狽")
+("khbue"	"玃")
+("khdc"	"癪")
+("khdd"	"痵")
+("khdlc"	"獺")
+("khdn"	"痢")
+("khdv"	"痿")
+("khefh"	"猀")
+("khey"	"疼")
+("khf"	"狄")
+("khfbk"	"獙")
+("khggu"	"獟")
+("khgr"	"狤")
+("khgrv"	"猿")
+("khhbn"	"猘")
+("khhdn"	"猁")
+("khhg"	"狅")
+("khhgf"	"獯")
+("khhhj"	"猈")
+("khhj"	"痺")
+("khhkb"	"獢")
+("khhl"	"奅")
+("khhni"	"猦")
+("khhqm"	"狌")
+("khhrb"	"獅")
+("khhsb"	"猏猵")
+("khhsk"	"獥")
+("khhvo"	"狐")
+("khhw"	"瘤")
+("khhxe"	"犍")
+("khhxf"	"獡")
+("khhxu"	"猊")
+("khi"	"瘣")
+("khiav"	"狼")
+("khibi"	"煄")
+("khice"	"狻")
+("khihu"	"狁")
+("khij"	"狨")
+("khio"	"疺")
+("khitc"	"獷")
+("khiv"	"狘")
+("khjc"	"狖")
+("khjdi"	"狩")
+("khjjl"	"獑")
+("khjkp"	"狫")
+("khjpn"	"獰")
+("khjr"	"狜")
+("khjrb"	"猢")
+("khkcf"	"獠")
+("khkkb"	"狶")
+("khkmr"	"猗")
+("khkn"	"犰")
+("khkoo"	"狹")
+("khl"	"狆")
+("khlln"	"狒")
+("khlmo"	"狣")
+("khmam"	"狟")
+("khmbb"	"獳")
+("khmbe"	"獶")
+("khmce"	"獿")
+("khmfb"	"獮")
+("khmfm"	"狉")
+("khmg"	"狂")
+("khmhf"	"煍")
+("khmj"	"犴")
+("khmmf"	"狋")
+("khmto"	"獗")
+("khmvh"	"犽")
+("khnbq"	"獬")
+("khndf"	"煚")
+("khndt"	"猛")
+("khne"	"疫")
+("khng"	"狃")
+("khngu"	"峱")
+("khnhb"	"獝")
+("khnhd"	"猱")
+("khni"	"瘋")
+("khnkm"	"狿")
+("khnmb"	"獼")
+("khoii"	"狑")
+("khoir"	"犌")
+("khok"	"癥癓")
+("khoma"	"獪")
+("khomd"	"狳")
+("khomo"	"獫")
+("khomr"	"猞")
+("khon"	"犵")
+("khonk"	"猴")
+("khoo"	"瘲")
+("khpa"	"痻")
+("khppg"	"狴")
+("khpr"	"狗")
+("khqhk"	"猰")
+("khqhl"	"狾")
+("khqkd"	"犑")
+("khqmb"	"猜")
+("khrb"	"狷")
+("khrrk"	"玁")
+("khrye"	"猳")
+("khs"	"痄")
+("khsp"	"狔")
+("khsu"	"犯")
+("khtav"	"獦")
+("khtco"	"獛")
+("khtcw"	"猶")
+("khtjl"	"玂")
+("khtmc"	"獚")
+("khtoe"	"獲")
+("khtrg"	"獾")
+("khub"	"癟")
+("khuce"	"猣")
+("khup"	"瘜")
+("khvno"	"猭")
+("khvp"	"疧")
+("khvvv"	"獵")
+("khwd"	"猓")
+("khwg"	"狸")
+("khwl"	"狎")
+("khwlg"	"玀")
+("khwli"	"獨")
+("khwlv"	"獧")
+("khwmv"	"猥")
+("khxe"	"瘦")
+("khxo"	"瘐")
+("khxv"	"癙")
+("khyck"	"狡")
+("khye"	"瘢")
+("khyhn"	"犺")
+("khymh"	"獩")
+("khymr"	"狺")
+("khyoj"	"猝")
+("khypu"	"猇")
+("khyrk"	"獄")
+("khyrv"	"獽")
+("khytg"	"獞")
+("khytj"	"獐")
+("khytu"	"獍")
+("khyy"	"犿")
+("ki"	"太")
+("kice"	"痠")
+("kijb"	"痡")
+("kiku"	"疣")
+("kiog"	"雄")
+("kismm"	"翃")
+("kiuh"	"痝")
+("kiv"	"奿")
+("kjbc"	"瘨")
+("kjcc"	"痲癲")
+("kjka"	"奢瓡瘏")
+("kjkd"	"痚")
+("kjrr"	"瑔痯")
+("kjt"	"奔")
+("kk"	"爻")
+("kkb"	"肴痏")
+("kkcf"	"療")
+("kkhaf"	"鷞鸑")
+("kkkk"	"爽")
+("kklb"	"希")
+("kklu"	"瓾痷")
+("kkn"	"痍")
+("kkog"	"瘞")
+("kkop"	"瘱")
+("kkrb"	"瘸")
+("kks"	"夯")
+("kksr"	"痂")
+("klb"	"布")
+("klg"	"在")
+("klll"	"夼")
+("klln"	"疿")
+("klmi"	"痋")
+("klmy"	"痱")
+("kln"	"刈")
+("klnd"	"存")
+("klwu"	"奄")
+("km"	"左疘")
+("kmaa"	"奭")
+("kmbw"	"癗")
+("kmfr"	"痞")
+("kmmf"	"奈")
+("kmmr"	"痦")
+("kmms"	"夸")
+("kmn"	"疔")
+("kmnr"	"奇")
+("kmob"	"病")
+("kmrt"	"痘")
+("kmso"	"瓿瘃")
+("kmvm"	"痙")
+("kmwf"	"瘭")
+("kmym"	"症")
+("kn"	"九夷")
+("kna"	"旭旮")
+("knbk"	"瘓")
+("kncr"	"癚")
+("knfq"	"癬")
+("knhaf"	"鳩")
+("kni"	"丸厹")
+("knib"	"痛")
+("knin"	"奓痑")
+("knlm"	"癃")
+("knlp"	"癮")
+("knlr"	"痾")
+("knmbc"	"頄")
+("kno"	"疚")
+("knoe"	"癈")
+("knthu"	"馗")
+("knymr"	"訄")
+("knypu"	"虓")
+("kog"	"痽")
+("kogi"	"奪")
+("kogw"	"奮")
+("kohaf"	"鵊")
+("kohh"	"疹")
+("koir"	"瘡")
+("kok"	"疾")
+("kokr"	"痴")
+("koll"	"疥")
+("koma"	"癐")
+("kombc"	"頰")
+("komg"	"痊")
+("komn"	"瘉")
+("komp"	"癒")
+("kon"	"疙")
+("konk"	"瘊")
+("konl"	"郟")
+("koo"	"夾")
+("koog"	"痤")
+("kowy"	"痗")
+("kp"	"疕")
+("kpblb"	"帶")
+("kpko"	"癡")
+("kpp"	"疪")
+("kpr"	"痀")
+("kpt"	"疶")
+("kqhk"	"瘈")
+("kqhp"	"瘛")
+("kr"	"右")
+("krbuc"	"賀")
+("krc"	"疻")
+("krd"	"架")
+("krhaf"	"鴐鵸")
+("krhqu"	"毠")
+("krje"	"攲")
+("krln"	"剞")
+("krmnr"	"哿")
+("krno"	"欹")
+("krrj"	"癉")
+("krru"	"癌")
+("krsqf"	"駕")
+("krye"	"敧瘕")
+("kryhv"	"袈")
+("ks"	"力")
+("ksce"	"癜")
+("kshaf"	"鴮")
+("kshvf"	"綔")
+("kshvo"	"瓠")
+("ksj"	"耷")
+("ksksb"	"脅")
+("kskss"	"劦")
+("ksksv"	"姭")
+("ksln"	"刳")
+("ksmb"	"瘺")
+("ksmh"	"瘳")
+("ksmi"	"套")
+("kspru"	"匏")
+("ksr"	"加")
+("ksrj"	"癖")
+("ksrr"	"奩")
+("kswp"	"勰")
+("ktak"	"瘼")
+("ktbc"	"痶")
+("ktjr"	"瘔")
+("ktlm"	"瘽")
+("ktm"	"疳")
+("ktog"	"癱")
+("ktor"	"瘩")
+("ktov"	"癢")
+("ktq"	"羍痒")
+("ktqm"	"瘥")
+("ktuo"	"瘚")
+("ktwb"	"癘")
+("ku"	"尢疝")
+("kubbb"	"尳")
+("kuhaf"	"鵪")
+("kuhjg"	"尰")
+("kumg"	"尪")
+("kuoll"	"尬")
+("kupi"	"尥")
+("kusit"	"尷")
+("kvfb"	"癵")
+("kvug"	"癰")
+("kwjr"	"痼")
+("kwle"	"瘝")
+("kwml"	"痹")
+("kwot"	"瘟")
+("kwr"	"痐")
+("kwvf"	"瘰")
+("kyg"	"疰")
+("kymp"	"疵")
+("kyoj"	"瘁")
+("kypm"	"瘧")
+("kyr"	"痁")
+("kysk"	"瘯")
+("kysy"	"瘀")
+("kyta"	"瘖")
+("kytj"	"瘴")
+("kyvo"	"痎")
+("kyx"	"癠")
+("l"	"中")
+("la"	"衵")
+("laa"	"裮")
+("lam"	"袒")
+("lamo"	"褆")
+("lanb"	"襉")
+("lanw"	"襴")
+("laph"	"裼")
+("lapv"	"褐")
+("lasm"	"褟")
+("late"	"襮")
+("lav"	"裉")
+("lb"	"巾")
+("lbabu"	"帽")
+("lbafu"	"幌")
+("lbau"	"帊")
+("lbawe"	"幔")
+("lbayf"	"幜")
+("lbbac"	"幎")
+("lbbhx"	"幍")
+("lbcru"	"帨")
+("lbdhe"	"帔")
+("lbdmq"	"幃")
+("lbfb"	"帩")
+("lbgni"	"幬")
+("lbgr"	"裯")
+("lbha"	"帕")
+("lbhal"	"幯")
+("lbhdw"	"幡")
+("lbhni"	"帆")
+("lbhqo"	"帙")
+("lbigi"	"幮")
+("lbii"	"帴")
+("lbiih"	"幓")
+("lbikk"	"帗")
+("lbjj"	"褌")
+("lbjka"	"帾")
+("lbjmo"	"幏")
+("lbjqp"	"幰")
+("lbjtc"	"幩")
+("lbk"	"央")
+("lblbu"	"帎")
+("lbm"	"袓")
+("lbmbc"	"幁幊")
+("lbme"	"褑")
+("lbmn"	"帄")
+("lbmrw"	"幅")
+("lbncr"	"幨")
+("lbnl"	"鄁")
+("lbog"	"帷")
+("lbomr"	"帢")
+("lbotf"	"幠")
+("lbqmc"	"幘")
+("lbrrd"	"幧")
+("lbrrj"	"幝")
+("lbsmg"	"幄")
+("lbsmv"	"帳")
+("lbt"	"盅")
+("lbtak"	"幙")
+("lbtbo"	"幪")
+("lbtt"	"帡")
+("lbtwi"	"幭")
+("lbu"	"冘")
+("lbwim"	"幗")
+("lbybc"	"幀")
+("lbyia"	"幟")
+("lbyr"	"帖")
+("lbytg"	"幢")
+("lbytj"	"幛")
+("lcnl"	"鄪")
+("lcor"	"裕")
+("lcru"	"裞")
+("lcsh"	"衯")
+("ldbb"	"襋")
+("lddf"	"襟")
+("lddq"	"襻")
+("ldhe"	"被")
+("ldk"	"袂")
+("ldmq"	"褘")
+("leed"	"褬")
+("leee"	"裰")
+("lei"	"衩")
+("lfbk"	"襒")
+("lfbw"	"襠")
+("lff"	"裧")
+("lfq"	"袢")
+("lfqu"	"裷")
+("lga"	"書")
+("lgam"	"晝")
+("lgb"	"袡")
+("lgce"	"裬")
+("lggu"	"襓")
+("lggy"	"褂")
+("lgi"	"袪")
+("lgr"	"袺")
+("lgrc"	"襭")
+("lgwc"	"襩")
+("lgwm"	"畫")
+("lha"	"袙")
+("lhbk"	"襖")
+("lheq"	"袶")
+("lher"	"袼")
+("lhg"	"衽")
+("lhhh"	"衫")
+("lhhj"	"裨")
+("lhjd"	"袾")
+("lhoo"	"褷")
+("lhpm"	"袛")
+("lhqo"	"袟")
+("lhsb"	"褊")
+("lhul"	"襣")
+("lhvp"	"衹")
+("lhyu"	"褫")
+("lia"	"蚎")
+("liabu"	"蝐")
+("liahu"	"蝞")
+("liail"	"蝍")
+("liamh"	"蝪")
+("liamo"	"蝭")
+("liaph"	"蜴")
+("liapv"	"蝎")
+("liau"	"蚆")
+("liav"	"蛝")
+("liavo"	"蠍")
+("liawe"	"蟃")
+("libac"	"螟")
+("libbb"	"螖")
+("libbr"	"蝸")
+("libcv"	"蠳")
+("libdi"	"蛶")
+("libgr"	"蜩")
+("libm"	"蛆")
+("libme"	"蝯")
+("libnd"	"蜉")
+("libp"	"褦")
+("libue"	"蠼")
+("libug"	"蠷")
+("libuu"	"蜆")
+("libvk"	"螇")
+("lici"	"蚣")
+("licim"	"螉")
+("lick"	"蚥")
+("licru"	"蛻")
+("licsh"	"蚡")
+("lid"	"蚞")
+("lidci"	"蜙")
+("lidhe"	"蚾")
+("lidhl"	"蜥")
+("lidk"	"蚗")
+("lidw"	"蝀")
+("lieee"	"蝃")
+("liesd"	"蟝")
+("lifb"	"蛸")
+("lifbg"	"螳")
+("lifbw"	"蟷")
+("liffd"	"蠑")
+("liffs"	"蟧")
+("lifqu"	"蜷")
+("ligb"	"蚺")
+("ligg"	"蛙")
+("liggu"	"蟯")
+("ligr"	"蛣")
+("ligrr"	"蟢")
+("ligth"	"蟛")
+("lihad"	"蟂")
+("lihag"	"蝗")
+("lihdj"	"蝌")
+("lihdn"	"蜊")
+("lihdp"	"蟋")
+("lihdv"	"蜲")
+("lihdw"	"蟠")
+("lihej"	"蜂")
+("lihhj"	"蜱")
+("lihi"	"螝")
+("lihjd"	"蛛")
+("lihjg"	"蝩")
+("lihjr"	"蛞")
+("lihkb"	"蟜")
+("lihlb"	"蝺")
+("lihml"	"蚚")
+("lihmy"	"蚸")
+("lihn"	"虮")
+("lihp"	"虴")
+("lihpm"	"蚳")
+("lihqi"	"蛾")
+("lihqo"	"蛈")
+("lihqu"	"蚝")
+("lihrb"	"螄")
+("lihrf"	"螐")
+("lihs"	"蚱")
+("lihsb"	"蝙")
+("lihsk"	"蜧")
+("lihsu"	"蚅")
+("lihuk"	"螑")
+("lihup"	"螅")
+("lihvo"	"蛌")
+("lihvp"	"蚔")
+("lihwp"	"蟌")
+("lihxu"	"蜺")
+("lihyu"	"螔")
+("liiav"	"蜋")
+("liih"	"襂")
+("liihq"	"蛑")
+("liihv"	"蝛")
+("liiil"	"螂")
+("liijb"	"蜅")
+("liije"	"蛷")
+("liikf"	"蟡")
+("liikk"	"蛂")
+("liiku"	"蚘")
+("liilr"	"螗")
+("liioc"	"蠀")
+("liirm"	"蜮")
+("liitc"	"蠊")
+("liitf"	"蟅")
+("liitu"	"蝷")
+("liiuh"	"蛖")
+("liixp"	"螰")
+("lijb"	"補")
+("lijbj"	"蝻")
+("lijcg"	"螲")
+("lije"	"蚑")
+("lijip"	"蟪")
+("lijj"	"褲")
+("lijjl"	"螹")
+("lijka"	"蝫")
+("lijlo"	"蜨")
+("lijmc"	"螾蠙")
+("lijmm"	"蝖")
+("lijnu"	"蜿")
+("lijp"	"蛇")
+("lijqr"	"螛")
+("lijr"	"蛄")
+("lijrb"	"蝴")
+("lijtc"	"蟦")
+("likcf"	"蟟")
+("likk"	"袚")
+("likn"	"蛦")
+("likok"	"螏")
+("likoo"	"蛺")
+("likpb"	"螮")
+("lilii"	"蟲")
+("lilit"	"蠱")
+("lille"	"蝂")
+("lilmq"	"蝆")
+("lilw"	"蚰")
+("lilwv"	"螻")
+("lilxl"	"蜵")
+("lim"	"虹")
+("lima"	"蛨")
+("limbb"	"蠕")
+("limbc"	"蝢")
+("limbk"	"蝡")
+("limfm"	"蚽")
+("limhf"	"螈")
+("limig"	"蛭")
+("limj"	"虷")
+("limmu"	"蚖")
+("limmv"	"蜄")
+("limn"	"虰")
+("limnn"	"蛚")
+("limnr"	"蚵")
+("limob"	"蛃")
+("limrw"	"蝠")
+("limtb"	"蠣")
+("limvh"	"蚜")
+("limvm"	"蛵")
+("limwf"	"螵")
+("limwj"	"蟫")
+("limwl"	"蝒")
+("linao"	"蟓")
+("linbc"	"蝜")
+("lincr"	"蟾")
+("lindt"	"蜢")
+("linhd"	"蝚")
+("linhx"	"蜭")
+("linib"	"蛹")
+("linkg"	"蜓")
+("linkm"	"蜒")
+("linl"	"蚓")
+("linmu"	"蛫")
+("linob"	"蝑")
+("linue"	"蜬")
+("lioae"	"蝮")
+("liob"	"蚋")
+("liodi"	"蚹")
+("liog"	"蜼")
+("liogf"	"蟭")
+("lioii"	"蛉")
+("lioin"	"蚙")
+("liokr"	"蜘")
+("lioll"	"蚧")
+("liom"	"蚯")
+("liomb"	"蜦")
+("liomd"	"蜍")
+("liomn"	"蝓")
+("liomr"	"蛤")
+("lion"	"虼")
+("liono"	"蜁")
+("liopc"	"蟘")
+("liosk"	"蛜")
+("lipi"	"虳")
+("lipim"	"蚐")
+("lipou"	"蜪")
+("lipp"	"蚍")
+("lippa"	"蝔")
+("lippg"	"蜌")
+("lipr"	"蚼")
+("liptd"	"蝶")
+("liqj"	"蚌")
+("liqkd"	"螓")
+("liqmb"	"蜻")
+("liqmy"	"蝳")
+("liqo"	"蚨")
+("lirb"	"蜎")
+("lirrj"	"蟬")
+("liruc"	"蟤")
+("lirvk"	"蜈")
+("lirxu"	"蠅")
+("lirye"	"蝦")
+("lisav"	"蝘")
+("lisem"	"蠮")
+("lish"	"虭")
+("lishr"	"蛁")
+("lisjr"	"蜛")
+("lismg"	"蠗")
+("lismh"	"蟉")
+("lismi"	"蟳")
+("liso"	"蚇")
+("lisqf"	"螞")
+("lisrg"	"蟶")
+("liss"	"蚷")
+("lisyi"	"蠾")
+("lita"	"蜡")
+("litak"	"蟆")
+("litb"	"褯")
+("litbo"	"蠓")
+("litcw"	"蝤")
+("litgi"	"蟻")
+("litgu"	"蜣")
+("litit"	"蟒")
+("litlk"	"蝧")
+("litlm"	"螼")
+("litlx"	"蠨")
+("litm"	"蚶")
+("litmc"	"蜞蟥")
+("litoe"	"蠖")
+("litpd"	"蠂")
+("litq"	"蛘")
+("litrg"	"蠸")
+("litt"	"蛢")
+("litw"	"蛐")
+("litwa"	"螬")
+("litwi"	"蠛")
+("liuce"	"蝬")
+("liumt"	"螘")
+("liuob"	"蠵")
+("livii"	"蟣")
+("livis"	"蚴")
+("livl"	"虯")
+("livno"	"蝝")
+("livvv"	"蠟")
+("liwb"	"蝟")
+("liwd"	"蜾")
+("liwgf"	"蟔")
+("liwhd"	"蜠")
+("liwim"	"蟈")
+("liwli"	"蠋")
+("liwlj"	"蠌")
+("liwlv"	"蠉")
+("liwot"	"蝹")
+("liwr"	"蛔")
+("liwvf"	"螺")
+("liwww"	"蠝")
+("liyav"	"螁")
+("liybp"	"蠬")
+("liybs"	"螃")
+("liycb"	"螪")
+("liyck"	"蛟")
+("liyg"	"蛀")
+("liyhn"	"蚢")
+("liyia"	"蟙")
+("liyij"	"蟀")
+("liyj"	"蚪")
+("liyk"	"蚊")
+("liypt"	"蠦")
+("liyr"	"蛅")
+("liyra"	"蠩")
+("liyrd"	"蜳")
+("liyrn"	"蝏")
+("liyro"	"蠔")
+("liyrv"	"蠰")
+("liysd"	"蝣")
+("liytj"	"蟑")
+("liyub"	"螭")
+("liyv"	"虻")
+("liyvi"	"蚿")
+("liywm"	"蟺")
+("liyx"	"蠐")
+("ljc"	"袕")
+("ljcr"	"褣")
+("lje"	"衼")
+("ljic"	"襶")
+("ljka"	"褚")
+("ljp"	"袉")
+("lk"	"史")
+("lkbt"	"盎")
+("lkhaf"	"鴦")
+("lkld"	"袸")
+("lklu"	"裺")
+("lkma"	"襫")
+("lkoo"	"裌")
+("ll"	"串衶")
+("llamh"	"暢")
+("llbu"	"衴")
+("lldwf"	"朄")
+("llfq"	"牉")
+("llgwc"	"牘")
+("llhe"	"版")
+("llhhj"	"牌")
+("llhsb"	"牖")
+("llii"	"牋")
+("lll"	"川")
+("lllc"	"順")
+("llml"	"片")
+("llmy"	"裶")
+("lln"	"弗")
+("llomn"	"煃")
+("llp"	"患")
+("llpb"	"褙")
+("llptd"	"牒")
+("llshr"	"牊")
+("llw"	"袖")
+("llwv"	"褸")
+("llww"	"丳")
+("llxl"	"裫")
+("llybs"	"牓")
+("lma"	"袹")
+("lmbb"	"襦")
+("lmbuc"	"貴")
+("lmfbc"	"賮")
+("lmfbt"	"盡")
+("lmi"	"虫")
+("lmlb"	"裲")
+("lmln"	"劃")
+("lmmm"	"韭")
+("lmmp"	"襹")
+("lmmv"	"裖")
+("lmp"	"北")
+("lmpnl"	"邶")
+("lmrt"	"裋")
+("lmrw"	"褔")
+("lmuo"	"兆")
+("lmuoc"	"頫")
+("lmuou"	"覜")
+("lmvi"	"褥")
+("lmwf"	"褾")
+("lmwu"	"褼")
+("lmyq"	"羋")
+("lmyyn"	"剕")
+("lmyyy"	"非")
+("ln"	"鬥")
+("lnao"	"襐")
+("lnbuc"	"費")
+("lncr"	"襜")
+("lnhe"	"衱")
+("lnhxu"	"鬩")
+("lnii"	"襁")
+("lnln"	"刜")
+("lnmjk"	"鬫")
+("lnnau"	"艴")
+("lnnxu"	"鬮")
+("lnoe"	"襏")
+("lntc"	"鬨")
+("lnylb"	"鬧")
+("loae"	"複")
+("lob"	"衲")
+("lohh"	"袗")
+("loik"	"袱")
+("loim"	"襳")
+("loin"	"衿")
+("loma"	"襘")
+("lomn"	"褕")
+("lomo"	"襝")
+("lomr"	"袷")
+("lopd"	"袘")
+("lord"	"褓")
+("lp"	"忠")
+("lpb"	"背")
+("lpd"	"衪")
+("lpim"	"袀")
+("lpr"	"袧")
+("lpru"	"袍")
+("lptd"	"褋")
+("lpwtc"	"冀")
+("lq"	"聿")
+("lqhk"	"褉")
+("lqmat"	"衋")
+("lqmv"	"裱")
+("lqo"	"衭")
+("lrb"	"裐")
+("lrhg"	"裎")
+("lrrd"	"襙")
+("lrrj"	"襌")
+("lsav"	"褗")
+("lsh"	"初")
+("lshr"	"袑")
+("lsit"	"襤")
+("lsjr"	"裾")
+("lskr"	"裙")
+("lsma"	"褶")
+("lsmi"	"襑")
+("ltbi"	"襺")
+("ltco"	"襆")
+("ltgi"	"襼")
+("ltor"	"褡")
+("ltwi"	"襪")
+("ltwv"	"襛")
+("lu"	"儿")
+("lue"	"沊")
+("luhaf"	"鴆")
+("lunl"	"邥")
+("lvbu"	"胤")
+("lvhaf"	"鷜")
+("lvhqu"	"氀")
+("lvis"	"袎")
+("lvno"	"褖")
+("lvok"	"數")
+("lvr"	"袽")
+("lw"	"由")
+("lwb"	"冑胄")
+("lwd"	"裸裍")
+("lwg"	"裡")
+("lwk"	"裀")
+("lwl"	"申")
+("lwli"	"襡")
+("lwlj"	"襗")
+("lwlp"	"襬")
+("lwlv"	"婁")
+("lwmvs"	"甹")
+("lwot"	"褞")
+("lwp"	"曳")
+("lx"	"肅")
+("lxhaf"	"鷫")
+("lyav"	"褪")
+("lybb"	"褅")
+("lybp"	"襱")
+("lyd"	"棐")
+("lydu"	"襯")
+("lyiu"	"裗")
+("lyjj"	"褳")
+("lyjwj"	"輩")
+("lyk"	"奜")
+("lylmi"	"蜚")
+("lyoiv"	"餥")
+("lyp"	"悲")
+("lysmm"	"翡")
+("lyto"	"襚")
+("lyub"	"褵")
+("lyv"	"婓")
+("lyvi"	"袨")
+("lywm"	"襢")
+("lyyhv"	"裴")
+("lyyk"	"斐")
+("m"	"一")
+("ma"	"百")
+("mabk"	"厭")
+("mad"	"櫫")
+("mahr"	"厬")
+("mai"	"戩")
+("mama"	"皕")
+("mamr"	"碧")
+("mand"	"厚")
+("manl"	"鄑")
+("mbbhg"	"霾")
+("mbbhv"	"霢")
+("mbbmo"	"霥")
+("mbcsh"	"雰")
+("mbdbu"	"霜")
+("mbdd"	"霖")
+("mbddh"	"霦")
+("mbdi"	"耐")
+("mbebg"	"霪")
+("mbebr"	"霘")
+("mbed"	"霂")
+("mbejb"	"霈")
+("mbemm"	"靋")
+("mbeni"	"霐")
+("mbetc"	"霟")
+("mbetv"	"霮")
+("mbeyr"	"霑")
+("mbfb"	"霄")
+("mbhaf"	"鴯鷊鸍")
+("mbhfd"	"雽")
+("mbhhh"	"耏")
+("mbhhw"	"霤")
+("mbhok"	"霺")
+("mbhxu"	"霓")
+("mbjlv"	"霋")
+("mbk"	"耎")
+("mbks"	"勵")
+("mblbk"	"雵")
+("mbll"	"而")
+("mblmi"	"融")
+("mblmo"	"雿")
+("mblmy"	"霏")
+("mbm"	"亙")
+("mbmbl"	"需")
+("mbmdm"	"靂")
+("mbmgi"	"璽")
+("mbmmi"	"雲")
+("mbmms"	"雩")
+("mbmmv"	"震")
+("mbnhs"	"霧")
+("mbnhu"	"霿")
+("mbnih"	"雺")
+("mbnkg"	"霆")
+("mbnl"	"邴")
+("mbnot"	"霯")
+("mboah"	"鬺")
+("mbog"	"霍")
+("mbogg"	"靃")
+("mboii"	"零")
+("mbowy"	"霉")
+("mbp"	"恧")
+("mbphe"	"憂")
+("mbpru"	"雹")
+("mbrbc"	"霣")
+("mbrji"	"霵")
+("mbrmr"	"露")
+("mbrrm"	"靈")
+("mbrrr"	"霝")
+("mbrye"	"霞")
+("mbsfi"	"霨")
+("mbsm"	"雪")
+("mbsma"	"霫")
+("mbsmm"	"翮")
+("mbsrj"	"霹")
+("mbtbk"	"霰")
+("mbtjb"	"霸")
+("mbtlk"	"霙")
+("mbtm"	"雸")
+("mbuc"	"頁貢")
+("mbuce"	"鬷")
+("mbv"	"耍")
+("mbw"	"雷")
+("mbwtc"	"霬")
+("mbwu"	"電")
+("mbybp"	"靇")
+("mbydl"	"霩")
+("mbyhs"	"雱")
+("mbyk"	"雯")
+("mbymr"	"霅")
+("mbyrv"	"靄")
+("mbytn"	"霠")
+("mbytv"	"霎")
+("mbyx"	"霽")
+("mche"	"夒")
+("mcw"	"西")
+("mcwm"	"酉")
+("md"	"于")
+("mda"	"曆")
+("mdbt"	"盂")
+("mdhaf"	"鷅")
+("mdm"	"五")
+("mdmr"	"磿")
+("mdnl"	"邘")
+("mdylm"	"歷")
+("me"	"汞")
+("mem"	"亟")
+("menl"	"鄾")
+("mf"	"不")
+("mfbk"	"爾")
+("mfbq"	"甭")
+("mfbt"	"盃")
+("mfbuc"	"贗")
+("mfbuu"	"覝")
+("mfhaf"	"鴀")
+("mfhhh"	"彯")
+("mfhni"	"飄")
+("mfhvo"	"瓢")
+("mfj"	"平")
+("mfk"	"奀")
+("mfln"	"剽")
+("mfm"	"丕")
+("mfmbc"	"願顠")
+("mfmym"	"歪")
+("mfnl"	"鄢")
+("mfp"	"愿")
+("mfr"	"否")
+("mfsmm"	"翲")
+("mfvnd"	"孬")
+("mg"	"王")
+("mgaa"	"琩")
+("mgabu"	"瑁")
+("mgahm"	"瑋")
+("mgahu"	"瑊")
+("mgamh"	"獂")
+("mgapp"	"琨")
+("mgau"	"琶")
+("mgayf"	"璟")
+("mgayk"	"琝")
+("mgb"	"再玥")
+("mgbbe"	"璦")
+("mgbcd"	"琛")
+("mgbcv"	"瓔")
+("mgbgr"	"琱")
+("mgbjj"	"琿")
+("mgbm"	"珇")
+("mgbme"	"猺")
+("mgbnd"	"琈")
+("mgbou"	"瑤")
+("mgbsd"	"琤")
+("mgbt"	"珊")
+("mgbuc"	"珼")
+("mgbuu"	"現")
+("mgby"	"玬")
+("mgcnh"	"珶")
+("mgcsh"	"玢")
+("mgcwa"	"璔")
+("mgdd"	"琳")
+("mgdhe"	"玻")
+("mgdk"	"玦")
+("mgdmq"	"猼")
+("mgegi"	"琺")
+("mgeii"	"瑵")
+("mgfbc"	"瑣")
+("mgfbw"	"璫")
+("mgfdq"	"璘")
+("mgff"	"琰")
+("mgfmu"	"珖")
+("mggb"	"珃")
+("mggg"	"珪")
+("mggnf"	"瓙")
+("mggsk"	"璈")
+("mgha"	"珀")
+("mghae"	"瑑")
+("mghaf"	"鳿")
+("mghby"	"珘")
+("mghdn"	"琍")
+("mghds"	"琇")
+("mghdw"	"璠")
+("mgher"	"珞")
+("mghgu"	"珗")
+("mghhl"	"珋")
+("mghi"	"瑰")
+("mghjd"	"珠")
+("mghlb"	"獀")
+("mghnb"	"珮")
+("mghon"	"珩")
+("mghoo"	"瑽")
+("mghqi"	"珴")
+("mghuc"	"瓚")
+("mghwp"	"璁")
+("mghxc"	"璵")
+("mgi"	"玉玊")
+("mgiav"	"琅")
+("mgihr"	"犎")
+("mgihs"	"臹")
+("mgii"	"琖")
+("mgiil"	"瑯")
+("mgije"	"球")
+("mgilg"	"班")
+("mgilr"	"瑭")
+("mgir"	"珆")
+("mgisk"	"璷")
+("mgjbc"	"瑱")
+("mgjch"	"獊")
+("mgjcr"	"瑢")
+("mgjii"	"瑼")
+("mgjmc"	"璸")
+("mgjmf"	"琮")
+("mgjmm"	"犐")
+("mgjnu"	"琬")
+("mgjrb"	"瑚")
+("mgjrr"	"琯")
+("mgkb"	"珛")
+("mgkkb"	"琋")
+("mgkld"	"珔")
+("mgkmr"	"琦")
+("mgksr"	"珈")
+("mglll"	"玔")
+("mglmo"	"珧")
+("mglmt"	"璶")
+("mglmy"	"琲")
+("mgln"	"到")
+("mglq"	"珒")
+("mglwl"	"珅")
+("mgm"	"玒")
+("mgmbb"	"瓀")
+("mgmbc"	"頊")
+("mgmd"	"玗")
+("mgmfj"	"玶")
+("mgmg"	"玨")
+("mgmgh"	"璱")
+("mgmhl"	"琊")
+("mgmig"	"臸")
+("mgmj"	"玕")
+("mgmmr"	"珸")
+("mgmmu"	"玩")
+("mgmn"	"玎")
+("mgmnr"	"珂")
+("mgmso"	"琢")
+("mgmvh"	"玡")
+("mgmvn"	"甄")
+("mgmwd"	"瑮")
+("mgnbe"	"瓊")
+("mgnbk"	"瑒")
+("mgnhb"	"璚")
+("mgnkg"	"珽")
+("mgnl"	"郅鄄")
+("mgno"	"玖歅")
+("mgnot"	"璒")
+("mgohh"	"珍")
+("mgoii"	"玲")
+("mgoin"	"琴")
+("mgoip"	"玳")
+("mgoir"	"琀瑲")
+("mgoj"	"玝")
+("mgok"	"玫致")
+("mgoll"	"玠")
+("mgoma"	"璯")
+("mgomn"	"瑜")
+("mgomr"	"珨")
+("mgono"	"琁")
+("mgpa"	"珣")
+("mgph"	"瑟珌")
+("mgpi"	"玓")
+("mgpp"	"琵玭")
+("mgppa"	"瑄")
+("mgpru"	"玸")
+("mgpt"	"玴")
+("mgqj"	"玤")
+("mgqkd"	"臻瑧")
+("mgqkq"	"琫")
+("mgrb"	"琄")
+("mgrhg"	"珵")
+("mgrmr"	"璐")
+("mgrr"	"噩")
+("mgrrd"	"璪")
+("mgrye"	"瑕")
+("mgryo"	"珿")
+("mgshr"	"玿")
+("mgsj"	"珥")
+("mgsjr"	"琚")
+("mgskr"	"珺")
+("mgsmh"	"璆")
+("mgsmi"	"璕")
+("mgsmj"	"璻")
+("mgsmm"	"珝")
+("mgsqf"	"瑪")
+("mgt"	"弄")
+("mgtbc"	"琠")
+("mgtbn"	"獉")
+("mgtc"	"珙")
+("mgtco"	"璞")
+("mgtgt"	"瓂")
+("mgtlb"	"璊")
+("mgtlk"	"瑛")
+("mgtlm"	"瑾")
+("mgtm"	"玵")
+("mgtmc"	"琪璜")
+("mgtod"	"瑹")
+("mgtoe"	"瓁")
+("mgtq"	"珜")
+("mgtqm"	"瑳")
+("mgtrg"	"瓘")
+("mgtrk"	"璥")
+("mgumb"	"瑞")
+("mguob"	"瓗")
+("mguog"	"璀")
+("mguon"	"琌")
+("mgvid"	"瓅")
+("mgvii"	"璣")
+("mgvne"	"琭")
+("mgvno"	"猻")
+("mgvvd"	"璅")
+("mgvvw"	"瑙")
+("mgwg"	"理")
+("mgwk"	"珚")
+("mgwl"	"玾")
+("mgwlv"	"環")
+("mgwww"	"瓃")
+("mgybj"	"璭")
+("mgybk"	"瓛")
+("mgybp"	"瓏")
+("mgybu"	"璿")
+("mgyck"	"珓")
+("mgyed"	"璨")
+("mgyfe"	"琡")
+("mgyiu"	"琉珫")
+("mgyjj"	"璉")
+("mgyk"	"玟")
+("mgykg"	"斑")
+("mgymp"	"玼")
+("mgyog"	"璡")
+("mgypo"	"璩")
+("mgypu"	"琥")
+("mgyr"	"玷")
+("mgyrv"	"瓖")
+("mgyso"	"璇")
+("mgytj"	"璋")
+("mgyto"	"璲")
+("mgytr"	"琣")
+("mgyub"	"璃")
+("mgyvi"	"玹")
+("mgyx"	"璾")
+("mgyyb"	"瓋")
+("mh"	"厂")
+("mhaf"	"原")
+("mhdd"	"厤")
+("mhhaf"	"鴉")
+("mhjm"	"厜")
+("mhnl"	"邪")
+("mhog"	"雅")
+("mhoiv"	"餮")
+("mhpm"	"厎")
+("mhs"	"厏")
+("mibbe"	"靉")
+("mig"	"至")
+("mihi"	"魂")
+("miia"	"晉")
+("minl"	"鄏")
+("mioin"	"霒")
+("miuh"	"厖")
+("miyle"	"靆")
+("mj"	"干")
+("mjbc"	"厧")
+("mjf"	"烎")
+("mjhaf"	"鳱鷣")
+("mjixp"	"麉")
+("mjln"	"刊")
+("mjmbc"	"頇")
+("mjnl"	"邗")
+("mjok"	"敢")
+("mjwj"	"厙")
+("mk"	"天")
+("mkg"	"壓")
+("mkhi"	"魘")
+("mkhqm"	"甦")
+("mkmwl"	"靨")
+("mknl"	"郠")
+("mkoiv"	"饜")
+("mkp"	"憨")
+("mks"	"功")
+("mkv"	"嬮")
+("mkwgf"	"黶")
+("mkwl"	"厴")
+("ml"	"丌")
+("mlbo"	"兩")
+("mlby"	"雨")
+("mllm"	"亞")
+("mlm"	"工")
+("mlmy"	"厞")
+("mlvs"	"丏")
+("mlwk"	"更")
+("mm"	"二")
+("mmbbp"	"麗")
+("mmbc"	"項")
+("mmf"	"示")
+("mmg"	"堊")
+("mmhaf"	"鵡鵛")
+("mmi"	"云")
+("mmig"	"厔")
+("mmks"	"勁")
+("mml"	"亓")
+("mmlmi"	"蝁")
+("mmln"	"剄")
+("mmm"	"三")
+("mmmbc"	"頸")
+("mmmv"	"辰")
+("mmn"	"亍")
+("mmnl"	"邳")
+("mmok"	"政")
+("mmp"	"惡")
+("mmr"	"吾")
+("mmu"	"元")
+("mmuu"	"黿")
+("mmvh"	"厊")
+("mmvn"	"瓨")
+("mmvs"	"巧")
+("mmyiu"	"巰")
+("mmypu"	"虣")
+("mn"	"丁")
+("mnbm"	"殂")
+("mnbnd"	"殍")
+("mnc"	"銎")
+("mnf"	"烈")
+("mng"	"型")
+("mngbt"	"殪")
+("mngwc"	"殰")
+("mnhaf"	"殦鴷")
+("mnhbt"	"殈")
+("mnhjd"	"殊")
+("mnhk"	"殀")
+("mnhpa"	"殙")
+("mnhuk"	"殠")
+("mni"	"歹")
+("mnii"	"殘")
+("mnije"	"殏")
+("mnir"	"殆")
+("mnjbm"	"殖")
+("mnjmc"	"殯殥")
+("mnjru"	"殑")
+("mnklu"	"殗")
+("mnkoo"	"殎")
+("mnkpb"	"殢")
+("mnl"	"邛")
+("mnlbk"	"殃")
+("mnle"	"殔")
+("mnlmi"	"蛩")
+("mnln"	"列")
+("mnlq"	"肂")
+("mnmbc"	"頂")
+("mnmem"	"殛")
+("mnmvm"	"殌")
+("mnmwm"	"殭")
+("mnne"	"歿")
+("mnnwf"	"鮤")
+("mnoah"	"殤")
+("mnohh"	"殄")
+("mnoim"	"殲")
+("mnomo"	"殮")
+("mnp"	"死恐")
+("mnpa"	"殉")
+("mnphh"	"歾")
+("mnr"	"可")
+("mnrbc"	"殞")
+("mnrrj"	"殫")
+("mnryo"	"跫")
+("mntlj"	"鞏")
+("mntlm"	"殣")
+("mnv"	"姴")
+("mnwot"	"殟")
+("mnyfu"	"殧")
+("mnyhv"	"裂")
+("mnytr"	"殕")
+("mo"	"仄")
+("moau"	"豝")
+("moav"	"豤")
+("mob"	"丙")
+("mobuu"	"覡")
+("mobvk"	"豯")
+("mof"	"燹")
+("mogbt"	"豷")
+("mohaf"	"鷢")
+("mohf"	"鴈")
+("mohoo"	"豵")
+("mohsn"	"豟")
+("mojka"	"豬")
+("mojtc"	"豶")
+("moju"	"厒")
+("mok"	"攻")
+("mokkb"	"豨")
+("molmi"	"蟨")
+("moln"	"劂")
+("momhf"	"豲")
+("momso"	"豩")
+("momt"	"豜")
+("moo"	"巫")
+("moog"	"雁")
+("morye"	"豭")
+("mowot"	"豱")
+("moyvo"	"豥")
+("mphaf"	"鸝")
+("mpnl"	"酈")
+("mpylm"	"武")
+("mr"	"石")
+("mramh"	"碭")
+("mrapv"	"碣")
+("mrav"	"硍")
+("mrbb"	"硼")
+("mrbbr"	"碢")
+("mrbgr"	"碉")
+("mrbj"	"鞷")
+("mrbl"	"鬲")
+("mrbm"	"砠")
+("mrbmr"	"硐")
+("mrbsd"	"碀")
+("mrbtu"	"碙")
+("mrbuu"	"硯")
+("mrbvk"	"磎")
+("mrby"	"砃")
+("mrcsh"	"砏")
+("mrcwa"	"磳")
+("mrdam"	"碴")
+("mrdci"	"硹")
+("mrdd"	"碄")
+("mrddo"	"礎")
+("mrdhe"	"破")
+("mrdm"	"砵")
+("mre"	"泵砅")
+("mreed"	"磉")
+("mresd"	"磲")
+("mrfb"	"硝")
+("mrfbw"	"礑")
+("mrfdq"	"磷")
+("mrfff"	"礯")
+("mrfh"	"砂")
+("mrgg"	"硅")
+("mrggu"	"磽")
+("mrgi"	"砝")
+("mrgit"	"磕")
+("mrgr"	"硈")
+("mrgrr"	"礂")
+("mrgsk"	"磝")
+("mrhdw"	"磻")
+("mrher"	"硌")
+("mrhgr"	"硞")
+("mrhhj"	"碑")
+("mrhi"	"磈")
+("mrhio"	"砭")
+("mrhjd"	"硃")
+("mrhje"	"碫")
+("mrhjm"	"硾")
+("mrhkb"	"礄")
+("mrhlc"	"礩")
+("mrhml"	"斫")
+("mrhne"	"砓")
+("mrhp"	"矺")
+("mrhpm"	"砥")
+("mrhqi"	"硪")
+("mrhs"	"砟")
+("mrhsb"	"碥")
+("mrhsk"	"礉")
+("mrhsn"	"砨")
+("mrhuc"	"礸")
+("mrhyu"	"磃")
+("mriav"	"硠")
+("mrie"	"砯")
+("mrihf"	"磩")
+("mriih"	"磣")
+("mrilr"	"磄")
+("mritc"	"礦")
+("mriuh"	"硥")
+("mrjbc"	"磌")
+("mrjcm"	"硿")
+("mrjii"	"磚")
+("mrjmc"	"礗")
+("mrjmo"	"碇")
+("mrjnu"	"碗")
+("mrjp"	"砣")
+("mrjqr"	"磍")
+("mrjwj"	"硨")
+("mrkkk"	"磢")
+("mrkmr"	"碕")
+("mrkoo"	"硤")
+("mrlln"	"砩")
+("mrlq"	"硉")
+("mrlwl"	"砷")
+("mrm"	"矼")
+("mrmbb"	"礝")
+("mrmbc"	"碩")
+("mrmbg"	"礭")
+("mrmbu"	"礵")
+("mrmbw"	"礌")
+("mrmcw"	"硒")
+("mrmfj"	"砰")
+("mrmgi"	"砡")
+("mrmj"	"矸")
+("mrmlk"	"硬")
+("mrmnr"	"砢")
+("mrmpm"	"碔")
+("mrmr"	"砳")
+("mrmrr"	"磊")
+("mrmt"	"研")
+("mrmtb"	"礪")
+("mrmtn"	"硎")
+("mrmu"	"矹")
+("mrmvb"	"磭")
+("mrmvh"	"砑")
+("mrmvm"	"硜")
+("mrmwj"	"磹")
+("mrmwm"	"礓")
+("mrnbg"	"确")
+("mrnd"	"矷")
+("mrnhe"	"砐")
+("mrni"	"矽")
+("mrnl"	"郚酃")
+("mrnmu"	"硊")
+("mrno"	"砍歌")
+("mrnot"	"磴")
+("mrnqd"	"磔")
+("mrnr"	"哥")
+("mrobg"	"確")
+("mrog"	"碓")
+("mrogd"	"磼")
+("mrogf"	"礁")
+("mroii"	"砱")
+("mrok"	"敔")
+("mroll"	"砎")
+("mromb"	"碖")
+("mromd"	"硢")
+("mron"	"矻")
+("mrpko"	"礙")
+("mrpp"	"砒")
+("mrpru"	"砲")
+("mrpsh"	"砌")
+("mrptd"	"碟")
+("mrqmb"	"碃")
+("mrqmc"	"磧")
+("mrqmy"	"碡")
+("mrqo"	"砆")
+("mrrrj"	"磾")
+("mrrrk"	"礹")
+("mrrye"	"碬")
+("mrsec"	"礥")
+("mrsit"	"礛")
+("mrslb"	"砸")
+("mrsmh"	"磟")
+("mrsqf"	"碼")
+("mrsrj"	"礔")
+("mrstv"	"碾")
+("mrt"	"豆")
+("mrta"	"碏")
+("mrtbc"	"碘")
+("mrtbf"	"礤")
+("mrtbo"	"礞")
+("mrtgi"	"礒")
+("mrtii"	"礡")
+("mrtlk"	"碤")
+("mrtmc"	"磺")
+("mrtmv"	"碪")
+("mrtqm"	"磋")
+("mrttc"	"碰")
+("mrtvi"	"磁")
+("mrtvs"	"磡")
+("mrtwi"	"礣")
+("mrtxc"	"磏")
+("mrtyv"	"硭")
+("mrubb"	"磞")
+("mrumf"	"碳")
+("mrumt"	"磑")
+("mruog"	"磪")
+("mrvid"	"礫")
+("mrvii"	"磯")
+("mrvne"	"碌")
+("mrwd"	"硱")
+("mrwhd"	"碅")
+("mrwmv"	"碨")
+("mrwvf"	"磥")
+("mrwww"	"礧")
+("mrwyi"	"砪")
+("mrybb"	"碲")
+("mrybs"	"磅")
+("mrydk"	"礅")
+("mryg"	"砫")
+("mryiu"	"硫")
+("mryoj"	"碎")
+("mryr"	"砧")
+("mryrb"	"碻")
+("mryrn"	"碠")
+("mryt"	"砬")
+("mrytr"	"碚")
+("mrywi"	"磠")
+("ms"	"万")
+("msho"	"豕")
+("msko"	"豖")
+("msnl"	"鄠")
+("msok"	"攷")
+("msu"	"厄")
+("mt"	"幵")
+("mta"	"厝")
+("mthaf"	"鳽")
+("mthhh"	"形")
+("mthhj"	"豍")
+("mtje"	"豉")
+("mtjnu"	"豌")
+("mtln"	"刑")
+("mtm"	"豇")
+("mtmbc"	"頭")
+("mtnl"	"邢郖")
+("mtog"	"雃")
+("mtq"	"揅")
+("mttxc"	"豏")
+("mtuo"	"厥")
+("mtwb"	"厲")
+("mu"	"兀兀")
+("mua"	"朁")
+("muali"	"蠶")
+("mub"	"襾")
+("muhe"	"夏")
+("mui"	"戛")
+("mukll"	"奡")
+("mulmi"	"虺")
+("muln"	"刓")
+("mumbc"	"頑")
+("mumrb"	"鬵")
+("mumso"	"豗")
+("munl"	"邧")
+("munmu"	"卼")
+("mv"	"匚")
+("mvb"	"脣")
+("mvdh"	"牙")
+("mvdi"	"辱")
+("mvku"	"旡")
+("mvlmi"	"蜃")
+("mvni"	"瓦")
+("mvnm"	"互")
+("mvphh"	"覅")
+("mvr"	"唇")
+("mvvm"	"巠")
+("mwahm"	"醒")
+("mwaj"	"覃")
+("mwamo"	"醍")
+("mwbdi"	"酹")
+("mwbmr"	"酮")
+("mwbuc"	"賈")
+("mwbuu"	"靦")
+("mwbwi"	"釂")
+("mwcsh"	"酚")
+("mwd"	"栗")
+("mwdd"	"醂")
+("mwdi"	"酎")
+("mweee"	"醊")
+("mwfd"	"粟")
+("mwg"	"厘垔")
+("mwhaf"	"鶝")
+("mwhd"	"酥")
+("mwher"	"酪")
+("mwhgf"	"醺")
+("mwhgr"	"酷")
+("mwhi"	"醜")
+("mwhio"	"覂")
+("mwhne"	"酘")
+("mwhoe"	"覆")
+("mwhqu"	"酕")
+("mwhs"	"酢")
+("mwhsk"	"覈")
+("mwhxe"	"醙")
+("mwice"	"酸")
+("mwidd"	"醾")
+("mwii"	"醆")
+("mwijb"	"酺")
+("mwill"	"酬")
+("mwilr"	"醣")
+("mwjcs"	"醡")
+("mwjka"	"醏")
+("mwjkd"	"酵")
+("mwjp"	"酡")
+("mwjr"	"酤")
+("mwjrb"	"醐")
+("mwklu"	"醃")
+("mwkrt"	"醢")
+("mwlbu"	"酖")
+("mwlii"	"蠠")
+("mwlkt"	"醠")
+("mwln"	"副")
+("mwlut"	"醓")
+("mwmbb"	"醹")
+("mwmbr"	"醽")
+("mwmj"	"酐")
+("mwmmf"	"票")
+("mwmmp"	"釃")
+("mwmn"	"酊")
+("mwmnr"	"酠")
+("mwmwf"	"醥")
+("mwmwj"	"醰")
+("mwnir"	"酩")
+("mwnob"	"醑")
+("mwnoe"	"醱")
+("mwog"	"醀")
+("mwogf"	"醮")
+("mwomd"	"酴")
+("mwpa"	"酯")
+("mwpd"	"酏")
+("mwpi"	"酌")
+("mwpou"	"醄")
+("mwrhg"	"酲")
+("mwrrk"	"釅")
+("mwsmh"	"醪")
+("mwsrr"	"醧")
+("mwsu"	"配")
+("mwta"	"醋")
+("mwtco"	"醭")
+("mwtlf"	"醼")
+("mwtm"	"酣")
+("mwtog"	"醛")
+("mwtqm"	"醝")
+("mwtwt"	"醴")
+("mwtwv"	"醲")
+("mwuk"	"酗")
+("mwv"	"要")
+("mwvib"	"酳")
+("mwvne"	"醁")
+("mwwlj"	"醳")
+("mwwot"	"醞")
+("mwyfd"	"醚")
+("mwyl"	"面")
+("mwyoj"	"醉")
+("mwypo"	"醵")
+("mwyr"	"酟")
+("mwyrd"	"醇")
+("mwyrv"	"釀")
+("mwytp"	"醷")
+("mwytr"	"醅")
+("mwyub"	"醨")
+("mwyut"	"醯")
+("my"	"下")
+("mylf"	"焉")
+("mylm"	"正")
+("myp"	"忑")
+("mytj"	"厗")
+("myvs"	"丐")
+("n"	"弓")
+("nahu"	"免")
+("napo"	"象")
+("nau"	"色弝")
+("nbam"	"觛")
+("nbb"	"弸")
+("nbbue"	"敻")
+("nbdk"	"觖")
+("nbdl"	"觫")
+("nbfmu"	"觥")
+("nbg"	"角墮")
+("nbgg"	"觟")
+("nbhaf"	"鷸")
+("nbher"	"觡")
+("nbhpm"	"觝")
+("nbhqu"	"氄")
+("nbhvo"	"觚")
+("nbhxu"	"觬")
+("nbije"	"觩")
+("nbjka"	"觰")
+("nbk"	"奐")
+("nbkmr"	"觭")
+("nbks"	"勇觔")
+("nblmi"	"触")
+("nbln"	"劀")
+("nbme"	"觨")
+("nbmgi"	"瓕")
+("nbnbe"	"觼")
+("nbnhe"	"觙")
+("nbnmu"	"觤")
+("nboah"	"觴")
+("nbop"	"隳")
+("nbp"	"恿")
+("nbrrj"	"觶")
+("nbshq"	"解")
+("nbtgq"	"觲")
+("nbtlf"	"觾")
+("nbu"	"嶞")
+("nbuc"	"負")
+("nbue"	"彏")
+("nbuob"	"觿")
+("nbvid"	"觻")
+("nbvl"	"觓")
+("nbwli"	"觸")
+("nbyj"	"斛")
+("nc"	"小")
+("ncymr"	"詹")
+("nd"	"子")
+("ndbt"	"孟")
+("ndhaf"	"鶔")
+("ndhvf"	"孫")
+("ndhvo"	"孤")
+("ndjmf"	"孮")
+("ndlmt"	"孻")
+("ndmbb"	"孺")
+("ndmlm"	"孲")
+("ndnd"	"孖")
+("ndok"	"孜")
+("ndpru"	"孢")
+("ndu"	"孔")
+("ndyvo"	"孩")
+("ne"	"氶")
+("nem"	"丞")
+("nemb"	"脀")
+("nemf"	"烝")
+("nemsu"	"巹")
+("nfaa"	"鯧")
+("nfagi"	"鰣")
+("nfail"	"鯽")
+("nfamo"	"鯷")
+("nfapp"	"鯤")
+("nfasm"	"鰨")
+("nfawe"	"鰻")
+("nfb"	"弰")
+("nfbgr"	"鯛")
+("nfbmr"	"鮦")
+("nfbof"	"鰶")
+("nfbou"	"鰩")
+("nfcru"	"鮵")
+("nfcsh"	"魵")
+("nfdn"	"粥")
+("nfdoo"	"鯠")
+("nffb"	"鮹")
+("nffba"	"鱨")
+("nffdq"	"鱗")
+("nffh"	"魦")
+("nfgce"	"鯪")
+("nfgcg"	"鯥")
+("nfgg"	"鮭")
+("nfggu"	"鱙")
+("nfgi"	"魼")
+("nfgr"	"鮚")
+("nfhag"	"鰉")
+("nfhd"	"穌")
+("nfhdd"	"鯚")
+("nfhdf"	"鰍")
+("nfhdw"	"鱕")
+("nfhe"	"魬")
+("nfher"	"鮥")
+("nfhhw"	"鰡")
+("nfhir"	"鱵")
+("nfhjd"	"鮢")
+("nfhkb"	"鱎")
+("nfhor"	"鯦")
+("nfhp"	"魠")
+("nfhrb"	"鰤")
+("nfhs"	"鮓")
+("nfhvf"	"鯀")
+("nfhxc"	"鱮")
+("nfhxh"	"鯓")
+("nfhxu"	"鯢")
+("nfihr"	"鰔")
+("nfijb"	"鯆")
+("nfije"	"鯄")
+("nfiku"	"魷")
+("nfir"	"鮐")
+("nfjcr"	"鰫")
+("nfjd"	"鮇")
+("nfjii"	"鱄")
+("nfjmu"	"鯇")
+("nfjp"	"鮀")
+("nfjpa"	"鰭")
+("nfjr"	"鮕")
+("nfjrb"	"鰗")
+("nfkb"	"鮪")
+("nflmo"	"鮡")
+("nflmy"	"鯡")
+("nflx"	"鱐")
+("nfm"	"魟")
+("nfmbl"	"鮞")
+("nfmbm"	"鱈")
+("nfmfm"	"魾")
+("nfmgr"	"鱷")
+("nfmlk"	"鯁")
+("nfmmp"	"鱺")
+("nfmmr"	"鯃")
+("nfmnr"	"魺")
+("nfmtb"	"鱱")
+("nfmto"	"鱖")
+("nfmvm"	"魱")
+("nfmwf"	"鰾")
+("nfnao"	"鱌")
+("nfnau"	"鮸")
+("nfnhb"	"鱊")
+("nfnhd"	"鰇")
+("nfnkq"	"鰎")
+("nfnmu"	"鮠")
+("nfnoe"	"鱍")
+("nfoae"	"鰒")
+("nfob"	"魶")
+("nfodi"	"鮒")
+("nfoip"	"鯰")
+("nfold"	"鰷")
+("nfoma"	"鱠")
+("nfomd"	"鮽")
+("nfomr"	"鮯")
+("nfonk"	"鯸")
+("nfop"	"魤")
+("nfp"	"愻")
+("nfpa"	"鮨")
+("nfph"	"鮅")
+("nfpi"	"魡")
+("nfpr"	"鮈")
+("nfpru"	"鮑")
+("nfptd"	"鰈")
+("nfpu"	"魨")
+("nfqka"	"鰆")
+("nfqmb"	"鯖")
+("nfqmc"	"鰿")
+("nfrrd"	"鱢")
+("nfrxu"	"鱦")
+("nfsav"	"鰋")
+("nfseg"	"鰹")
+("nfsh"	"魛")
+("nfsje"	"鯫")
+("nfsju"	"鮿")
+("nfskr"	"鮶")
+("nfsma"	"鰼")
+("nfsmb"	"鯞")
+("nfsmi"	"鱘")
+("nftgr"	"鱔")
+("nftjs"	"鰳")
+("nftm"	"魽")
+("nftmc"	"鯕")
+("nftq"	"鮮")
+("nftrg"	"鱹")
+("nftwa"	"鰽")
+("nftwi"	"鱒鱴")
+("nftwt"	"鱧")
+("nftxc"	"鰜")
+("nfvid"	"鱳")
+("nfvvw"	"鯔")
+("nfwg"	"鯉")
+("nfwl"	"魻")
+("nfwlb"	"鰅")
+("nfwle"	"鰥")
+("nfwlv"	"鱞")
+("nfwo"	"鮂")
+("nfwp"	"鰓")
+("nfyck"	"鮫")
+("nfyhn"	"魧")
+("nfyhs"	"魴")
+("nfyjj"	"鰱")
+("nfyk"	"魰")
+("nfymf"	"鮛")
+("nfymo"	"鱁")
+("nfypk"	"鰬")
+("nfypm"	"鱋")
+("nfypt"	"鱸")
+("nfyrb"	"鰝")
+("nfyrd"	"鯙")
+("nfyrf"	"鯨")
+("nfytj"	"鱆")
+("nfytv"	"鯜")
+("nfywm"	"鱣")
+("nfyx"	"鱭")
+("ng"	"丑")
+("ngmbc"	"頲")
+("ngmwm"	"疆")
+("nhbcr"	"矞")
+("nhd"	"柔")
+("nhe"	"及")
+("nhli"	"虱")
+("nhlii"	"蟊")
+("nhoin"	"矜")
+("nhoks"	"務")
+("nhpm"	"弤")
+("nhs"	"乃")
+("nhsqf"	"騭")
+("nhta"	"矠")
+("nhvo"	"弧")
+("ni"	"夕弘")
+("nibq"	"甬")
+("nihaf"	"鵵")
+("nijmc"	"夤")
+("nili"	"強")
+("niln"	"劖")
+("ninh"	"矛")
+("nini"	"多")
+("ninl"	"酁")
+("ninn"	"予")
+("nioiv"	"飧")
+("niq"	"舛")
+("nir"	"名")
+("nisu"	"夗")
+("niy"	"外")
+("niymr"	"謽")
+("njhaf"	"鳵")
+("njlii"	"蝨")
+("nk"	"又")
+("nkbu"	"瞀")
+("nkc"	"鍪")
+("nkd"	"楘")
+("nkf"	"煞")
+("nkg"	"堥")
+("nkhaf"	"鶩")
+("nkhg"	"廷")
+("nkhml"	"郔")
+("nkhym"	"延")
+("nki"	"戣")
+("nklmi"	"蝥")
+("nklq"	"建")
+("nknl"	"鄈")
+("nksqf"	"騖")
+("nktlj"	"鞪")
+("nkv"	"婺")
+("nl"	"弔引")
+("nlamh"	"陽")
+("nlamo"	"隄")
+("nlav"	"限")
+("nlavf"	"隰")
+("nlbm"	"阻")
+("nlbmp"	"隱")
+("nlbof"	"際")
+("nlbt"	"盄")
+("nldhe"	"陂")
+("nldw"	"陳")
+("nldwk"	"敶")
+("nlfhf"	"隙")
+("nlgce"	"陵")
+("nlgcg"	"陸")
+("nlggu"	"隢")
+("nlgi"	"阹")
+("nlgsk"	"隞")
+("nlgyo"	"陡")
+("nlhag"	"隍")
+("nlhbk"	"隩")
+("nlhe"	"阪")
+("nlhem"	"隆")
+("nlheq"	"降")
+("nlhhj"	"陴")
+("nlhi"	"隗")
+("nlhj"	"阡")
+("nlhjd"	"陎")
+("nlhjg"	"隀")
+("nlhjm"	"陲")
+("nlhpm"	"阺")
+("nlhs"	"阼")
+("nlhtg"	"陞")
+("nlhxg"	"隉")
+("nlihu"	"阭")
+("nlihv"	"隇")
+("nljka"	"陼")
+("nljmu"	"院")
+("nljp"	"陀")
+("nljwj"	"陣")
+("nlkb"	"陏")
+("nlkmb"	"隋")
+("nlkmm"	"隓")
+("nlkmr"	"陭")
+("nlkms"	"陓")
+("nlkoo"	"陝陜")
+("nlks"	"阞")
+("nllmc"	"隤")
+("nllmy"	"陫")
+("nlma"	"陌")
+("nlmbk"	"陾")
+("nlmbl"	"陑")
+("nlmbv"	"陋")
+("nlmfb"	"隬")
+("nlmmu"	"阮")
+("nlmnr"	"阿")
+("nlmob"	"陃")
+("nlmrb"	"隔")
+("nlmsu"	"阨")
+("nlmu"	"阢")
+("nlmvm"	"陘")
+("nlnhx"	"陷")
+("nlnin"	"陊")
+("nlnj"	"阠")
+("nlodi"	"附")
+("nloii"	"陰")
+("nlomb"	"陯")
+("nlomd"	"除")
+("nlomn"	"隃")
+("nlomo"	"險")
+("nlon"	"阣")
+("nlpd"	"阤")
+("nlpfd"	"陱")
+("nlpou"	"陶")
+("nlpp"	"阰")
+("nlppa"	"階")
+("nlppg"	"陛")
+("nlrbc"	"隕")
+("nlsje"	"陬")
+("nltct"	"隘")
+("nltpo"	"隊")
+("nltt"	"阱")
+("nltxc"	"隒")
+("nlumt"	"隑")
+("nlwlb"	"隅")
+("nlwmv"	"隈")
+("nlybp"	"隴")
+("nlyhm"	"隡")
+("nlyhn"	"阬")
+("nlyhs"	"防")
+("nlykb"	"隨")
+("nlylh"	"陟")
+("nlylm"	"阯")
+("nlyr"	"阽")
+("nlytj"	"障")
+("nlyto"	"隧")
+("nlytr"	"陪")
+("nlyvo"	"陔")
+("nlyx"	"隮")
+("nman"	"弼")
+("nmfb"	"彌")
+("nmlmi"	"蜑")
+("nmnim"	"弱")
+("nmnmf"	"鶸")
+("nmsu"	"危")
+("nmvm"	"弳")
+("nmwm"	"彊")
+("nmyiu"	"疏")
+("nn"	"了")
+("nnm"	"孑")
+("nnmbc"	"預")
+("nnmrb"	"鬻")
+("nnnao"	"豫")
+("nno"	"孓")
+("nnpr"	"夠")
+("nnqo"	"承")
+("nnsmm"	"翗")
+("nnvvu"	"郺")
+("no"	"久欠")
+("nob"	"胥")
+("noc"	"鐆")
+("nodi"	"弣")
+("nof"	"灸")
+("nog"	"墜墬")
+("nohne"	"癹")
+("nohto"	"飛")
+("nolmi"	"蛋")
+("nomk"	"癸")
+("nomrn"	"凳")
+("nomrt"	"登")
+("nonhe"	"發")
+("npd"	"弛")
+("nq"	"丮")
+("nqd"	"桀")
+("nqlmi"	"蟹")
+("nrmvn"	"甔")
+("nrppi"	"毚")
+("nrrj"	"彈")
+("nsbt"	"盈")
+("nsbul"	"鼐")
+("nsd"	"檃")
+("nse"	"夃")
+("nsf"	"尕")
+("nshr"	"弨")
+("nsj"	"弭")
+("nsmv"	"張")
+("nsnd"	"孕")
+("nsp"	"急")
+("nsrr"	"彄")
+("nti"	"戤")
+("ntmc"	"彉")
+("ntnl"	"鄧")
+("nu"	"乙")
+("nubu"	"眢")
+("nue"	"函弢")
+("nuhaf"	"鴛")
+("nui"	"兔")
+("nuks"	"勉")
+("numbc"	"頠顄")
+("nup"	"怨")
+("nusqf"	"駌")
+("nuv"	"妴")
+("nwf"	"魚")
+("nwfa"	"魯")
+("nwlmi"	"螴")
+("nwlv"	"彋")
+("nwtj"	"彃")
+("nx"	"卍")
+("nxff"	"燄")
+("nxno"	"欿")
+("nxu"	"龜")
+("nyo"	"疋")
+("nyrf"	"弶")
+("nyvi"	"弦")
+("o"	"人")
+("oaa"	"倡")
+("oahe"	"复")
+("oaln"	"劊")
+("oam"	"但")
+("oamo"	"偍")
+("oan"	"們")
+("oanb"	"僩")
+("oanl"	"鄶")
+("oapp"	"倱")
+("oapv"	"偈")
+("oasm"	"傝")
+("oate"	"儤")
+("oav"	"佷")
+("oavf"	"儑")
+("oawe"	"僈")
+("ob"	"內仴")
+("obau"	"俷")
+("obb"	"倗")
+("obbe"	"僾")
+("obch"	"儩")
+("obcn"	"側")
+("obgb"	"偁")
+("obgr"	"倜")
+("obhaf"	"鸙")
+("obhd"	"龢")
+("obhu"	"伔")
+("obmc"	"俱")
+("obmr"	"侗")
+("obnd"	"俘")
+("obo"	"肉")
+("obof"	"傺")
+("obou"	"傜")
+("obp"	"憊")
+("obppa"	"龤")
+("obq"	"佣")
+("obuu"	"俔")
+("obv"	"俀")
+("obvk"	"傒")
+("oc"	"仈")
+("ocb"	"佾")
+("oci"	"伀")
+("ocor"	"俗")
+("ocru"	"侻")
+("ocsh"	"份")
+("ocwa"	"僧")
+("od"	"休")
+("odc"	"鎥")
+("odci"	"倯")
+("oddf"	"僸")
+("oddo"	"儊")
+("odf"	"烋溣")
+("odg"	"堡")
+("odhf"	"鵂")
+("odi"	"付")
+("odm"	"体")
+("odmq"	"偉")
+("odog"	"雓")
+("odok"	"敘")
+("odp"	"怹")
+("odsmg"	"糴")
+("odyj"	"斜")
+("oe"	"汆")
+("of"	"伙尒")
+("ofb"	"俏")
+("ofbc"	"償")
+("ofbf"	"儻")
+("ofbr"	"倘")
+("ofbw"	"儅")
+("ofdq"	"僯")
+("off"	"倓")
+("offs"	"僗")
+("ofhaf"	"鷡鷦")
+("ofhu"	"偗")
+("ofln"	"劁")
+("ofmvn"	"甒")
+("ofnl"	"鄦")
+("ofp"	"您")
+("ofq"	"伴")
+("ofqu"	"倦")
+("og"	"仕隹")
+("ogbuc"	"賃")
+("ogce"	"倰")
+("ogd"	"集栠")
+("ogdi"	"侍")
+("oge"	"隻雙")
+("ogf"	"焦")
+("ogg"	"佳")
+("oggu"	"僥")
+("oghaf"	"鶴鵀")
+("oghq"	"犨")
+("ogi"	"佉")
+("ogj"	"隼")
+("oglms"	"雋")
+("ogln"	"剉")
+("ogni"	"儔")
+("ogog"	"雔")
+("ogogg"	"雥")
+("ogp"	"恁")
+("ogr"	"售佶")
+("ogrg"	"儓")
+("ogrr"	"僖")
+("ogsk"	"傲")
+("ogtj"	"倖")
+("ogwc"	"儥")
+("ogyrg"	"讎")
+("oh"	"入")
+("oha"	"伯")
+("ohag"	"偟")
+("ohbt"	"侐")
+("ohby"	"侜")
+("ohce"	"傻")
+("ohdf"	"偢")
+("ohdi"	"俬")
+("ohdn"	"俐")
+("ohdp"	"僁")
+("ohdv"	"倭")
+("ohdw"	"僠")
+("oher"	"佫")
+("ohey"	"佟")
+("ohfp"	"僽")
+("ohg"	"任")
+("ohgu"	"侁")
+("ohhj"	"俾")
+("ohi"	"傀")
+("ohj"	"仟")
+("ohjd"	"侏")
+("ohjg"	"偅")
+("ohjm"	"倕")
+("ohjr"	"佸")
+("ohjx"	"偛")
+("ohkb"	"僑")
+("ohlb"	"偊")
+("ohml"	"伒")
+("ohn"	"仉")
+("ohnb"	"佩")
+("ohni"	"偑")
+("ohoa"	"偺")
+("ohoi"	"偫")
+("ohoo"	"傱")
+("ohpm"	"低")
+("ohq"	"件")
+("ohqi"	"俄")
+("ohqo"	"佚")
+("ohs"	"作")
+("ohsb"	"偏")
+("ohsg"	"僱")
+("ohsk"	"儌")
+("ohuc"	"儹")
+("ohvf"	"係")
+("ohvl"	"仰")
+("ohwp"	"傯")
+("ohxu"	"倪")
+("ohyu"	"傂")
+("oi"	"伐")
+("oiamh"	"餳")
+("oiapp"	"餛")
+("oiapv"	"餲")
+("oiar"	"倉")
+("oiav"	"食俍")
+("oiawe"	"饅")
+("oibi"	"傅")
+("oibjj"	"餫")
+("oibmr"	"餇")
+("oibv"	"餒")
+("oice"	"俊")
+("oicyo"	"餩")
+("oidl"	"餗")
+("oieee"	"餟")
+("oifbd"	"饓")
+("oiff"	"餤")
+("oigbt"	"饐")
+("oiggu"	"饒")
+("oigit"	"饁")
+("oigrr"	"饎")
+("oihaf"	"鴒")
+("oihag"	"餭")
+("oihbr"	"餉")
+("oihdv"	"餧")
+("oihe"	"飯")
+("oihf"	"傶")
+("oihg"	"飪")
+("oihhl"	"飹")
+("oihhw"	"餾")
+("oihi"	"餽")
+("oihjr"	"餂")
+("oihk"	"飫")
+("oihn"	"飢")
+("oihon"	"餰")
+("oihp"	"侂飥")
+("oihq"	"侔")
+("oihqi"	"餓")
+("oihuc"	"饡")
+("oihxe"	"餿")
+("oii"	"俴")
+("oiibi"	"餺")
+("oiice"	"餕")
+("oiii"	"餞")
+("oiijb"	"餔")
+("oiir"	"飴")
+("oijbd"	"餑")
+("oije"	"俅")
+("oijrb"	"餬")
+("oijrr"	"館")
+("oijtc"	"饙")
+("oik"	"伏")
+("oikf"	"偽")
+("oikkb"	"餚")
+("oiku"	"优")
+("oilb"	"傭")
+("oilmc"	"饋")
+("oilmi"	"蝕")
+("oilmm"	"韱")
+("oimbc"	"領")
+("oimbk"	"餪")
+("oimn"	"飣")
+("oimo"	"佽")
+("oimrt"	"餖")
+("oimvn"	"瓴")
+("oin"	"今")
+("oinc"	"貪")
+("oinhx"	"餡")
+("oini"	"令")
+("oino"	"飲")
+("oinp"	"念")
+("oinr"	"含")
+("oinri"	"饞")
+("oint"	"盦")
+("oinv"	"衾")
+("oinw"	"酓")
+("oioi"	"俯")
+("oiok"	"俟")
+("oioks"	"飭")
+("oiolb"	"飾")
+("oiomd"	"餘")
+("oiond"	"餼")
+("oionk"	"餱")
+("oip"	"代怤")
+("oipf"	"儦")
+("oiph"	"飶")
+("oipru"	"飽")
+("oipu"	"飩")
+("oir"	"佁")
+("oiruc"	"饌")
+("oisj"	"餌")
+("oismm"	"翎")
+("oismr"	"飼")
+("oisrr"	"饇")
+("oitak"	"饃")
+("oitbo"	"饛")
+("oitk"	"餀")
+("oitlm"	"饉")
+("oitqg"	"饈")
+("oitt"	"餅")
+("oiv"	"姇")
+("oivii"	"饑")
+("oivno"	"餯")
+("oiwmv"	"餵")
+("oiyck"	"餃")
+("oiymh"	"饖")
+("oiyrv"	"饟")
+("oiywm"	"饘")
+("oj"	"什午")
+("ojb"	"伂")
+("ojbc"	"傎")
+("ojbm"	"值")
+("ojcm"	"倥")
+("ojcr"	"傛")
+("oje"	"伎")
+("ojhp"	"侘")
+("ojii"	"傳")
+("ojk"	"仗")
+("ojkp"	"佬")
+("ojlk"	"使")
+("ojln"	"倳")
+("ojlo"	"倢")
+("ojmc"	"儐")
+("ojmf"	"倧")
+("ojmmr"	"啎")
+("ojmn"	"佇")
+("ojmo"	"傢")
+("ojnu"	"倇")
+("ojp"	"佗")
+("ojpn"	"儜")
+("ojr"	"估")
+("ojrk"	"做")
+("ojrr"	"倌")
+("ojtc"	"僨")
+("ojtg"	"僿")
+("oju"	"缶")
+("ojv"	"侒")
+("ok"	"矢")
+("okb"	"侑")
+("okcf"	"僚")
+("okcwa"	"矰")
+("okf"	"焂")
+("okhae"	"瀪")
+("okhaf"	"鴙")
+("okhdv"	"矮")
+("okhg"	"俇")
+("okhk"	"矨")
+("okhkb"	"矯")
+("okkb"	"俙")
+("okkk"	"傸")
+("oklb"	"佈")
+("oklu"	"俺")
+("okm"	"佐")
+("okmf"	"倷")
+("okmr"	"倚")
+("okmrt"	"短")
+("okms"	"侉")
+("okn"	"仇侇")
+("oknl"	"矧")
+("okog"	"雉")
+("okoo"	"俠")
+("okoog"	"矬")
+("okp"	"悠")
+("okr"	"佑知")
+("okryo"	"跾")
+("oks"	"仂")
+("oksr"	"伽")
+("okss"	"矩")
+("oktoe"	"矱")
+("okvif"	"繁")
+("okwlp"	"矲")
+("ol"	"仲")
+("olbk"	"佒")
+("oll"	"介")
+("olln"	"佛")
+("olmc"	"僓")
+("olmo"	"佻")
+("olmt"	"儘")
+("olmy"	"俳")
+("olnk"	"候")
+("olob"	"脩")
+("olod"	"條")
+("olof"	"絛鯈儵")
+("oloh"	"修")
+("oloj"	"鞗")
+("olok"	"攸倏")
+("olom"	"翛")
+("olpb"	"偝")
+("olwl"	"伸")
+("olws"	"俜")
+("olwv"	"僂")
+("om"	"丘仜仝")
+("oma"	"佰")
+("ombb"	"儒")
+("ombe"	"優")
+("ombl"	"侕")
+("ombn"	"俞")
+("ombp"	"愈")
+("ombt"	"侖")
+("omc"	"兵")
+("omd"	"余")
+("omdm"	"伍儮")
+("omdp"	"悆")
+("omdu"	"峹嵞")
+("omdw"	"畬")
+("omf"	"伓")
+("omfj"	"伻")
+("omfm"	"伾")
+("omfr"	"俖")
+("omg"	"全")
+("omgn"	"倒")
+("omh"	"乒")
+("omi"	"乓")
+("omig"	"侄")
+("omjr"	"舍")
+("omlb"	"倆")
+("omlk"	"便")
+("omm"	"仁")
+("ommf"	"佘")
+("ommi"	"伝")
+("ommm"	"仨")
+("ommp"	"儷")
+("ommr"	"俉")
+("ommv"	"佞侲")
+("omn"	"仃气")
+("omnl"	"邱")
+("omnn"	"例")
+("omno"	"歙")
+("omnr"	"何")
+("ompm"	"倵")
+("omr"	"合")
+("omrb"	"龠")
+("omrl"	"命")
+("omrm"	"翕")
+("omro"	"僉")
+("omrp"	"龕")
+("omrq"	"拿")
+("omrr"	"樖")
+("omrt"	"盒弇")
+("omrw"	"偪畣")
+("omsl"	"卸")
+("omsp"	"屔")
+("omtn"	"侀")
+("omu"	"岳")
+("omua"	"僭")
+("omvh"	"伢")
+("omvm"	"俓")
+("omvn"	"佤")
+("omwa"	"會")
+("omwc"	"價")
+("omwd"	"僳")
+("omwf"	"僄")
+("omwl"	"偭")
+("omwm"	"僵")
+("omwu"	"僊")
+("omwv"	"偠")
+("omyf"	"傿")
+("on"	"乞")
+("onao"	"像")
+("onau"	"俛")
+("onbc"	"偩")
+("onbuu"	"覦")
+("oncr"	"儋")
+("oncsh"	"氛")
+("ond"	"仔")
+("onf"	"你")
+("onfd"	"氣")
+("onff"	"氮")
+("onhaf"	"鳹")
+("onhb"	"僪")
+("onhe"	"伋")
+("onhey"	"氡")
+("onhqu"	"毹")
+("onhs"	"仍")
+("onib"	"俑")
+("onin"	"侈")
+("onjru"	"氪")
+("onjv"	"氨")
+("onkg"	"侹")
+("onkl"	"鄇")
+("onkq"	"健")
+("onl"	"氕伄")
+("onll"	"氘")
+("onlll"	"氚")
+("onlln"	"氟")
+("onln"	"刉")
+("onlwl"	"氠")
+("onmcw"	"氥")
+("onmk"	"侯")
+("onmlm"	"氬")
+("onmu"	"佹")
+("onmvm"	"氫")
+("onnhs"	"氖")
+("onnl"	"鄃")
+("onno"	"歈")
+("onob"	"氝")
+("onog"	"雂")
+("onp"	"忥")
+("onqd"	"傑")
+("onqmb"	"氰")
+("onri"	"儳")
+("ontq"	"氧")
+("onu"	"氙")
+("onvne"	"氯")
+("onwk"	"氤")
+("onwot"	"氳")
+("onyvo"	"氦")
+("ooah"	"傷")
+("oobg"	"傕")
+("oobm"	"俎")
+("oobo"	"肏")
+("oog"	"坐倠")
+("ooge"	"夎")
+("oogf"	"僬")
+("ooic"	"僋")
+("ooii"	"伶")
+("ooin"	"仱")
+("ooir"	"傖")
+("ooj"	"仵")
+("ooll"	"价")
+("ooln"	"劍")
+("ooma"	"儈")
+("oomb"	"倫")
+("oombc"	"顩")
+("oomg"	"佺")
+("oomn"	"偷")
+("oomo"	"儉")
+("oomr"	"佮")
+("oon"	"仡")
+("oono"	"歛")
+("ooog"	"侳")
+("oooj"	"傘")
+("oook"	"斂")
+("oou"	"佡")
+("oowy"	"侮")
+("op"	"化伈")
+("opa"	"侚")
+("opbuc"	"貨貸")
+("opd"	"他柋")
+("oph"	"佖")
+("ophq"	"牮")
+("opko"	"儗")
+("opmc"	"傾")
+("opok"	"敜")
+("opp"	"仳")
+("oppa"	"偕")
+("opr"	"佝")
+("opt"	"伳")
+("optd"	"偞")
+("opu"	"岱伅")
+("opwgf"	"黛")
+("opyhv"	"袋")
+("oq"	"年")
+("oqhk"	"偰")
+("oqka"	"偆")
+("oqke"	"傣")
+("oqkq"	"俸")
+("oqmb"	"倩")
+("oqmc"	"債")
+("oqmf"	"傃")
+("oqmv"	"俵")
+("oqo"	"伕")
+("oqoa"	"僣")
+("ora"	"智")
+("orau"	"俋")
+("orc"	"伿")
+("ord"	"保")
+("orhaf"	"鴿鵨鶬")
+("orhr"	"侶")
+("orhu"	"侃")
+("ori"	"戧")
+("orijb"	"舖")
+("orln"	"創")
+("ormbc"	"頜頷")
+("ornin"	"舒")
+("ornl"	"郃")
+("orno"	"欱")
+("orrj"	"僤")
+("orrk"	"儼")
+("orsj"	"偮")
+("oruc"	"僎")
+("orvk"	"俁")
+("orxu"	"僶")
+("orye"	"假敆")
+("oryo"	"促")
+("osav"	"偃")
+("oshi"	"仞")
+("osj"	"佴")
+("osjr"	"倨")
+("osk"	"伊")
+("osme"	"侵")
+("osmg"	"偓")
+("osmh"	"僇")
+("osmr"	"伺")
+("osmv"	"倀")
+("osnd"	"僝")
+("oso"	"伬")
+("osqf"	"傌")
+("osrj"	"僻")
+("osrr"	"傴")
+("oss"	"佢")
+("ossr"	"侷")
+("ostt"	"偋")
+("osuu"	"倔")
+("ota"	"借")
+("otbc"	"倎")
+("otc"	"供")
+("otco"	"僕僛")
+("otcw"	"偤")
+("otdd"	"橆")
+("otf"	"無")
+("otgi"	"儀")
+("othb"	"備")
+("otif"	"儰")
+("otkr"	"偌")
+("otlk"	"偀")
+("otlm"	"僅")
+("otmc"	"倛")
+("otmv"	"偡")
+("otniq"	"舞")
+("otog"	"儺")
+("otq"	"佯")
+("otqm"	"傞")
+("otrk"	"儆")
+("otsj"	"傇")
+("ott"	"併")
+("ottb"	"傋")
+("otwa"	"傮")
+("otwi"	"僔")
+("otwn"	"儚")
+("otwv"	"儂")
+("otxc"	"傔")
+("ou"	"仙仚屳")
+("oubb"	"傰")
+("oudk"	"缺")
+("oudm"	"缽")
+("ouf"	"缹")
+("ouhmr"	"缿")
+("oum"	"缸")
+("oumb"	"偳")
+("oumwj"	"罈")
+("ouog"	"催")
+("ouon"	"侺")
+("outrg"	"罐")
+("outt"	"缾")
+("ouypd"	"罅")
+("ouypt"	"罏")
+("ovio"	"似")
+("ovr"	"侞")
+("ovvv"	"儠")
+("ow"	"佃")
+("owg"	"俚")
+("owjr"	"個")
+("owlb"	"偶")
+("owlg"	"儸")
+("owlv"	"儇")
+("owmv"	"偎")
+("owp"	"偲")
+("owr"	"佪")
+("owwf"	"儽")
+("owww"	"儡")
+("owyi"	"每")
+("owyta"	"韽")
+("oy"	"仆")
+("oyaj"	"倬")
+("oybc"	"偵")
+("oybp"	"儱")
+("oybs"	"傍")
+("oyck"	"佼")
+("oydu"	"儭")
+("oyfe"	"俶")
+("oyfu"	"僦")
+("oyg"	"住")
+("oyhn"	"伉")
+("oyhs"	"仿")
+("oyhv"	"依")
+("oyjj"	"僆")
+("oykk"	"傚")
+("oylm"	"企")
+("oym"	"仩")
+("oymp"	"佌")
+("oymr"	"信")
+("oymy"	"佧")
+("oyoj"	"倅")
+("oyok"	"敏")
+("oypd"	"偨")
+("oypp"	"儢")
+("oyr"	"佔")
+("oyra"	"儲")
+("oyrf"	"倞")
+("oyrn"	"停")
+("oyrv"	"偯儴")
+("oysk"	"倣")
+("oyt"	"位")
+("oyta"	"偣")
+("oytg"	"僮")
+("oytj"	"傽")
+("oytp"	"億")
+("oytr"	"倍")
+("oyub"	"禽")
+("oyvi"	"伭")
+("oyvo"	"侅")
+("oywm"	"儃")
+("oyx"	"儕")
+("oyyiu"	"毓")
+("p"	"心")
+("pa"	"旨旬")
+("pahaf"	"鶛")
+("pahm"	"惺")
+("paiu"	"慨")
+("paks"	"勓")
+("pam"	"怛")
+("pamh"	"愓")
+("pamj"	"悍")
+("pamo"	"惿")
+("panb"	"憪")
+("pank"	"憫")
+("panl"	"郇")
+("paph"	"惕")
+("papp"	"惃")
+("papv"	"愒")
+("pate"	"懪")
+("pav"	"恨")
+("pawe"	"慢")
+("payf"	"憬")
+("pbac"	"慏")
+("pbbb"	"愲")
+("pbcn"	"惻")
+("pbg"	"墯")
+("pbgr"	"惆")
+("pbhx"	"慆")
+("pbjj"	"惲")
+("pbm"	"怚")
+("pbme"	"愋")
+("pbmr"	"恫")
+("pbou"	"愮")
+("pbtv"	"惘")
+("pbue"	"戄")
+("pbug"	"懼")
+("pbvk"	"慀")
+("pc"	"惍")
+("pci"	"忪")
+("pcks"	"勩")
+("pcnh"	"悌")
+("pcru"	"悅")
+("pcwa"	"憎")
+("pd"	"也")
+("pdd"	"惏")
+("pdhaf"	"鵴")
+("pdi"	"忖")
+("pdk"	"快")
+("pdl"	"悚")
+("pdlc"	"懶")
+("pdmbc"	"穎")
+("peee"	"惙")
+("peg"	"怪")
+("peii"	"慅")
+("pembc"	"潁")
+("pfb"	"悄")
+("pfbf"	"戃")
+("pfbr"	"惝")
+("pfd"	"匊")
+("pfdq"	"憐")
+("pff"	"惔")
+("pfmbc"	"熲顈")
+("pfmu"	"恍")
+("pfq"	"怑")
+("pfqu"	"惓")
+("pgdi"	"恃")
+("pggu"	"憢")
+("pgi"	"怯")
+("pgni"	"懤")
+("pgr"	"恄")
+("pgth"	"憉")
+("pgtj"	"悻")
+("ph"	"必")
+("pha"	"怕曶")
+("phag"	"惶")
+("phbk"	"懊")
+("phbq"	"甮")
+("phbr"	"恦")
+("phbt"	"恤")
+("phbuu"	"覕")
+("phcn"	"懰")
+("phdb"	"憡")
+("phdd"	"悸")
+("phdf"	"愀")
+("pher"	"恪")
+("phgr"	"悎")
+("phgs"	"慟")
+("phh"	"勿")
+("phhn"	"匑")
+("phi"	"愧")
+("phj"	"忏")
+("phjr"	"恬")
+("phkb"	"憍")
+("phkp"	"悿")
+("phlc"	"懫")
+("phln"	"刎")
+("phml"	"忻")
+("phnl"	"邲")
+("php"	"忽")
+("phpa"	"惛")
+("phqm"	"性")
+("phqo"	"怢")
+("phs"	"怍")
+("phsb"	"惼")
+("phsk"	"悷憿")
+("phvp"	"忯")
+("phyhv"	"袃")
+("pi"	"丫勺勾")
+("piav"	"悢")
+("pice"	"悛")
+("piih"	"慘")
+("pijb"	"匍")
+("pijc"	"怵")
+("pilb"	"慵")
+("pile"	"慷")
+("pim"	"勻")
+("pir"	"怡")
+("pirp"	"憾")
+("pit"	"悈")
+("pitc"	"懭")
+("piv"	"怴")
+("piyr"	"惦")
+("pjbc"	"慎")
+("pjbd"	"悖")
+("pjbo"	"懥")
+("pjcm"	"悾")
+("pje"	"忮")
+("pjhaf"	"鴇")
+("pjhr"	"愘")
+("pjii"	"慱")
+("pjip"	"憓")
+("pjjl"	"慚")
+("pjkp"	"恅")
+("pjlv"	"悽")
+("pjmf"	"悰")
+("pjmm"	"愃")
+("pjnu"	"惋")
+("pjpn"	"懧")
+("pjr"	"怙")
+("pjrr"	"悺")
+("pjsqf"	"駂")
+("pjtc"	"憤")
+("pk"	"忕")
+("pkcf"	"憭")
+("pkf"	"恢")
+("pkk"	"匆")
+("pkkb"	"悕")
+("pkkk"	"慡")
+("pklb"	"怖")
+("pklq"	"肄")
+("pklu"	"匎")
+("pkmb"	"惰")
+("pkn"	"勼恞")
+("pknio"	"疑")
+("pksb"	"愶")
+("pl"	"忡")
+("plbk"	"怏")
+("plbu"	"忱")
+("plln"	"怫")
+("plmc"	"憒")
+("plmo"	"恌")
+("plmy"	"悱")
+("plpc"	"懻")
+("plw"	"怞")
+("plwv"	"慺")
+("pmak"	"懨")
+("pmam"	"恒")
+("pmbb"	"懦")
+("pmbc"	"頃愩")
+("pmbe"	"懮")
+("pmbm"	"恆")
+("pmcw"	"恓")
+("pmf"	"怀")
+("pmfj"	"匉怦")
+("pmfm"	"怌")
+("pmmr"	"悟")
+("pmmu"	"忨")
+("pmob"	"怲")
+("pmrw"	"匐愊")
+("pmua"	"憯")
+("pmwd"	"慄憟")
+("pmwf"	"慓")
+("pmwj"	"憛")
+("pmwl"	"愐")
+("pmym"	"怔")
+("pn"	"乜")
+("pnau"	"悗")
+("pnbq"	"懈")
+("pncr"	"憺")
+("png"	"忸")
+("pnhb"	"憰")
+("pnhe"	"忣")
+("pnib"	"悀")
+("pnin"	"恀")
+("pno"	"忺")
+("pnyi"	"惤")
+("poae"	"愎")
+("pod"	"恘")
+("pog"	"惟")
+("poge"	"愯")
+("pogf"	"憔")
+("poii"	"怜")
+("poim"	"懺")
+("poin"	"忴")
+("poir"	"愴")
+("poj"	"忤")
+("poju"	"匋")
+("pomb"	"惀")
+("pomd"	"悇")
+("pomg"	"恮")
+("pomn"	"愉")
+("pomo"	"憸")
+("pomr"	"恰")
+("pon"	"忔")
+("ponbg"	"觺")
+("pond"	"愾")
+("potf"	"憮")
+("powy"	"悔")
+("pp"	"比")
+("ppa"	"恉恂")
+("ppad"	"惸")
+("ppfd"	"粊")
+("ppg"	"坒")
+("pph"	"怭")
+("ppha"	"皆")
+("pphp"	"惚")
+("pphqu"	"毞")
+("ppp"	"惢")
+("pppd"	"橤")
+("pppf"	"繠")
+("ppph"	"毖")
+("ppr"	"怐")
+("ppru"	"怉")
+("pptd"	"惵")
+("ppu"	"忳")
+("ppuk"	"恟")
+("pqmb"	"情")
+("pqmf"	"愫")
+("pr"	"句")
+("prau"	"悒")
+("prb"	"悁")
+("prhaf"	"鴝")
+("prhg"	"悜")
+("prhml"	"斪")
+("prhu"	"怳")
+("prks"	"劬")
+("prno"	"欨")
+("prog"	"雊")
+("prrd"	"懆")
+("prrj"	"憚")
+("prrs"	"愕")
+("pru"	"包")
+("prvp"	"怋")
+("prxu"	"憴")
+("psav"	"愝")
+("pseg"	"慳")
+("psh"	"切忉")
+("pshr"	"怊")
+("psjj"	"懾")
+("psko"	"愜")
+("psma"	"慴")
+("psmg"	"恇")
+("psmh"	"憀")
+("psmi"	"憳")
+("psmv"	"悵")
+("psp"	"怩")
+("psrr"	"慪")
+("pt"	"世")
+("pta"	"惜")
+("ptak"	"慔")
+("ptbo"	"懞")
+("ptbuc"	"貰")
+("pthg"	"懂")
+("ptlb"	"慲")
+("ptlj"	"愅")
+("ptlm"	"慬")
+("ptmv"	"愖")
+("ptor"	"匒")
+("ptov"	"懩")
+("ptrg"	"懽")
+("ptt"	"恲")
+("ptwa"	"慒")
+("ptwi"	"懱")
+("ptwu"	"懵")
+("ptxc"	"慊")
+("ptyu"	"慌")
+("pu"	"屯")
+("puce"	"惾")
+("pudhe"	"皺")
+("puf"	"炰")
+("puhaf"	"鶵")
+("puk"	"匈忷")
+("puln"	"刨")
+("pumb"	"惴")
+("pumbc"	"頓")
+("pumt"	"愷")
+("punl"	"鄒")
+("puog"	"雛慛")
+("pupu"	"芻")
+("pve"	"怓")
+("pvis"	"怮")
+("pvvw"	"惱")
+("pw"	"甸")
+("pwc"	"怬")
+("pwd"	"悃惈")
+("pwg"	"悝")
+("pwim"	"慖")
+("pwjc"	"慣")
+("pwlj"	"懌")
+("pwls"	"愣")
+("pwlv"	"懁")
+("pwmv"	"愄")
+("pwot"	"慍")
+("pwr"	"恛")
+("pyaj"	"悼")
+("pyck"	"恔")
+("pyfu"	"憱")
+("pyhr"	"慥")
+("pymr"	"訇")
+("pyoj"	"悴")
+("pypo"	"懅")
+("pyr"	"怗")
+("pyrd"	"惇")
+("pyrf"	"惊")
+("pyrv"	"懹")
+("pyta"	"愔")
+("pytg"	"憧")
+("pytj"	"慞")
+("pytp"	"憶")
+("pyv"	"忙")
+("pyvw"	"慉")
+("pywd"	"懍")
+("pywv"	"懷")
+("pyx"	"懠")
+("pyy"	"忭")
+("q"	"手")
+("qa"	"抇")
+("qail"	"揤")
+("qaiu"	"摡")
+("qamh"	"揚")
+("qamj"	"捍")
+("qamo"	"提")
+("qan"	"捫")
+("qanb"	"撊")
+("qang"	"撋")
+("qank"	"捑")
+("qanr"	"擱")
+("qanw"	"攔")
+("qapp"	"掍")
+("qapv"	"揭")
+("qase"	"撮")
+("qasm"	"搨")
+("qau"	"把")
+("qav"	"拫")
+("qb"	"抈")
+("qbb"	"掤")
+("qbbb"	"搰")
+("qbbe"	"授")
+("qbbsd"	"靜")
+("qbbuu"	"靚")
+("qbcd"	"探")
+("qbcv"	"攖")
+("qbd"	"採")
+("qbdi"	"捋")
+("qbhaf"	"鶄")
+("qbhx"	"搯")
+("qbjj"	"揮")
+("qbjmo"	"靛")
+("qbkf"	"撚")
+("qbm"	"抯")
+("qbme"	"援")
+("qbmr"	"挏")
+("qbnau"	"靘")
+("qbnd"	"捊")
+("qbnl"	"郬")
+("qbou"	"搖")
+("qbsd"	"掙")
+("qbue"	"攫")
+("qbuu"	"挸")
+("qbv"	"挼")
+("qc"	"扒")
+("qchq"	"掰")
+("qcks"	"勣")
+("qcno"	"撳")
+("qcru"	"挩")
+("qcsh"	"扮")
+("qd"	"耒")
+("qdau"	"耙")
+("qdb"	"拺")
+("qdbms"	"耡")
+("qdfh"	"耖")
+("qdhe"	"披")
+("qdhqu"	"耗")
+("qdir"	"耛")
+("qdj"	"抹")
+("qdk"	"抉")
+("qdksr"	"耞")
+("qdlwv"	"耬")
+("qdmbc"	"頛")
+("qdmbe"	"耰")
+("qdmmi"	"耘")
+("qdmvi"	"耨")
+("qdnd"	"耔")
+("qdrlr"	"耜")
+("qdss"	"耟")
+("qdta"	"耤")
+("qdtt"	"耕")
+("qdttb"	"耩")
+("qdwf"	"揀")
+("qdwlb"	"耦")
+("qdybs"	"耪")
+("qeed"	"搡")
+("qeee"	"掇")
+("qei"	"扠")
+("qeii"	"搔")
+("qfb"	"捎")
+("qfbf"	"攩")
+("qfbk"	"撇")
+("qfbq"	"撐")
+("qfbw"	"擋")
+("qff"	"掞")
+("qffs"	"撈")
+("qfh"	"抄")
+("qfq"	"拌")
+("qfqu"	"捲")
+("qgb"	"抩")
+("qgdi"	"持")
+("qgg"	"挂")
+("qggu"	"撓")
+("qggy"	"掛")
+("qgi"	"抾")
+("qgit"	"搕")
+("qglc"	"捇")
+("qgni"	"擣")
+("qgr"	"拮")
+("qgrc"	"擷")
+("qha"	"拍")
+("qhag"	"揘")
+("qhal"	"擳")
+("qhau"	"搗")
+("qhbf"	"攥")
+("qhbk"	"擙")
+("qhbu"	"攪")
+("qhd"	"栔")
+("qhdf"	"揪")
+("qhdv"	"捼")
+("qhdw"	"播")
+("qhe"	"扳洯")
+("qhej"	"捀")
+("qher"	"挌")
+("qhgr"	"捁")
+("qhhj"	"捭")
+("qhhv"	"挀")
+("qhio"	"抸")
+("qhj"	"扦")
+("qhjg"	"揰")
+("qhjm"	"捶")
+("qhjr"	"括")
+("qhju"	"揗")
+("qhjx"	"插")
+("qhk"	"契扷")
+("qhkb"	"撟")
+("qhkp"	"掭")
+("qhlmi"	"蛪")
+("qhlo"	"抓掀")
+("qhml"	"折")
+("qhmy"	"拆")
+("qhnbg"	"觢")
+("qhne"	"投")
+("qhoa"	"揝")
+("qhoo"	"摐")
+("qhor"	"撘")
+("qhp"	"托恝")
+("qhpm"	"抵")
+("qhq"	"挈")
+("qhqo"	"抶")
+("qhrf"	"摀")
+("qhsb"	"掮揙")
+("qhsk"	"捩撽")
+("qhsm"	"搧")
+("qhuc"	"攢")
+("qhul"	"擤")
+("qhuo"	"擨")
+("qhuu"	"撬")
+("qhvif"	"絜")
+("qhvl"	"抑")
+("qhvp"	"扺")
+("qhwp"	"摠")
+("qhxe"	"搜")
+("qhxm"	"捏")
+("qhxu"	"掜")
+("qhye"	"搬")
+("qhymu"	"齧")
+("qhyu"	"搋")
+("qi"	"找")
+("qibi"	"搏")
+("qice"	"捘")
+("qidy"	"攠")
+("qihf"	"搣摵")
+("qihu"	"抁")
+("qiih"	"摻")
+("qijb"	"捕")
+("qije"	"捄")
+("qikf"	"撝")
+("qikk"	"拔")
+("qiku"	"扰")
+("qilr"	"搪")
+("qiok"	"挨")
+("qipd"	"攗")
+("qipm"	"拭")
+("qir"	"抬")
+("qirm"	"掝")
+("qirp"	"撼")
+("qit"	"拚")
+("qitc"	"擴")
+("qitf"	"摭")
+("qixp"	"摝")
+("qiyr"	"掂")
+("qj"	"丰")
+("qjbc"	"搷")
+("qjbd"	"挬")
+("qjbf"	"擦")
+("qjbj"	"揇")
+("qjbv"	"攮")
+("qjcm"	"控")
+("qjcn"	"挖")
+("qjcs"	"搾")
+("qjcv"	"攛")
+("qje"	"技")
+("qjhp"	"挓")
+("qjhu"	"抭")
+("qjii"	"摶")
+("qjji"	"撠")
+("qjjj"	"搟")
+("qjjl"	"摲")
+("qjk"	"扙")
+("qjks"	"拷")
+("qjlo"	"捷")
+("qjmc"	"擯")
+("qjmm"	"揎")
+("qjmo"	"掟")
+("qjmr"	"砉")
+("qjmu"	"捖")
+("qjnl"	"邦鄻")
+("qjnu"	"捥")
+("qjoa"	"摍")
+("qjpa"	"搘")
+("qjpn"	"擰")
+("qjqp"	"攇")
+("qjqr"	"搳")
+("qjsm"	"彗")
+("qjsmp"	"慧")
+("qjto"	"攓")
+("qjtv"	"攐")
+("qjv"	"按")
+("qjwj"	"捙")
+("qka"	"春")
+("qkali"	"蠢")
+("qkap"	"惷")
+("qkce"	"摋")
+("qkcf"	"撩")
+("qke"	"泰")
+("qkf"	"拻")
+("qkhd"	"秦")
+("qkhk"	"奏")
+("qkhx"	"舂")
+("qkhxp"	"憃")
+("qkja"	"撦")
+("qklb"	"抪")
+("qkld"	"拵")
+("qklu"	"掩")
+("qkmf"	"捺")
+("qkmr"	"掎")
+("qkms"	"挎")
+("qkoo"	"挾")
+("qkq"	"奉")
+("qks"	"扐")
+("qksb"	"搚")
+("qkso"	"摦")
+("qkss"	"拹")
+("qkus"	"拋")
+("qla"	"晢")
+("qlbk"	"抰")
+("qlbu"	"抌")
+("qlc"	"銴")
+("qle"	"捸")
+("qlf"	"焎")
+("qllmi"	"蜇")
+("qlln"	"拂")
+("qlmc"	"撌")
+("qlmo"	"挑")
+("qlmr"	"硩")
+("qlmy"	"排")
+("qlp"	"悊")
+("qlpb"	"揹")
+("qlr"	"哲")
+("qlryo"	"踅")
+("qlvk"	"擻")
+("qlw"	"抽")
+("qlwl"	"抻")
+("qlwp"	"拽")
+("qlwv"	"摟")
+("qlyhv"	"裚")
+("qlymr"	"誓")
+("qm"	"扛")
+("qmak"	"擫")
+("qmb"	"青")
+("qmbb"	"擩")
+("qmbc"	"摃")
+("qmbe"	"擾")
+("qmbg"	"攉")
+("qmbs"	"摴")
+("qmbuc"	"責")
+("qmbw"	"擂")
+("qmd"	"扜")
+("qmf"	"抔")
+("qmfj"	"抨")
+("qmgg"	"捱")
+("qmgn"	"捯")
+("qmia"	"搢")
+("qmig"	"挃")
+("qmj"	"扞")
+("qmjk"	"撖")
+("qmlk"	"挭")
+("qmlm"	"掗")
+("qmmi"	"抎")
+("qmmp"	"攦")
+("qmmr"	"捂")
+("qmmu"	"抏")
+("qmmv"	"振")
+("qmn"	"打")
+("qmr"	"拓")
+("qmrb"	"搹")
+("qmrw"	"揊")
+("qmsu"	"扼")
+("qmto"	"撅")
+("qmu"	"扤")
+("qmv"	"表")
+("qmvif"	"素")
+("qmvm"	"挳")
+("qmwd"	"搮")
+("qmwf"	"摽")
+("qmwj"	"撢")
+("qmwyf"	"纛")
+("qmwyi"	"毒")
+("qnau"	"挽")
+("qnbg"	"捔")
+("qnbk"	"換")
+("qncr"	"擔")
+("qndf"	"搎")
+("qnem"	"拯")
+("qng"	"扭")
+("qnhd"	"揉")
+("qnhe"	"扱")
+("qnhs"	"扔")
+("qnhx"	"掐")
+("qnib"	"捅")
+("qnin"	"抒拸")
+("qnkg"	"挺")
+("qnkm"	"挻")
+("qnkq"	"揵")
+("qnlb"	"撱")
+("qnmm"	"搦")
+("qno"	"扻")
+("qnob"	"揟")
+("qnoe"	"撥")
+("qnok"	"揆")
+("qnot"	"撜")
+("qnri"	"攙")
+("qnwa"	"擼")
+("qo"	"夫")
+("qoa"	"替")
+("qoah"	"摥")
+("qobg"	"搉")
+("qobuu"	"規")
+("qodi"	"拊")
+("qog"	"推")
+("qohaf"	"鳺")
+("qohg"	"拰")
+("qohh"	"抮")
+("qoii"	"拎")
+("qoim"	"攕")
+("qoin"	"扲")
+("qoip"	"捻")
+("qoir"	"搶")
+("qojwj"	"輦")
+("qoll"	"扴")
+("qomb"	"掄")
+("qomd"	"捈")
+("qomg"	"拴")
+("qomn"	"揄")
+("qomo"	"撿")
+("qomr"	"拾捨")
+("qomt"	"揜")
+("qon"	"扢")
+("qonl"	"邞")
+("qoog"	"挫")
+("qopd"	"拖")
+("qorq"	"搿")
+("qotf"	"撫")
+("qowy"	"挴")
+("qoya"	"摿")
+("qoyb"	"擒")
+("qpa"	"指")
+("qpd"	"扡")
+("qpfd"	"掬")
+("qpi"	"扚")
+("qpko"	"擬")
+("qpmm"	"揯")
+("qpou"	"掏")
+("qpp"	"批")
+("qppa"	"揩")
+("qpr"	"拘")
+("qpru"	"抱")
+("qpt"	"抴")
+("qptd"	"揲")
+("qpu"	"扽")
+("qpuu"	"搊")
+("qpyr"	"揈")
+("qqhk"	"揳")
+("qqkk"	"揍")
+("qqkq"	"捧")
+("qqmb"	"掅")
+("qqo"	"扶")
+("qqoj"	"攆")
+("qqou"	"摫")
+("qqq"	"掱")
+("qqu"	"扥")
+("qr"	"扣")
+("qrau"	"挹")
+("qrb"	"捐")
+("qrbc"	"損")
+("qrrd"	"操")
+("qrrj"	"撣")
+("qrsh"	"拐")
+("qrsj"	"揖")
+("qrsn"	"捌")
+("qruc"	"撰")
+("qrvp"	"抿")
+("qryo"	"捉")
+("qsav"	"揠")
+("qshr"	"招")
+("qsj"	"挕")
+("qsje"	"掫")
+("qsjj"	"攝")
+("qsjl"	"揶")
+("qsjr"	"据")
+("qskr"	"捃")
+("qsll"	"挋")
+("qsma"	"摺")
+("qsmb"	"掃")
+("qsmg"	"握擢")
+("qsmh"	"摎")
+("qsmi"	"撏")
+("qsmv"	"掁")
+("qsp"	"抳")
+("qsql"	"挪")
+("qsrj"	"擗")
+("qsrr"	"摳")
+("qss"	"拒")
+("qssr"	"挶")
+("qstt"	"摒")
+("qstv"	"搌")
+("qsuu"	"掘")
+("qswu"	"攬")
+("qsyq"	"摨")
+("qta"	"措")
+("qtak"	"摸")
+("qtav"	"擖")
+("qtbc"	"捵")
+("qtbf"	"攃")
+("qtbk"	"撒")
+("qtbn"	"揃")
+("qtc"	"拱")
+("qtcl"	"撕")
+("qtco"	"撲")
+("qtct"	"搤")
+("qtcw"	"揂")
+("qtkl"	"擲")
+("qtm"	"拑")
+("qtmc"	"掑撗")
+("qtmv"	"揕")
+("qtod"	"搽")
+("qtoe"	"擭")
+("qtog"	"攤")
+("qtor"	"搭")
+("qtov"	"攁")
+("qtpd"	"擛")
+("qtqm"	"搓")
+("qtrk"	"擏")
+("qtt"	"拼")
+("qttb"	"搆")
+("qttc"	"掽")
+("qtub"	"搠")
+("qtw"	"描")
+("qtwi"	"撙")
+("qtwv"	"擃")
+("qtxc"	"搛")
+("qu"	"扎")
+("qud"	"槼")
+("qumb"	"揣")
+("quob"	"攜")
+("quog"	"摧")
+("quu"	"拙")
+("quv"	"嫢")
+("qvid"	"擽")
+("qvis"	"拗")
+("qvno"	"掾")
+("qvoi"	"攭")
+("qvvd"	"摷")
+("qvvn"	"拶")
+("qvvv"	"擸")
+("qwd"	"捆捰")
+("qwg"	"捚")
+("qwhr"	"撂")
+("qwim"	"摑")
+("qwjc"	"摜")
+("qwkp"	"摁")
+("qwl"	"押")
+("qwli"	"擉")
+("qwlj"	"擇")
+("qwlp"	"擺")
+("qwlv"	"擐")
+("qwmv"	"揋")
+("qwot"	"搵")
+("qwp"	"揌")
+("qwvf"	"摞")
+("qwwv"	"攌")
+("qwyi"	"拇")
+("qy"	"扑")
+("qyaj"	"掉")
+("qybb"	"撾揥")
+("qybg"	"攡")
+("qybk"	"撤")
+("qybp"	"攏")
+("qybs"	"搒")
+("qycb"	"摘")
+("qyck"	"挍")
+("qyg"	"拄")
+("qygq"	"撻")
+("qyhj"	"摓")
+("qyhn"	"抗")
+("qyhr"	"搥")
+("qyhv"	"挔")
+("qyij"	"摔")
+("qyj"	"抖")
+("qyjj"	"摙")
+("qyk"	"抆")
+("qylh"	"捗")
+("qylm"	"扯")
+("qymb"	"掯")
+("qyoj"	"捽")
+("qyok"	"掖")
+("qypo"	"據")
+("qypp"	"攄")
+("qyps"	"擄")
+("qypt"	"攎")
+("qyr"	"拈")
+("qyrb"	"搞")
+("qyrf"	"掠")
+("qyrn"	"揨攍")
+("qyrv"	"攘")
+("qysd"	"揓")
+("qyt"	"拉")
+("qytg"	"撞")
+("qytr"	"掊")
+("qytu"	"摬")
+("qytv"	"接")
+("qyub"	"摛")
+("qyvg"	"擁")
+("qyvw"	"搐")
+("qywm"	"擅")
+("qyx"	"擠")
+("qyy"	"抃")
+("qyyb"	"擿")
+("r"	"口")
+("raa"	"唱")
+("rail"	"唧")
+("ram"	"呾")
+("ramj"	"哻")
+("ranx"	"嚪")
+("rapv"	"喝")
+("rase"	"嘬")
+("rate"	"嚗")
+("rau"	"吧邑")
+("rav"	"哏")
+("raye"	"敯")
+("rb"	"肙")
+("rbbe"	"噯")
+("rbbr"	"喎")
+("rbcv"	"嚶")
+("rbd"	"啋")
+("rbdi"	"哷")
+("rbgr"	"啁")
+("rbhaf"	"鵑")
+("rbm"	"咀")
+("rbmr"	"哃")
+("rbou"	"嗂")
+("rbsmr"	"嗣")
+("rbuc"	"員唄")
+("rbv"	"哸")
+("rbwi"	"嚼")
+("rc"	"只叭")
+("rcim"	"嗡")
+("rckn"	"嗲")
+("rcks"	"勛")
+("rcnl"	"鄖")
+("rcsh"	"吩")
+("rcwa"	"噌")
+("rd"	"呆")
+("rdam"	"喳")
+("rddf"	"噤")
+("rdhqu"	"氉")
+("rdi"	"吋")
+("rdk"	"吷")
+("rdln"	"喇劋")
+("rdlo"	"嗽")
+("rdm"	"呠")
+("rdmq"	"喡")
+("rdnl"	"鄵")
+("rdoo"	"唻")
+("rede"	"啵")
+("reed"	"嗓")
+("reee"	"啜")
+("refh"	"唦")
+("reoy"	"嗨")
+("rf"	"吙")
+("rfb"	"哨")
+("rfba"	"嚐")
+("rfbc"	"嗩")
+("rfbw"	"噹")
+("rfd"	"咪")
+("rff"	"啖")
+("rffs"	"嘮")
+("rfh"	"吵")
+("rg"	"吐")
+("rgb"	"呥")
+("rgbt"	"噎")
+("rgcc"	"嚇")
+("rgg"	"哇")
+("rggu"	"嘵")
+("rghaf"	"鷕")
+("rgi"	"呿")
+("rgit"	"嗑")
+("rgkc"	"嚽")
+("rglc"	"哧")
+("rgnl"	"郢")
+("rgr"	"咭")
+("rgrr"	"嘻")
+("rgsk"	"嗷")
+("rgtj"	"啈")
+("rgyo"	"唗")
+("rhad"	"嘄")
+("rhaf"	"鳴")
+("rhag"	"喤")
+("rhaj"	"嗥")
+("rhbk"	"噢")
+("rhbu"	"咱")
+("rhdf"	"啾")
+("rhdn"	"唎")
+("rher"	"咯")
+("rhey"	"咚")
+("rhfd"	"呼")
+("rhg"	"呈")
+("rhgr"	"哠")
+("rhhj"	"啤")
+("rhjd"	"咮")
+("rhjm"	"唾")
+("rhjr"	"咶")
+("rhjx"	"喢")
+("rhkb"	"嘺")
+("rhml"	"听")
+("rhmo"	"噬")
+("rhoa"	"喒")
+("rhp"	"吒")
+("rhpm"	"呧")
+("rhq"	"吽")
+("rhqi"	"哦")
+("rhr"	"呂")
+("rhrf"	"嗚")
+("rhs"	"咋")
+("rhsk"	"唳噭")
+("rht"	"呏")
+("rhu"	"兄")
+("rhuc"	"囋")
+("rhuk"	"嗅")
+("rhvo"	"呱")
+("rhxe"	"嗖")
+("rhxu"	"唲")
+("rice"	"唆")
+("rihf"	"嘁")
+("rihq"	"哞")
+("rihr"	"喊")
+("rihu"	"吮")
+("riil"	"啷")
+("rijb"	"哺")
+("rijc"	"嘛")
+("rik"	"吠")
+("rikf"	"噅")
+("riog"	"雖")
+("riok"	"唉")
+("rir"	"咍")
+("ritc"	"嚝")
+("rite"	"喥")
+("riuh"	"哤")
+("rjal"	"嘟")
+("rjbc"	"嗔")
+("rjbd"	"哱")
+("rjbf"	"嗦嚓")
+("rjbj"	"喃")
+("rjbo"	"嚏")
+("rjbv"	"囔")
+("rjca"	"噾")
+("rjd"	"味")
+("rje"	"吱")
+("rjhaf"	"鷤")
+("rjhr"	"喀")
+("rji"	"戢戰")
+("rjjb"	"嘲")
+("rjji"	"囀")
+("rjkd"	"哮")
+("rjkp"	"咾")
+("rjlo"	"啑")
+("rjmm"	"喧")
+("rjmmv"	"辴")
+("rjmo"	"啶")
+("rjnl"	"鄲")
+("rjon"	"嘜")
+("rjpa"	"嗜")
+("rjpn"	"嚀")
+("rjpu"	"嘧")
+("rjqr"	"嗐")
+("rjr"	"咕")
+("rjstv"	"囅")
+("rjtc"	"噴")
+("rka"	"暋")
+("rkbu"	"睯")
+("rkcf"	"嘹")
+("rki"	"吰呔")
+("rkkb"	"唏")
+("rklb"	"咘")
+("rklu"	"唵")
+("rkn"	"咦")
+("rkoo"	"唊")
+("rkp"	"愍")
+("rks"	"另叻")
+("rksb"	"嗋")
+("rksr"	"咖")
+("rlb"	"吊")
+("rlln"	"咈")
+("rlmc"	"嘳")
+("rlmo"	"咷")
+("rlmt"	"嚍")
+("rlmy"	"啡")
+("rlwl"	"呻")
+("rlwv"	"嘍")
+("rlx"	"嘯")
+("rmam"	"咺")
+("rmamh"	"踼")
+("rmamo"	"踶")
+("rmanw"	"躝")
+("rmaph"	"踢")
+("rmasm"	"蹋")
+("rmau"	"跁")
+("rmav"	"跟")
+("rmbb"	"嚅")
+("rmbc"	"嗊")
+("rmbd"	"踩")
+("rmbe"	"嚘")
+("rmbhx"	"蹈")
+("rmbm"	"跙")
+("rmbt"	"跚")
+("rmbue"	"躩")
+("rmbug"	"躣")
+("rmbvk"	"蹊")
+("rmc"	"趴")
+("rmcw"	"哂唒")
+("rmcwa"	"蹭")
+("rmd"	"吁")
+("rmdam"	"蹅")
+("rmdhe"	"跛")
+("rmdk"	"趹")
+("rmdm"	"嚦")
+("rmea"	"踏")
+("rmf"	"吥")
+("rmfb"	"踃")
+("rmfbg"	"蹚")
+("rmfcb"	"蹐")
+("rmfdq"	"蹸")
+("rmffe"	"躞")
+("rmfj"	"呯")
+("rmfm"	"呸")
+("rmfq"	"跘")
+("rmfqu"	"踡")
+("rmgce"	"踜")
+("rmgcg"	"踛")
+("rmgdi"	"跱")
+("rmgg"	"啀跬")
+("rmggu"	"蹺")
+("rmgni"	"躊")
+("rmgt"	"哢")
+("rmgyo"	"跿")
+("rmhdf"	"踿")
+("rmhdv"	"踒")
+("rmhdw"	"蹯")
+("rmher"	"路")
+("rmhgu"	"跣")
+("rmhhw"	"蹓")
+("rmhjd"	"跦")
+("rmhjg"	"踵")
+("rmhkb"	"蹻")
+("rmhlb"	"踽")
+("rmhlc"	"躓")
+("rmhml"	"斲")
+("rmhmy"	"跅")
+("rmhnd"	"跺")
+("rmhoo"	"蹤蹝")
+("rmhqo"	"跌")
+("rmhsb"	"蹁")
+("rmhsk"	"躈")
+("rmhuc"	"躦")
+("rmiav"	"踉")
+("rmice"	"踆")
+("rmig"	"咥")
+("rmigi"	"躕")
+("rmii"	"踐")
+("rmikk"	"跋")
+("rmir"	"跆")
+("rmite"	"踱")
+("rmitf"	"蹠")
+("rmiwg"	"躔")
+("rmixp"	"蹗")
+("rmiyr"	"踮")
+("rmjbc"	"蹎")
+("rmjcv"	"躥")
+("rmje"	"跂")
+("rmjk"	"噉")
+("rmjkd"	"踍")
+("rmjlo"	"踕")
+("rmjnu"	"踠")
+("rmjoa"	"蹜")
+("rmjp"	"跎")
+("rmjr"	"跍")
+("rmkmr"	"踦")
+("rmkms"	"跨")
+("rmkn"	"跠")
+("rmkpb"	"蹛")
+("rmksr"	"跏")
+("rmlb"	"啢")
+("rmlk"	"哽")
+("rmlm"	"啞")
+("rmlmc"	"蹪")
+("rmlmo"	"跳")
+("rmlwp"	"跩")
+("rmmcw"	"跴")
+("rmmd"	"趶")
+("rmmfb"	"躎")
+("rmmig"	"跮")
+("rmmp"	"噁")
+("rmmr"	"唔跖")
+("rmmrw"	"踾")
+("rmmt"	"趼")
+("rmmto"	"蹶")
+("rmn"	"叮")
+("rmnbs"	"踴")
+("rmnhd"	"蹂")
+("rmnhe"	"趿")
+("rmnib"	"踊")
+("rmnin"	"跢")
+("rmnmu"	"跪")
+("rmnn"	"咧")
+("rmnoe"	"蹳")
+("rmnot"	"蹬")
+("rmnr"	"呵")
+("rmodi"	"跗")
+("rmog"	"踓")
+("rmohh"	"跈")
+("rmoip"	"踗")
+("rmoir"	"蹌")
+("rmokr"	"踟")
+("rmomb"	"踚")
+("rmomg"	"跧")
+("rmomn"	"踰")
+("rmomr"	"跲")
+("rmon"	"趷")
+("rmotq"	"躌")
+("rmowy"	"踇")
+("rmpfd"	"踘")
+("rmpi"	"趵")
+("rmpmc"	"蹞")
+("rmpru"	"跑")
+("rmpt"	"跇")
+("rmptd"	"蹀")
+("rmqka"	"踳")
+("rmqkx"	"蹖")
+("rmqmc"	"蹟")
+("rmqo"	"趺")
+("rmrb"	"嗝")
+("rmrrd"	"躁")
+("rmryo"	"踀")
+("rmsje"	"踙")
+("rmsjj"	"躡")
+("rmsjr"	"踞")
+("rmsju"	"踂")
+("rmsmg"	"躍")
+("rmso"	"啄")
+("rmsp"	"跜")
+("rmss"	"距")
+("rmssr"	"跼")
+("rmstv"	"蹍")
+("rmsu"	"呃")
+("rmsup"	"跽")
+("rmta"	"踖")
+("rmtag"	"躪")
+("rmtce"	"躨")
+("rmtco"	"蹼")
+("rmtja"	"躇")
+("rmtkl"	"躑")
+("rmtlb"	"蹣")
+("rmtmc"	"踑")
+("rmtmv"	"踸")
+("rmto"	"噘")
+("rmtqa"	"躤")
+("rmtqm"	"蹉")
+("rmtt"	"跰")
+("rmttc"	"踫")
+("rmtwa"	"蹧")
+("rmtwi"	"蹲")
+("rmua"	"噆")
+("rmubb"	"蹦")
+("rmue"	"嗄")
+("rmui"	"嘎")
+("rmumb"	"踹")
+("rmvh"	"呀")
+("rmvi"	"嗕")
+("rmvid"	"躒")
+("rmvim"	"躖")
+("rmvmi"	"蹡")
+("rmvvv"	"躐")
+("rmwd"	"踝")
+("rmwf"	"嘌")
+("rmwg"	"喱")
+("rmwj"	"嘾")
+("rmwl"	"喕")
+("rmwli"	"躅")
+("rmwtj"	"蹕")
+("rmwv"	"喓")
+("rmyaj"	"踔")
+("rmybb"	"蹄")
+("rmybp"	"躘")
+("rmycb"	"蹢")
+("rmyck"	"跤")
+("rmyf"	"嘕")
+("rmyfe"	"踧")
+("rmyfu"	"蹴")
+("rmyg"	"跓")
+("rmygq"	"躂")
+("rmyjj"	"蹥")
+("rmylc"	"跡")
+("rmylh"	"踄")
+("rmylm"	"趾")
+("rmymp"	"跐")
+("rmymu"	"躚")
+("rmyoj"	"踤")
+("rmypo"	"躆")
+("rmyr"	"跕")
+("rmyrv"	"躟")
+("rmytr"	"踣")
+("rmytv"	"踥")
+("rmyx"	"躋")
+("rnbg"	"唃")
+("rnbj"	"嘝")
+("rnbk"	"喚")
+("rnd"	"吇")
+("rndu"	"吼")
+("rng"	"吜")
+("rnhb"	"噊")
+("rnhe"	"吸")
+("rnhx"	"啗")
+("rnin"	"哆")
+("rnkm"	"唌")
+("rnlr"	"啊")
+("rno"	"吹")
+("rnri"	"嚵")
+("rnwa"	"嚕")
+("rob"	"吶")
+("rod"	"咻")
+("rodi"	"咐")
+("rog"	"唯")
+("roic"	"嗿")
+("roii"	"呤")
+("roin"	"吟")
+("roip"	"唸")
+("roir"	"嗆唅")
+("roj"	"吘")
+("roll"	"吤")
+("roma"	"噲")
+("romd"	"唋")
+("roml"	"啣")
+("romn"	"喻")
+("romo"	"噞")
+("romr"	"哈啥")
+("romt"	"啽")
+("ron"	"吃")
+("ronk"	"喉")
+("roog"	"唑")
+("rop"	"吪")
+("roq"	"哖")
+("rosk"	"咿")
+("rotf"	"嘸")
+("royb"	"噙")
+("rp"	"叱")
+("rpa"	"咰")
+("rph"	"咇")
+("rphh"	"吻")
+("rpim"	"呁")
+("rpln"	"刡")
+("rpok"	"敃")
+("rpou"	"啕")
+("rppa"	"喈")
+("rpr"	"呴")
+("rpru"	"咆")
+("rptd"	"喋")
+("rpu"	"吨")
+("rpuc"	"噸")
+("rpuk"	"哅")
+("rqha"	"啪")
+("rqhk"	"喫")
+("rqhl"	"哳")
+("rqhu"	"囓")
+("rqjm"	"嘒")
+("rqkq"	"唪")
+("rqmc"	"嘖")
+("rqmf"	"嗉")
+("rqmn"	"咑")
+("rqyt"	"啦")
+("rrau"	"唈")
+("rrbyj"	"斝")
+("rrf"	"喣")
+("rrhaf"	"鷺")
+("rrhn"	"咒")
+("rrik"	"哭獸")
+("rrikr"	"器")
+("rrill"	"喌")
+("rrmcr"	"囂")
+("rrmmk"	"嚴")
+("rrmms"	"咢")
+("rrms"	"呺")
+("rrnl"	"郘")
+("rrr"	"品")
+("rrrd"	"噪喿")
+("rrrj"	"嘽")
+("rrrr"	"碞")
+("rrru"	"喦嵒")
+("rrslr"	"嚚")
+("rruc"	"噀")
+("rrvlr"	"嘂")
+("rrvp"	"呡")
+("rrwj"	"單")
+("rrwmu"	"鼉")
+("rryo"	"哫")
+("rsbn"	"唰")
+("rsh"	"叨")
+("rshaf"	"鴞鶚")
+("rsit"	"嚂")
+("rsj"	"咡咠")
+("rsjj"	"囁")
+("rsl"	"叩")
+("rslb"	"咂")
+("rsln"	"別")
+("rsm"	"叼")
+("rsmbc"	"顎")
+("rsme"	"唚")
+("rsmg"	"喔嚁")
+("rsmh"	"嘐")
+("rsmi"	"噚")
+("rsmj"	"噿")
+("rsnl"	"鄂")
+("rso"	"呎")
+("rsp"	"呢")
+("rsqf"	"嗎")
+("rsql"	"哪")
+("rsrr"	"嘔")
+("rsuu"	"啒")
+("rsyi"	"囑")
+("rsypu"	"號")
+("rta"	"唶")
+("rtak"	"嗼")
+("rtav"	"噶")
+("rtc"	"哄")
+("rtcl"	"嘶")
+("rtco"	"噗")
+("rtct"	"嗌")
+("rtgi"	"囈")
+("rtgu"	"唴")
+("rtk"	"哎")
+("rtkr"	"喏")
+("rtlf"	"嚥")
+("rtlo"	"嘆")
+("rtm"	"咁")
+("rtmc"	"唭")
+("rtmj"	"嘩")
+("rtmv"	"啿")
+("rtnd"	"囌")
+("rtod"	"嗏")
+("rtoe"	"嚄")
+("rtor"	"嗒")
+("rtq"	"咩")
+("rtqm"	"嗟")
+("rtrg"	"嚾")
+("rtub"	"嗍")
+("rtw"	"喵")
+("rtwa"	"嘈")
+("rtwi"	"噂囆")
+("rtwv"	"噥")
+("rtxc"	"嗛")
+("rtyb"	"嚆")
+("ru"	"巳")
+("rumb"	"喘")
+("rumi"	"嗤")
+("runl"	"鄳")
+("ruog"	"嗺")
+("ruoiv"	"饕")
+("rutc"	"巽")
+("ruu"	"咄")
+("rve"	"呶")
+("rvfi"	"喲")
+("rvi"	"吆")
+("rvii"	"嘰")
+("rvis"	"呦")
+("rvl"	"叫")
+("rvnk"	"吳")
+("rvno"	"喙")
+("rvp"	"民")
+("rvvu"	"嗈")
+("rwb"	"喟")
+("rwc"	"呬")
+("rwg"	"哩")
+("rwgf"	"嘿")
+("rwgg"	"嚜")
+("rwim"	"嘓")
+("rwk"	"咽")
+("rwkp"	"嗯")
+("rwl"	"呷")
+("rwlb"	"喁")
+("rwlc"	"嘪")
+("rwlg"	"囉")
+("rwli"	"噣")
+("rwlv"	"噮")
+("rwmv"	"喂")
+("rwnl"	"鄙")
+("rwot"	"嗢")
+("rwtj"	"嗶")
+("rwyi"	"呣")
+("rxu"	"黽")
+("ryaj"	"啅")
+("ryao"	"噷")
+("rybb"	"啼")
+("rybp"	"嚨")
+("rybs"	"嗙")
+("rycb"	"嘀")
+("ryck"	"咬")
+("rydg"	"囃")
+("rydu"	"嚫")
+("ryfu"	"噈")
+("rygq"	"噠")
+("ryhc"	"嚬")
+("ryhh"	"喭")
+("ryhn"	"吭")
+("ryib"	"唷")
+("ryjj"	"嗹")
+("ryk"	"呅")
+("rymb"	"啃")
+("rymh"	"噦")
+("rymp"	"呲")
+("rymr"	"唁")
+("rymu"	"嚙")
+("ryo"	"足")
+("ryoj"	"啐")
+("rypb"	"嘴")
+("rypd"	"喍")
+("rypk"	"噳")
+("rypm"	"噓")
+("rypo"	"噱")
+("rypt"	"嚧")
+("rypu"	"唬")
+("ryr"	"呫")
+("ryrb"	"嗃")
+("ryrd"	"啍")
+("ryrn"	"哼")
+("ryro"	"嚎")
+("ryru"	"喨")
+("ryrv"	"嚷")
+("rysk"	"嗾")
+("rysy"	"唹")
+("ryta"	"喑")
+("rytp"	"噫")
+("rytv"	"唼")
+("ryvg"	"噰")
+("ryvo"	"咳")
+("rywe"	"嚃")
+("ryx"	"嚌")
+("s"	"尸")
+("sahaf"	"鷵")
+("sahni"	"飁")
+("sammu"	"翫")
+("sav"	"匽")
+("sbcc"	"屭")
+("sbhg"	"朢")
+("sbln"	"刷")
+("sbug"	"匷")
+("sc"	"匹")
+("schaf"	"鴄")
+("schne"	"殿")
+("scwa"	"層")
+("se"	"尿")
+("seb"	"腎臀")
+("sebuc"	"賢贀")
+("sec"	"鋻")
+("sed"	"棸")
+("sef"	"焣")
+("seg"	"堅壂")
+("sehaf"	"鷖")
+("selmi"	"蜸")
+("semcw"	"醫")
+("semgi"	"瑿")
+("semoo"	"毉")
+("semr"	"硻")
+("semrt"	"豎")
+("seog"	"匯")
+("seooo"	"聚")
+("seq"	"掔")
+("sesmm"	"翳")
+("sev"	"娶婜嫛")
+("sevif"	"緊繄")
+("sewgf"	"黳")
+("sfa"	"馹")
+("sfajv"	"騴")
+("sfamj"	"駻")
+("sfamo"	"騠")
+("sfapp"	"騉")
+("sfapv"	"騔")
+("sfb"	"屑")
+("sfbbr"	"騧")
+("sfbgr"	"騆")
+("sfbm"	"駔")
+("sfbmr"	"駧")
+("sfbr"	"駉")
+("sfbvk"	"騱")
+("sfcru"	"駾")
+("sfcwa"	"驓")
+("sfd"	"屎")
+("sfdi"	"尉")
+("sfdk"	"駃")
+("sfdl"	"駷")
+("sfdoo"	"騋")
+("sfe"	"馭")
+("sfeii"	"騷")
+("sffdq"	"驎")
+("sfggu"	"驍")
+("sfhag"	"騜")
+("sfhdp"	"騬")
+("sfher"	"駱")
+("sfhgu"	"駪")
+("sfhhw"	"騮")
+("sfhi"	"騩")
+("sfhkb"	"驕")
+("sfhni"	"颿")
+("sfhp"	"馲")
+("sfhsb"	"騙")
+("sfhsm"	"騸")
+("sfhwp"	"驄")
+("sfhxe"	"騪")
+("sfiav"	"駺")
+("sfice"	"駿")
+("sfihu"	"馻")
+("sfiih"	"驂")
+("sfij"	"駥")
+("sfiok"	"騃")
+("sfir"	"駘")
+("sfit"	"駴")
+("sfiuh"	"駹")
+("sfjig"	"驖")
+("sfjmc"	"驞")
+("sfjp"	"駝")
+("sfk"	"馱")
+("sfkk"	"駁")
+("sfkmr"	"騎")
+("sfl"	"馽")
+("sflk"	"駛")
+("sflll"	"馴")
+("sflmo"	"駣")
+("sflmy"	"騑")
+("sflpc"	"驥")
+("sflw"	"駎")
+("sflws"	"騁")
+("sflx"	"驌")
+("sfmbu"	"驦")
+("sfmfj"	"駍")
+("sfmfm"	"駓")
+("sfmhf"	"騵")
+("sfmig"	"駤")
+("sfmj"	"馯")
+("sfmmp"	"驪")
+("sfmwf"	"驃")
+("sfmwj"	"驔")
+("sfmwv"	"騕")
+("sfnhb"	"驈")
+("sfnhd"	"騥")
+("sfnhe"	"馺")
+("sfnkq"	"騝")
+("sfnok"	"騤")
+("sfnoo"	"騛")
+("sfodi"	"駙")
+("sfog"	"騅")
+("sfohh"	"駗")
+("sfoii"	"駖")
+("sfok"	"駇")
+("sfomd"	"駼")
+("sfomg"	"駩")
+("sfomo"	"驗")
+("sfomr"	"騇")
+("sfpd"	"馳")
+("sfph"	"駜")
+("sfpi"	"馰")
+("sfpou"	"騊")
+("sfpr"	"駒")
+("sfpuu"	"騶")
+("sfqjr"	"騞")
+("sfrb"	"駽")
+("sfrrj"	"驒")
+("sfrye"	"騢")
+("sfseo"	"驟")
+("sfsff"	"驫")
+("sfshr"	"駋")
+("sfsj"	"駬")
+("sfsma"	"騽")
+("sfsme"	"駸")
+("sfsnd"	"驏")
+("sfsrr"	"驅")
+("sfss"	"駏")
+("sfssr"	"駶")
+("sft"	"馵")
+("sftaj"	"騲")
+("sftbn"	"騚")
+("sftjd"	"驧")
+("sftlf"	"驠")
+("sftlm"	"騹")
+("sftmc"	"騏")
+("sftmj"	"驊")
+("sftrg"	"驩")
+("sftt"	"駢")
+("sfuce"	"騣")
+("sfuob"	"驨")
+("sfvne"	"騄")
+("sfwc"	"駟")
+("sfwd"	"騍")
+("sfwk"	"駰")
+("sfwlj"	"驛")
+("sfwtj"	"驆")
+("sfwvf"	"騾")
+("sfyck"	"駮")
+("sfydk"	"驐")
+("sfyg"	"駐")
+("sfyhv"	"褧")
+("sfypm"	"驉")
+("sfypt"	"驢")
+("sfyrv"	"驤")
+("sfytj"	"騂騿")
+("sfyvo"	"駭")
+("sfywm"	"驙")
+("sghaf"	"鸐")
+("sgi"	"戳")
+("sgjwp"	"聽")
+("sgks"	"劻")
+("sgln"	"剭")
+("sh"	"刀")
+("shaf"	"鳲")
+("shaph"	"鬄")
+("shawe"	"鬘")
+("shbb"	"鬅")
+("shbt"	"匴")
+("shcwa"	"鬙")
+("shdbn"	"鬎")
+("shdci"	"鬆")
+("shdhe"	"髲")
+("shfb"	"髾")
+("shfqu"	"鬈")
+("shgb"	"髯")
+("shgr"	"髻")
+("shhaf"	"鳭鷚")
+("shhdn"	"鬁")
+("shhej"	"髼")
+("shhhc"	"鬚")
+("shhjr"	"髺")
+("shhqu"	"髦")
+("shi"	"刃戮")
+("shiih"	"鬖")
+("shikk"	"髮")
+("shjbc"	"鬒")
+("shjmc"	"鬢")
+("shjmf"	"鬃")
+("shjpa"	"鬐")
+("shjrb"	"鬍")
+("shkmb"	"鬌")
+("shlbu"	"髧")
+("shmbc"	"顟")
+("shmfm"	"髬")
+("shml"	"匠")
+("shmu"	"髡")
+("shnih"	"髳")
+("shnl"	"鄝")
+("shob"	"屩")
+("shod"	"屧髹")
+("shoe"	"屐履")
+("shog"	"雡")
+("shoma"	"鬠")
+("shoo"	"屣")
+("shoog"	"髽")
+("shot"	"屜")
+("shov"	"屨")
+("shpru"	"髱")
+("shqka"	"鬊")
+("shqu"	"尾")
+("shr"	"召")
+("shsb"	"匾")
+("shshr"	"髫")
+("shsj"	"髶")
+("shtak"	"鬕")
+("shtbn"	"鬋")
+("shtlb"	"鬗")
+("shtw"	"髷")
+("shtwv"	"鬞")
+("shtxc"	"鬑")
+("shvvv"	"鬣")
+("shwlv"	"鬟")
+("shyhs"	"髣")
+("shymp"	"髭")
+("shyrv"	"鬤")
+("sibt"	"監")
+("sif"	"熨")
+("sihhh"	"髟")
+("sihk"	"镺")
+("sihml"	"斸")
+("sihq"	"犚")
+("sihqo"	"镻")
+("sikcf"	"镽")
+("silq"	"肆")
+("sinl"	"鄩")
+("sip"	"忍慰")
+("sisuu"	"镼")
+("siyhv"	"褽")
+("sj"	"耳")
+("sjb"	"臂")
+("sjc"	"屄")
+("sjcim"	"聬")
+("sjd"	"檗")
+("sje"	"取")
+("sjenl"	"郰")
+("sjf"	"耿")
+("sjfd"	"糪")
+("sjg"	"壁")
+("sjgb"	"聃")
+("sjgr"	"聐")
+("sjhaf"	"鷿")
+("sjhhl"	"聊")
+("sjhjr"	"聒")
+("sjhqu"	"毦")
+("sjhwp"	"聰")
+("sjirm"	"聝")
+("sjjcm"	"聜")
+("sjjn"	"匭")
+("sjjpn"	"聹")
+("sjka"	"屠")
+("sjkf"	"屪")
+("sjki"	"耾")
+("sjlb"	"幦")
+("sjlbu"	"耽")
+("sjlmc"	"聵")
+("sjln"	"刵")
+("sjlws"	"聘")
+("sjmbc"	"顳")
+("sjmbl"	"聏")
+("sjmgi"	"璧")
+("sjmn"	"耵")
+("sjmvn"	"甓")
+("sjmym"	"聇")
+("sjncr"	"聸")
+("sjnl"	"耶")
+("sjnok"	"聧")
+("sjoii"	"聆")
+("sjoin"	"耹")
+("sjp"	"恥憵")
+("sjq"	"擘")
+("sjr"	"居")
+("sjrxu"	"鼊")
+("sjryo"	"躄")
+("sjsh"	"劈")
+("sjsj"	"聑")
+("sjsjj"	"聶")
+("sju"	"耴")
+("sjv"	"嬖")
+("sjvif"	"繴")
+("sjvis"	"聈")
+("sjvit"	"聯")
+("sjyhv"	"襞")
+("sjyia"	"職")
+("sjymr"	"譬")
+("sjyrn"	"聤")
+("sk"	"尹")
+("skn"	"尻")
+("skr"	"君")
+("slb"	"匝")
+("slmbc"	"頤")
+("slmc"	"匱")
+("slmy"	"匪屝")
+("slo"	"臥")
+("slorr"	"臨")
+("slqmc"	"賾")
+("slsl"	"臣")
+("slsll"	"臦")
+("slwv"	"屢")
+("sm"	"刁")
+("smamo"	"翨")
+("smbjj"	"翬")
+("smblb"	"帚")
+("smcsh"	"翂")
+("smdhe"	"翍")
+("smg"	"匡")
+("smha"	"習")
+("smhaf"	"翵")
+("smhqo"	"翐")
+("smhqu"	"毣")
+("smig"	"屋")
+("smikk"	"翇")
+("smkoo"	"翜")
+("sml"	"翀")
+("smm"	"羾")
+("smmbc"	"頨")
+("smmri"	"尋")
+("smnp"	"屍")
+("smog"	"翟")
+("smohh"	"翏")
+("smonk"	"翭")
+("smpr"	"翑")
+("smr"	"司")
+("smsim"	"羽")
+("smt"	"羿")
+("smuce"	"翪")
+("smv"	"長")
+("smwtc"	"翼")
+("smyjj"	"翴")
+("smyoj"	"翠")
+("smyrb"	"翯")
+("smyrf"	"翞")
+("smyt"	"翌翋")
+("smytv"	"翣")
+("sndd"	"孱")
+("snlr"	"屙")
+("so"	"尺")
+("somr"	"匼")
+("sonl"	"鄹")
+("sorc"	"咫")
+("sp"	"尼")
+("spd"	"匜")
+("sphaf"	"鵋")
+("sphh"	"匢")
+("spp"	"屁")
+("sqnl"	"那")
+("sqsf"	"馬")
+("sr"	"叵")
+("srbt"	"盬")
+("srbuu"	"覗")
+("srf"	"焄")
+("srhaf"	"鷗鵘鶋")
+("srhg"	"聖")
+("srhne"	"毆")
+("srks"	"劭")
+("srlb"	"屌")
+("srmbc"	"頵")
+("srmvn"	"甌")
+("srnl"	"邵郡")
+("srno"	"歐")
+("srp"	"慝")
+("srrj"	"匰")
+("srrr"	"區")
+("srsl"	"卲")
+("srtq"	"群")
+("srye"	"敺")
+("srytj"	"辟")
+("ss"	"巨")
+("ssf"	"燛")
+("sskll"	"臩")
+("sslii"	"螶")
+("ssr"	"局")
+("ssu"	"凹")
+("stkr"	"匿")
+("stqq"	"羼")
+("stt"	"屏")
+("stv"	"展")
+("su"	"己已")
+("suf"	"熙")
+("sug"	"屆")
+("suhaf"	"鶌")
+("suhu"	"兕")
+("sund"	"屘")
+("sunl"	"邔")
+("suok"	"改")
+("sup"	"忌")
+("sut"	"异")
+("suu"	"屈")
+("suv"	"妀媐")
+("svhaf"	"鶠")
+("svnl"	"郾")
+("sw"	"屇")
+("swbt"	"鹽")
+("swbuu"	"覽")
+("swc"	"鑒")
+("swl"	"匣")
+("syhn"	"匟")
+("sytj"	"屖")
+("syyi"	"屬")
+("syyq"	"犀")
+("t"	"廿")
+("ta"	"昔")
+("taa"	"菖")
+("tab"	"萌")
+("tabu"	"萺")
+("tadhe"	"皵")
+("tagi"	"蒔")
+("tahaf"	"鵲")
+("tahml"	"斮")
+("tahs"	"葃")
+("taiu"	"蔇")
+("taj"	"草")
+("tak"	"莫")
+("taka"	"暮")
+("takb"	"幕")
+("takf"	"驀")
+("takg"	"墓")
+("takp"	"慕")
+("takq"	"摹")
+("taks"	"募")
+("taln"	"剒")
+("tan"	"菛")
+("tanb"	"蕑")
+("tang"	"藺")
+("tanp"	"蕄")
+("tanw"	"蘭")
+("tapp"	"菎")
+("tapv"	"葛")
+("tase"	"蕞")
+("tau"	"芭")
+("tav"	"茛")
+("tawe"	"蔓")
+("tbac"	"蓂")
+("tbau"	"萉")
+("tbbb"	"蓇")
+("tbbe"	"薆")
+("tbbq"	"蕣")
+("tbbr"	"萵")
+("tbbu"	"薍")
+("tbbuu"	"覯")
+("tbc"	"典")
+("tbcn"	"萴")
+("tbcsh"	"黺")
+("tbcv"	"蘡")
+("tbd"	"菜槊")
+("tbfe"	"藤")
+("tbg"	"塑")
+("tbhg"	"薶")
+("tbhs"	"葄")
+("tbhu"	"藐")
+("tbijb"	"黼")
+("tbikk"	"黻")
+("tbjj"	"葷")
+("tbks"	"勱")
+("tbli"	"繭")
+("tbln"	"前蒯")
+("tbm"	"苴")
+("tbmbc"	"顜顢")
+("tbme"	"萲")
+("tbmo"	"蒙")
+("tbmr"	"茼")
+("tbms"	"莇")
+("tbmw"	"蒏")
+("tbnd"	"莩")
+("tbnf"	"煎")
+("tbnh"	"剪")
+("tbni"	"蒬")
+("tbnm"	"翦")
+("tbof"	"蔡")
+("tbok"	"散")
+("tbp"	"愬")
+("tbpr"	"葋")
+("tbse"	"菔")
+("tbtv"	"菵")
+("tbu"	"苜")
+("tbud"	"蔝")
+("tbuk"	"藈")
+("tbul"	"薡")
+("tbut"	"萛")
+("tbuu"	"莧")
+("tbv"	"荽")
+("tbyj"	"斠")
+("tc"	"共菳")
+("tca"	"普")
+("tcb"	"期")
+("tcbt"	"益")
+("tcfb"	"黹")
+("tcg"	"基")
+("tchaf"	"鶼鷬")
+("tche"	"夔")
+("tchml"	"斯")
+("tcim"	"蓊")
+("tcjwj"	"輂")
+("tclmi"	"蛬")
+("tcmr"	"碁")
+("tcno"	"欺歉")
+("tcp"	"恭惎")
+("tcq"	"拲")
+("tcru"	"巷莌")
+("tcsd"	"棻")
+("tcsh"	"芬")
+("tcst"	"葐")
+("tctd"	"業")
+("tcte"	"叢")
+("tcvif"	"綦")
+("tcwm"	"酋")
+("tcyg"	"黈")
+("tcyj"	"斢")
+("tcymr"	"諅")
+("tdb"	"茦")
+("tdbb"	"蕀")
+("tdbk"	"蓛")
+("tdbn"	"莿")
+("tdbu"	"葙")
+("tdci"	"菘")
+("tdd"	"菻")
+("tdhaf"	"鷋")
+("tdhl"	"菥")
+("tdj"	"茉")
+("tdk"	"芵")
+("tdlc"	"藾")
+("tdlo"	"蔌")
+("tdm"	"苯")
+("tdmq"	"葦")
+("tdnl"	"鄴")
+("tdoo"	"萊")
+("tdr"	"莕")
+("tdsr"	"藲")
+("tdw"	"菄")
+("tdwf"	"萰")
+("teah"	"蕩")
+("tebm"	"菹")
+("tec"	"鑿")
+("ted"	"莯")
+("tede"	"菠")
+("tefh"	"莎")
+("tege"	"蔆")
+("tehr"	"落萿")
+("tehv"	"蒎")
+("tehw"	"藩")
+("teib"	"蒲")
+("teii"	"薄")
+("teiv"	"蒗")
+("telu"	"莐")
+("tem"	"茳")
+("temf"	"薸")
+("temj"	"萍藫")
+("temr"	"菏")
+("tene"	"莈")
+("teod"	"蒤")
+("teom"	"虃")
+("teon"	"蕍")
+("teot"	"蒞")
+("terd"	"藻")
+("tesd"	"蕖")
+("tesr"	"菬")
+("tess"	"菃")
+("tesu"	"范")
+("tett"	"蓱")
+("tewb"	"蕅")
+("tewt"	"薀")
+("teyb"	"薃")
+("teye"	"蔋")
+("teyu"	"蓅")
+("teyv"	"茫")
+("tf"	"苂")
+("tfaj"	"蔊")
+("tfb"	"莦")
+("tfbk"	"蔽")
+("tfbn"	"萷")
+("tff"	"菼")
+("tfff"	"藀")
+("tfkc"	"蘱")
+("tfku"	"虌")
+("tfmc"	"薠")
+("tfmu"	"茪")
+("tfnl"	"酀")
+("tfqu"	"菤")
+("tg"	"芏")
+("tgb"	"苒")
+("tgbuu"	"觀")
+("tgce"	"菱")
+("tgdi"	"對")
+("tgeno"	"羨")
+("tgf"	"羔")
+("tgftk"	"羹")
+("tgg"	"茥")
+("tggi"	"葑蓺")
+("tggu"	"蕘")
+("tghaf"	"鸛")
+("tghds"	"羲")
+("tghni"	"飌")
+("tghqi"	"義")
+("tghu"	"羌")
+("tgif"	"爇")
+("tgii"	"藝")
+("tgimo"	"羡")
+("tgine"	"羕")
+("tgit"	"蓋")
+("tgje"	"蕔")
+("tgji"	"蓻")
+("tgk"	"美")
+("tgks"	"勸")
+("tglln"	"羛")
+("tgmbc"	"顴")
+("tgni"	"薵")
+("tgnl"	"酄")
+("tgno"	"歡羑莰")
+("tgobo"	"臡")
+("tgow"	"薔")
+("tgp"	"恙戁")
+("tgpm"	"荺")
+("tgrg"	"薹")
+("tgsk"	"蔜")
+("tgte"	"薣")
+("tgtr"	"善")
+("tgv"	"姜")
+("tgwc"	"藚")
+("tgyv"	"蘾")
+("thaf"	"蔦蘤")
+("thag"	"葟")
+("thai"	"菂")
+("thau"	"葩")
+("thbh"	"虋")
+("thbk"	"薁")
+("thbu"	"首")
+("thcn"	"藰")
+("thda"	"萫")
+("thdb"	"蕱")
+("thde"	"薐")
+("thdf"	"萩")
+("thdh"	"菞蕛")
+("thdm"	"蒩")
+("thdn"	"莉")
+("thds"	"莠")
+("thdv"	"萎藒")
+("thdw"	"蕃")
+("ther"	"茖")
+("they"	"苳")
+("thgf"	"薰")
+("thhaf"	"鶜")
+("thhc"	"蕦")
+("thhd"	"蔾")
+("thhe"	"藜")
+("thhj"	"萆")
+("thhl"	"茆")
+("thi"	"蒐")
+("thj"	"芊")
+("thjd"	"茱孽")
+("thje"	"葮")
+("thjg"	"董")
+("thjm"	"菙")
+("thjo"	"躠")
+("thk"	"芺")
+("thkb"	"蕎")
+("thkp"	"菾")
+("thlb"	"萭")
+("thlf"	"蘌")
+("thmb"	"蘬")
+("thml"	"芹")
+("thmr"	"茩")
+("thne"	"芟")
+("thni"	"芃")
+("thoe"	"蕧")
+("thok"	"薇藢")
+("thol"	"蓹")
+("thon"	"荇蘅")
+("thoo"	"蓏蓗蓰蓯")
+("thoq"	"葎")
+("thqi"	"莪")
+("thqo"	"苵")
+("thqu"	"芼")
+("thrj"	"薛")
+("ths"	"苲")
+("thsb"	"菺萹")
+("thse"	"蒑")
+("thsk"	"薂")
+("thsu"	"蔰")
+("thup"	"蒠")
+("thvi"	"蘶")
+("thwp"	"蔥蓖")
+("thxc"	"藇")
+("thxf"	"蕮")
+("thxo"	"萸")
+("thye"	"蒰")
+("tiav"	"莨")
+("tibi"	"蒪")
+("tice"	"荾")
+("tidq"	"藦")
+("tidr"	"蘑")
+("tidy"	"蘼")
+("tih"	"茂")
+("tihaf"	"鷷")
+("tihc"	"蕆")
+("tihm"	"菧")
+("tihr"	"葴蒧")
+("tihs"	"荿")
+("tihv"	"葳")
+("tiih"	"蔘")
+("tij"	"茙")
+("tijb"	"莆")
+("tije"	"莍")
+("tikf"	"蒍")
+("tikk"	"茇")
+("tikt"	"莽")
+("tilo"	"菮")
+("tilr"	"蓎")
+("timo"	"茨")
+("tims"	"藏")
+("tino"	"芝")
+("tioc"	"薋")
+("tip"	"芅懟")
+("tipd"	"蘪")
+("tipf"	"藨")
+("tir"	"苔")
+("titb"	"蓆")
+("titc"	"薕")
+("titf"	"蔗")
+("tixf"	"薦")
+("tixp"	"蔍")
+("tj"	"卅")
+("tjam"	"靼")
+("tjamo"	"鞮")
+("tjapv"	"鞨")
+("tjau"	"靶")
+("tjav"	"鞎")
+("tjavf"	"韅")
+("tjb"	"芾")
+("tjbd"	"荸")
+("tjbj"	"萳")
+("tjbm"	"萓靻")
+("tjck"	"葖")
+("tjcn"	"藭")
+("tjcr"	"蓉")
+("tjdhe"	"鞁")
+("tjdj"	"靺")
+("tjds"	"葧")
+("tje"	"芰")
+("tjea"	"鞜")
+("tjef"	"蘻")
+("tjfb"	"鞘")
+("tjfbr"	"鞝")
+("tjfq"	"靽")
+("tjgg"	"鞋")
+("tjgr"	"鞊")
+("tjgwc"	"韇")
+("tjhaf"	"鷨")
+("tjhd"	"鞂")
+("tjhdf"	"鞦")
+("tjhhj"	"鞞")
+("tjhml"	"靳")
+("tjii"	"蓴")
+("tjip"	"蕙")
+("tjjcm"	"鞚")
+("tjjj"	"蓒")
+("tjjl"	"蔪")
+("tjjv"	"鞍")
+("tjka"	"著")
+("tjkp"	"荖")
+("tjks"	"勒")
+("tjlbk"	"鞅")
+("tjlo"	"萐")
+("tjlv"	"萋")
+("tjlwv"	"鞻")
+("tjmc"	"蔩")
+("tjme"	"蔻")
+("tjmj"	"靬")
+("tjmm"	"萱")
+("tjmn"	"苧靪")
+("tjmo"	"萣")
+("tjmr"	"菪")
+("tjmu"	"莞靰")
+("tjmwm"	"韁")
+("tjnau"	"鞔")
+("tjnhd"	"鞣")
+("tjnhe"	"靸")
+("tjni"	"鞃")
+("tjnkq"	"鞬")
+("tjnl"	"靷鄿")
+("tjnu"	"菀")
+("tjoa"	"蓿")
+("tjoin"	"靲")
+("tjomk"	"鞭")
+("tjomr"	"鞈")
+("tjomt"	"鞥")
+("tjop"	"靴")
+("tjpa"	"蓍")
+("tjpfd"	"鞠")
+("tjpi"	"靮")
+("tjpn"	"薴")
+("tjpru"	"鞄")
+("tjpt"	"靾")
+("tjptd"	"鞢")
+("tjpu"	"蔤")
+("tjpyr"	"鞫")
+("tjqyt"	"鞡")
+("tjr"	"苦")
+("tjrb"	"葫鞙")
+("tjrr"	"菅")
+("tjshr"	"鞀")
+("tjtc"	"蕡")
+("tjtif"	"韉")
+("tjtoe"	"韄")
+("tjtor"	"鞳")
+("tjtq"	"藆")
+("tjv"	"荌")
+("tjvii"	"鞿")
+("tjvis"	"靿")
+("tjwj"	"莗")
+("tjydl"	"鞹")
+("tjygq"	"韃")
+("tjymu"	"韆")
+("tk"	"艾")
+("tkce"	"蔱")
+("tkd"	"檠")
+("tke"	"苃")
+("tkhaf"	"鴱鶧")
+("tkhf"	"荻")
+("tkhg"	"莥")
+("tkhi"	"藱")
+("tkhw"	"蕕")
+("tkkb"	"莃")
+("tkld"	"荐")
+("tklg"	"茬")
+("tklmi"	"蟼")
+("tklu"	"菴")
+("tkms"	"荂")
+("tkn"	"艽荑")
+("tkni"	"芄")
+("tknl"	"鄭鄚")
+("tkok"	"蒺")
+("tkoo"	"莢")
+("tkp"	"憼")
+("tkpb"	"蔕")
+("tkq"	"擎")
+("tkr"	"若")
+("tkrp"	"惹")
+("tksqf"	"驚")
+("tksr"	"茄")
+("tkss"	"荔")
+("tkymr"	"警")
+("tlbk"	"英")
+("tlj"	"革")
+("tllmi"	"蟴")
+("tlln"	"茀")
+("tlmc"	"蕢")
+("tlmi"	"茧")
+("tlmt"	"藎")
+("tlmy"	"菲")
+("tlpf"	"燕鷰")
+("tlqm"	"堇")
+("tlvk"	"藪")
+("tlw"	"苖")
+("tlwv"	"蔞")
+("tlx"	"蕭")
+("tm"	"甘")
+("tmam"	"荁")
+("tmbb"	"薷")
+("tmbg"	"藿")
+("tmbi"	"蕓蕶")
+("tmbl"	"荋")
+("tmbr"	"蘦")
+("tmbuu"	"覲")
+("tmbw"	"蕾")
+("tmcw"	"茜莤")
+("tmd"	"芋某")
+("tmdm"	"藶")
+("tmf"	"芣")
+("tmfb"	"薾")
+("tmff"	"蒜")
+("tmfj"	"苹")
+("tmfm"	"苤")
+("tmgf"	"蘸")
+("tmgn"	"菿薽")
+("tmgr"	"蘁")
+("tmhf"	"蒝")
+("tmhg"	"蕥")
+("tmhml"	"斳")
+("tmig"	"荎")
+("tmks"	"勤")
+("tmlm"	"菫")
+("tmmc"	"其")
+("tmmi"	"芸")
+("tmms"	"葝")
+("tmmu"	"芫")
+("tmmv"	"甚")
+("tmn"	"艼")
+("tmnh"	"薚")
+("tmnj"	"茿")
+("tmnl"	"鄞邯")
+("tmnm"	"薤")
+("tmnn"	"茢")
+("tmnr"	"苛")
+("tmnv"	"蒆薞")
+("tmoa"	"藸")
+("tmob"	"苪")
+("tmom"	"蕤")
+("tmoo"	"莁")
+("tmpt"	"葬")
+("tmrb"	"蒚")
+("tmrr"	"藞")
+("tmrt"	"荳")
+("tmrw"	"葍")
+("tmtj"	"華")
+("tmtn"	"荊")
+("tmto"	"蕨")
+("tmvh"	"芽")
+("tmvi"	"蓐")
+("tmvm"	"莖")
+("tmwc"	"黃")
+("tmwf"	"蔈")
+("tmwj"	"蕈")
+("tmwm"	"薑")
+("tmwv"	"葽")
+("tmy"	"芐")
+("tmyf"	"蔫")
+("tmymu"	"齹")
+("tn"	"芎")
+("tnbc"	"萯")
+("tnbe"	"藑")
+("tnbq"	"薢")
+("tncr"	"薝")
+("tnd"	"芓")
+("tndf"	"蓀")
+("tndo"	"菰")
+("tndu"	"芤")
+("tnef"	"蒸")
+("tnfd"	"蘇")
+("tnfn"	"薊")
+("tnfq"	"蘚")
+("tnhd"	"葇")
+("tnhe"	"芨")
+("tnhs"	"艿蓩")
+("tnhx"	"萏")
+("tni"	"苰")
+("tnih"	"茅")
+("tnin"	"芧茤")
+("tniq"	"荈")
+("tnir"	"茗")
+("tniu"	"苑")
+("tniv"	"蕵")
+("tnkg"	"莛")
+("tnkm"	"莚")
+("tnlc"	"藬")
+("tnld"	"蒢")
+("tnli"	"蔭")
+("tnlm"	"薩")
+("tnlp"	"蘟")
+("tnlw"	"蔯")
+("tnmm"	"蒻")
+("tnmu"	"蔬")
+("tnnc"	"蕷")
+("tnnl"	"鄸")
+("tno"	"芡")
+("tnok"	"葵")
+("tnsj"	"葞")
+("tntg"	"虇")
+("tnue"	"菡")
+("tnui"	"菟")
+("tnup"	"葾")
+("tnus"	"葂")
+("toav"	"艱")
+("tob"	"芮")
+("tobg"	"蒮")
+("tod"	"茶茠")
+("todi"	"苻")
+("tof"	"苶")
+("tog"	"茌萑雈")
+("togf"	"蕉")
+("togx"	"舊")
+("tohaf"	"鸏")
+("tohg"	"荏")
+("tohqu"	"氋")
+("tohs"	"莋")
+("toi"	"茷")
+("toiav"	"養")
+("toie"	"葰")
+("toii"	"苓")
+("toik"	"茯")
+("toin"	"芩")
+("toir"	"蒼")
+("tokf"	"蘩")
+("tokg"	"薙")
+("tolb"	"蓨")
+("told"	"蓧")
+("toll"	"芥")
+("toma"	"薈")
+("tomb"	"菕蘥")
+("tomd"	"荼")
+("tomg"	"荃")
+("tomm"	"芢")
+("tomn"	"芞")
+("tomo"	"薟")
+("tomr"	"荷荅")
+("tonk"	"葔")
+("tono"	"歎")
+("tonwf"	"鯗")
+("tooe"	"蓌")
+("toog"	"難莝")
+("took"	"蘞")
+("toom"	"葅")
+("top"	"花")
+("toqb"	"蒨")
+("tord"	"葆")
+("tose"	"葠")
+("totf"	"蕪")
+("touk"	"蒛")
+("towy"	"莓")
+("toyr"	"蓓")
+("tp"	"芯")
+("tpa"	"荀")
+("tpfd"	"菊")
+("tph"	"苾")
+("tphh"	"芴")
+("tpi"	"芍芶")
+("tpib"	"葡")
+("tpko"	"薿")
+("tpmw"	"蔔")
+("tpou"	"萄")
+("tpp"	"芘")
+("tppp"	"蕊")
+("tpr"	"苟茍")
+("tpru"	"苞")
+("tptd"	"葉")
+("tpu"	"芚")
+("tpyv"	"蘹")
+("tq"	"羊")
+("tqapv"	"羯")
+("tqcsh"	"羒")
+("tqda"	"藉")
+("tqdb"	"藕")
+("tqfh"	"莏")
+("tqhdw"	"羳")
+("tqhne"	"羖")
+("tqhpm"	"羝")
+("tqhr"	"葀")
+("tqib"	"蒱")
+("tqice"	"羧")
+("tqihr"	"羬")
+("tqij"	"羢")
+("tqik"	"菝")
+("tqixe"	"羻")
+("tqjm"	"蔧")
+("tqjmn"	"羜")
+("tqjmu"	"羦")
+("tqjtc"	"羵")
+("tqka"	"萶")
+("tqkd"	"蓁")
+("tqkn"	"羠")
+("tqkq"	"菶")
+("tqlw"	"菗")
+("tqm"	"差")
+("tqmb"	"菁")
+("tqmbb"	"羺")
+("tqmhf"	"羱")
+("tqmvm"	"羥")
+("tqng"	"羞")
+("tqo"	"芙")
+("tqog"	"蓷")
+("tqoii"	"羚")
+("tqomn"	"羭")
+("tqomo"	"羷")
+("tqpu"	"菢")
+("tqqo"	"荴")
+("tqsmm"	"翔")
+("tqumf"	"羰")
+("tqwj"	"蘀")
+("tqyt"	"菈")
+("tqywm"	"羶")
+("trhr"	"莒")
+("trjd"	"菋")
+("trji"	"蕺")
+("trjl"	"蘄")
+("trmr"	"蕗")
+("trnl"	"鄀鄯")
+("trog"	"蓶")
+("trok"	"敬")
+("tron"	"荶")
+("trrg"	"雚")
+("trrj"	"蕇")
+("trrr"	"虈")
+("trrs"	"萼")
+("trsj"	"葺")
+("trvp"	"苠")
+("trye"	"葭")
+("tsem"	"蘙")
+("tseo"	"藂")
+("tsfi"	"蔚")
+("tsh"	"芀")
+("tshr"	"苕")
+("tsic"	"蕻")
+("tsip"	"荵藯")
+("tsiq"	"蕼")
+("tsit"	"藍")
+("tsj"	"茸")
+("tsja"	"蘵")
+("tsjd"	"蘗")
+("tsje"	"菆")
+("tsk"	"芛")
+("tskr"	"莙")
+("tsle"	"菣")
+("tsll"	"茞")
+("tsmg"	"藋")
+("tsmh"	"蓼")
+("tsmi"	"蕁")
+("tsmv"	"萇")
+("tsp"	"苨懃")
+("tsrf"	"蔒")
+("tsrj"	"薜")
+("tsrr"	"蓲")
+("tss"	"苣")
+("tsu"	"芑")
+("tt"	"井并卌")
+("ttbn"	"葥")
+("ttc"	"並")
+("ttcf"	"藄")
+("ttcg"	"蘣蘳")
+("ttgb"	"冓")
+("ttgf"	"蓔")
+("ttgi"	"薱")
+("tthaf"	"鵧鷁")
+("tti"	"丼")
+("ttjd"	"蘜")
+("ttlm"	"蓳")
+("ttmbc"	"頩")
+("ttmc"	"萁")
+("ttmv"	"葚")
+("ttmvn"	"瓶")
+("ttnau"	"艵")
+("ttnl"	"郱")
+("ttqm"	"蒫")
+("ttshi"	"刱")
+("ttt"	"荓")
+("ttub"	"蒴")
+("ttvb"	"蘛")
+("ttwli"	"蠲")
+("ttxc"	"蒹")
+("tub"	"朔")
+("tuirm"	"馘")
+("tujt"	"蘴")
+("tuu"	"茁")
+("tvff"	"蕬")
+("tvfh"	"蒶")
+("tvfi"	"葯")
+("tvfm"	"葒")
+("tvft"	"蘊")
+("tvfu"	"蕝")
+("tvfy"	"蔠")
+("tvhl"	"薌")
+("tvi"	"戡")
+("tvid"	"孳藥")
+("tvif"	"鶿")
+("tvii"	"茲")
+("tvio"	"苡")
+("tvip"	"慈")
+("tvis"	"苭")
+("tvjr"	"菇")
+("tvks"	"勘")
+("tvlk"	"荍")
+("tvmg"	"莊")
+("tvmi"	"蔣薅")
+("tvmw"	"蘠")
+("tvne"	"菉")
+("tvno"	"歁")
+("tvr"	"茹")
+("tvrf"	"蕠")
+("tvrq"	"蒘")
+("tvvv"	"葌")
+("tvvw"	"菑")
+("tvyj"	"斟")
+("tw"	"曲苗")
+("twa"	"曹")
+("twbi"	"蠆")
+("twbo"	"躉")
+("twcb"	"莔")
+("twdi"	"尊")
+("twfu"	"蔨")
+("twhd"	"菌")
+("twik"	"猷")
+("twim"	"蔮")
+("twk"	"茵奠")
+("twks"	"莮")
+("twla"	"薯")
+("twlb"	"萬")
+("twle"	"蘉")
+("twlg"	"蘿")
+("twli"	"蔑薎")
+("twlii"	"蠤")
+("twln"	"夢甍藅蘮")
+("twlp"	"薨藣")
+("twlu"	"瞢")
+("twmmv"	"農")
+("twmrt"	"豊")
+("twmv"	"葨")
+("two"	"苬")
+("twp"	"葸")
+("twr"	"茴")
+("twtj"	"蓽")
+("twvf"	"蔂")
+("twwf"	"虆")
+("twwg"	"蘲")
+("twww"	"藟")
+("twyi"	"苺")
+("txc"	"兼")
+("tybb"	"蒂薖")
+("tybg"	"蘺")
+("tybo"	"藃")
+("tybp"	"蘢")
+("tybs"	"蒡")
+("tycb"	"蔏")
+("tyck"	"茭")
+("tycu"	"萒")
+("tycv"	"蔉")
+("tydl"	"薪")
+("tydo"	"藗")
+("tydu"	"藽")
+("tyfe"	"菽")
+("tygq"	"薘")
+("tygv"	"薳")
+("tyhc"	"蘋")
+("tyhj"	"蓬")
+("tyhn"	"苀")
+("tyhs"	"芳")
+("tyiu"	"茺")
+("tyjj"	"蓮")
+("tyk"	"芠")
+("tylm"	"芷")
+("tymh"	"薉")
+("tymo"	"蓫")
+("tymp"	"茈")
+("tynb"	"蓪")
+("tyoe"	"藙")
+("tyoj"	"萃")
+("typm"	"蔖")
+("typp"	"藘")
+("typt"	"蘆")
+("tyr"	"苫")
+("tyra"	"藷")
+("tyrb"	"蒿")
+("tyre"	"蔎蕸")
+("tyrl"	"蔀")
+("tyrn"	"葶")
+("tyrp"	"薧")
+("tyrv"	"藹蘘")
+("tysd"	"葹")
+("tysk"	"蔟")
+("tysm"	"虀")
+("tyso"	"蔙")
+("tysy"	"菸")
+("tyt"	"苙")
+("tyta"	"萻")
+("tytg"	"蕫")
+("tytj"	"莘")
+("tytp"	"薏")
+("tytr"	"菩蒟")
+("tytv"	"菨")
+("tyv"	"芒")
+("tyvg"	"蕹")
+("tyvo"	"荄")
+("tyvp"	"莣")
+("tyvu"	"荒")
+("tyvw"	"蓄")
+("tywi"	"蓾")
+("tywv"	"蓑")
+("tyx"	"薺")
+("tyyb"	"藡")
+("tyyo"	"蘧")
+("u"	"山")
+("uahu"	"嵋")
+("uamh"	"崵")
+("uamo"	"崼")
+("uapp"	"崑")
+("uapv"	"嵑")
+("uav"	"峎")
+("ubb"	"崩")
+("ubcn"	"崱")
+("ubln"	"剬剻")
+("ubm"	"岨")
+("ubmbc"	"顓")
+("ubmr"	"峒")
+("ubnl"	"酅")
+("ubno"	"歂")
+("ubsd"	"崢")
+("ubtu"	"崗")
+("ubuu"	"峴")
+("uc"	"崟")
+("ucno"	"嶔")
+("ucor"	"峪")
+("ucwa"	"嶒")
+("udci"	"崧")
+("udhe"	"岥")
+("udoo"	"崍")
+("udsmg"	"糶")
+("udw"	"崠")
+("udyg"	"嵀")
+("ufb"	"峭")
+("ufdq"	"嶙")
+("uffd"	"嶸")
+("uffr"	"巆")
+("uffs"	"嶗")
+("ufgi"	"巀")
+("ugce"	"崚")
+("ugdi"	"峙")
+("uggi"	"崶")
+("uggu"	"嶢")
+("ugno"	"崁")
+("uh"	"匕")
+("uha"	"岶")
+("uhag"	"崲")
+("uhdj"	"嵙")
+("uhdp"	"嵊")
+("uhdv"	"崣")
+("uhdw"	"嶓")
+("uhej"	"峰")
+("uher"	"峉峈")
+("uhhj"	"崥")
+("uhhw"	"嵧")
+("uhi"	"嵬")
+("uhk"	"岆")
+("uhkb"	"嶠")
+("uhmb"	"巋")
+("uhml"	"岓")
+("uhni"	"嵐")
+("uhoo"	"嵷")
+("uhoq"	"嵂")
+("uhpa"	"崏")
+("uhqi"	"峨")
+("uhrf"	"嵨")
+("uhrj"	"嶭")
+("uhs"	"岝")
+("uhuc"	"巑")
+("uhud"	"嵲")
+("uhvi"	"巍")
+("uhxc"	"嶼")
+("uiav"	"崀")
+("uice"	"峻")
+("uihr"	"嵅")
+("uihs"	"峸")
+("uihv"	"崴")
+("uiih"	"嵾")
+("uijb"	"峬")
+("uilr"	"嵣")
+("uip"	"鬯")
+("ujc"	"岤")
+("ujcc"	"巔")
+("ujcm"	"崆")
+("ujcr"	"嵱")
+("ujd"	"櫱")
+("uje"	"岐")
+("ujfd"	"糱")
+("ujjl"	"嶄")
+("ujkp"	"峔")
+("ujlmi"	"蠥")
+("ujlo"	"崨")
+("ujmf"	"崇")
+("ujmrt"	"豐")
+("ujp"	"岮")
+("ujr"	"岵")
+("ujv"	"峖")
+("uk"	"凶")
+("ukb"	"峟")
+("ukcf"	"嶚")
+("ukg"	"峚")
+("ukhk"	"嶽")
+("ukhu"	"兇")
+("ukjj"	"輋")
+("ukkb"	"崤")
+("uklu"	"崦")
+("ukmr"	"崎")
+("ukn"	"峓")
+("ukoo"	"峽")
+("ukpb"	"嵽")
+("uks"	"屴")
+("ul"	"屮")
+("ulbk"	"岟")
+("ulln"	"岪")
+("ulw"	"岫")
+("ulwv"	"嶁")
+("umam"	"峘")
+("umbc"	"崸")
+("umbl"	"耑峏")
+("umbs"	"嶀")
+("umf"	"炭")
+("umfm"	"岯")
+("umgg"	"崖")
+("umig"	"峌")
+("umli"	"蚩")
+("ummj"	"岸")
+("ummr"	"峿")
+("ummu"	"岏")
+("umnc"	"嵿")
+("umnn"	"峛")
+("umnr"	"岢")
+("umoo"	"豳")
+("umr"	"岩")
+("umrt"	"豈")
+("umt"	"岍")
+("umtj"	"崋")
+("umto"	"嶡")
+("umu"	"屼")
+("umua"	"嶜")
+("umvh"	"岈")
+("unbq"	"嶰")
+("unhe"	"岌岋")
+("unii"	"嵹")
+("unmu"	"峗峞")
+("unot"	"嶝")
+("unqd"	"嵥")
+("unri"	"巉")
+("uog"	"崔")
+("uogb"	"巂雟")
+("uogf"	"嶕")
+("uogs"	"嶲")
+("uoic"	"嶺")
+("uoii"	"岭")
+("uoin"	"岑岒")
+("uoir"	"嵢")
+("uoll"	"岕")
+("uomb"	"崙")
+("uomn"	"崳")
+("uomo"	"嶮")
+("uomr"	"峇峆")
+("uon"	"屹")
+("upa"	"峋")
+("uphh"	"岉")
+("upko"	"嶷")
+("upr"	"岣")
+("uqmb"	"崝")
+("uqog"	"嶊")
+("urji"	"嶯")
+("urog"	"嶉")
+("urrk"	"巖")
+("urrs"	"崿")
+("urvp"	"岷")
+("ushi"	"屻")
+("ushr"	"岧")
+("usjr"	"崌")
+("uskr"	"峮")
+("usma"	"嶍")
+("usmh"	"嵺")
+("usrr"	"嶇")
+("uss"	"岠")
+("usu"	"屺")
+("usuu"	"崛")
+("utav"	"嶱")
+("utbuu"	"覬")
+("utcd"	"嶪")
+("utcw"	"崷")
+("utgi"	"嶬")
+("utgit"	"豔")
+("uthn"	"凱")
+("uthni"	"颽")
+("uthv"	"巕")
+("utik"	"獃")
+("utln"	"剴")
+("utmbc"	"顗")
+("utmo"	"嵌")
+("utmv"	"嵁")
+("utnau"	"艷")
+("utnl"	"酆")
+("utok"	"敳")
+("utqm"	"嵯")
+("utrg"	"巏")
+("utvi"	"嵫")
+("utwa"	"嶆")
+("utwi"	"嶟")
+("utwv"	"嶩")
+("uu"	"出屾艸")
+("uuce"	"嵕")
+("uummf"	"祟")
+("uuu"	"芔")
+("uuuu"	"茻")
+("uvii"	"幽")
+("uvis"	"岰")
+("uvmi"	"嶈")
+("uvvw"	"崰")
+("uwjr"	"崮")
+("uwl"	"岬")
+("uwlb"	"嵎")
+("uwlj"	"嶧")
+("uwly"	"嶵")
+("uwp"	"崽")
+("uybb"	"崹")
+("uybk"	"巘")
+("uybp"	"巃")
+("uyhh"	"嵃")
+("uyhm"	"嵼")
+("uyoj"	"崒")
+("uyrb"	"嵩")
+("uyrd"	"崞")
+("uyrn"	"嵉")
+("uysd"	"崺")
+("uyt"	"岦")
+("uyti"	"巇")
+("uytj"	"峷嶂")
+("uyvo"	"峐")
+("v"	"女")
+("vaa"	"娼")
+("vabu"	"媢")
+("vahu"	"媚")
+("vam"	"妲")
+("vamh"	"婸")
+("vamo"	"媞")
+("vand"	"嫻")
+("vawe"	"嫚")
+("vbac"	"嫇")
+("vbbe"	"嬡")
+("vbbr"	"媧")
+("vbd"	"婇")
+("vbgr"	"婤")
+("vbhg"	"婬")
+("vbhx"	"嫍")
+("vbm"	"姐")
+("vbme"	"媛")
+("vbmr"	"姛")
+("vbou"	"媱")
+("vbt"	"姍")
+("vbuu"	"娊")
+("vbv"	"娞")
+("vci"	"妐")
+("vcnh"	"娣")
+("vcsh"	"妢")
+("vdj"	"妺")
+("vdks"	"勦")
+("vdl"	"娕")
+("vdlc"	"嬾")
+("vdlk"	"嫩")
+("vdln"	"剿")
+("vdnl"	"鄛")
+("ve"	"奴")
+("vebt"	"盝")
+("veks"	"努")
+("velb"	"帑")
+("veln"	"剝")
+("vemr"	"砮")
+("ven"	"弩")
+("vend"	"孥")
+("vep"	"怒")
+("veq"	"拏")
+("vesqf"	"駑")
+("vfa"	"曫")
+("vfamo"	"緹")
+("vfaph"	"緆")
+("vfapp"	"緄")
+("vfase"	"繓")
+("vfawe"	"縵")
+("vfbb"	"嫦")
+("vfbbb"	"縎")
+("vfbbe"	"綬")
+("vfbbr"	"緺")
+("vfbcv"	"纓")
+("vfbd"	"綵")
+("vfbgr"	"綢")
+("vfbhx"	"縚")
+("vfbjj"	"緷")
+("vfbm"	"組")
+("vfbme"	"緩")
+("vfbmr"	"絧")
+("vfbnd"	"綒")
+("vfbof"	"縩")
+("vfbr"	"絅")
+("vfbsh"	"絼")
+("vfbtu"	"綱")
+("vfbtv"	"網")
+("vfbu"	"矕")
+("vfbuh"	"緲")
+("vfbuo"	"繉")
+("vfbv"	"綏")
+("vfc"	"鑾")
+("vfcnh"	"綈")
+("vfcor"	"綌")
+("vfcsh"	"紛")
+("vfcwa"	"繒")
+("vfd"	"欒")
+("vfdbu"	"緗")
+("vfdd"	"綝")
+("vfdi"	"紂")
+("vfdl"	"綀")
+("vfdm"	"絊")
+("vfdmq"	"緯")
+("vfdwf"	"練")
+("vfeed"	"縔")
+("vfeee"	"綴")
+("vff"	"婒")
+("vffb"	"綃")
+("vffdq"	"繗")
+("vfff"	"緂")
+("vffh"	"紗")
+("vffmu"	"絖")
+("vffq"	"絆")
+("vffqu"	"綣")
+("vfgce"	"綾")
+("vfgg"	"絓")
+("vfggu"	"繞")
+("vfgi"	"紶")
+("vfgr"	"結")
+("vfgrc"	"纈")
+("vfgwc"	"續")
+("vfh"	"妙")
+("vfhab"	"綿")
+("vfhae"	"線")
+("vfhaf"	"鷥鸞")
+("vfhce"	"繌")
+("vfhdv"	"緌")
+("vfhdw"	"繙")
+("vfheq"	"絳")
+("vfher"	"絡")
+("vfhey"	"終")
+("vfhg"	"紝")
+("vfhgf"	"纁")
+("vfhhj"	"綼")
+("vfhjd"	"絑")
+("vfhje"	"緞")
+("vfhjg"	"緟")
+("vfhjm"	"綞")
+("vfhkb"	"繑")
+("vfhon"	"絎")
+("vfhoo"	"縱縰")
+("vfhor"	"綹")
+("vfhqo"	"紩")
+("vfhsb"	"編")
+("vfhsk"	"繳綟")
+("vfhuc"	"纘")
+("vfhvp"	"紙")
+("vfhwp"	"總")
+("vfibi"	"縛")
+("vfihr"	"緘")
+("vfiih"	"縿")
+("vfij"	"絨")
+("vfije"	"絿")
+("vfik"	"紁紎")
+("vfikk"	"紱")
+("vfiku"	"紌")
+("vfill"	"絒")
+("vfimo"	"絘")
+("vfir"	"紿")
+("vfirm"	"緎")
+("vfitc"	"纊")
+("vfiwg"	"纏")
+("vfjbc"	"縝")
+("vfjbd"	"綍")
+("vfjii"	"縳")
+("vfjip"	"繐")
+("vfjka"	"緒")
+("vfjlo"	"緁")
+("vfjlv"	"緀")
+("vfjmc"	"縯繽")
+("vfjmf"	"綜")
+("vfjmn"	"紵")
+("vfjmo"	"綻")
+("vfjmu"	"綄")
+("vfjnu"	"綩")
+("vfjoa"	"縮")
+("vfjp"	"紽")
+("vfjqr"	"縖")
+("vfjrr"	"綰")
+("vfjyj"	"縡")
+("vfk"	"奱")
+("vfkcf"	"繚")
+("vfki"	"紘")
+("vfkkb"	"絺")
+("vfkmr"	"綺")
+("vfkni"	"紈")
+("vflbk"	"紻")
+("vflbu"	"紞")
+("vflgm"	"繣")
+("vflll"	"紃")
+("vflln"	"紼")
+("vflmc"	"繢")
+("vflmi"	"蠻")
+("vflmo"	"絩")
+("vflmy"	"緋")
+("vflw"	"紬")
+("vflwl"	"紳")
+("vflwp"	"絏")
+("vflwv"	"縷")
+("vflx"	"繡")
+("vfm"	"紅")
+("vfma"	"絔")
+("vfmbb"	"繻")
+("vfmbe"	"纋")
+("vfmbk"	"緛")
+("vfmd"	"紆")
+("vfmf"	"紑")
+("vfmgk"	"緻")
+("vfmhf"	"縓")
+("vfmia"	"縉")
+("vfmig"	"絰")
+("vfmlb"	"緉")
+("vfmlk"	"綆")
+("vfmmi"	"紜")
+("vfmmp"	"纚")
+("vfmn"	"糽")
+("vfmvi"	"縟")
+("vfmvm"	"經")
+("vfmwf"	"縹")
+("vfmwl"	"緬")
+("vfn"	"彎")
+("vfnau"	"絻")
+("vfnbq"	"繲")
+("vfnd"	"孿")
+("vfng"	"紐")
+("vfnhb"	"繘")
+("vfnhe"	"級")
+("vfnii"	"繈")
+("vfnin"	"紓")
+("vfnkf"	"繺")
+("vfnkg"	"綎")
+("vfnkm"	"綖")
+("vfnl"	"紖")
+("vfnob"	"縃")
+("vfnri"	"纔")
+("vfoae"	"緮")
+("vfob"	"納")
+("vfobo"	"臠")
+("vfodi"	"紨")
+("vfog"	"維")
+("vfohh"	"紾")
+("vfoim"	"纖")
+("vfoin"	"紟")
+("vfok"	"變")
+("vfoll"	"紒")
+("vfoma"	"繪")
+("vfomb"	"綸")
+("vfomg"	"絟")
+("vfomk"	"緶")
+("vfomn"	"緰")
+("vfomr"	"給")
+("vfon"	"紇")
+("vfonk"	"緱")
+("vfopd"	"絁")
+("vfoto"	"纀")
+("vfp"	"戀")
+("vfpa"	"絢")
+("vfpi"	"約")
+("vfpmm"	"緪")
+("vfpou"	"綯")
+("vfpp"	"紕")
+("vfpr"	"絇")
+("vfpt"	"紲")
+("vfpu"	"純")
+("vfpuu"	"縐")
+("vfq"	"姅攣")
+("vfqjl"	"綁")
+("vfqkd"	"縥")
+("vfqmb"	"綪")
+("vfqmc"	"績")
+("vfqmf"	"縤")
+("vfqu"	"婘")
+("vfr"	"轡")
+("vfrb"	"絹")
+("vfrbc"	"縜")
+("vfrhr"	"絽")
+("vfrpa"	"緡")
+("vfrrd"	"繰")
+("vfrrj"	"繟")
+("vfrsj"	"緝")
+("vfrxu"	"繩")
+("vfshi"	"紉")
+("vfshr"	"紹")
+("vfshu"	"絕")
+("vfsje"	"緅")
+("vfsme"	"綅")
+("vfsmh"	"繆")
+("vfsu"	"紀")
+("vfswu"	"纜")
+("vftak"	"縸")
+("vftbk"	"繖")
+("vftct"	"縊")
+("vftcw"	"緧")
+("vftgr"	"繕")
+("vftlj"	"緙")
+("vftm"	"紺")
+("vftqm"	"縒")
+("vftt"	"絣")
+("vftwi"	"繜")
+("vftwv"	"繷")
+("vftxc"	"縑")
+("vfu"	"巒")
+("vfubb"	"繃")
+("vfuob"	"纗")
+("vfuog"	"繀")
+("vfuu"	"絀")
+("vfv"	"孌")
+("vfvif"	"絲")
+("vfvl"	"糾")
+("vfvne"	"綠")
+("vfvno"	"緣")
+("vfvvd"	"繅")
+("vfvvi"	"繼")
+("vfvvw"	"緇")
+("vfw"	"細")
+("vfwd"	"綑")
+("vfwgg"	"纆")
+("vfwk"	"絪")
+("vfwlg"	"纙")
+("vfwlj"	"繹")
+("vfwlv"	"繯")
+("vfwot"	"縕")
+("vfwp"	"緦")
+("vfwtj"	"縪")
+("vfwvf"	"縲")
+("vfyaj"	"綽")
+("vfybb"	"締")
+("vfybs"	"縍")
+("vfyck"	"絞")
+("vfyg"	"紸")
+("vfygq"	"繨")
+("vfyhj"	"縫")
+("vfyhr"	"縋")
+("vfyhs"	"紡")
+("vfyia"	"織")
+("vfyij"	"繂")
+("vfyiu"	"統")
+("vfyj"	"紏")
+("vfyjj"	"縺")
+("vfyk"	"紋")
+("vfylr"	"繾")
+("vfyoj"	"綷")
+("vfypt"	"纑")
+("vfyrb"	"縞")
+("vfyrd"	"綧")
+("vfyrf"	"綡")
+("vfyrv"	"纕")
+("vfyso"	"縼")
+("vfyto"	"繸")
+("vfytp"	"繶")
+("vfytu"	"縌")
+("vfyub"	"縭")
+("vfyvi"	"絃")
+("vfyvo"	"絯")
+("vfyvq"	"縴")
+("vfywm"	"繵")
+("vfywv"	"縗")
+("vgb"	"姌")
+("vgce"	"婈")
+("vgf"	"焋")
+("vgg"	"娃")
+("vggu"	"嬈")
+("vgk"	"奘奊")
+("vgni"	"嬦")
+("vgow"	"嬙")
+("vgr"	"姞")
+("vgrg"	"嬯")
+("vgrr"	"嬉")
+("vgrv"	"媴")
+("vgtj"	"婞")
+("vgyhv"	"裝")
+("vhab"	"婂")
+("vhag"	"媓")
+("vhav"	"嬝")
+("vhbr"	"姠")
+("vhcn"	"嬼")
+("vhd"	"姀")
+("vhdn"	"娳")
+("vhdv"	"婑")
+("vhdw"	"嬏")
+("vhg"	"妊")
+("vhgu"	"姺")
+("vhhj"	"婢")
+("vhhw"	"媹")
+("vhi"	"媿")
+("vhiil"	"鄉")
+("vhj"	"奷")
+("vhjd"	"姝")
+("vhjm"	"娷")
+("vhjr"	"姡")
+("vhk"	"妖")
+("vhkb"	"嬌")
+("vhkp"	"婖")
+("vhml"	"妡")
+("vhmr"	"姤")
+("vhnb"	"姵")
+("vhp"	"奼")
+("vhpa"	"婚")
+("vhqi"	"娥")
+("vhqm"	"姓")
+("vhs"	"妒")
+("vhsb"	"媥")
+("vhsk"	"嬓")
+("vhup"	"媳")
+("vhwp"	"媲")
+("vhxe"	"嫂")
+("vhxu"	"婗")
+("viav"	"娘")
+("vid"	"槳樂")
+("vidi"	"嬤")
+("vie"	"漿")
+("vif"	"糸")
+("vig"	"墏")
+("vihi"	"幾")
+("vihml"	"斷")
+("viik"	"獎")
+("vij"	"娀")
+("vikf"	"媯")
+("viks"	"幼")
+("viksf"	"鴢")
+("vilb"	"嫞")
+("vile"	"嫝")
+("vilmi"	"螿")
+("viln"	"劙")
+("vimcw"	"醬")
+("vio"	"以")
+("viok"	"娭")
+("vir"	"始")
+("vis"	"幻")
+("vitc"	"嬚")
+("vitf"	"嫬")
+("viuh"	"娏")
+("viw"	"畿")
+("vjbj"	"婻")
+("vjcr"	"嫆")
+("vjd"	"妹")
+("vje"	"妓")
+("vjhw"	"嬸")
+("vjii"	"嫥")
+("vjka"	"媎")
+("vjkp"	"姥")
+("vjlo"	"婕")
+("vjmc"	"嬪")
+("vjmf"	"婃")
+("vjmm"	"媗")
+("vjmo"	"嫁婝")
+("vjnu"	"婉")
+("vjpn"	"嬣")
+("vjr"	"姑")
+("vjrb"	"媩")
+("vjrj"	"嫴")
+("vjrr"	"婠")
+("vjv"	"姲")
+("vkb"	"姷")
+("vkbt"	"盭")
+("vkcf"	"嫽")
+("vkmr"	"婍")
+("vkms"	"姱")
+("vkn"	"姨")
+("vkok"	"嫉")
+("vl"	"凵")
+("vlbk"	"姎")
+("vlgm"	"嫿")
+("vlhbr"	"嚮")
+("vlllm"	"丱")
+("vllmi"	"蠁")
+("vlm"	"爿")
+("vlmc"	"嬇")
+("vlmo"	"姚")
+("vlmt"	"嬧")
+("vloiv"	"饗")
+("vlok"	"收")
+("vlw"	"妯")
+("vlwl"	"妽")
+("vlws"	"娉")
+("vlxh"	"姊")
+("vlyta"	"響")
+("vm"	"妅")
+("vmam"	"姮")
+("vmbb"	"嬬")
+("vmbdi"	"將")
+("vmbs"	"嫮")
+("vmbu"	"孀")
+("vmbwd"	"彙")
+("vmfb"	"嬭")
+("vmfft"	"彝")
+("vmg"	"壯")
+("vmgg"	"娾")
+("vmgow"	"牆")
+("vmhf"	"嫄")
+("vmhml"	"斨")
+("vmi"	"戕")
+("vmig"	"姪")
+("vmik"	"狀")
+("vmj"	"奸")
+("vmlii"	"蠿")
+("vmlm"	"婭")
+("vmmi"	"妘")
+("vmmnr"	"牁")
+("vmmp"	"孋")
+("vmmu"	"妧")
+("vmmv"	"娠")
+("vmoir"	"牄")
+("vmpop"	"彘")
+("vmt"	"妍")
+("vmtq"	"牂")
+("vmv"	"妝")
+("vmvi"	"媷")
+("vmvm"	"娙")
+("vmwf"	"嫖")
+("vmwl"	"媔")
+("vmyf"	"嫣")
+("vmym"	"姃")
+("vnau"	"娩")
+("vnd"	"好")
+("vnf"	"妳")
+("vng"	"妞")
+("vnhd"	"媃")
+("vnhs"	"奶")
+("vnin"	"妤姼")
+("vnir"	"姳")
+("vnkg"	"娗")
+("vnlb"	"嫷")
+("vnlr"	"婀")
+("vnme"	"彔")
+("vnmm"	"嫋")
+("vnmo"	"彖")
+("vnmu"	"姽")
+("vnob"	"婿")
+("vnot"	"嬁")
+("vnum"	"嬔")
+("vnyi"	"娹")
+("vob"	"妠")
+("voge"	"孇")
+("vogf"	"嫶")
+("vohaf"	"鶨")
+("voii"	"姈")
+("voim"	"孅")
+("voin"	"妗")
+("volii"	"蠡")
+("voll"	"妎")
+("vomg"	"姾")
+("vomn"	"媮")
+("vomo"	"嬐")
+("vomr"	"姶")
+("vomt"	"媕")
+("voq"	"姩")
+("vord"	"媬")
+("votf"	"嫵")
+("vpd"	"她")
+("vph"	"妼")
+("vpi"	"妁")
+("vpp"	"妣")
+("vpr"	"姁")
+("vptd"	"媟")
+("vpuu"	"媰")
+("vqj"	"妦")
+("vqka"	"媋")
+("vqkd"	"嫀")
+("vqmb"	"婧")
+("vqmf"	"嫊")
+("vqmv"	"婊")
+("vr"	"如")
+("vrb"	"娟")
+("vrhaf"	"鴽")
+("vrlb"	"帤")
+("vrp"	"恕")
+("vrq"	"挐")
+("vrrd"	"嬠")
+("vrrj"	"嬋")
+("vrrk"	"孍")
+("vrvif"	"絮")
+("vrvk"	"娛")
+("vrye"	"婽")
+("vryo"	"娖")
+("vshaf"	"鶭")
+("vshr"	"妱")
+("vshu"	"娓")
+("vsje"	"娵")
+("vskp"	"嫕")
+("vsll"	"姬")
+("vsmb"	"婦")
+("vsmg"	"嬥")
+("vsmh"	"嫪")
+("vsp"	"妮")
+("vsqf"	"媽")
+("vsql"	"娜")
+("vsrr"	"嫗")
+("vss"	"姖")
+("vstr"	"嫟")
+("vsu"	"妃")
+("vsyi"	"孎")
+("vtak"	"嫫")
+("vtbc"	"婰")
+("vtbn"	"媊")
+("vtgk"	"媄")
+("vtgr"	"嫸")
+("vthg"	"嬞")
+("vtkr"	"婼")
+("vtlf"	"嬿")
+("vtlo"	"嫨")
+("vtm"	"姏")
+("vtmc"	"娸嫹")
+("vtmd"	"媒")
+("vtmj"	"嬅")
+("vtsj"	"媶")
+("vtt"	"姘")
+("vttb"	"媾")
+("vtvp"	"嬨")
+("vtw"	"媌")
+("vtxc"	"嫌")
+("vu"	"奾")
+("vumb"	"媏")
+("vumi"	"媸")
+("vumj"	"婩")
+("vuob"	"孈")
+("vuog"	"雝")
+("vuuk"	"媺")
+("vv"	"奻")
+("vvf"	"災")
+("vvio"	"姒")
+("vvrau"	"邕")
+("vvv"	"姦")
+("vvw"	"甾")
+("vvwd"	"巢")
+("vwb"	"媦")
+("vwd"	"婐")
+("vwg"	"娌")
+("vwhaf"	"鶅")
+("vwjlo"	"疀")
+("vwjr"	"婟")
+("vwk"	"姻")
+("vwlk"	"嬽")
+("vwlv"	"嬛")
+("vwot"	"媼")
+("vwvf"	"嫘")
+("vwyi"	"姆")
+("vyaj"	"婥")
+("vybc"	"媜")
+("vycb"	"嫡")
+("vyck"	"姣")
+("vyfe"	"婌")
+("vyg"	"妵")
+("vyhs"	"妨")
+("vyia"	"嬂")
+("vyk"	"妏")
+("vymr"	"娮")
+("vypd"	"嫭")
+("vyrf"	"婛")
+("vyrn"	"婷")
+("vyrv"	"孃")
+("vyso"	"嫙")
+("vytj"	"嫜")
+("vytr"	"婄")
+("vyvi"	"妶")
+("vywm"	"嬗")
+("w"	"田")
+("wb"	"胃")
+("wbmbc"	"顒")
+("wbp"	"愚")
+("wc"	"四")
+("wcb"	"囧")
+("wchaf"	"鷶")
+("wche"	"畟")
+("wd"	"困果")
+("wdhv"	"褁")
+("wdmbc"	"顆")
+("wdmq"	"圍")
+("wdnin"	"夥")
+("wdye"	"敤")
+("weee"	"瑆畷")
+("wfdq"	"疄")
+("wfgr"	"黠")
+("wfgwc"	"黷")
+("wfiih"	"黲")
+("wfik"	"默")
+("wfip"	"黓")
+("wfjbc"	"黰")
+("wfjnu"	"黦")
+("wfklu"	"黤")
+("wflbu"	"黕")
+("wfmvu"	"黖")
+("wfmwg"	"黫")
+("wfncr"	"黵")
+("wfnin"	"黟")
+("wfoin"	"黔")
+("wfomt"	"黭")
+("wfq"	"畔")
+("wfqu"	"圈")
+("wftm"	"黚")
+("wftmv"	"黮")
+("wfuu"	"黜")
+("wfvis"	"黝")
+("wfyr"	"點")
+("wfyrf"	"黥")
+("wfyta"	"黯")
+("wg"	"里")
+("wgdi"	"畤")
+("wgf"	"黑")
+("wgfg"	"墨")
+("wgg"	"畦")
+("wgit"	"圔")
+("wgni"	"疇")
+("wgnin"	"野")
+("wgrv"	"園")
+("wgtj"	"圉")
+("whd"	"囷")
+("whe"	"畈")
+("wher"	"略")
+("whjg"	"畽")
+("wice"	"畯")
+("wihaf"	"鸀")
+("wijb"	"圃")
+("wik"	"畎")
+("wino"	"歜")
+("wirm"	"國")
+("wiye"	"斀")
+("wj"	"毋毌")
+("wjbuc"	"貫")
+("wjhaf"	"鷝鸅")
+("wjii"	"團")
+("wjnu"	"瑂畹")
+("wjok"	"斁")
+("wjr"	"固")
+("wk"	"因")
+("wkb"	"囿")
+("wkmr"	"畸")
+("wkno"	"欭")
+("wkp"	"恩")
+("wks"	"男")
+("wl"	"甲")
+("wlbi"	"禺")
+("wlbm"	"罝")
+("wlbnd"	"罦")
+("wlbuc"	"買")
+("wlcwa"	"罾")
+("wldd"	"罧")
+("wleee"	"罬")
+("wlgg"	"罣")
+("wlggy"	"罫")
+("wlgrv"	"瞏")
+("wlgtj"	"睪")
+("wlhaf"	"鴨")
+("wlhhw"	"罶")
+("wlhvo"	"罛")
+("wlibp"	"罷")
+("wlipf"	"羆")
+("wlirm"	"罭")
+("wljbm"	"置")
+("wljka"	"署")
+("wljr"	"罟")
+("wlklu"	"罨")
+("wlll"	"甽")
+("wllmy"	"罪")
+("wlmc"	"圚")
+("wlmf"	"罘")
+("wlmfn"	"罽")
+("wlmym"	"罡")
+("wlnih"	"罞")
+("wlooo"	"眾")
+("wlpli"	"蜀")
+("wlpog"	"罹")
+("wlrb"	"罥")
+("wlrvp"	"罠")
+("wlsfi"	"罻")
+("wlsqf"	"罵")
+("wltab"	"羃")
+("wltjf"	"羈")
+("wltjr"	"羇")
+("wlvff"	"羉")
+("wlvfg"	"羅")
+("wlvvd"	"罺")
+("wlwp"	"罳")
+("wlwtj"	"罼")
+("wlwwk"	"奰")
+("wlyaj"	"罩")
+("wlyg"	"罜")
+("wlymr"	"詈")
+("wlyrn"	"罰")
+("wlytg"	"罿")
+("wml"	"畀")
+("wmmr"	"圄")
+("wmn"	"町")
+("wmso"	"圂")
+("wmv"	"畏")
+("wnd"	"囝")
+("wng"	"墅")
+("wo"	"囚")
+("wohh"	"畛")
+("woii"	"囹")
+("wok"	"畋")
+("woll"	"界")
+("womb"	"圇")
+("wop"	"囮慁")
+("wp"	"思")
+("wphh"	"囫")
+("wpim"	"畇")
+("wpp"	"毗毘")
+("wpu"	"囤")
+("wqmb"	"圊")
+("wr"	"回")
+("wrbc"	"圓")
+("wryw"	"圖")
+("wsvws"	"嬲")
+("wtc"	"異")
+("wtj"	"畢")
+("wumb"	"圌")
+("wv"	"囡")
+("wvfd"	"圞")
+("wvif"	"累")
+("wvsmm"	"翾")
+("wwhaf"	"鸓")
+("wwlj"	"圛")
+("wwlv"	"圜")
+("www"	"畾")
+("wwwd"	"櫐")
+("wwwf"	"纍")
+("wwwg"	"壘")
+("wwwm"	"疊")
+("wwwr"	"礨")
+("wwwu"	"罍")
+("wwwwg"	"壨")
+("wyhn"	"囥")
+("wyi"	"母")
+("wymr"	"圁")
+("wyv"	"甿")
+("y"	"卜")
+("yad"	"桌")
+("yahag"	"韹")
+("yahej"	"韸")
+("yai"	"戠")
+("yaj"	"卓")
+("yamh"	"逿")
+("yano"	"歆")
+("yaog"	"暹")
+("yapv"	"遏")
+("yarbc"	"韻")
+("yashr"	"韶")
+("yasm"	"遢")
+("yatlk"	"韺")
+("yatoe"	"頀")
+("yav"	"退")
+("ybaht"	"髜")
+("ybbr"	"過")
+("ybgr"	"週")
+("ybhaf"	"鶙")
+("ybhg"	"望")
+("ybhne"	"毃")
+("ybhu"	"邈")
+("ybik"	"獻")
+("ybjj"	"運")
+("yblb"	"帝")
+("yblbr"	"啻")
+("ybmcu"	"睿")
+("ybmo"	"遯")
+("ybmr"	"迵")
+("ybmvn"	"甋甗")
+("ybnl"	"鄗")
+("ybno"	"欳歊")
+("ybog"	"離")
+("ybok"	"敵")
+("ybou"	"遙")
+("ybr"	"迥")
+("ybuc"	"貞")
+("ybye"	"敲")
+("ybyhs"	"旁")
+("ybysp"	"龍")
+("yc"	"六")
+("ycbr"	"商")
+("ychaf"	"鶐")
+("ychhj"	"顰")
+("yck"	"交奕")
+("yclb"	"帟")
+("ycp"	"戇")
+("ycrhu"	"兗")
+("ycrhv"	"袞")
+("yct"	"弈")
+("ydbuu"	"親")
+("ydhaf"	"鶉")
+("ydhhh"	"虨")
+("ydhml"	"新")
+("ydkni"	"孰")
+("ydl"	"速")
+("ydlk"	"遫")
+("ydmq"	"違")
+("ydnl"	"郭")
+("ydno"	"歑")
+("ydog"	"雜")
+("ydok"	"敦敹")
+("ydrrj"	"嚲")
+("yebu"	"督")
+("yec"	"錖")
+("yefd"	"粲")
+("yefh"	"逤")
+("yeg"	"壑")
+("yelmm"	"韰")
+("yeoiv"	"餐")
+("yep"	"惄")
+("yeyhv"	"裻")
+("yfb"	"逍")
+("yfd"	"迷")
+("yfdq"	"遴")
+("yfe"	"叔")
+("yfhaf"	"鶁")
+("yfiku"	"就")
+("yfks"	"勍")
+("yfye"	"敊")
+("yg"	"主")
+("ygcg"	"逵")
+("yggu"	"遶")
+("yghne"	"殶")
+("yghqu"	"氃")
+("ygiv"	"褻")
+("ygmms"	"虧")
+("ygr"	"迼")
+("ygrv"	"遠")
+("ygsk"	"遨")
+("ygtq"	"達")
+("yha"	"迫")
+("yhaf"	"鳪")
+("yhag"	"遑")
+("yhbm"	"亹")
+("yhds"	"透")
+("yhdv"	"逶褎")
+("yhe"	"返")
+("yhee"	"邍")
+("yhej"	"逢")
+("yheq"	"逄")
+("yhgr"	"造")
+("yhhhh"	"彥")
+("yhhqm"	"產")
+("yhhw"	"遛")
+("yhiv"	"褢")
+("yhjr"	"适")
+("yhju"	"遁")
+("yhk"	"迗")
+("yhln"	"劌")
+("yhmbc"	"頻顏顪")
+("yhml"	"近")
+("yhmo"	"遾")
+("yhmr"	"逅")
+("yhn"	"亢")
+("yhqo"	"迭")
+("yhrr"	"追")
+("yhs"	"方迮")
+("yhsb"	"遍")
+("yhsk"	"邀")
+("yhsmm"	"翽")
+("yhus"	"邊")
+("yhv"	"衣")
+("yhvl"	"迎")
+("yhxv"	"裒")
+("yhyu"	"遞")
+("yib"	"育")
+("yice"	"逡")
+("yif"	"熟")
+("yifh"	"玅")
+("yig"	"塾")
+("yihu"	"充")
+("yihxo"	"斔螤")
+("yijb"	"逋")
+("yijc"	"述")
+("yije"	"逑")
+("yik"	"迖")
+("yiohv"	"玈")
+("yioj"	"率")
+("yir"	"迨")
+("yirv"	"袬")
+("yitd"	"棄")
+("yitf"	"遮")
+("yiyvi"	"玆")
+("yj"	"斗")
+("yjco"	"邃")
+("yjdl"	"辣")
+("yjhaf"	"鵫")
+("yjhec"	"贛")
+("yjhee"	"竷")
+("yjhhh"	"彰")
+("yjhoj"	"瓣")
+("yjilj"	"辨")
+("yjksj"	"辦")
+("yjnl"	"鄣")
+("yjrr"	"逭")
+("yjvfj"	"辮")
+("yjwj"	"連")
+("yjyrj"	"辯")
+("yk"	"文")
+("ykanw"	"斕")
+("ykb"	"迶")
+("ykcf"	"遼")
+("ykhaf"	"鳼鵁鷟鸆")
+("ykhbm"	"斖")
+("ykhf"	"逖")
+("ykhg"	"逛")
+("ykhsb"	"斒")
+("ykmbc"	"頝")
+("ykmpm"	"斌")
+("yknl"	"郊")
+("ykok"	"效")
+("ykp"	"忞憝")
+("ykpb"	"遰")
+("ykq"	"撉")
+("ykr"	"吝")
+("yksr"	"迦")
+("ykvif"	"紊")
+("ykymu"	"齾")
+("ylb"	"市")
+("yle"	"逮")
+("ylhv"	"衷")
+("ylm"	"止")
+("ylmc"	"遺")
+("ylmh"	"步")
+("ylmo"	"逃")
+("ylmr"	"遣")
+("ylnc"	"亦")
+("ylw"	"迪")
+("ym"	"上")
+("ymb"	"肯")
+("ymbuc"	"贇")
+("ymbuu"	"覷")
+("ymcw"	"迺")
+("ymd"	"迂")
+("ymdhe"	"皻皽")
+("ymfb"	"邇")
+("ymg"	"迋")
+("ymgdi"	"歭")
+("ymhaf"	"鸇")
+("ymhqu"	"氈")
+("ymihh"	"歲")
+("ymje"	"歧")
+("ymks"	"勯")
+("ymln"	"剷")
+("ymmbc"	"顫")
+("ymmp"	"邐")
+("ymmr"	"言逜")
+("ymnn"	"迾")
+("ymno"	"歔")
+("ymp"	"此忐")
+("ympog"	"雌")
+("ymrt"	"逗")
+("ymrw"	"逼")
+("ymso"	"逐")
+("ymuoo"	"齒")
+("ymvh"	"迓")
+("ymvm"	"逕")
+("ymwu"	"遷")
+("ymy"	"卡")
+("ynbq"	"邂")
+("yndf"	"遜")
+("ynhb"	"遹")
+("ynhv"	"袤")
+("ynib"	"通")
+("ynin"	"迻")
+("yniv"	"袲")
+("ynj"	"迅")
+("ynmbc"	"頏")
+("ynnl"	"邟")
+("ynot"	"邆")
+("ynui"	"逸")
+("yobuc"	"賌")
+("yodv"	"褒")
+("yog"	"進")
+("yohne"	"毅")
+("yoj"	"迕")
+("yoks"	"劾")
+("yoln"	"刻劇")
+("yombc"	"頦")
+("yomd"	"途")
+("yomn"	"逾")
+("yon"	"迄")
+("yonk"	"夜")
+("yono"	"欬")
+("yooj"	"卒")
+("yopd"	"迤")
+("yp"	"虍")
+("ypa"	"迿")
+("ypbu"	"眥")
+("ypbuc"	"貲")
+("ypc"	"鈭")
+("ypd"	"迆柴")
+("ypg"	"壟")
+("yphaf"	"鷾鸗")
+("yphen"	"處")
+("yphfd"	"虖")
+("yphu"	"虎")
+("ypks"	"勴")
+("yplmi"	"蠪")
+("ypmk"	"龑")
+("ypmm"	"些")
+("ypmmf"	"祡龒")
+("ypmr"	"砦礱")
+("ypmrb"	"骿")
+("ypmso"	"豦")
+("ypnbg"	"觜")
+("ypnwf"	"鮆")
+("ypobo"	"胔")
+("ypoiv"	"飺")
+("ypph"	"虙")
+("ypr"	"呰")
+("yprvk"	"虞")
+("ypsj"	"聾")
+("ypsm"	"虐")
+("ypt"	"衧")
+("yptc"	"龔")
+("yptm"	"虛")
+("yptmc"	"虡")
+("ypu"	"迍")
+("ypuv"	"袌")
+("ypvif"	"紫")
+("ypwb"	"膚")
+("ypwbt"	"盧")
+("ypwks"	"虜")
+("ypwlb"	"歶")
+("ypwp"	"慮")
+("ypybp"	"龘")
+("ypyhv"	"襲")
+("ypyk"	"虔")
+("ypymr"	"訾讋")
+("yqhl"	"逝")
+("yr"	"占")
+("yramo"	"諟")
+("yranb"	"譋")
+("yranw"	"讕")
+("yrapv"	"謁")
+("yrav"	"裛")
+("yrawe"	"謾")
+("yrbb"	"膏")
+("yrbbn"	"贏")
+("yrbgr"	"調")
+("yrbhn"	"鸁")
+("yrbjj"	"諢")
+("yrbln"	"蠃")
+("yrbm"	"詛")
+("yrbme"	"諼")
+("yrbmr"	"詷")
+("yrbn"	"亭")
+("yrbo"	"豪")
+("yrbou"	"謠")
+("yrbp"	"亳")
+("yrbr"	"高詗")
+("yrbsd"	"諍")
+("yrbtn"	"羸")
+("yrbu"	"亮毫")
+("yrbuu"	"覘")
+("yrbvk"	"謑")
+("yrbvn"	"嬴")
+("yrbwn"	"臝")
+("yrci"	"訟")
+("yrcmt"	"諡")
+("yrcru"	"說")
+("yrdd"	"諃")
+("yrdhe"	"詖")
+("yrdi"	"討")
+("yrdk"	"訣")
+("yrdmq"	"諱")
+("yrdoo"	"誺")
+("yrdwf"	"諫")
+("yrea"	"誻")
+("yrf"	"京")
+("yrfb"	"誚")
+("yrfbf"	"讜")
+("yrff"	"談")
+("yrfh"	"訬")
+("yrfq"	"詊")
+("yrgcr"	"讟")
+("yrgdi"	"詩")
+("yrgg"	"詿")
+("yrggu"	"譊")
+("yrgni"	"譸")
+("yrgp"	"誌")
+("yrgr"	"詰")
+("yrgrr"	"譆")
+("yrgwc"	"讀")
+("yrhag"	"諻")
+("yrhdn"	"謻")
+("yrhds"	"誘")
+("yrhdv"	"諉")
+("yrhdw"	"譒")
+("yrher"	"詻")
+("yrhg"	"逞")
+("yrhge"	"譭")
+("yrhgr"	"誥")
+("yrhgu"	"詵")
+("yrhhi"	"謝")
+("yrhhj"	"諀")
+("yrhjd"	"誅")
+("yrhjm"	"諈")
+("yrhjr"	"話")
+("yrhk"	"訞")
+("yrhkb"	"譑")
+("yrhml"	"訢")
+("yrhmr"	"詬")
+("yrhmy"	"訴")
+("yrhne"	"設")
+("yrhni"	"諷")
+("yrhor"	"譗")
+("yrhp"	"託")
+("yrhpa"	"諙")
+("yrhpm"	"詆")
+("yrhqo"	"詄")
+("yrhs"	"詐")
+("yrhsb"	"諞")
+("yrhsm"	"謆")
+("yrhuc"	"讚")
+("yrhv"	"哀")
+("yrhwp"	"謥")
+("yrhxe"	"謏")
+("yrhxo"	"諛")
+("yrhxu"	"誽")
+("yrhyu"	"謕")
+("yriav"	"誏")
+("yrihr"	"諴")
+("yrihs"	"誠")
+("yrii"	"諓")
+("yrijb"	"誧")
+("yrijc"	"訹")
+("yrikk"	"詙")
+("yriku"	"訧")
+("yrill"	"詶")
+("yrine"	"詠")
+("yriok"	"誒")
+("yrior"	"諮")
+("yripm"	"試")
+("yrir"	"詒")
+("yrit"	"誡")
+("yritc"	"譧")
+("yritf"	"謶")
+("yrj"	"計")
+("yrjbc"	"謓")
+("yrjbd"	"誖")
+("yrjbj"	"諵")
+("yrjbm"	"誼")
+("yrjhp"	"詫")
+("yrjhw"	"讅")
+("yrjip"	"譓")
+("yrjka"	"諸")
+("yrjmm"	"諠")
+("yrjp"	"詑")
+("yrjr"	"詁")
+("yrkb"	"詴")
+("yrkf"	"詼")
+("yrkhg"	"誑")
+("yrkja"	"譇")
+("yrkms"	"誇")
+("yrlll"	"訓")
+("yrlmo"	"誂")
+("yrlmy"	"誹")
+("yrln"	"剖")
+("yrlwv"	"謱")
+("yrm"	"訌")
+("yrmbs"	"謣")
+("yrmd"	"訏")
+("yrmdm"	"讈")
+("yrmfj"	"評")
+("yrmhf"	"謜")
+("yrmj"	"訐")
+("yrmjk"	"譀")
+("yrmmr"	"語")
+("yrmmv"	"誫")
+("yrmn"	"訂")
+("yrmnr"	"訶")
+("yrmoo"	"誣")
+("yrmrw"	"諨")
+("yrmso"	"諑")
+("yrmua"	"譖")
+("yrmvh"	"訝")
+("yrmvm"	"誙")
+("yrmvn"	"瑀")
+("yrmwf"	"謤")
+("yrmwg"	"諲")
+("yrmwj"	"譚")
+("yrmym"	"証")
+("yrnbe"	"讂")
+("yrncr"	"譫")
+("yrnd"	"享")
+("yrnf"	"烹")
+("yrnhb"	"譎")
+("yrnhx"	"諂")
+("yrnib"	"誦")
+("yrnin"	"誃")
+("yrnir"	"詺")
+("yrnj"	"訊")
+("yrnkm"	"誕")
+("yrnl"	"部")
+("yrnlp"	"讔")
+("yrnmu"	"詭")
+("yrnn"	"亨")
+("yrnob"	"諝")
+("yrnot"	"證")
+("yrnqd"	"謋")
+("yrnri"	"讒")
+("yrnyi"	"誸")
+("yrob"	"訥")
+("yrog"	"誰")
+("yroge"	"謢")
+("yrogf"	"譙")
+("yrohh"	"診")
+("yroii"	"詅")
+("yroim"	"讖")
+("yroip"	"諗")
+("yroir"	"謒")
+("yroj"	"許")
+("yrok"	"敨")
+("yromb"	"論")
+("yromg"	"詮")
+("yromn"	"諭")
+("yromo"	"譣")
+("yron"	"訖")
+("yrop"	"訛")
+("yrotf"	"譕")
+("yrowy"	"誨")
+("yrpa"	"詣詢")
+("yrpd"	"訑")
+("yrpht"	"謐")
+("yrpko"	"譺")
+("yrppa"	"諧")
+("yrpt"	"詍")
+("yrptd"	"諜")
+("yrpu"	"訰")
+("yrpuu"	"謅")
+("yrqd"	"誄")
+("yrqjp"	"譿")
+("yrqmb"	"請")
+("yrqmc"	"謮")
+("yrqmv"	"諘")
+("yrrrd"	"譟")
+("yrrrj"	"譂")
+("yrrrs"	"諤")
+("yrrsj"	"諿")
+("yrru"	"遻")
+("yrruc"	"譔")
+("yrrv"	"襄")
+("yrrvk"	"誤")
+("yrrxu"	"譝")
+("yrshi"	"訒")
+("yrshr"	"詔")
+("yrsim"	"譅")
+("yrsip"	"認")
+("yrsje"	"諏")
+("yrsjj"	"讘")
+("yrsma"	"謵")
+("yrsmg"	"誆")
+("yrsmh"	"謬")
+("yrsmm"	"詡")
+("yrsmr"	"詞")
+("yrsrr"	"謳")
+("yrss"	"詎")
+("yrsu"	"記")
+("yrsup"	"誋")
+("yrsyj"	"謘")
+("yrtak"	"謨")
+("yrtav"	"譪")
+("yrtbm"	"譾")
+("yrtca"	"譜")
+("yrtct"	"謚")
+("yrtgi"	"議")
+("yrtkr"	"諾")
+("yrtlf"	"讌")
+("yrtlm"	"謹")
+("yrtm"	"詌")
+("yrtmc"	"諆")
+("yrtmd"	"謀")
+("yrtmj"	"譁")
+("yrtmv"	"諶")
+("yrtoe"	"護")
+("yrtq"	"詳")
+("yrtrg"	"讙")
+("yrtt"	"誁")
+("yrttb"	"講")
+("yrtwi"	"譐")
+("yrtwv"	"譨")
+("yrtxc"	"謙")
+("yrtyu"	"謊")
+("yru"	"乩訕")
+("yruc"	"選")
+("yrumb"	"諯")
+("yruu"	"詘")
+("yrvii"	"譏")
+("yrvis"	"詏")
+("yrwb"	"謂")
+("yrwce"	"謖")
+("yrwd"	"課")
+("yrwlj"	"譯")
+("yrwp"	"諰")
+("yrwww"	"讄")
+("yry"	"訃")
+("yrybb"	"諦")
+("yrybk"	"讞")
+("yrybs"	"謗")
+("yrycb"	"謫謪")
+("yryck"	"詨")
+("yrydk"	"譈")
+("yrye"	"遐敁")
+("yryfd"	"謎")
+("yryfe"	"諔")
+("yryg"	"註")
+("yryhh"	"諺")
+("yryhs"	"訪")
+("yryia"	"識")
+("yryjj"	"謰")
+("yrylr"	"譴")
+("yrymp"	"訿")
+("yryoj"	"誶")
+("yrypd"	"謼")
+("yrypm"	"謔謯")
+("yrypu"	"諕")
+("yryr"	"詀")
+("yryrb"	"謞")
+("yryrd"	"諄")
+("yryrf"	"諒")
+("yryro"	"譹")
+("yryrv"	"讓")
+("yryta"	"諳")
+("yryub"	"謧")
+("yryvo"	"該")
+("yrywm"	"譠")
+("ys"	"迉")
+("ysfv"	"褭")
+("yshr"	"迢")
+("ysm"	"与")
+("ysmvn"	"瓬")
+("ysnl"	"邡")
+("ysoby"	"旃")
+("ysofb"	"旓")
+("ysohc"	"旟")
+("ysohl"	"旂")
+("ysohm"	"旌")
+("ysohn"	"斻")
+("ysohu"	"旄")
+("ysohv"	"旅")
+("ysohw"	"旛")
+("ysojb"	"旆")
+("ysok"	"放")
+("ysokr"	"旖")
+("ysolo"	"旐")
+("ysomf"	"旚")
+("ysond"	"斿")
+("ysono"	"旋")
+("ysooa"	"旝")
+("ysooi"	"旍")
+("ysook"	"族")
+("ysopd"	"施")
+("ysosp"	"旎")
+("ysotc"	"旗")
+("ysoy"	"於")
+("ysoyu"	"旒")
+("ysp"	"迡")
+("ysrj"	"避")
+("ysyoo"	"旞")
+("ysyq"	"遲")
+("yt"	"立")
+("yta"	"音")
+("ytahu"	"竟")
+("ytaj"	"章")
+("ytap"	"意")
+("ytapv"	"竭")
+("ytbsd"	"竫")
+("ytcw"	"遒")
+("ytdl"	"竦")
+("ythaf"	"鴗鸕")
+("ythni"	"颯")
+("ythu"	"道")
+("yti"	"戲")
+("ytice"	"竣")
+("ytj"	"辛")
+("ytjki"	"竤")
+("ytk"	"送")
+("ytki"	"竑")
+("ytkr"	"逽")
+("ytmbc"	"顱")
+("ytog"	"遳")
+("ytpo"	"遂")
+("ytpr"	"竘")
+("ytqmb"	"靖")
+("ytsmm"	"翊")
+("ytstt"	"竮")
+("ytt"	"迸")
+("yttb"	"遘")
+("ytu"	"逆")
+("ytumb"	"端")
+("ytv"	"妾")
+("ytwa"	"遭")
+("ytwb"	"邁")
+("ytwg"	"童")
+("ytwi"	"遵")
+("ytyr"	"站")
+("yu"	"辿")
+("yuav"	"齦")
+("yubm"	"齟")
+("yubuc"	"贙")
+("yubuu"	"覤")
+("yudi"	"導")
+("yue"	"叡")
+("yuhaf"	"鷲")
+("yuhhh"	"彪")
+("yuhlb"	"齲")
+("yuhml"	"齗")
+("yuhxu"	"齯")
+("yuii"	"虥")
+("yuir"	"齝")
+("yujbc"	"齻")
+("yukb"	"离")
+("yukmr"	"齮")
+("yulwp"	"齥")
+("yumb"	"遄")
+("yummr"	"齬")
+("yumvh"	"齖")
+("yuoii"	"齡")
+("yuolf"	"虪")
+("yuoll"	"齘")
+("yuon"	"齕")
+("yup"	"齔")
+("yupr"	"齣")
+("yupru"	"齙")
+("yupt"	"齛")
+("yupuu"	"齺")
+("yurc"	"齞")
+("yurrs"	"齶")
+("yuryo"	"齪")
+("yushr"	"齠")
+("yusje"	"齱")
+("yusmg"	"齷")
+("yuta"	"齰")
+("yutct"	"齸")
+("yutm"	"瑎甝")
+("yuwd"	"齫")
+("yuwlb"	"齵")
+("yuyhh"	"齴")
+("yuymp"	"齜")
+("yuypu"	"虤")
+("yuytu"	"競")
+("yv"	"亡")
+("yvb"	"肓膂")
+("yvbcr"	"裔")
+("yvbq"	"牽")
+("yvbu"	"盲")
+("yvd"	"杗")
+("yvgg"	"壅")
+("yvgn"	"甕")
+("yvgu"	"罋")
+("yvgv"	"饔")
+("yvhbt"	"衁")
+("yvhg"	"雍")
+("yvhlu"	"巟")
+("yvho"	"亥")
+("yvhvo"	"瓤")
+("yvi"	"玄")
+("yviw"	"畜")
+("yvks"	"勷")
+("yvne"	"逯")
+("yvnl"	"邙")
+("yvp"	"忘")
+("yvrvp"	"氓")
+("yvv"	"妄")
+("yvvv"	"巡邋")
+("ywdv"	"裹")
+("ywgv"	"裏")
+("ywihr"	"鹹")
+("ywii"	"鹵")
+("ywlb"	"遇")
+("ywle"	"遝")
+("ywlg"	"邏")
+("ywlv"	"還褱")
+("ywmv"	"衰")
+("ywnl"	"鄐")
+("ywno"	"畝")
+("ywomo"	"鹼")
+("ywr"	"迴")
+("ywrd"	"稟")
+("ywrm"	"亶")
+("yws"	"卣")
+("ywtqm"	"鹺")
+("yx"	"齊")
+("yxbt"	"齍")
+("yxbuc"	"齎")
+("yxf"	"齋齌")
+("yxlmm"	"齏")
+("yxln"	"劑")
+("yy"	"卞")
+("yyaj"	"逴")
+("yybc"	"遉")
+("yycb"	"適")
+("yyhn"	"迒")
+("yymr"	"這")
+("yypo"	"遽")
+("yyr"	"迠")
+("yysd"	"遊")
+("yytj"	"遧")
+("yywm"	"邅")
+("yyws"	"逌")
+("z;" "；﹔，、﹐﹑")
+("z:" "：︰﹕．。‧﹒·")
+("z'" "’‘")
+("z\"" "”“〝〞〃")
+("z\\" "＼﹨╲")
+("z|" "｜︱︳∣")
+("z/" "／∕╱")
+("z?" "？﹖")
+("z<" "〈＜﹤︿∠")
+("z>" "〉＞﹥﹀")
+("z[" "〔【﹝︹︻「『﹁﹃")
+("z]" "〕】﹞︺︼」』﹂﹄")
+("z{" "｛﹛︷ ")
+("z}" "｝﹜︸")
+("z`" "‵′")
+("z~" "～﹋﹌︴﹏")
+("z!" "！﹗")
+("z@" "＠﹫")
+("z#" "＃﹟")
+("z$" "＄﹩")
+("z%" "％﹪")
+("z&" "＆﹠")
+("z*" "＊﹡※☆★")
+("z(" "（﹙︵")
+("z)" "）﹚︶")
+("z-" "–—¯￣－﹣")
+("z_" "＿ˍ")
+("z=" "＝﹦")
+("z+" "＋﹢")
+)
+;; Local Variables:
+;; version-control: never
+;; no-update-autoloads: t
+;; End:
+
+;;; tsang-b5.el ends here
@@ -3007,6 +3007,7 @@ cleanup_vector (struct Lisp_Vector *vector)
 	      eassert (valid_font_driver (drv));
 	      drv->close_font (font);
 	    }
+	  font_free_glyph_cache (font);
 	}
     }
   else if (PSEUDOVECTOR_TYPEP (&vector->header, PVEC_THREAD))
@@ -3015,6 +3016,8 @@ cleanup_vector (struct Lisp_Vector *vector)
     finalize_one_mutex (PSEUDOVEC_STRUCT (vector, Lisp_Mutex));
   else if (PSEUDOVECTOR_TYPEP (&vector->header, PVEC_CONDVAR))
     finalize_one_condvar (PSEUDOVEC_STRUCT (vector, Lisp_CondVar));
+  else if (PSEUDOVECTOR_TYPEP (&vector->header, PVEC_REGEXP))
+    finalize_one_regexp (PSEUDOVEC_STRUCT (vector, Lisp_Regexp));
   else if (PSEUDOVECTOR_TYPEP (&vector->header, PVEC_MARKER))
     {
       /* sweep_buffer should already have unchained this from its buffer.  */
@@ -3861,6 +3864,9 @@ memory_full (size_t nbytes)
       Vmemory_full = Qt;
       consing_until_gc = min (consing_until_gc, memory_full_cons_threshold);
 
+      /* Give back what the regexp matcher keeps for later.  */
+      shrink_fail_arenas (true);
+
       /* The first time we get here, free the spare memory.  */
       for (int i = 0; i < ARRAYELTS (spare_memory); i++)
 	if (spare_memory[i])
@@ -5532,15 +5538,15 @@ total_bytes_of_live_objects (void)
 
 #ifdef HAVE_WINDOW_SYSTEM
 
-/* Remove unmarked font-spec and font-entity objects from ENTRY, which is
-   (DRIVER-TYPE NUM-FRAMES FONT-CACHE-DATA ...), and return changed entry.  */
+/* Remove unmarked font-spec and font-entity objects from DATA, which
+   is a list of FONT-CACHE-DATA, and return changed list.  */
 
 static Lisp_Object
-compact_font_cache_entry (Lisp_Object entry)
+compact_font_cache_data (Lisp_Object data)
 {
-  Lisp_Object tail, *prev = &entry;
+  Lisp_Object tail, *prev = &data;
 
-  for (tail = entry; CONSP (tail); tail = XCDR (tail))
+  for (tail = data; CONSP (tail); tail = XCDR (tail))
     {
       bool drop = 0;
       Lisp_Object obj = XCAR (tail);
@@ -5596,6 +5602,29 @@ compact_font_cache_entry (Lisp_Object entry)
       else
 	prev = xcdr_addr (tail);
     }
+  return data;
+}
+
+/* Remove unmarked font-spec and font-entity objects from ENTRY, which is
+   (DRIVER-TYPE NUM-FRAMES INDEX), and return changed entry.  */
+
+static Lisp_Object
+compact_font_cache_entry (Lisp_Object entry)
+{
+  Lisp_Object tail = CONSP (entry) ? XCDR (entry) : Qnil;
+
+  tail = CONSP (tail) ? XCDR (tail) : Qnil;
+  if (CONSP (tail) && HASH_TABLE_P (XCAR (tail)))
+    {
+      Lisp_Object kv = XHASH_TABLE (XCAR (tail))->key_and_value;
+      ptrdiff_t i, size = gc_asize (kv);
+
+      /* The values of the hash table are lists of FONT-CACHE-DATA.  */
+      for (i = 0; i < size; i += 2)
+	if (!EQ (XVECTOR (kv)->contents[i], Qunbound))
+	  gc_aset (kv, i + 1,
+		   compact_font_cache_data (XVECTOR (kv)->contents[i + 1]));
+    }
   return entry;
 }
 
@@ -5929,6 +5958,7 @@ garbage_collect (void)
   block_input ();
 
   shrink_regexp_cache ();
+  shrink_fail_arenas (false);
 
   gc_in_progress = 1;
 
@@ -6262,6 +6292,13 @@ mark_face_cache (struct face_cache *c)
 		mark_object (face->lface[j]);
 	    }
 	}
+
+      /* Mark the face properties remembered in the face memo.  */
+      if (c->memo)
+	for (i = 0; i < FACE_MEMO_SIZE; ++i)
+	  if (c->memo[i].generation == c->memo_generation)
+	    for (j = 0; j < c->memo[i].nrefs; ++j)
+	      mark_object (c->memo[i].refs[j]);
     }
 }
 
@@ -6339,6 +6376,8 @@ mark_window (struct Lisp_Vector *ptr)
       mark_glyph_matrix (w->desired_matrix);
     }
 
+  mark_line_start_cache (w);
+
   /* Filter out killed buffers from both buffer lists
      in attempt to help GC to reclaim killed buffers faster.
      We can do it elsewhere for live windows, but this is the
@@ -6655,7 +6694,8 @@ #define CHECK_ALLOCATED_AND_LIVE_SYMBOL()	((void) 0)
 #undef CHECK_ALLOCATED_AND_LIVE
 }
 
-/* Mark the Lisp pointers in the terminal objects.
+/* Mark the Lisp pointers in the terminal objects, and in the
+   animation caches that their image caches share.
    Called by Fgarbage_collect.  */
 
 static void
@@ -6674,6 +6714,9 @@ mark_terminals (void)
       if (!vectorlike_marked_p (&t->header))
 	mark_vectorlike (&t->header);
     }
+#ifdef HAVE_WINDOW_SYSTEM
+  mark_anim_caches ();
+#endif
 }
 
 /* Value is non-zero if OBJ will survive the current GC because it's
@@ -365,6 +365,35 @@ bidi_isolate_fmt_char (bidi_type_t ch_type)
   return (ch_type == LRI || ch_type == RLI || ch_type == PDI || ch_type == FSI);
 }
 
+/* Return true if the UBA resolves character CH to the base level of a
+   left-to-right paragraph whenever the text around it has only such
+   characters.  This is true of all characters except the strong
+   right-to-left ones, Arabic numbers, directional formatting
+   characters, and paragraph separators.  */
+static bool
+bidi_ltr_char_p (int ch)
+{
+  switch (bidi_get_type (ch, NEUTRAL_DIR))
+    {
+    case STRONG_R:
+    case STRONG_AL:
+    case WEAK_AN:
+    case NEUTRAL_B:
+    case LRE:
+    case LRO:
+    case RLE:
+    case RLO:
+    case PDF:
+    case LRI:
+    case RLI:
+    case FSI:
+    case PDI:
+      return false;
+    default:
+      return true;
+    }
+}
+
 /* Return the mirrored character of C, if it has one.  If C has no
    mirrored counterpart, return C.
    Note: The conditions in UAX#9 clause L4 regarding the surrounding
@@ -405,7 +434,10 @@ bidi_mirror_char (int c)
 static bidi_bracket_type_t
 bidi_paired_bracket_type (int c)
 {
-  if (c == BIDI_EOB || bidi_inhibit_bpa)
+  /* Resolving brackets can look at the rest of a paragraph, which is
+     too slow in a buffer whose lines are too long.  */
+  if (c == BIDI_EOB || bidi_inhibit_bpa
+      || current_buffer->long_line_optimizations_p)
     return BIDI_BRACKET_NONE;
   if (c < 0 || c > MAX_CHAR)
     emacs_abort ();
@@ -1162,6 +1194,7 @@ bidi_init_it (ptrdiff_t charpos, ptrdiff_t bytepos, bool frame_window_p,
   bidi_it->sos = L2R;	 /* FIXME: should it be user-selectable? */
   bidi_it->disp_pos = -1;	/* invalid/unknown */
   bidi_it->disp_prop = 0;
+  bidi_it->ltr_limit = -1;
   /* We can only shrink the cache if we are at the bottom level of its
      "stack".  */
   if (bidi_cache_start == 0)
@@ -1477,10 +1510,11 @@ bidi_at_paragraph_end (ptrdiff_t charpos, ptrdiff_t bytepos)
 }
 
 /* If the user has requested the long scans caching, make sure that
-   BIDI cache is enabled.  Otherwise, make sure it's disabled.  */
+   the BIDI paragraph cache, or the BIDI LTR cache if LTR_P, is
+   enabled.  Otherwise, make sure it's disabled.  */
 
 static struct region_cache *
-bidi_paragraph_cache_on_off (void)
+bidi_region_cache_on_off (bool ltr_p)
 {
   struct buffer *cache_buffer = current_buffer;
   bool indirect_p = false;
@@ -1493,6 +1527,10 @@ bidi_paragraph_cache_on_off (void)
       indirect_p = true;
     }
 
+  struct region_cache **cache = (ltr_p
+				 ? &cache_buffer->bidi_ltr_cache
+				 : &cache_buffer->bidi_paragraph_cache);
+
   /* Don't turn on or off the cache in the base buffer, if the value
      of cache-long-scans of the base buffer is inconsistent with that.
      This is because doing so will just make the cache pure overhead,
@@ -1503,10 +1541,10 @@ bidi_paragraph_cache_on_off (void)
       if (!indirect_p
 	  || NILP (BVAR (cache_buffer, cache_long_scans)))
 	{
-	  if (cache_buffer->bidi_paragraph_cache)
+	  if (*cache)
 	    {
-	      free_region_cache (cache_buffer->bidi_paragraph_cache);
-	      cache_buffer->bidi_paragraph_cache = 0;
+	      free_region_cache (*cache);
+	      *cache = 0;
 	    }
 	}
       return NULL;
@@ -1516,10 +1554,10 @@ bidi_paragraph_cache_on_off (void)
       if (!indirect_p
 	  || !NILP (BVAR (cache_buffer, cache_long_scans)))
 	{
-	  if (!cache_buffer->bidi_paragraph_cache)
-	    cache_buffer->bidi_paragraph_cache = new_region_cache ();
+	  if (!*cache)
+	    *cache = new_region_cache ();
 	}
-      return cache_buffer->bidi_paragraph_cache;
+      return *cache;
     }
 }
 
@@ -1541,7 +1579,7 @@ bidi_find_paragraph_start (ptrdiff_t pos, ptrdiff_t pos_byte)
     ? BVAR (current_buffer, bidi_paragraph_start_re)
     : paragraph_start_re;
   ptrdiff_t limit = ZV, limit_byte = ZV_BYTE;
-  struct region_cache *bpc = bidi_paragraph_cache_on_off ();
+  struct region_cache *bpc = bidi_region_cache_on_off (false);
   ptrdiff_t n = 0, oldpos = pos, next;
   struct buffer *cache_buffer = current_buffer;
 
@@ -1581,6 +1619,91 @@ bidi_find_paragraph_start (ptrdiff_t pos, ptrdiff_t pos_byte)
   return pos_byte;
 }
 
+/* The maximum number of characters bidi_find_ltr_limit examines when
+   the BIDI LTR cache is disabled, and it must examine them anew each
+   time it's called for the same line.  */
+#define MAX_LTR_LINE_SEARCH 100000
+
+/* Find where the text of the current line of BIDI_IT ends, if all of
+   that text, from the next character to deliver, can be delivered in
+   logical order at base level 0.  That's true in a left-to-right
+   paragraph of buffer text when bidi_ltr_char_p is true of each of
+   the characters, because then each one resolves to the base level,
+   whatever the types of the characters around it.  Value is the
+   position of the newline that ends the line, or ZV if the line
+   doesn't end in a newline; or -1 if the text can't be delivered that
+   way.  */
+static ptrdiff_t
+bidi_find_ltr_limit (struct bidi_it *bidi_it)
+{
+  ptrdiff_t pos, bytepos, eol, counted;
+  struct region_cache *blc;
+  struct buffer *cache_buffer = current_buffer;
+
+  if (bidi_it->string.s || STRINGP (bidi_it->string.lstring)
+      || bidi_it->paragraph_dir != L2R
+      || bidi_it->level_stack[0].level != 0)
+    return -1;
+
+  /* Find the next character to deliver, like bidi_resolve_explicit.  */
+  if (bidi_it->bytepos < BEGV_BYTE || bidi_it->first_elt)
+    {
+      pos = bidi_it->charpos;
+      bytepos = bidi_it->bytepos;
+      if (pos < BEGV)
+	pos = BEGV, bytepos = BEGV_BYTE;
+    }
+  else
+    {
+      pos = bidi_it->charpos + bidi_it->nchars;
+      bytepos = bidi_it->bytepos + bidi_it->ch_len;
+    }
+  if (pos >= ZV)
+    return -1;
+
+  eol = find_newline (pos, bytepos, ZV, ZV_BYTE, 1, &counted, NULL, false);
+  if (counted > 0)
+    eol--;
+
+  blc = bidi_region_cache_on_off (true);
+  if (!blc && eol - pos > MAX_LTR_LINE_SEARCH)
+    return -1;
+  if (cache_buffer->base_buffer)
+    cache_buffer = cache_buffer->base_buffer;
+
+  while (pos < eol)
+    {
+      ptrdiff_t next = eol, start = pos;
+
+      if (blc && region_cache_forward (cache_buffer, blc, pos, &next))
+	{
+	  /* Positions returned by the region cache are not limited to
+	     BEGV..ZV range.  */
+	  pos = next;
+	  bytepos = -1;
+	  continue;
+	}
+      if (next > eol)
+	next = eol;
+      if (bytepos < 0)
+	bytepos = CHAR_TO_BYTE (pos);
+      while (pos < next)
+	{
+	  if (!bidi_ltr_char_p (FETCH_CHAR (bytepos)))
+	    {
+	      if (blc && pos > start)
+		know_region_cache (cache_buffer, blc, start, pos);
+	      return -1;
+	    }
+	  INC_BOTH (pos, bytepos);
+	}
+      if (blc)
+	know_region_cache (cache_buffer, blc, start, next);
+    }
+
+  return eol;
+}
+
 /* On a 3.4 GHz machine, searching forward for a strong directional
    character in a long paragraph full of weaks or neutrals takes about
    1 ms for each 20K characters.  The number below limits each call to
@@ -3394,6 +3517,57 @@ bidi_find_other_level_edge (struct bidi_it *bidi_it, int level, bool end_flag)
     }
 }
 
+/* Advance BIDI_IT to the next character of text before its LTR_LIMIT,
+   and resolve it to the base level.  This does what the UBA does for
+   such text, but in a single step and without using the cache.  */
+static void
+bidi_move_to_next_ltr_char (struct bidi_it *bidi_it)
+{
+  if (bidi_it->bytepos < BEGV_BYTE || bidi_it->first_elt)
+    {
+      bidi_it->first_elt = 0;
+      if (bidi_it->charpos < BEGV)
+	{
+	  bidi_it->charpos = BEGV;
+	  bidi_it->bytepos = BEGV_BYTE;
+	}
+    }
+  else
+    {
+      bidi_it->charpos += bidi_it->nchars;
+      bidi_it->bytepos += bidi_it->ch_len;
+    }
+  bidi_it->ch = bidi_fetch_char (bidi_it->charpos, bidi_it->bytepos,
+				 &bidi_it->disp_pos, &bidi_it->disp_prop,
+				 &bidi_it->string, bidi_it->w,
+				 bidi_it->frame_window_p,
+				 &bidi_it->ch_len, &bidi_it->nchars);
+  bidi_it->orig_type = bidi_get_type (bidi_it->ch, NEUTRAL_DIR);
+  bidi_check_type (bidi_it->orig_type);
+  bidi_it->resolved_level = bidi_it->level_stack[0].level;
+
+  switch (bidi_it->orig_type)
+    {
+    case NEUTRAL_B:
+      /* This is a `space' display spec, see bidi_fetch_char.  */
+      bidi_set_sos_type (bidi_it, bidi_it->resolved_level,
+			 bidi_it->resolved_level); /* X10 */
+      FALLTHROUGH;
+    case WEAK_BN:		/* X9/Retaining */
+      bidi_it->type = bidi_it->type_after_wn = bidi_it->orig_type;
+      break;
+    case NEUTRAL_S:
+    case NEUTRAL_WS:		/* needed in L1 */
+      bidi_it->type_after_wn = bidi_it->orig_type;
+      bidi_it->type = STRONG_L;
+      break;
+    default:
+      /* Everything else is L or becomes L by W7, N1 or N2.  */
+      bidi_it->type = bidi_it->type_after_wn = STRONG_L;
+      break;
+    }
+}
+
 void
 bidi_move_to_visually_next (struct bidi_it *bidi_it)
 {
@@ -3411,7 +3585,26 @@ bidi_move_to_visually_next (struct bidi_it *bidi_it)
   /* If we just passed a newline, initialize for the next line.  */
   if (!bidi_it->first_elt
       && (bidi_it->ch == '\n' || bidi_it->ch == BIDI_EOB))
-    bidi_line_init (bidi_it);
+    {
+      bidi_line_init (bidi_it);
+      bidi_it->ltr_limit = bidi_find_ltr_limit (bidi_it);
+    }
+  else if (bidi_it->first_elt)
+    bidi_it->ltr_limit = bidi_find_ltr_limit (bidi_it);
+
+  /* If the rest of the line needs no reordering, deliver the next
+     character without running the UBA on it.  The newline at the
+     line's end is delivered by the UBA, so that it handles the end
+     of the paragraph as usual.  */
+  if (bidi_it->scan_dir == 1
+      && bidi_cache_idx == bidi_cache_start
+      && (bidi_it->first_elt || bidi_it->bytepos < BEGV_BYTE
+	  ? max (bidi_it->charpos, BEGV)
+	  : bidi_it->charpos + bidi_it->nchars) < bidi_it->ltr_limit)
+    {
+      bidi_move_to_next_ltr_char (bidi_it);
+      return;
+    }
 
   /* Prepare the sentinel iterator state, and cache it.  When we bump
      into it, scanning backwards, we'll know that the last non-base
@@ -577,6 +577,8 @@ DEFUN ("get-buffer-create", Fget_buffer_create, Sget_buffer_create, 1, 1, 0,
   b->newline_cache = 0;
   b->width_run_cache = 0;
   b->bidi_paragraph_cache = 0;
+  b->bidi_ltr_cache = 0;
+  b->redisplay_stats = NULL;
   bset_width_table (b, Qnil);
   b->prevent_redisplay_optimizations_p = 1;
 
@@ -814,6 +816,8 @@ DEFUN ("make-indirect-buffer", Fmake_indirect_buffer, Smake_indirect_buffer,
   b->newline_cache = 0;
   b->width_run_cache = 0;
   b->bidi_paragraph_cache = 0;
+  b->bidi_ltr_cache = 0;
+  b->redisplay_stats = NULL;
   bset_width_table (b, Qnil);
 
   name = Fcopy_sequence (name);
@@ -949,6 +953,8 @@ reset_buffer (register struct buffer *b)
   /* It is more conservative to start out "changed" than "unchanged".  */
   b->clip_changed = 0;
   b->prevent_redisplay_optimizations_p = 1;
+  b->long_line_optimizations_p = 0;
+  b->long_line_checked_size = 0;
   bset_backed_up (b, Qnil);
   BUF_AUTOSAVE_MODIFF (b) = 0;
   b->auto_save_failure_time = 0;
@@ -1340,6 +1346,10 @@ DEFUN ("force-mode-line-update", Fforce_mode_line_update,
 menu bar menus and the frame title.  */)
      (Lisp_Object all)
 {
+  /* Whatever made the caller want the mode line updated might not be
+     among the dependencies of its (:memo DEPS FORM) elements.  */
+  mode_line_memo_tick++;
+
   if (!NILP (all))
     {
       update_mode_lines = 10;
@@ -1945,6 +1955,13 @@ DEFUN ("kill-buffer", Fkill_buffer, Skill_buffer, 0, 1, "bKill buffer: ",
       free_region_cache (b->bidi_paragraph_cache);
       b->bidi_paragraph_cache = 0;
     }
+  if (b->bidi_ltr_cache)
+    {
+      free_region_cache (b->bidi_ltr_cache);
+      b->bidi_ltr_cache = 0;
+    }
+  xfree (b->redisplay_stats);
+  b->redisplay_stats = NULL;
   bset_width_table (b, Qnil);
   unblock_input ();
   bset_undo_list (b, Qnil);
@@ -2250,6 +2267,7 @@ DEFUN ("erase-buffer", Ferase_buffer, Serase_buffer, 0, 0, "*",
   del_range (BEG, Z);
 
   current_buffer->last_window_start = 1;
+  current_buffer->long_line_optimizations_p = 0;
   /* Prevent warnings, or suspension of auto saving, that would happen
      if future size is less than past size.  Use of erase-buffer
      implies that the future text is not really related to the past text.  */
@@ -2377,6 +2395,7 @@ #define swapfield_(field, type) \
   swapfield (newline_cache, struct region_cache *);
   swapfield (width_run_cache, struct region_cache *);
   swapfield (bidi_paragraph_cache, struct region_cache *);
+  swapfield (bidi_ltr_cache, struct region_cache *);
   current_buffer->prevent_redisplay_optimizations_p = 1;
   other_buffer->prevent_redisplay_optimizations_p = 1;
   swapfield (overlays_before, struct Lisp_Overlay *);
@@ -5555,6 +5574,14 @@ syms_of_buffer (void)
  using the result as a mode line construct.  Be careful--FORM should
  not load any files, because that can cause an infinite recursion.
 
+A list of the form `(:memo DEPS FORM)' is processed like `(:eval FORM)',
+ except that FORM is evaluated again only when the value of DEPS, the
+ buffer shown in the window, its text or text properties, whether it is
+ modified, the width of the window or whether it is selected changed,
+ or after `force-mode-line-update'.
+ Otherwise the previous value of FORM in that window is used.  DEPS is
+ evaluated every time, so it should be cheap.
+
 A list of the form `(:propertize ELT PROPS...)' is processed by
  processing ELT as the mode line construct, and adding the text
  properties PROPS to the result.
@@ -640,6 +640,10 @@ #define BVAR(buf, field) ((buf)->field ## _)
      the last time this buffer was displayed.  */
   ptrdiff_t last_window_start;
 
+  /* The size of the buffer text the last time redisplay looked for
+     long lines in it.  */
+  ptrdiff_t long_line_checked_size;
+
   /* If the long line scan cache is enabled (i.e. the buffer-local
      variable cache-long-line-scans is non-nil), newline_cache
      points to the newline cache, and width_run_cache points to the
@@ -657,10 +661,21 @@ #define BVAR(buf, field) ((buf)->field ## _)
      such regions very quickly, using algebra instead of inspecting
      each character.   See also width_table, below.
 
-     The latter cache is used to speedup bidi_find_paragraph_start.  */
+     The bidi paragraph cache is used to speedup
+     bidi_find_paragraph_start.
+
+     The bidi LTR cache records which stretches of the buffer are
+     known to contain no characters that could be displayed other
+     than in logical order in a left-to-right paragraph, so that the
+     bidi iterator can deliver them without reordering.  */
   struct region_cache *newline_cache;
   struct region_cache *width_run_cache;
   struct region_cache *bidi_paragraph_cache;
+  struct region_cache *bidi_ltr_cache;
+
+  /* What it took to redisplay the windows showing this buffer, or
+     NULL if it hasn't been displayed yet; see `redisplay-statistics'.  */
+  struct redisplay_stats *redisplay_stats;
 
   /* Non-zero means disable redisplay optimizations when rebuilding the glyph
      matrices (but not when redrawing).  */
@@ -676,6 +691,12 @@ #define BVAR(buf, field) ((buf)->field ## _)
      defined.  */
   bool_bf inhibit_buffer_hooks : 1;
 
+  /* Non-zero means the buffer has a line longer than
+     `long-line-threshold', so redisplay should bound the work it does
+     on each line.  See the comment before `get_narrowed_len' in
+     xdisp.c.  */
+  bool_bf long_line_optimizations_p : 1;
+
   /* List of overlays that end at or before the current center,
      in order of end-position.  */
   struct Lisp_Overlay *overlays_before;
@@ -22,12 +22,21 @@
 
 #include "lisp.h"
 #include "buffer.h"
+#include "character.h"
 
 Lisp_Object Vascii_downcase_table;
 static Lisp_Object Vascii_upcase_table;
 Lisp_Object Vascii_canon_table;
 static Lisp_Object Vascii_eqv_table;
 
+/* The number of translation tables of which flat copies are kept.  */
+enum { FOLD_TABLES = 4 };
+
+/* The flat copies, and the index of the copy to reuse next for
+   another table.  */
+static struct fold_table fold_tables[FOLD_TABLES];
+static int fold_table_next;
+
 static void set_canon (Lisp_Object case_table, Lisp_Object range, Lisp_Object elt);
 static void set_identity (Lisp_Object table, Lisp_Object c, Lisp_Object elt);
 static void shuffle (Lisp_Object table, Lisp_Object c, Lisp_Object elt);
@@ -239,6 +248,64 @@ shuffle (Lisp_Object table, Lisp_Object c, Lisp_Object elt)
     }
 }
 
+/* Discard the translations in FOLD.  */
+
+static void
+clear_fold_table (struct fold_table *fold)
+{
+  for (int i = 0; i < ARRAYELTS (fold->page); i++)
+    {
+      xfree (fold->page[i]);
+      fold->page[i] = NULL;
+    }
+  fold->modiff = char_table_modiff;
+}
+
+/* Return a flat copy of the translation char-table TABLE, such as a
+   case canonicalization table, for use with fold_char.  The copy is
+   good until Lisp code runs that might modify char-tables or
+   translate characters with other tables.  */
+
+struct fold_table *
+get_fold_table (Lisp_Object table)
+{
+  struct fold_table *fold;
+  int i;
+
+  eassert (CHAR_TABLE_P (table));
+  for (i = 0; i < FOLD_TABLES; i++)
+    if (EQ (fold_tables[i].table, table))
+      break;
+  if (i == FOLD_TABLES)
+    {
+      i = fold_table_next;
+      fold_table_next = (i + 1) % FOLD_TABLES;
+      fold_tables[i].table = table;
+      clear_fold_table (&fold_tables[i]);
+    }
+
+  fold = &fold_tables[i];
+  if (fold->modiff != char_table_modiff)
+    clear_fold_table (fold);
+  return fold;
+}
+
+/* Fill the page of FOLD that holds the translation of character CH,
+   and return that translation.  */
+
+int
+fill_fold_table_page (struct fold_table *fold, int ch)
+{
+  int size = 1 << FOLD_TABLE_PAGE_BITS;
+  int first = ch & ~(size - 1);
+  int *page = xmalloc (size * sizeof *page);
+
+  for (int i = 0; i < size; i++)
+    page[i] = char_table_translate (fold->table, first + i);
+  fold->page[ch >> FOLD_TABLE_PAGE_BITS] = page;
+  return page[ch - first];
+}
+
 void
 init_casetab_once (void)
 {
@@ -294,6 +361,8 @@ syms_of_casetab (void)
   staticpro (&Vascii_downcase_table);
   staticpro (&Vascii_eqv_table);
   staticpro (&Vascii_upcase_table);
+  for (int i = 0; i < FOLD_TABLES; i++)
+    staticpro (&fold_tables[i].table);
 
   defsubr (&Scase_table_p);
   defsubr (&Scurrent_case_table);
@@ -702,6 +702,55 @@ char_table_translate (Lisp_Object obj, int ch)
   return CHARACTERP (obj) ? XFIXNUM (obj) : ch;
 }
 
+/* Flat copies of translation tables.  */
+
+enum
+  {
+    /* The characters for which fold tables hold translations: those
+       of the Basic Multilingual Plane, which includes ASCII.  */
+    FOLD_TABLE_CHARS = 0x10000,
+
+    /* Fold tables are filled a page of this many bits at a time.  */
+    FOLD_TABLE_PAGE_BITS = 8
+  };
+
+/* A flat copy of the part of the translation char-table TABLE for
+   the first FOLD_TABLE_CHARS characters, so that case-insensitive
+   searches need not look up each character they examine in a
+   char-table.  A page of the copy is filled when a character in it is
+   first translated.  See get_fold_table.  */
+struct fold_table
+{
+  Lisp_Object table;
+
+  /* The value of char_table_modiff when the pages were filled.  */
+  EMACS_INT modiff;
+
+  /* The translations, or null for pages not yet filled.  */
+  int *page[FOLD_TABLE_CHARS >> FOLD_TABLE_PAGE_BITS];
+};
+
+extern struct fold_table *get_fold_table (Lisp_Object);
+extern int fill_fold_table_page (struct fold_table *, int);
+
+/* Return the translation of character CH by the char-table TABLE,
+   using FOLD, which get_fold_table returned for TABLE.  Check that
+   FOLD is still a copy of TABLE, as Lisp code run in the meantime
+   may have made get_fold_table reuse it for another table.  */
+
+INLINE int
+fold_char (struct fold_table *fold, Lisp_Object table, int ch)
+{
+  if (ch < FOLD_TABLE_CHARS && EQ (fold->table, table))
+    {
+      int *page = fold->page[ch >> FOLD_TABLE_PAGE_BITS];
+      return (page
+	      ? page[ch & ((1 << FOLD_TABLE_PAGE_BITS) - 1)]
+	      : fill_fold_table_page (fold, ch));
+    }
+  return char_table_translate (table, ch);
+}
+
 extern signed char const hexdigit[];
 
 /* If C is a hexadecimal digit ('0'-'9', 'a'-'f', 'A'-'F'), return its
@@ -413,11 +413,19 @@ sub_char_table_set (Lisp_Object table, int c, Lisp_Object val, bool is_uniprop)
     }
 }
 
+/* Incremented whenever a character's value or an extra slot in some
+   char-table may change, so that copies of char-tables such as the
+   fold tables in casetab.c, and what redisplay computed from display
+   tables, can tell when they are out of date.  */
+EMACS_INT char_table_modiff;
+
 void
 char_table_set (Lisp_Object table, int c, Lisp_Object val)
 {
   struct Lisp_Char_Table *tbl = XCHAR_TABLE (table);
 
+  char_table_modiff++;
+
   if (ASCII_CHAR_P (c)
       && SUB_CHAR_TABLE_P (tbl->ascii))
     set_sub_char_table_contents (tbl->ascii, c, val);
@@ -481,6 +489,7 @@ char_table_set_range (Lisp_Object table, int from, int to, Lisp_Object val)
 {
   struct Lisp_Char_Table *tbl = XCHAR_TABLE (table);
 
+  char_table_modiff++;
   if (from == to)
     char_table_set (table, from, val);
   else
@@ -558,6 +567,7 @@ DEFUN ("set-char-table-parent", Fset_char_table_parent, Sset_char_table_parent,
     }
 
   set_char_table_parent (char_table, parent);
+  char_table_modiff++;
 
   return parent;
 }
@@ -589,6 +599,7 @@ DEFUN ("set-char-table-extra-slot", Fset_char_table_extra_slot,
     args_out_of_range (char_table, n);
 
   set_char_table_extras (char_table, XFIXNUM (n), value);
+  char_table_modiff++;
   return value;
 }
 
@@ -631,6 +642,7 @@ DEFUN ("set-char-table-range", Fset_char_table_range, Sset_char_table_range,
   (Lisp_Object char_table, Lisp_Object range, Lisp_Object value)
 {
   CHECK_CHAR_TABLE (char_table);
+  char_table_modiff++;
   if (EQ (range, Qt))
     {
       int i;
@@ -46,6 +46,7 @@ cmputc (int c)
   if (current_tty->termscript)
     putc (c & 0177, current_tty->termscript);
   putc (c & 0177, current_tty->output);
+  current_tty->bytes_output++;
   return c;
 }
 
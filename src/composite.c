@@ -24,6 +24,8 @@
 
 #include <config.h>
 
+#include <stdlib.h>
+
 #include "lisp.h"
 #include "character.h"
 #include "composite.h"
@@ -31,6 +33,7 @@
 #include "coding.h"
 #include "intervals.h"
 #include "frame.h"
+#include "window.h"
 #include "dispextern.h"
 #include "termhooks.h"
 
@@ -634,19 +637,60 @@ compose_text (ptrdiff_t start, ptrdiff_t end, Lisp_Object components,
 
 /* Hash table for automatic composition.  The key is a header of a
    lgstring (Lispy glyph-string), and the value is a body of a
-   lgstring.  */
+   lgstring.  The header consists of the font object, which also
+   determines the OpenType features used, and the characters shaped,
+   so this caches the result of shaping those characters with that
+   font.  */
 
 static Lisp_Object gstring_hash_table;
 
+/* When each glyph-string in gstring_hash_table was last used, by the
+   index of its hash table entry, which is also its ID.  This is used
+   to keep the cache within `composition-cache-size-limit'.  */
+
+static EMACS_UINT *gstring_last_use;
+static ptrdiff_t gstring_last_use_size;
+static EMACS_UINT gstring_use_count;
+
+/* Statistics of the cache, for `composition-cache-statistics'.  */
+
+static intmax_t gstring_cache_hits, gstring_cache_misses;
+static intmax_t gstring_cache_evictions;
+
 static Lisp_Object gstring_lookup_cache (Lisp_Object);
 
+/* Record that the glyph-string with ID was just used.  */
+
+static void
+gstring_note_use (ptrdiff_t id)
+{
+  ptrdiff_t size = HASH_TABLE_SIZE (XHASH_TABLE (gstring_hash_table));
+
+  if (gstring_last_use_size < size)
+    {
+      gstring_last_use = xrealloc (gstring_last_use,
+				   size * sizeof *gstring_last_use);
+      memset (gstring_last_use + gstring_last_use_size, 0,
+	      (size - gstring_last_use_size) * sizeof *gstring_last_use);
+      gstring_last_use_size = size;
+    }
+  gstring_last_use[id] = ++gstring_use_count;
+}
+
 static Lisp_Object
 gstring_lookup_cache (Lisp_Object header)
 {
   struct Lisp_Hash_Table *h = XHASH_TABLE (gstring_hash_table);
   ptrdiff_t i = hash_lookup (h, header, NULL);
 
-  return (i >= 0 ? HASH_VALUE (h, i) : Qnil);
+  if (i < 0)
+    {
+      gstring_cache_misses++;
+      return Qnil;
+    }
+  gstring_cache_hits++;
+  gstring_note_use (i);
+  return HASH_VALUE (h, i);
 }
 
 Lisp_Object
@@ -670,6 +714,7 @@ composition_gstring_put_cache (Lisp_Object gstring, ptrdiff_t len)
     LGSTRING_SET_GLYPH (copy, i, Fcopy_sequence (LGSTRING_GLYPH (gstring, i)));
   ptrdiff_t id = hash_put (h, LGSTRING_HEADER (copy), copy, hash);
   LGSTRING_SET_ID (copy, make_fixnum (id));
+  gstring_note_use (id);
   return copy;
 }
 
@@ -678,9 +723,169 @@ composition_gstring_from_id (ptrdiff_t id)
 {
   struct Lisp_Hash_Table *h = XHASH_TABLE (gstring_hash_table);
 
+  if (id < gstring_last_use_size)
+    gstring_last_use[id] = ++gstring_use_count;
   return HASH_VALUE (h, id);
 }
 
+/* Mark in IN_USE, which has N elements, the IDs of the glyph-strings
+   of automatic compositions shown in glyph matrix MATRIX.  */
+
+static void
+mark_gstrings_in_matrix (struct glyph_matrix *matrix, bool *in_use,
+			 ptrdiff_t n)
+{
+  for (int i = 0; i < matrix->nrows; i++)
+    {
+      struct glyph_row *row = MATRIX_ROW (matrix, i);
+
+      if (row->enabled_p)
+	for (int area = LEFT_MARGIN_AREA; area < LAST_AREA; area++)
+	  for (struct glyph *g = row->glyphs[area];
+	       g < row->glyphs[area] + row->used[area]; g++)
+	    if (g->type == COMPOSITE_GLYPH && g->u.cmp.automatic
+		&& 0 <= g->u.cmp.id && g->u.cmp.id < n)
+	      in_use[g->u.cmp.id] = true;
+    }
+}
+
+/* Likewise for the current matrices of the windows in the window tree
+   starting with W.  */
+
+static void
+mark_gstrings_in_use (struct window *w, bool *in_use, ptrdiff_t n)
+{
+  while (w)
+    {
+      if (WINDOWP (w->contents))
+	mark_gstrings_in_use (XWINDOW (w->contents), in_use, n);
+      else if (w->current_matrix)
+	mark_gstrings_in_matrix (w->current_matrix, in_use, n);
+
+      w = NILP (w->next) ? NULL : XWINDOW (w->next);
+    }
+}
+
+/* Compare the IDs of glyph-strings A and B by when they were last
+   used.  */
+
+static int
+compare_gstring_last_use (void const *a, void const *b)
+{
+  EMACS_UINT use_a = gstring_last_use[*(ptrdiff_t const *) a];
+  EMACS_UINT use_b = gstring_last_use[*(ptrdiff_t const *) b];
+
+  return use_a < use_b ? -1 : use_a > use_b;
+}
+
+/* Remove the least recently used glyph-strings from the composition
+   cache when it holds more than `composition-cache-size-limit' of
+   them, until it holds no more than 3/4 of that.  Leaving room for
+   new glyph-strings means the cache and the glyph matrices are only
+   scanned once every so many new glyph-strings, rather than each time
+   one is added.  Don't remove glyph-strings that are displayed, as
+   glyphs refer to them by ID.  Call this at the end of redisplay,
+   when the current matrices show what is displayed.  */
+
+void
+limit_composition_cache (void)
+{
+  struct Lisp_Hash_Table *h = XHASH_TABLE (gstring_hash_table);
+  ptrdiff_t size = HASH_TABLE_SIZE (h);
+  ptrdiff_t i, nids = 0;
+  Lisp_Object tail, frame;
+
+  if (!FIXNATP (Vcomposition_cache_size_limit)
+      || h->count <= XFIXNAT (Vcomposition_cache_size_limit))
+    return;
+
+  EMACS_INT target = XFIXNAT (Vcomposition_cache_size_limit) / 4 * 3;
+
+  bool *in_use = xzalloc (size * sizeof *in_use);
+  ptrdiff_t *ids = xmalloc (size * sizeof *ids);
+
+  FOR_EACH_FRAME (tail, frame)
+    {
+      struct frame *f = XFRAME (frame);
+
+      /* On text terminals, the frame matrix also has the rows of the
+	 tab bar and the menu bar.  */
+      if (f->current_matrix)
+	mark_gstrings_in_matrix (f->current_matrix, in_use, size);
+      mark_gstrings_in_use (XWINDOW (f->root_window), in_use, size);
+#ifdef HAVE_WINDOW_SYSTEM
+      if (WINDOWP (f->tab_bar_window))
+	mark_gstrings_in_use (XWINDOW (f->tab_bar_window), in_use, size);
+#endif
+#ifdef HAVE_INT_TOOL_BAR
+      if (WINDOWP (f->tool_bar_window))
+	mark_gstrings_in_use (XWINDOW (f->tool_bar_window), in_use, size);
+#endif
+#if defined HAVE_X_WINDOWS && ! defined USE_X_TOOLKIT && ! defined USE_GTK
+      if (WINDOWP (f->menu_bar_window))
+	mark_gstrings_in_use (XWINDOW (f->menu_bar_window), in_use, size);
+#endif
+    }
+
+  for (i = 0; i < size; i++)
+    if (!EQ (HASH_KEY (h, i), Qunbound) && !in_use[i])
+      ids[nids++] = i;
+
+  /* Glyph-strings that were never looked up are the oldest.  */
+  if (gstring_last_use_size < size)
+    {
+      gstring_last_use = xrealloc (gstring_last_use,
+				   size * sizeof *gstring_last_use);
+      memset (gstring_last_use + gstring_last_use_size, 0,
+	      (size - gstring_last_use_size) * sizeof *gstring_last_use);
+      gstring_last_use_size = size;
+    }
+  qsort (ids, nids, sizeof *ids, compare_gstring_last_use);
+
+  for (i = 0; i < nids && h->count > target; i++)
+    {
+      /* Lisp code might still have the glyph-string.  Its ID will be
+	 reused, so make it look like it was never cached.  */
+      LGSTRING_SET_ID (HASH_VALUE (h, ids[i]), Qnil);
+      hash_remove_from_table (h, HASH_KEY (h, ids[i]));
+      gstring_cache_evictions++;
+    }
+
+  xfree (ids);
+  xfree (in_use);
+}
+
+DEFUN ("composition-cache-statistics", Fcomposition_cache_statistics,
+       Scomposition_cache_statistics, 0, 1, 0,
+       doc: /* Return statistics about the cache of shaped glyph-strings.
+Automatic compositions are shaped by the font once for each sequence
+of characters, and the resulting glyph-strings are cached.
+
+The value is a property list with the following properties:
+
+ `:size' is the number of glyph-strings in the cache.
+ `:hits' is the number of times Emacs found the glyph-string it needed
+   in the cache.
+ `:misses' is the number of times it didn't, and had to shape the
+   characters again.
+ `:evictions' is the number of glyph-strings it removed from the
+   cache to keep it within `composition-cache-size-limit'.
+
+If RESET is non-nil, reset the statistics other than `:size' to zero
+after returning them.  */)
+  (Lisp_Object reset)
+{
+  Lisp_Object val
+    = list (QCsize, make_int (XHASH_TABLE (gstring_hash_table)->count),
+	    QChits, make_int (gstring_cache_hits),
+	    QCmisses, make_int (gstring_cache_misses),
+	    QCevictions, make_int (gstring_cache_evictions));
+
+  if (!NILP (reset))
+    gstring_cache_hits = gstring_cache_misses = gstring_cache_evictions = 0;
+  return val;
+}
+
 DEFUN ("clear-composition-cache", Fclear_composition_cache,
        Sclear_composition_cache, 0, 0, 0,
        doc: /* Internal use only.
@@ -689,6 +894,8 @@ DEFUN ("clear-composition-cache", Fclear_composition_cache,
 {
   Lisp_Object args[] = {QCtest, Qequal, QCsize, make_fixnum (311)};
   gstring_hash_table = CALLMANY (Fmake_hash_table, args);
+  memset (gstring_last_use, 0,
+	  gstring_last_use_size * sizeof *gstring_last_use);
   /* Fixme: We call Fclear_face_cache to force complete re-building of
      display glyphs.  But, it may be better to call this function from
      Fclear_face_cache instead.  */
@@ -1967,6 +2174,10 @@ syms_of_composite (void)
 
   DEFSYM (Qcomposition, "composition");
 
+  DEFSYM (QChits, ":hits");
+  DEFSYM (QCmisses, ":misses");
+  DEFSYM (QCevictions, ":evictions");
+
   /* Make a hash table for static composition.  */
   /* We used to make the hash table weak so that unreferenced
      compositions can be garbage-collected.  But, usually once
@@ -2073,9 +2284,20 @@ syms_of_composite (void)
 See also the documentation of `auto-composition-mode'.  */);
   Vcomposition_function_table = Fmake_char_table (Qnil, Qnil);
 
+  DEFVAR_LISP ("composition-cache-size-limit", Vcomposition_cache_size_limit,
+	       doc: /* Maximum number of glyph-strings to keep in the composition cache.
+Automatic compositions are shaped by the font once for each sequence
+of characters and font, and the resulting glyph-strings are cached.
+After a redisplay that leaves more than this many glyph-strings in
+the cache, Emacs removes the least recently used glyph-strings that are
+not displayed until the cache holds no more than 3/4 of this many.
+If nil, the cache is never limited this way.  */);
+  Vcomposition_cache_size_limit = make_fixnum (10000);
+
   defsubr (&Scompose_region_internal);
   defsubr (&Scompose_string_internal);
   defsubr (&Sfind_composition_internal);
   defsubr (&Scomposition_get_gstring);
   defsubr (&Sclear_composition_cache);
+  defsubr (&Scomposition_cache_statistics);
 }
@@ -253,6 +253,7 @@ DEFUN ("type-of", Ftype_of, Stype_of, 1, 1, 0,
         case PVEC_THREAD: return Qthread;
         case PVEC_MUTEX: return Qmutex;
         case PVEC_CONDVAR: return Qcondition_variable;
+        case PVEC_REGEXP: return Qregexp;
         case PVEC_TERMINAL: return Qterminal;
         case PVEC_RECORD:
           {
@@ -3906,6 +3907,7 @@ #define PUT_ERROR(sym, tail, msg)			\
   DEFSYM (Qthread, "thread");
   DEFSYM (Qmutex, "mutex");
   DEFSYM (Qcondition_variable, "condition-variable");
+  DEFSYM (Qregexp, "regexp");
   DEFSYM (Qfont_spec, "font-spec");
   DEFSYM (Qfont_entity, "font-entity");
   DEFSYM (Qfont_object, "font-object");
@@ -1835,6 +1835,30 @@ #define FACE_UNIBYTE_P(FACE) ((FACE)->charset < 0)
 
 #define MAX_FACE_ID  ((1 << FACE_ID_BITS) - 1)
 
+/* The face memo of a face cache remembers which face was realized
+   for a base face and the face properties merged into it, so that
+   the faces of text and overlay properties needn't be merged again
+   each time redisplay meets them.  It has FACE_MEMO_SIZE entries,
+   and remembers at most FACE_MEMO_REFS properties per face.  */
+
+enum { FACE_MEMO_SIZE = 256, FACE_MEMO_REFS = 8 };
+
+struct face_memo_entry
+{
+  /* The face properties, in the order they were merged.  Lists are
+     copied, so that changing them in place doesn't go unnoticed.  */
+  Lisp_Object refs[FACE_MEMO_REFS];
+  int nrefs;
+
+  /* The face the properties were merged into, the attribute filter
+     of the merge, and the ID of the resulting face.  */
+  int base_face_id, face_id;
+  enum lface_attribute_index attr_filter;
+
+  /* The entry is valid if this is the generation of the memo.  */
+  uintmax_t generation;
+};
+
 /* A cache of realized faces.  Each frame has its own cache because
    Emacs allows different frame-local face definitions.  */
 
@@ -1853,6 +1877,11 @@ #define MAX_FACE_ID  ((1 << FACE_ID_BITS) - 1)
   ptrdiff_t size;
   int used;
 
+  /* The face memo, allocated when first used, and its generation,
+     which is incremented whenever faces are freed.  */
+  struct face_memo_entry *memo;
+  uintmax_t memo_generation;
+
   /* Flag indicating that attributes of the `menu' face have been
      changed.  */
   bool_bf menu_face_changed_p : 1;
@@ -2052,6 +2081,9 @@ #define BIDI_MAXDEPTH 125
   int disp_prop;		/* if non-zero, there really is a
 				   `display' property/string at disp_pos;
 				   if 2, the property is a `space' spec */
+  ptrdiff_t ltr_limit;		/* characters before this position in
+				   the current line are at base level
+				   0 without reordering, or -1 */
   int stack_idx;		/* index of current data on the stack */
   /* Note: Everything from here on is not copied/saved when the bidi
      iterator state is saved, pushed, or popped.  So only put here
@@ -2320,6 +2352,13 @@ #define IT_STACK_SIZE 5
      with which display_string was called.  */
   ptrdiff_t end_charpos;
 
+  /* If non-zero, the current buffer has long lines, and the iterator
+     treats the text from NARROWED_BEGV to NARROWED_ZV, which contains
+     the window's point, as if the buffer were narrowed to it.  See the
+     comment before get_narrowed_len in xdisp.c.  */
+  ptrdiff_t narrowed_begv;
+  ptrdiff_t narrowed_zv;
+
   /* C string to iterate over.  Non-null means get characters from
      this string, otherwise characters are read from current_buffer
      or it->string.  */
@@ -3136,9 +3175,18 @@ #define CENTERED_IMAGE_ASCENT -1
   /* Reference to the type of the image.  */
   struct image_type const *type;
 
+  /* Size in bytes of the image's pixmaps and other pixel data, as
+     accounted for in the image cache.  */
+  ptrdiff_t size_in_bytes;
+
   /* True means that loading the image failed.  Don't try again.  */
   bool load_failed_p;
 
+  /* True means that redisplay deferred loading the image, because it
+     used up `image-load-time-budget'.  The width and height are those
+     of a placeholder until the image is loaded.  */
+  bool load_deferred_p;
+
   /* A place for image types to store additional data.  It is marked
      during GC.  */
   Lisp_Object lisp_data;
@@ -3181,6 +3229,20 @@ #define CENTERED_IMAGE_ASCENT -1
 
   /* Reference count (number of frames sharing this cache).  */
   ptrdiff_t refcount;
+
+  /* Total size in bytes of the images in the cache.  */
+  intmax_t bytes;
+
+  /* Number of times an image was found in the cache, had to be
+     loaded, and was freed to keep the cache within
+     `image-cache-size-limit'.  */
+  intmax_t hits, misses, evictions;
+
+  /* The total size of the images and `image-cache-size-limit' when
+     limit_image_caches last failed to get the cache within the limit,
+     because the images it could free didn't add up to enough, or -1.
+     There's no point in trying again before either changes.  */
+  intmax_t failed_bytes, failed_limit;
 };
 
 
@@ -3340,6 +3402,79 @@ #define TTY_CAP_BOLD		0x04
 #define TTY_CAP_DIM		0x08
 #define TTY_CAP_ITALIC  	0x10
 
+
+/***********************************************************************
+			 Redisplay statistics
+ ***********************************************************************/
+
+/* Events counted for `redisplay-statistics'.  */
+
+enum redisplay_count
+{
+  /* How redisplay_window brought a window up to date: by moving the
+     cursor in the current matrix, by reusing rows of the current
+     matrix, with try_window_id, or by displaying all of it again.  */
+  RSTAT_CURSOR_MOVEMENT,
+  RSTAT_REUSED_MATRIX,
+  RSTAT_WINDOW_ID,
+  RSTAT_FULL,
+
+  /* Screen lines produced by display_line.  */
+  RSTAT_LINES,
+
+  /* Screen lines that try_window copied from the current matrix
+     instead of producing them again.  */
+  RSTAT_LINES_REUSED,
+
+  /* Glyph rows written to the screen by update_window, or, on text
+     terminals, by update_frame.  */
+  RSTAT_ROWS_UPDATED,
+
+  /* Glyph rows that update_window didn't have to write because
+     scrolling_window found them elsewhere on the screen.  */
+  RSTAT_ROWS_REUSED,
+
+  /* Requests sent to the X server while updating a window.  */
+  RSTAT_DRAW_REQUESTS,
+
+  /* Times expose_window redrew a part of a window that was exposed,
+     and the area in pixels of the glyphs it redrew.  */
+  RSTAT_EXPOSURES,
+  RSTAT_EXPOSED_AREA,
+
+  /* Faces of text and overlay properties that redisplay needed, and
+     how many of those it found in the face memo.  */
+  RSTAT_FACES_MERGED,
+  RSTAT_FACES_MEMOIZED,
+
+  /* Bytes that update_frame wrote to text terminals.  */
+  RSTAT_BYTES_OUTPUT,
+
+  RSTAT_COUNT_MAX
+};
+
+/* Time spent, for `redisplay-statistics'.  */
+
+enum redisplay_timer
+{
+  /* In display_line, including fontification.  */
+  RSTAT_DISPLAY_LINE_TIME,
+
+  /* Running `fontification-functions' from handle_fontified_prop.  */
+  RSTAT_FONTIFICATION_TIME,
+
+  /* Writing glyph rows to the screen.  */
+  RSTAT_UPDATE_TIME,
+
+  RSTAT_TIMER_MAX
+};
+
+struct redisplay_stats
+{
+  EMACS_INT count[RSTAT_COUNT_MAX];
+  struct timespec time[RSTAT_TIMER_MAX];
+};
+
 
 /***********************************************************************
 			  Function Prototypes
@@ -3363,6 +3498,9 @@ #define TTY_CAP_ITALIC  	0x10
                                       struct glyph_row *,
                                       struct glyph_row *, int);
 int line_bottom_y (struct it *);
+void mark_line_start_cache (struct window *);
+void free_line_start_cache (struct window *);
+void invalidate_line_start_caches (void);
 int default_line_pixel_height (struct window *);
 bool display_prop_intangible_p (Lisp_Object, Lisp_Object, ptrdiff_t, ptrdiff_t);
 void resize_echo_area_exactly (void);
@@ -3401,6 +3539,10 @@ #define TTY_CAP_ITALIC  	0x10
 int partial_line_height (struct it *it_origin);
 bool in_display_vector_p (struct it *);
 int frame_mode_line_height (struct frame *);
+extern EMACS_INT mode_line_memo_tick;
+void redisplay_stats_count (struct window *, enum redisplay_count, int);
+void redisplay_stats_time (struct window *, enum redisplay_timer,
+			   struct timespec);
 extern bool redisplaying_p;
 extern bool help_echo_showing_p;
 extern Lisp_Object help_echo_string, help_echo_window;
@@ -3460,6 +3602,8 @@ #define TTY_CAP_ITALIC  	0x10
                                    int, int, bool, int);
 
 extern void expose_frame (struct frame *, int, int, int, int);
+extern void expose_frame_damage (struct frame *, int, int, int, int);
+extern void flush_frame_damage (struct frame *);
 extern bool gui_intersect_rectangles (const Emacs_Rectangle *,
                                       const Emacs_Rectangle *,
                                       Emacs_Rectangle *);
@@ -3531,10 +3675,14 @@ #define TRY_WINDOW_IGNORE_FONTS_CHANGE	(1 << 1)
 struct image_cache *make_image_cache (void);
 void free_image_cache (struct frame *);
 void clear_image_caches (Lisp_Object);
+void limit_image_caches (void);
 void mark_image_cache (struct image_cache *);
+void mark_anim_caches (void);
 bool valid_image_p (Lisp_Object);
 void prepare_image_for_display (struct frame *, struct image *);
 ptrdiff_t lookup_image (struct frame *, Lisp_Object);
+ptrdiff_t lookup_image_lazily (struct frame *, Lisp_Object);
+extern struct timespec image_load_time_used;
 
 #if defined HAVE_X_WINDOWS || defined USE_CAIRO || defined HAVE_MACGUI || defined HAVE_NS
 #define RGB_PIXEL_COLOR unsigned long
@@ -3681,6 +3829,7 @@ #define IMAGE_BACKGROUND_TRANSPARENT(img, f, mask)			      \
 void blank_row (struct window *, struct glyph_row *, int);
 void clear_glyph_matrix_rows (struct glyph_matrix *, int, int);
 void clear_glyph_row (struct glyph_row *);
+bool copy_glyph_row (struct glyph_row *, struct glyph_row *);
 void prepare_desired_row (struct window *, struct glyph_row *, bool);
 void update_single_window (struct window *);
 #ifdef HAVE_WINDOW_SYSTEM
@@ -3716,6 +3865,7 @@ #define IMAGE_BACKGROUND_TRANSPARENT(img, f, mask)			      \
 /* Defined in term.c */
 
 extern void tty_turn_off_insert (struct tty_display_info *);
+extern void tty_set_output_buffer (struct tty_display_info *, bool);
 extern int string_cost (const char *);
 extern int per_line_cost (const char *);
 extern void calculate_costs (struct frame *);
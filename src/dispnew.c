@@ -1047,6 +1047,38 @@ assign_row (struct glyph_row *to, struct glyph_row *from)
 }
 
 
+/* Make glyph row TO a copy of glyph row FROM, glyphs included, without
+   changing FROM.  Value is false, and TO is left alone, if the areas
+   of TO are too small to hold the glyphs of FROM.  */
+
+bool
+copy_glyph_row (struct glyph_row *to, struct glyph_row *from)
+{
+  int area;
+
+  for (area = LEFT_MARGIN_AREA; area < LAST_AREA; ++area)
+    if (to->glyphs[area + 1] - to->glyphs[area] < from->used[area])
+      return false;
+
+  for (area = LEFT_MARGIN_AREA; area < LAST_AREA; ++area)
+    {
+      memcpy (to->glyphs[area], from->glyphs[area],
+	      from->used[area] * sizeof *from->glyphs[area]);
+      to->used[area] = from->used[area];
+    }
+
+  /* See the kludge alert in dispextern.h.  */
+  if (from->used[TEXT_AREA] == 0
+      && to->glyphs[TEXT_AREA] < to->glyphs[TEXT_AREA + 1]
+      && from->glyphs[TEXT_AREA] < from->glyphs[TEXT_AREA + 1])
+    to->glyphs[TEXT_AREA][0] = from->glyphs[TEXT_AREA][0];
+
+  to->hash = from->hash;
+  copy_row_except_pointers (to, from);
+  return true;
+}
+
+
 /* Test whether the glyph memory of the glyph row WINDOW_ROW, which is
    a row in a window matrix, is a slice of the glyph memory of the
    glyph row FRAME_ROW which is a row in a frame glyph matrix.  Value
@@ -2336,6 +2368,7 @@ free_window_matrices (struct window *w)
 	  free_glyph_matrix (w->current_matrix);
 	  free_glyph_matrix (w->desired_matrix);
 	  w->current_matrix = w->desired_matrix = NULL;
+	  free_line_start_cache (w);
 	}
 
       /* Next window on same level.  */
@@ -3240,7 +3273,16 @@ update_frame (struct frame *f, bool force_p, bool inhibit_hairy_id_p)
       /* Build F's desired matrix from window matrices.  */
       build_frame_matrix (f);
 
-      /* Update the display.  */
+      /* Update the display.  The output to a text terminal is
+	 buffered until the update is complete, and then sent to the
+	 terminal in one go.  */
+      struct timespec start = current_timespec ();
+      intmax_t bytes_output = 0;
+      if (FRAME_TERMCAP_P (f))
+	{
+	  tty_set_output_buffer (FRAME_TTY (f), false);
+	  bytes_output = FRAME_TTY (f)->bytes_output;
+	}
       update_begin (f);
       paused_p = update_frame_1 (f, force_p, inhibit_hairy_id_p, 1, false);
       update_end (f);
@@ -3250,8 +3292,14 @@ update_frame (struct frame *f, bool force_p, bool inhibit_hairy_id_p)
           if (FRAME_TTY (f)->termscript)
 	    fflush (FRAME_TTY (f)->termscript);
 	  if (FRAME_TERMCAP_P (f))
-	    fflush (FRAME_TTY (f)->output);
+	    {
+	      fflush (FRAME_TTY (f)->output);
+	      redisplay_stats_count (NULL, RSTAT_BYTES_OUTPUT,
+				     (FRAME_TTY (f)->bytes_output
+				      - bytes_output));
+	    }
         }
+      redisplay_stats_time (NULL, RSTAT_UPDATE_TIME, start);
 
       /* Check window matrices for lost pointers.  */
 #ifdef GLYPH_DEBUG
@@ -3535,6 +3583,7 @@ update_window (struct window *w, bool force_p)
       int yb;
       bool changed_p = 0, mouse_face_overwritten_p = 0;
       int n_updated = 0;
+      struct timespec start = current_timespec ();
 
 #ifdef HAVE_WINDOW_SYSTEM
       gui_update_window_begin (w);
@@ -3691,6 +3740,8 @@ update_window (struct window *w, bool force_p)
 	 completely updated.  */
       if (!paused_p)
 	w->must_be_updated_p = false;
+
+      redisplay_stats_time (w, RSTAT_UPDATE_TIME, start);
     }
   else
     paused_p = 1;
@@ -4073,6 +4124,7 @@ update_window_line (struct window *w, int vpos, bool *mouse_face_overwritten_p)
       || desired_row->visible_height > 0)
     {
       eassert (desired_row->enabled_p);
+      redisplay_stats_count (w, RSTAT_ROWS_UPDATED, 1);
 
       /* Update display of the left margin area, if there is one.  */
       if (!desired_row->full_width_p && w->left_margin_cols > 0)
@@ -4223,9 +4275,14 @@ set_window_update_flags (struct window *w, bool on_p)
   /* Number of occurrences of this row in desired and current matrix.  */
   int old_uses, new_uses;
 
-  /* Vpos of row in new matrix.  */
+  /* Vpos of the first row in the new matrix equal to this one that
+     isn't yet known to be scrolled into place, or -1.  The others
+     follow in new_line_next.  */
   int new_line_number;
 
+  /* Vpos of the last row in the new matrix equal to this one.  */
+  int last_new_line_number;
+
   /* Bucket index of this row_entry in the hash table row_table.  */
   ptrdiff_t bucket;
 
@@ -4260,6 +4317,11 @@ set_window_update_flags (struct window *w, bool on_p)
 static struct row_entry **old_lines, **new_lines;
 static ptrdiff_t old_lines_size, new_lines_size;
 
+/* For each row in the desired matrix, the vpos of the next row equal
+   to it, or -1.  Allocated with new_lines_size elements.  */
+
+static int *new_line_next;
+
 /* A pool to allocate run structures from, and its size.  */
 
 static struct run *run_pool;
@@ -4287,7 +4349,7 @@ add_row_entry (struct glyph_row *row)
       entry = row_entry_pool + row_entry_idx++;
       entry->row = row;
       entry->old_uses = entry->new_uses = 0;
-      entry->new_line_number = 0;
+      entry->new_line_number = entry->last_new_line_number = -1;
       entry->bucket = i;
       entry->next = row_table[i];
       row_table[i] = entry;
@@ -4296,6 +4358,16 @@ add_row_entry (struct glyph_row *row)
   return entry;
 }
 
+/* Record that ENTRY's rows in the new matrix up to vpos VPOS are
+   scrolled into place.  */
+
+static void
+use_new_lines (struct row_entry *entry, int vpos)
+{
+  while (entry->new_line_number >= 0 && entry->new_line_number <= vpos)
+    entry->new_line_number = new_line_next[entry->new_line_number];
+}
+
 
 /* Try to reuse part of the current display of W by scrolling lines.
    HEADER_LINE_P means W has a header line.
@@ -4313,6 +4385,10 @@ add_row_entry (struct glyph_row *row)
 
    3. Rows that appear exactly once in both matrices serve as anchors,
    i.e. we assume that such lines are likely to have been moved.
+   Rows that appear the same number of times in both matrices, like
+   empty lines, serve as anchors too, the Nth occurrence in the
+   current matrix being paired with the Nth one in the desired
+   matrix, so that windows without unique rows can be scrolled.
 
    4. Starting from anchor lines, extend regions to be scrolled both
    forward and backward.
@@ -4464,9 +4540,13 @@ scrolling_window (struct window *w, int tab_line_p)
 			 INT_MAX, sizeof *old_lines);
 
   if (desired_matrix->nrows > new_lines_size)
-    new_lines = xpalloc (new_lines, &new_lines_size,
-			 desired_matrix->nrows - new_lines_size,
-			 INT_MAX, sizeof *new_lines);
+    {
+      new_lines = xpalloc (new_lines, &new_lines_size,
+			   desired_matrix->nrows - new_lines_size,
+			   INT_MAX, sizeof *new_lines);
+      new_line_next = xnrealloc (new_line_next, new_lines_size,
+				 sizeof *new_line_next);
+    }
 
   n = desired_matrix->nrows;
   n += current_matrix->nrows;
@@ -4513,21 +4593,28 @@ scrolling_window (struct window *w, int tab_line_p)
       eassert (MATRIX_ROW_ENABLED_P (desired_matrix, i));
       entry = add_row_entry (MATRIX_ROW (desired_matrix, i));
       ++entry->new_uses;
-      entry->new_line_number = i;
+      new_line_next[i] = -1;
+      if (entry->last_new_line_number < 0)
+	entry->new_line_number = i;
+      else
+	new_line_next[entry->last_new_line_number] = i;
+      entry->last_new_line_number = i;
       new_lines[i] = entry;
     }
 
-  /* Identify moves based on lines that are unique and equal
-     in both matrices.  */
+  /* Identify moves based on lines that are equal in both matrices
+     and appear as often in both.  */
   for (i = first_old; i < last_old;)
     if (old_lines[i]
-	&& old_lines[i]->old_uses == 1
-        && old_lines[i]->new_uses == 1)
+	&& old_lines[i]->old_uses == old_lines[i]->new_uses
+	&& old_lines[i]->new_line_number >= 0)
       {
 	int p, q;
 	int new_line = old_lines[i]->new_line_number;
 	struct run *run = run_pool + run_idx++;
 
+	use_new_lines (old_lines[i], new_line);
+
 	/* Record move.  */
 	run->current_vpos = i;
 	run->current_y = MATRIX_ROW (current_matrix, i)->y;
@@ -4544,6 +4631,7 @@ scrolling_window (struct window *w, int tab_line_p)
 	       && old_lines[p] == new_lines[q])
 	  {
 	    int h = MATRIX_ROW (current_matrix, p)->height;
+	    use_new_lines (new_lines[q], q);
 	    --run->current_vpos;
 	    --run->desired_vpos;
 	    ++run->nrows;
@@ -4561,6 +4649,7 @@ scrolling_window (struct window *w, int tab_line_p)
 	       && old_lines[p] == new_lines[q])
 	  {
 	    int h = MATRIX_ROW (current_matrix, p)->height;
+	    use_new_lines (new_lines[q], q);
 	    ++run->nrows;
 	    run->height += h;
 	    ++p, ++q;
@@ -4674,6 +4763,7 @@ scrolling_window (struct window *w, int tab_line_p)
 	  }
 
 	/* Assign matrix rows.  */
+	redisplay_stats_count (w, RSTAT_ROWS_REUSED, r->nrows);
 	for (j = 0; j < r->nrows; ++j)
 	  {
 	    struct glyph_row *from, *to;
@@ -4763,22 +4853,6 @@ update_frame_1 (struct frame *f, bool force_p, bool inhibit_id_p,
     {
       if (MATRIX_ROW_ENABLED_P (desired_matrix, i))
 	{
-	  if (FRAME_TERMCAP_P (f))
-	    {
-	      /* Flush out every so many lines.
-		 Also flush out if likely to have more than 1k buffered
-		 otherwise.   I'm told that some telnet connections get
-		 really screwed by more than 1k output at once.  */
-	      FILE *display_output = FRAME_TTY (f)->output;
-	      if (display_output)
-		{
-		  ptrdiff_t outq = __fpending (display_output);
-		  if (outq > 900
-		      || (outq > 20 && ((i - 1) % preempt_count == 0)))
-		    fflush (display_output);
-		}
-	    }
-
 	  if (!force_p && (i - 1) % preempt_count == 0)
 	    detect_input_pending_ignore_squeezables ();
 
@@ -5039,6 +5113,8 @@ update_frame_line (struct frame *f, int vpos, bool updating_menu_p)
   if (colored_spaces_p)
     write_spaces_p = 1;
 
+  redisplay_stats_count (NULL, RSTAT_ROWS_UPDATED, 1);
+
   /* Current row not enabled means it has unknown contents.  We must
      write the whole desired line in that case.  */
   must_write_whole_line_p = !current_row->enabled_p;
@@ -0,0 +1,57 @@
+/* Generated by dmpstruct.awk */
+#ifndef EMACS_DMPSTRUCT_H
+#define EMACS_DMPSTRUCT_H
+#define HASH_Lisp_Bits_465C612CF6
+#define HASH_Lisp_Type_E2AD97D3F7
+#define HASH_Lisp_Fwd_Type_9CBA6EE55E
+#define HASH_symbol_interned_05A917C0E6
+#define HASH_symbol_redirect_ADB4F5B113
+#define HASH_symbol_trapped_write_B578834E51
+#define HASH_Lisp_Symbol_999DC26DEC
+#define HASH_vectorlike_header_00A5A4BFB2
+#define HASH_pvec_type_EF38C6C9F9
+#define HASH_More_Lisp_Bits_797DD3B9F3
+#define HASH_Lisp_Cons_00EEE63F67
+#define HASH_Lisp_String_86FEA6EC7C
+#define HASH_Lisp_Vector_3091289B35
+#define HASH_Lisp_Bool_Vector_B91E462B98
+#define HASH_CHARTAB_SIZE_BITS_FA86D3892C
+#define HASH_Lisp_Char_Table_7E320A6122
+#define HASH_Lisp_Sub_Char_Table_337929480F
+#define HASH_Lisp_Subr_594AB72B54
+#define HASH_Aligned_Lisp_Subr_6258942CAE
+#define HASH_char_table_specials_92ED2EBFE6
+#define HASH_hash_table_test_44DB513AFC
+#define HASH_Lisp_Hash_Table_12AFBF47AF
+#define HASH_Lisp_Marker_642DBAF866
+#define HASH_Lisp_Overlay_72EADA9882
+#define HASH_Lisp_Misc_Ptr_2E05530DDC
+#define HASH_Lisp_User_Ptr_867CEC7F22
+#define HASH_Lisp_Finalizer_D58E647CB8
+#define HASH_Lisp_Intfwd_4D887A7387
+#define HASH_Lisp_Boolfwd_0EA1C7ADCC
+#define HASH_Lisp_Objfwd_45D3E513DC
+#define HASH_Lisp_Buffer_Objfwd_611EBD13FF
+#define HASH_Lisp_Buffer_Local_Value_3C363FAC3C
+#define HASH_Lisp_Kboard_Objfwd_CAA7E71069
+#define HASH_Lisp_Float_50A7B216D9
+#define HASH_Lisp_Compiled_41B71088BE
+#define HASH_char_bits_12D02C79BD
+#define HASH_maxargs_72DF86719F
+#define HASH_specbinding_84446F63A2
+#define HASH_nonlocal_exit_2A6455DD17
+#define HASH_handler_67ABD3AA06
+#define HASH_gc_root_type_0F03773B71
+#define HASH_gc_root_visitor_3CE0D37157
+#define HASH_Lisp_Regexp_2F93C5647B
+#define HASH_text_quoting_style_4599680CB4
+#define HASH_for_each_tail_internal_C6451C8FC1
+#define HASH_buffer_text_C1E18D920B
+#define HASH_buffer_FA58D1B7C8
+#define HASH_interval_1B38941C37
+#define HASH_define_charset_arg_index_86E934CC70
+#define HASH_charset_attr_index_3715C067D8
+#define HASH_charset_method_8BD433B7B8
+#define HASH_charset_317C49E291
+#define HASH_Lisp_Bignum_661945DE2B
+#endif /* EMACS_DMPSTRUCT_H */
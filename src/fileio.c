@@ -316,7 +316,7 @@ DEFUN ("find-file-name-handler", Ffind_file_name_handler,
 	  if (SYMBOLP (handler))
 	    operations = Fget (handler, Qoperations);
 
-	  if (STRINGP (string)
+	  if ((STRINGP (string) || REGEXPP (string))
 	      && (match_pos = fast_string_match (string, filename)) > pos
 	      && (NILP (operations) || ! NILP (Fmemq (operation, operations))))
 	    {
@@ -4813,8 +4813,8 @@ because (1) it preserves some marker positions and (2) it puts less data
     }
 
   /* We made a lot of deletions and insertions above, so invalidate
-     the newline cache for the entire region of the inserted
-     characters.  */
+     the newline cache and the bidi LTR cache for the entire region of
+     the inserted characters.  */
   if (current_buffer->base_buffer && current_buffer->base_buffer->newline_cache)
     invalidate_region_cache (current_buffer->base_buffer,
                              current_buffer->base_buffer->newline_cache,
@@ -4823,6 +4823,14 @@ because (1) it preserves some marker positions and (2) it puts less data
     invalidate_region_cache (current_buffer,
                              current_buffer->newline_cache,
                              PT - BEG, Z - PT - inserted);
+  if (current_buffer->base_buffer && current_buffer->base_buffer->bidi_ltr_cache)
+    invalidate_region_cache (current_buffer->base_buffer,
+                             current_buffer->base_buffer->bidi_ltr_cache,
+                             PT - BEG, Z - PT - inserted);
+  else if (current_buffer->bidi_ltr_cache)
+    invalidate_region_cache (current_buffer,
+                             current_buffer->bidi_ltr_cache,
+                             PT - BEG, Z - PT - inserted);
 
   if (read_quit)
     quit ();
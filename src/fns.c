@@ -2535,6 +2535,7 @@ DEFUN ("fillarray", Ffillarray, Sfillarray, 2, 2, 0,
       for (i = 0; i < (1 << CHARTAB_SIZE_BITS_0); i++)
 	set_char_table_contents (array, i, item);
       set_char_table_defalt (array, item);
+      char_table_modiff++;
     }
   else if (STRINGP (array))
     {
@@ -194,6 +194,7 @@ font_make_object (int size, Lisp_Object entity, int pixelsize)
   /* GC can happen before the driver is set up,
      so avoid dangling pointer here (Bug#17771).  */
   font->driver = NULL;
+  font->glyph_cache = NULL;
   XSETFONT (font_object, font);
 
   if (! NILP (entity))
@@ -2550,15 +2551,27 @@ font_match_p (Lisp_Object spec, Lisp_Object font)
    caching fonts.  The cons cell may be shared by multiple frames
    and/or multiple font drivers.  So, we arrange the cdr part as this:
 
-	((DRIVER-TYPE NUM-FRAMES FONT-CACHE-DATA ...) ...)
+	((DRIVER-TYPE NUM-FRAMES INDEX) ...)
 
    where DRIVER-TYPE is a symbol such as `x', `xft', etc., NUM-FRAMES
-   is a number frames sharing this cache, and FONT-CACHE-DATA is a
-   cons (FONT-SPEC . [FONT-ENTITY ...]).  */
+   is a number frames sharing this cache, and INDEX is a hash table
+   that maps the hash code computed by font_spec_hash for a font spec
+   to a list of FONT-CACHE-DATA, each a cons (FONT-SPEC . [FONT-ENTITY
+   ...]).  Since get_cache returns the same cons cell for all frames on
+   a display, fonts listed, matched, and opened for one frame are
+   reused for the others.  */
 
 static void font_clear_cache (struct frame *, Lisp_Object,
                               struct font_driver const *);
 
+/* Statistics of the font cache, for `font-cache-statistics'.  */
+
+static intmax_t font_cache_lists, font_cache_list_hits;
+static intmax_t font_cache_matches, font_cache_match_hits;
+static intmax_t font_cache_opens, font_cache_open_hits;
+static intmax_t font_cache_codes, font_cache_code_hits;
+static intmax_t font_cache_metrics, font_cache_metrics_hits;
+
 static void
 font_prepare_cache (struct frame *f, struct font_driver const *driver)
 {
@@ -2570,7 +2583,11 @@ font_prepare_cache (struct frame *f, struct font_driver const *driver)
     val = XCDR (val);
   if (NILP (val))
     {
-      val = list2 (driver->type, make_fixnum (1));
+      Lisp_Object index = make_hash_table (hashtest_eql, DEFAULT_HASH_SIZE,
+					   DEFAULT_REHASH_SIZE,
+					   DEFAULT_REHASH_THRESHOLD,
+					   Qnil, false);
+      val = list3 (driver->type, make_fixnum (1), index);
       XSETCDR (cache, Fcons (val, XCDR (cache)));
     }
   else
@@ -2602,6 +2619,8 @@ font_finish_cache (struct frame *f, struct font_driver const *driver)
 }
 
 
+/* Return the INDEX of the font cache of DRIVER on frame F.  */
+
 static Lisp_Object
 font_get_cache (struct frame *f, struct font_driver const *driver)
 {
@@ -2611,27 +2630,89 @@ font_get_cache (struct frame *f, struct font_driver const *driver)
   eassert (CONSP (val));
   for (val = XCDR (val); ! EQ (XCAR (XCAR (val)), type); val = XCDR (val));
   eassert (CONSP (val));
-  /* VAL = ((DRIVER-TYPE NUM-FRAMES FONT-CACHE-DATA ...) ...) */
-  val = XCDR (XCAR (val));
+  /* VAL = ((DRIVER-TYPE NUM-FRAMES INDEX) ...) */
+  val = XCAR (XCDR (XCDR (XCAR (val))));
+  eassert (HASH_TABLE_P (val));
   return val;
 }
 
 
+/* Return a hash code for font spec SPEC, such that font specs that
+   are `equal' have the same hash code.  sxhash can't be used for
+   this, as it hashes font specs by their address.  */
+
+static Lisp_Object
+font_spec_hash (Lisp_Object spec)
+{
+  EMACS_UINT hash = 0;
+  int i;
+
+  for (i = 0; i < FONT_SPEC_MAX; i++)
+    hash = sxhash_combine (hash, sxhash (AREF (spec, i), 0));
+  return make_fixnum (hash & INTMASK);
+}
+
+
+/* Return the vector of font entities cached for font spec SPEC in the
+   font cache INDEX, or nil if SPEC isn't cached.  */
+
+static Lisp_Object
+font_cache_lookup (Lisp_Object index, Lisp_Object spec)
+{
+  struct Lisp_Hash_Table *h = XHASH_TABLE (index);
+  ptrdiff_t i = hash_lookup (h, font_spec_hash (spec), NULL);
+  Lisp_Object val;
+
+  if (i < 0)
+    return Qnil;
+  val = assoc_no_quit (spec, HASH_VALUE (h, i));
+  return CONSP (val) ? XCDR (val) : Qnil;
+}
+
+
+/* Cache the vector of font entities ENTITIES for a copy of font spec
+   SPEC, of font driver TYPE, in the font cache INDEX.  */
+
+static void
+font_cache_put (Lisp_Object index, Lisp_Object spec, Lisp_Object type,
+		Lisp_Object entities)
+{
+  struct Lisp_Hash_Table *h = XHASH_TABLE (index);
+  Lisp_Object copy = copy_font_spec (spec);
+  Lisp_Object key, hash, elt;
+  ptrdiff_t i;
+
+  ASET (copy, FONT_TYPE_INDEX, type);
+  elt = Fcons (copy, entities);
+  key = font_spec_hash (copy);
+  i = hash_lookup (h, key, &hash);
+  if (i < 0)
+    hash_put (h, key, list1 (elt), hash);
+  else
+    set_hash_value_slot (h, i, Fcons (elt, HASH_VALUE (h, i)));
+}
+
+
 static void
 font_clear_cache (struct frame *f, Lisp_Object cache,
 		  struct font_driver const *driver)
 {
   Lisp_Object tail, elt;
   Lisp_Object entity;
-  ptrdiff_t i;
+  struct Lisp_Hash_Table *h;
+  ptrdiff_t i, j;
 
-  /* CACHE = (DRIVER-TYPE NUM-FRAMES FONT-CACHE-DATA ...) */
-  for (tail = XCDR (XCDR (cache)); CONSP (tail); tail = XCDR (tail))
+  /* CACHE = (DRIVER-TYPE NUM-FRAMES INDEX) */
+  h = XHASH_TABLE (XCAR (XCDR (XCDR (cache))));
+  for (j = 0; j < HASH_TABLE_SIZE (h); j++)
     {
-      elt = XCAR (tail);
-      /* elt should have the form (FONT-SPEC . [FONT-ENTITY ...]) */
-      if (CONSP (elt) && FONT_SPEC_P (XCAR (elt)))
+      if (EQ (HASH_KEY (h, j), Qunbound))
+	continue;
+      for (tail = HASH_VALUE (h, j); CONSP (tail); tail = XCDR (tail))
 	{
+	  elt = XCAR (tail);
+	  /* elt should have the form (FONT-SPEC . [FONT-ENTITY ...]) */
+	  eassert (CONSP (elt) && FONT_SPEC_P (XCAR (elt)));
 	  elt = XCDR (elt);
 	  eassert (VECTORP (elt));
 	  for (i = 0; i < ASIZE (elt); i++)
@@ -2793,13 +2874,12 @@ font_list_entities (struct frame *f, Lisp_Object spec)
 	Lisp_Object cache = font_get_cache (f, driver_list->driver);
 
 	ASET (scratch_font_spec, FONT_TYPE_INDEX, driver_list->driver->type);
-	val = assoc_no_quit (scratch_font_spec, XCDR (cache));
-	if (CONSP (val))
-	  val = XCDR (val);
+	font_cache_lists++;
+	val = font_cache_lookup (cache, scratch_font_spec);
+	if (! NILP (val))
+	  font_cache_list_hits++;
 	else
 	  {
-	    Lisp_Object copy;
-
 	    val = (driver_list->driver->list) (f, scratch_font_spec);
 	    /* We put zero_vector in the font-cache to indicate that
 	       no fonts matching SPEC were found on the system.
@@ -2810,9 +2890,8 @@ font_list_entities (struct frame *f, Lisp_Object spec)
 	      val = zero_vector;
 	    else
 	      val = Fvconcat (1, &val);
-	    copy = copy_font_spec (scratch_font_spec);
-	    ASET (copy, FONT_TYPE_INDEX, driver_list->driver->type);
-	    XSETCDR (cache, Fcons (Fcons (copy, val), XCDR (cache)));
+	    font_cache_put (cache, scratch_font_spec,
+			    driver_list->driver->type, val);
 	  }
 	if (ASIZE (val) > 0
 	    && (need_filtering
@@ -2856,20 +2935,19 @@ font_matching_entity (struct frame *f, Lisp_Object *attrs, Lisp_Object spec)
 	Lisp_Object cache = font_get_cache (f, driver_list->driver);
 
 	ASET (work, FONT_TYPE_INDEX, driver_list->driver->type);
-	entity = assoc_no_quit (work, XCDR (cache));
-	if (CONSP (entity))
-	  entity = AREF (XCDR (entity), 0);
+	font_cache_matches++;
+	entity = font_cache_lookup (cache, work);
+	if (! NILP (entity))
+	  {
+	    font_cache_match_hits++;
+	    entity = AREF (entity, 0);
+	  }
 	else
 	  {
 	    entity = driver_list->driver->match (f, work);
 	    if (!NILP (entity))
-	      {
-		Lisp_Object copy = copy_font_spec (work);
-		Lisp_Object match = Fvector (1, &entity);
-
-		ASET (copy, FONT_TYPE_INDEX, driver_list->driver->type);
-		XSETCDR (cache, Fcons (Fcons (copy, match), XCDR (cache)));
-	      }
+	      font_cache_put (cache, work, driver_list->driver->type,
+			      Fvector (1, &entity));
 	  }
 	if (! NILP (entity))
 	  break;
@@ -2902,6 +2980,9 @@ font_open_entity (struct frame *f, Lisp_Object entity, int pixel_size)
   if (! driver_list)
     return Qnil;
 
+  /* Reuse a font object opened for this or another frame on the same
+     display.  */
+  font_cache_opens++;
   for (objlist = AREF (entity, FONT_OBJLIST_INDEX); CONSP (objlist);
        objlist = XCDR (objlist))
     {
@@ -2911,7 +2992,10 @@ font_open_entity (struct frame *f, Lisp_Object entity, int pixel_size)
         {
           if (driver_list->driver->cached_font_ok == NULL
               || driver_list->driver->cached_font_ok (f, fn, entity))
-            return fn;
+	    {
+	      font_cache_open_hits++;
+	      return fn;
+	    }
         }
     }
 
@@ -3023,6 +3107,145 @@ font_has_char (struct frame *f, Lisp_Object font, int c)
 }
 
 
+/* Glyph cache
+
+   Redisplay needs the glyph code of each character it displays and
+   the metrics of that glyph, and gets them from the font driver's
+   encode_char and text_extents methods, which, depending on the
+   driver, call into FreeType, Xft or Core Text each time.  The glyph
+   cache of a font remembers both, in pages of FONT_GLYPH_PAGE_SIZE
+   characters or glyph codes filled when first needed.  Only Unicode
+   characters and the 2-byte glyph codes redisplay uses are cached.  */
+
+enum { FONT_GLYPH_PAGE_BITS = 8 };
+enum { FONT_GLYPH_PAGE_SIZE = 1 << FONT_GLYPH_PAGE_BITS };
+
+struct font_code_page
+{
+  unsigned code[FONT_GLYPH_PAGE_SIZE];
+
+  /* Bit I is set if CODE[I] is known.  */
+  unsigned char known[FONT_GLYPH_PAGE_SIZE / CHAR_BIT];
+};
+
+struct font_metrics_page
+{
+  struct font_metrics metrics[FONT_GLYPH_PAGE_SIZE];
+  unsigned char known[FONT_GLYPH_PAGE_SIZE / CHAR_BIT];
+};
+
+struct font_glyph_cache
+{
+  /* Pages of glyph codes, by the plane and the page of a character in
+     that plane.  */
+  struct font_code_page **codes[(MAX_UNICODE_CHAR >> 16) + 1];
+
+  /* Pages of glyph metrics.  */
+  struct font_metrics_page *metrics[0x10000 >> FONT_GLYPH_PAGE_BITS];
+};
+
+/* Return the glyph cache of FONT, making it if necessary.  */
+
+static struct font_glyph_cache *
+font_glyph_cache (struct font *font)
+{
+  if (!font->glyph_cache)
+    font->glyph_cache = xzalloc (sizeof *font->glyph_cache);
+  return font->glyph_cache;
+}
+
+/* Return the glyph code of character C in FONT, or FONT_INVALID_CODE
+   if FONT has no glyph for C.  */
+
+unsigned
+font_glyph_code (struct font *font, int c)
+{
+  struct font_glyph_cache *cache;
+  struct font_code_page *page;
+  int i = c & (FONT_GLYPH_PAGE_SIZE - 1);
+
+  if (! (0 <= c && c <= MAX_UNICODE_CHAR))
+    return font->driver->encode_char (font, c);
+
+  font_cache_codes++;
+  cache = font_glyph_cache (font);
+  if (!cache->codes[c >> 16])
+    cache->codes[c >> 16]
+      = xzalloc ((1 << (16 - FONT_GLYPH_PAGE_BITS))
+		 * sizeof *cache->codes[0]);
+  page = cache->codes[c >> 16][(c & 0xFFFF) >> FONT_GLYPH_PAGE_BITS];
+  if (!page)
+    page = cache->codes[c >> 16][(c & 0xFFFF) >> FONT_GLYPH_PAGE_BITS]
+      = xzalloc (sizeof *page);
+
+  if (page->known[i / CHAR_BIT] & (1 << (i % CHAR_BIT)))
+    font_cache_code_hits++;
+  else
+    {
+      page->code[i] = font->driver->encode_char (font, c);
+      page->known[i / CHAR_BIT] |= 1 << (i % CHAR_BIT);
+    }
+  return page->code[i];
+}
+
+/* Store in *METRICS the metrics of the glyph with glyph code CODE in
+   FONT.  */
+
+void
+font_glyph_metrics (struct font *font, unsigned code,
+		    struct font_metrics *metrics)
+{
+  struct font_glyph_cache *cache;
+  struct font_metrics_page *page;
+  int i = code & (FONT_GLYPH_PAGE_SIZE - 1);
+
+  if (code > 0xFFFF)
+    {
+      font->driver->text_extents (font, &code, 1, metrics);
+      return;
+    }
+
+  font_cache_metrics++;
+  cache = font_glyph_cache (font);
+  page = cache->metrics[code >> FONT_GLYPH_PAGE_BITS];
+  if (!page)
+    page = cache->metrics[code >> FONT_GLYPH_PAGE_BITS]
+      = xzalloc (sizeof *page);
+
+  if (page->known[i / CHAR_BIT] & (1 << (i % CHAR_BIT)))
+    font_cache_metrics_hits++;
+  else
+    {
+      font->driver->text_extents (font, &code, 1, &page->metrics[i]);
+      page->known[i / CHAR_BIT] |= 1 << (i % CHAR_BIT);
+    }
+  *metrics = page->metrics[i];
+}
+
+/* Free the glyph cache of FONT.  */
+
+void
+font_free_glyph_cache (struct font *font)
+{
+  struct font_glyph_cache *cache = font->glyph_cache;
+  int i, j;
+
+  if (!cache)
+    return;
+  for (i = 0; i < ARRAYELTS (cache->codes); i++)
+    if (cache->codes[i])
+      {
+	for (j = 0; j < 1 << (16 - FONT_GLYPH_PAGE_BITS); j++)
+	  xfree (cache->codes[i][j]);
+	xfree (cache->codes[i]);
+      }
+  for (i = 0; i < ARRAYELTS (cache->metrics); i++)
+    xfree (cache->metrics[i]);
+  xfree (cache);
+  font->glyph_cache = NULL;
+}
+
+
 /* Return the glyph ID of FONT_OBJECT for character C.  */
 
 static unsigned
@@ -4440,6 +4663,57 @@ DEFUN ("clear-font-cache", Fclear_font_cache, Sclear_font_cache, 0, 0, 0,
   return Qnil;
 }
 
+DEFUN ("font-cache-statistics", Ffont_cache_statistics,
+       Sfont_cache_statistics, 0, 1, 0,
+       doc: /* Return statistics about the use of the font caches.
+Frames on the same display share their font cache, so fonts listed or
+opened for one of them are reused for the others.
+
+The value is a property list with the following properties:
+
+ `:lists' is the number of times Emacs needed the list of fonts
+   matching a font spec.
+ `:list-hits' is the number of times it found that list in the cache.
+ `:matches' is the number of times it needed the font that best
+   matches a font spec.
+ `:match-hits' is the number of times it found that font in the cache.
+ `:opens' is the number of times it needed to open a font.
+ `:open-hits' is the number of times it could use a font it had
+   already opened, possibly for another frame.
+ `:glyph-codes' is the number of times redisplay needed the glyph of
+   a character in a font.
+ `:glyph-code-hits' is the number of times it found that glyph in the
+   glyph cache of the font, without asking the font driver.
+ `:glyph-metrics' is the number of times redisplay needed the metrics
+   of a glyph.
+ `:glyph-metrics-hits' is the number of times it found them in the
+   glyph cache.
+
+If RESET is non-nil, reset the statistics to zero after returning
+them.  */)
+  (Lisp_Object reset)
+{
+  Lisp_Object val
+    = CALLN (Flist,
+	     QClists, make_int (font_cache_lists),
+	     QClist_hits, make_int (font_cache_list_hits),
+	     QCmatches, make_int (font_cache_matches),
+	     QCmatch_hits, make_int (font_cache_match_hits),
+	     QCopens, make_int (font_cache_opens),
+	     QCopen_hits, make_int (font_cache_open_hits),
+	     QCglyph_codes, make_int (font_cache_codes),
+	     QCglyph_code_hits, make_int (font_cache_code_hits),
+	     QCglyph_metrics, make_int (font_cache_metrics),
+	     QCglyph_metrics_hits, make_int (font_cache_metrics_hits));
+
+  if (!NILP (reset))
+    font_cache_lists = font_cache_list_hits = font_cache_matches
+      = font_cache_match_hits = font_cache_opens = font_cache_open_hits
+      = font_cache_codes = font_cache_code_hits = font_cache_metrics
+      = font_cache_metrics_hits = 0;
+  return val;
+}
+
 
 void
 font_fill_lglyph_metrics (Lisp_Object glyph, struct font *font, unsigned int code)
@@ -5414,6 +5688,18 @@ syms_of_font (void)
 
   DEFSYM (QCuser_spec, ":user-spec");
 
+  /* Properties returned by `font-cache-statistics'.  */
+  DEFSYM (QClists, ":lists");
+  DEFSYM (QClist_hits, ":list-hits");
+  DEFSYM (QCmatches, ":matches");
+  DEFSYM (QCmatch_hits, ":match-hits");
+  DEFSYM (QCopens, ":opens");
+  DEFSYM (QCopen_hits, ":open-hits");
+  DEFSYM (QCglyph_codes, ":glyph-codes");
+  DEFSYM (QCglyph_code_hits, ":glyph-code-hits");
+  DEFSYM (QCglyph_metrics, ":glyph-metrics");
+  DEFSYM (QCglyph_metrics_hits, ":glyph-metrics-hits");
+
   /* For shapers that need to know text directionality.  */
   DEFSYM (QL2R, "L2R");
   DEFSYM (QR2L, "R2L");
@@ -5447,6 +5733,7 @@ syms_of_font (void)
   defsubr (&Sfind_font);
   defsubr (&Sfont_xlfd_name);
   defsubr (&Sclear_font_cache);
+  defsubr (&Sfont_cache_statistics);
   defsubr (&Sfont_shape_gstring);
   defsubr (&Sfont_variation_glyphs);
   defsubr (&Sinternal_char_font);
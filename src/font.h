@@ -383,6 +383,10 @@ #define FONT_ENCODING_NOT_DECIDED 255
 
 #endif /* HAVE_WINDOW_SYSTEM */
 
+  /* Glyph codes and metrics of characters remembered by
+     font_glyph_code and font_glyph_metrics, or NULL.  */
+  struct font_glyph_cache *glyph_cache;
+
   /* Font-driver for the font.  */
   struct font_driver const *driver;
 
@@ -846,6 +850,10 @@ #define FONT_INVALID_CODE 0xFFFFFFFF
 extern Lisp_Object font_spec_from_name (Lisp_Object font_name);
 extern Lisp_Object font_get_frame (Lisp_Object font_object);
 extern int font_has_char (struct frame *, Lisp_Object, int);
+extern unsigned font_glyph_code (struct font *, int);
+extern void font_glyph_metrics (struct font *, unsigned,
+				struct font_metrics *);
+extern void font_free_glyph_cache (struct font *);
 
 extern void font_clear_prop (Lisp_Object *attrs,
                              enum font_property_index prop);
@@ -588,6 +588,13 @@ #define EMACS_FRAME_H
   /* List of font-drivers available on the frame.  */
   struct font_driver_list *font_driver_list;
 
+#ifdef HAVE_WINDOW_SYSTEM
+  /* Areas of the frame that were exposed but not redrawn yet, in frame
+     pixel coordinates.  See expose_frame_damage.  */
+  Emacs_Rectangle damage[4];
+  int n_damage;
+#endif
+
 #if defined (HAVE_X_WINDOWS)
   /* Used by x_wait_for_event when watching for an X event on this frame.  */
   int wait_event_type;
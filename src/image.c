@@ -31,6 +31,7 @@ Copyright (C) 1989, 1992-2021 Free Software Foundation, Inc.
 #include <setjmp.h>
 
 #include <stdint.h>
+#include <stdlib.h>
 #include <c-ctype.h>
 #include <flexmember.h>
 
@@ -1416,6 +1417,7 @@ free_image (struct frame *f, struct image *img)
 	img->next->prev = img->prev;
 
       c->images[img->id] = NULL;
+      c->bytes -= img->size_in_bytes;
 
 #if !defined USE_CAIRO && defined HAVE_XRENDER
       if (img->picture)
@@ -1464,6 +1466,48 @@ check_image_size (struct frame *f, int width, int height)
     return 1;
 }
 
+/* Return the size in bytes of the pixel data of image IMG.  On X, the
+   pixmaps are on the server, so assume that the image takes 4 bytes
+   and the mask 1 bit per pixel there.  */
+
+static ptrdiff_t
+image_size_in_bytes (struct image *img)
+{
+  ptrdiff_t size = 0;
+
+#if defined USE_CAIRO || defined HAVE_MACGUI
+  if (img->pixmap)
+    size += (ptrdiff_t) img->pixmap->bytes_per_line * img->pixmap->height;
+  if (img->mask)
+    size += (ptrdiff_t) img->mask->bytes_per_line * img->mask->height;
+#else
+  if (img->pixmap != NO_PIXMAP)
+    size += (ptrdiff_t) img->width * img->height * 4;
+  if (img->mask != NO_PIXMAP)
+    size += (ptrdiff_t) (img->width + 7) / 8 * img->height;
+#endif
+#ifdef HAVE_X_WINDOWS
+  if (img->ximg && img->ximg->data)
+    size += (ptrdiff_t) img->ximg->bytes_per_line * img->ximg->height;
+  if (img->mask_img && img->mask_img->data)
+    size += (ptrdiff_t) img->mask_img->bytes_per_line * img->mask_img->height;
+#endif
+
+  return size;
+}
+
+/* Account for the size of image IMG, which has just been loaded, in
+   the image cache of frame F.  */
+
+static void
+image_account_size (struct frame *f, struct image *img)
+{
+  ptrdiff_t size = image_size_in_bytes (img);
+
+  FRAME_IMAGE_CACHE (f)->bytes += size - img->size_in_bytes;
+  img->size_in_bytes = size;
+}
+
 /* Prepare image IMG for display on frame F.  Must be called before
    drawing an image.  */
 
@@ -1473,10 +1517,17 @@ prepare_image_for_display (struct frame *f, struct image *img)
   /* We're about to display IMG, so set its timestamp to `now'.  */
   img->timestamp = current_timespec ();
 
+  /* If redisplay deferred loading IMG, display a placeholder.  */
+  if (img->load_deferred_p)
+    return;
+
   /* If IMG doesn't have a pixmap yet, load it now, using the image
      type dependent loader function.  */
   if (img->pixmap == NO_PIXMAP && !img->load_failed_p)
-    img->load_failed_p = ! img->type->load (f, img);
+    {
+      img->load_failed_p = ! img->type->load (f, img);
+      image_account_size (f, img);
+    }
 
 #ifdef USE_CAIRO
   if (!img->load_failed_p)
@@ -1827,6 +1878,223 @@ image_alloc_image_color (struct frame *f, struct image *img,
 
 
 
+/***********************************************************************
+			  Animation Frame Cache
+ ***********************************************************************/
+
+#ifdef HAVE_GIF
+
+/* Animated images are displayed one frame at a time, by asking for
+   the image with increasing values of :index.  Each frame is
+   composited on top of the preceding ones, so loading frame N from
+   scratch would mean decoding and compositing N frames.  Instead, an
+   animation frame cache keeps the decoder's handle on the image, so
+   that it is decoded only once, and the last few composited frames.
+   Frame N can then be computed from frame N - 1 or found as is.
+
+   Composited frames are arrays of 0xRRGGBB values, or
+   ANIM_BACKGROUND for pixels that no frame covers, or
+   ANIM_TRANSPARENT for transparent pixels.  They don't depend on the
+   frame or on the colors allocated for the image, so that any image
+   in any image cache can use them.  */
+
+enum { ANIM_BACKGROUND = 0xff000000, ANIM_TRANSPARENT = 0xfe000000 };
+
+/* Number of composited frames to keep for an animation.  */
+
+enum { ANIM_CACHE_FRAMES = 4 };
+
+struct anim_cache
+{
+  /* The image specification, without :index.  */
+  Lisp_Object spec;
+
+  /* The decoder's handle on the image, and a function to free it.  */
+  void *handle;
+  void (*destructor) (void *);
+
+  /* Size of the frames, and number of frames that can be shown.  */
+  int width, height, count;
+
+  /* Function that composites frame INDEX on top of PIXELS, which
+     holds frame INDEX - 1, or no frame if INDEX is 0.  */
+  void (*composite) (struct anim_cache *, int index, uint32_t *pixels);
+
+  /* The composited frames, and when they were last used.  */
+  struct anim_frame
+  {
+    int index;
+    uintmax_t use;
+    uint32_t *pixels;
+  } frames[ANIM_CACHE_FRAMES];
+  uintmax_t uses;
+
+  struct timespec update_time;
+  struct anim_cache *next;
+};
+
+static struct anim_cache *anim_cache;
+
+/* Return image specification SPEC without its :index property.  */
+
+static Lisp_Object
+anim_cache_spec (Lisp_Object spec)
+{
+  Lisp_Object plist = Qnil;
+
+  for (Lisp_Object tail = XCDR (spec);
+       CONSP (tail) && CONSP (XCDR (tail));
+       tail = XCDR (XCDR (tail)))
+    if (!EQ (XCAR (tail), QCindex))
+      plist = Fcons (XCAR (XCDR (tail)), Fcons (XCAR (tail), plist));
+
+  return Fcons (Qimage, Fnreverse (plist));
+}
+
+static void
+anim_free_cache (struct anim_cache *cache)
+{
+  if (cache->handle)
+    cache->destructor (cache->handle);
+  for (int i = 0; i < ANIM_CACHE_FRAMES; i++)
+    xfree (cache->frames[i].pixels);
+  xfree (cache);
+}
+
+/* Discard animation frame caches.  If CLEAR is nil, discard those
+   that haven't been used for a minute.  If it is t, discard all of
+   them.  Otherwise, CLEAR is an image specification; discard the
+   cache of its animation.  */
+
+static void
+anim_prune_animation_cache (Lisp_Object clear)
+{
+  struct anim_cache **pcache = &anim_cache;
+  struct timespec old = timespec_sub (current_timespec (),
+				      make_timespec (60, 0));
+
+  if (!NILP (clear) && !EQ (clear, Qt))
+    clear = anim_cache_spec (clear);
+
+  while (*pcache)
+    {
+      struct anim_cache *cache = *pcache;
+
+      if (NILP (clear)
+	  ? timespec_cmp (old, cache->update_time) <= 0
+	  : !EQ (clear, Qt) && NILP (Fequal (clear, cache->spec)))
+	pcache = &cache->next;
+      else
+	{
+	  *pcache = cache->next;
+	  anim_free_cache (cache);
+	}
+    }
+}
+
+/* Return the animation frame cache of the animation of image
+   specification SPEC, or NULL if there is none.  */
+
+static struct anim_cache *
+anim_get_animation_cache (Lisp_Object spec)
+{
+  anim_prune_animation_cache (Qnil);
+
+  spec = anim_cache_spec (spec);
+  for (struct anim_cache *cache = anim_cache; cache; cache = cache->next)
+    if (!NILP (Fequal (spec, cache->spec)))
+      {
+	cache->update_time = current_timespec ();
+	return cache;
+      }
+
+  return NULL;
+}
+
+/* Return a new animation frame cache for the animation of image
+   specification SPEC, whose decoder's handle is HANDLE.  The caller
+   must set the members of the cache that describe the animation.  If
+   CACHED, keep the cache for later loads of the image; otherwise the
+   caller must free it with anim_free_cache.  */
+
+static struct anim_cache *
+anim_create_cache (Lisp_Object spec, void *handle,
+		   void (*destructor) (void *), bool cached)
+{
+  struct anim_cache *cache = xzalloc (sizeof *cache);
+
+  cache->spec = anim_cache_spec (spec);
+  cache->handle = handle;
+  cache->destructor = destructor;
+  for (int i = 0; i < ANIM_CACHE_FRAMES; i++)
+    cache->frames[i].index = -1;
+  cache->update_time = current_timespec ();
+
+  if (cached)
+    {
+      cache->next = anim_cache;
+      anim_cache = cache;
+    }
+
+  return cache;
+}
+
+/* Return composited frame INDEX of the animation of CACHE.  Start
+   from the latest cached frame before it, if any.  */
+
+static uint32_t *
+anim_get_frame (struct anim_cache *cache, int index)
+{
+  struct anim_frame *start = NULL, *frame = &cache->frames[0];
+  ptrdiff_t npixels = (ptrdiff_t) cache->width * cache->height;
+  int i;
+
+  for (i = 0; i < ANIM_CACHE_FRAMES; i++)
+    {
+      struct anim_frame *f = &cache->frames[i];
+
+      if (f->index == index)
+	{
+	  f->use = ++cache->uses;
+	  return f->pixels;
+	}
+      if (f->index >= 0 && f->index < index
+	  && (!start || start->index < f->index))
+	start = f;
+      if (f->use < frame->use)
+	frame = f;
+    }
+
+  /* Replace the least recently used frame, or continue from START if
+     that is the one.  */
+  if (!frame->pixels)
+    frame->pixels = xnmalloc (npixels, sizeof *frame->pixels);
+  if (!start)
+    {
+      for (ptrdiff_t j = 0; j < npixels; j++)
+	frame->pixels[j] = ANIM_BACKGROUND;
+      i = 0;
+    }
+  else
+    {
+      if (start != frame)
+	memcpy (frame->pixels, start->pixels,
+		npixels * sizeof *frame->pixels);
+      i = start->index + 1;
+    }
+
+  for (; i <= index; i++)
+    cache->composite (cache, i, frame->pixels);
+
+  frame->index = index;
+  frame->use = ++cache->uses;
+  return frame->pixels;
+}
+
+#endif /* HAVE_GIF */
+
+
+
 /***********************************************************************
 			     Image Cache
  ***********************************************************************/
@@ -1843,6 +2111,8 @@ make_image_cache (void)
 
   c->size = 50;
   c->used = c->refcount = 0;
+  c->bytes = c->hits = c->misses = c->evictions = 0;
+  c->failed_bytes = c->failed_limit = -1;
   c->images = xmalloc (c->size * sizeof *c->images);
   c->buckets = xzalloc (IMAGE_CACHE_BUCKETS_SIZE * sizeof *c->buckets);
   return c;
@@ -1913,6 +2183,11 @@ uncache_image (struct frame *f, Lisp_Object spec)
 	 must garbage the frame (Bug#6426).  */
       SET_FRAME_GARBAGED (f);
     }
+
+#ifdef HAVE_GIF
+  /* Reload all frames of an animation from its file or data.  */
+  anim_prune_animation_cache (spec);
+#endif
 }
 
 
@@ -2007,6 +2282,12 @@ clear_image_cache (struct frame *f, Lisp_Object filter)
 	    }
 	}
 
+#ifdef HAVE_GIF
+      /* Discard the frames of animations that weren't shown for a
+	 while, or all of them when clearing the whole cache.  */
+      anim_prune_animation_cache (EQ (filter, Qt) ? Qt : Qnil);
+#endif
+
       /* We may be clearing the image cache because, for example,
 	 Emacs was iconified for a longer period of time.  In that
 	 case, current matrices may still contain references to
@@ -2023,6 +2304,8 @@ clear_image_cache (struct frame *f, Lisp_Object filter)
 	    }
 
 	  windows_or_buffers_changed = 19;
+	  /* Images loaded again may have a different size.  */
+	  invalidate_line_start_caches ();
 	}
 
       unblock_input ();
@@ -2042,6 +2325,137 @@ clear_image_caches (Lisp_Object filter)
       clear_image_cache (XFRAME (frame), filter);
 }
 
+/* Mark in IN_USE, which has an element for each image in an image
+   cache, the images shown in the current matrices of the windows in
+   the window tree starting with W.  */
+
+static void
+mark_images_in_use (struct window *w, bool *in_use, ptrdiff_t n)
+{
+  while (w)
+    {
+      if (WINDOWP (w->contents))
+	mark_images_in_use (XWINDOW (w->contents), in_use, n);
+      else if (w->current_matrix)
+	{
+	  struct glyph_matrix *matrix = w->current_matrix;
+
+	  for (int i = 0; i < matrix->nrows; i++)
+	    {
+	      struct glyph_row *row = MATRIX_ROW (matrix, i);
+
+	      if (row->enabled_p)
+		for (int area = LEFT_MARGIN_AREA; area < LAST_AREA; area++)
+		  for (struct glyph *g = row->glyphs[area];
+		       g < row->glyphs[area] + row->used[area]; g++)
+		    if (g->type == IMAGE_GLYPH && g->u.img_id < n)
+		      in_use[g->u.img_id] = true;
+	    }
+	}
+
+      w = NILP (w->next) ? NULL : XWINDOW (w->next);
+    }
+}
+
+/* Compare images A and B by the time they were last displayed.  */
+
+static int
+compare_image_timestamps (void const *a, void const *b)
+{
+  struct image const *img_a = *(struct image *const *) a;
+  struct image const *img_b = *(struct image *const *) b;
+
+  return timespec_cmp (img_a->timestamp, img_b->timestamp);
+}
+
+/* Free the least recently displayed images in the image cache of
+   frame F until it takes no more than LIMIT bytes.  Don't free images
+   that windows currently show, so that redisplay doesn't have to load
+   them again right away.  */
+
+static void
+limit_image_cache (struct frame *f, intmax_t limit)
+{
+  struct image_cache *c = FRAME_IMAGE_CACHE (f);
+  bool *in_use = xzalloc (c->used * sizeof *in_use);
+  struct image **images = xmalloc (c->used * sizeof *images);
+  ptrdiff_t i, nimages = 0;
+  Lisp_Object tail, frame;
+
+  FOR_EACH_FRAME (tail, frame)
+    {
+      struct frame *fr = XFRAME (frame);
+
+      if (FRAME_IMAGE_CACHE (fr) == c)
+	{
+	  mark_images_in_use (XWINDOW (fr->root_window), in_use, c->used);
+	  if (WINDOWP (fr->tab_bar_window))
+	    mark_images_in_use (XWINDOW (fr->tab_bar_window), in_use, c->used);
+#ifdef HAVE_INT_TOOL_BAR
+	  if (WINDOWP (fr->tool_bar_window))
+	    mark_images_in_use (XWINDOW (fr->tool_bar_window), in_use,
+				c->used);
+#endif
+	}
+    }
+
+  for (i = 0; i < c->used; i++)
+    if (c->images[i] && !in_use[i] && c->images[i]->size_in_bytes > 0)
+      images[nimages++] = c->images[i];
+  qsort (images, nimages, sizeof *images, compare_image_timestamps);
+
+  block_input ();
+  for (i = 0; i < nimages && c->bytes > limit; i++)
+    {
+      free_image (f, images[i]);
+      c->evictions++;
+    }
+  unblock_input ();
+
+  if (c->bytes > limit)
+    {
+      c->failed_bytes = c->bytes;
+      c->failed_limit = limit;
+    }
+
+  xfree (images);
+  xfree (in_use);
+}
+
+/* Free the least recently displayed images in image caches that take
+   more than image-cache-size-limit bytes.  Call this at the end of
+   redisplay, when the current matrices show what is displayed.
+
+   If the images that aren't displayed didn't add up to enough the
+   last time, don't look at a cache again until its size or the limit
+   changed.  An image that is no longer displayed is thus only freed
+   after another image was loaded or freed, which saves scanning the
+   cache and the windows in every redisplay meanwhile.  */
+
+void
+limit_image_caches (void)
+{
+  Lisp_Object tail, frame;
+
+  if (!FIXNATP (Vimage_cache_size_limit))
+    return;
+
+  intmax_t limit = XFIXNAT (Vimage_cache_size_limit);
+
+  FOR_EACH_FRAME (tail, frame)
+    {
+      struct frame *f = XFRAME (frame);
+      struct image_cache *c = FRAME_IMAGE_CACHE (f);
+
+      if (FRAME_WINDOW_P (f)
+	  && c
+	  && c->bytes > limit
+	  && (c->bytes != c->failed_bytes || limit != c->failed_limit)
+	  && !f->inhibit_clear_image_cache)
+	limit_image_cache (f, limit);
+    }
+}
+
 DEFUN ("clear-image-cache", Fclear_image_cache, Sclear_image_cache,
        0, 1, 0,
        doc: /* Clear the image cache.
@@ -2060,6 +2474,59 @@ DEFUN ("clear-image-cache", Fclear_image_cache, Sclear_image_cache,
 }
 
 
+DEFUN ("image-cache-size", Fimage_cache_size, Simage_cache_size, 0, 0, 0,
+       doc: /* Return the size in bytes of the images in all image caches.
+This is the size of the images' pixmaps and other pixel data.  */)
+  (void)
+{
+  intmax_t total = 0;
+
+  for (struct terminal *t = terminal_list; t; t = t->next_terminal)
+    if (t->image_cache)
+      total += t->image_cache->bytes;
+  return make_int (total);
+}
+
+DEFUN ("image-cache-statistics", Fimage_cache_statistics,
+       Simage_cache_statistics, 0, 1, 0,
+       doc: /* Return statistics about the image cache of FRAME.
+FRAME defaults to the selected frame.  Frames on the same display
+share their image cache, and so these statistics.
+
+The value is a property list with the following properties:
+
+ `:size' is the size in bytes of the images in the cache.
+ `:images' is the number of images in the cache.
+ `:hits' is the number of times Emacs found an image it needed in
+   the cache.
+ `:misses' is the number of times it didn't, and had to load the image.
+ `:evictions' is the number of images it freed to keep the cache
+   within `image-cache-size-limit'.  */)
+  (Lisp_Object frame)
+{
+  struct frame *f = decode_window_system_frame (frame);
+  struct image_cache *c = FRAME_IMAGE_CACHE (f);
+  intmax_t bytes = 0, hits = 0, misses = 0, evictions = 0;
+  ptrdiff_t nimages = 0;
+
+  if (c)
+    {
+      for (ptrdiff_t i = 0; i < c->used; i++)
+	if (c->images[i])
+	  nimages++;
+      bytes = c->bytes;
+      hits = c->hits;
+      misses = c->misses;
+      evictions = c->evictions;
+    }
+
+  return list (QCsize, make_int (bytes),
+	       QCimages, make_int (nimages),
+	       QChits, make_int (hits),
+	       QCmisses, make_int (misses),
+	       QCevictions, make_int (evictions));
+}
+
 DEFUN ("image-flush", Fimage_flush, Simage_flush,
        1, 2, 0,
        doc: /* Flush the image with specification SPEC on frame FRAME.
@@ -2087,6 +2554,9 @@ DEFUN ("image-flush", Fimage_flush, Simage_flush,
   else
     uncache_image (decode_window_system_frame (frame), spec);
 
+  /* The image may have a different size when it is loaded again.  */
+  invalidate_line_start_caches ();
+
   return Qnil;
 }
 
@@ -2566,20 +3036,299 @@ image_set_transform (struct frame *f, struct image *img)
       && matrix[1][1] == 1 && matrix[2][0] == 0 && matrix[2][1] == 0)
     return;
 
-  img->cg_transform = xmalloc (sizeof *img->cg_transform);
-  *img->cg_transform = CGAffineTransformMake (matrix[0][0], matrix[0][1],
-					      matrix[1][0], matrix[1][1],
-					      matrix[2][0], matrix[2][1]);
-# endif
-}
+  img->cg_transform = xmalloc (sizeof *img->cg_transform);
+  *img->cg_transform = CGAffineTransformMake (matrix[0][0], matrix[0][1],
+					      matrix[1][0], matrix[1][1],
+					      matrix[2][0], matrix[2][1]);
+# endif
+}
+
+#endif /* HAVE_IMAGEMAGICK || HAVE_NATIVE_TRANSFORMS */
+
+/* Time spent loading images during the current redisplay cycle; see
+   image-load-time-budget.  */
+
+struct timespec image_load_time_used;
+
+/* Return true if USED is at least image-load-time-budget.  */
+
+static bool
+image_load_budget_used_p (struct timespec used)
+{
+  return (NUMBERP (Vimage_load_time_budget)
+	  && timespectod (used) >= XFLOATINT (Vimage_load_time_budget));
+}
+
+/* Set the image type independent attributes `:ascent ASCENT',
+   `:margin MARGIN' and `:relief RELIEF' of image IMG from its
+   specification.  */
+
+static void
+image_set_spec_attributes (struct image *img)
+{
+  Lisp_Object ascent, margin, relief;
+  int relief_bound;
+
+  img->ascent = DEFAULT_IMAGE_ASCENT;
+  ascent = image_spec_value (img->spec, QCascent, NULL);
+  if (FIXNUMP (ascent))
+    img->ascent = XFIXNUM (ascent);
+  else if (EQ (ascent, Qcenter))
+    img->ascent = CENTERED_IMAGE_ASCENT;
+
+  img->hmargin = img->vmargin = 0;
+  margin = image_spec_value (img->spec, QCmargin, NULL);
+  if (FIXNUMP (margin))
+    img->vmargin = img->hmargin = XFIXNUM (margin);
+  else if (CONSP (margin))
+    {
+      img->hmargin = XFIXNUM (XCAR (margin));
+      img->vmargin = XFIXNUM (XCDR (margin));
+    }
+
+  img->relief = 0;
+  relief = image_spec_value (img->spec, QCrelief, NULL);
+  relief_bound = INT_MAX - max (img->hmargin, img->vmargin);
+  if (RANGED_FIXNUMP (- relief_bound, relief, relief_bound))
+    {
+      img->relief = XFIXNUM (relief);
+      img->hmargin += eabs (img->relief);
+      img->vmargin += eabs (img->relief);
+    }
+}
+
+/* Load image IMG, which is in the image cache of frame F, using its
+   type dependent loader function, and apply the image type
+   independent attributes of its specification.  Call this with input
+   blocked.  */
+
+static void
+load_cached_image (struct frame *f, struct image *img)
+{
+  struct timespec start = current_timespec ();
+  Lisp_Object spec = img->spec;
+  bool deferred_p = img->load_deferred_p;
+  int placeholder_width = img->width, placeholder_height = img->height;
+
+  img->load_deferred_p = false;
+  img->load_failed_p = ! img->type->load (f, img);
+
+  /* If we can't load the image, and we don't have a width and
+     height, use some arbitrary width and height so that we can
+     draw a rectangle for it.  */
+  if (img->load_failed_p)
+    {
+      Lisp_Object value;
+
+      value = image_spec_value (spec, QCwidth, NULL);
+      img->width = (FIXNUMP (value)
+		    ? XFIXNAT (value) : DEFAULT_IMAGE_WIDTH);
+      value = image_spec_value (spec, QCheight, NULL);
+      img->height = (FIXNUMP (value)
+		     ? XFIXNAT (value) : DEFAULT_IMAGE_HEIGHT);
+    }
+  else
+    {
+      /* Handle image type independent image attributes
+	 `:ascent ASCENT', `:margin MARGIN', `:relief RELIEF',
+	 `:background COLOR'.  */
+      image_set_spec_attributes (img);
+
+      if (! img->background_valid)
+	{
+	  Lisp_Object bg = image_spec_value (img->spec, QCbackground, NULL);
+	  if (!NILP (bg))
+	    {
+	      img->background
+		= image_alloc_image_color (f, img, bg,
+					   FRAME_BACKGROUND_PIXEL (f));
+	      img->background_valid = 1;
+	    }
+	}
+
+      /* Do image transformations and compute masks, unless we
+	 don't have the image yet.  */
+      if (!EQ (builtin_lisp_symbol (img->type->type), Qpostscript))
+	postprocess_image (f, img);
+
+      /* postprocess_image above may modify the image or the mask,
+	 relying on the image's real width and height, so
+	 image_set_transform must be called after it.  */
+#ifdef HAVE_NATIVE_TRANSFORMS
+      image_set_transform (f, img);
+#endif
+    }
+
+  image_account_size (f, img);
+
+  /* Lines showing the placeholder of a deferred image were laid out
+     with its size, which may not be the image's.  */
+  if (deferred_p
+      && (img->width != placeholder_width
+	  || img->height != placeholder_height))
+    invalidate_line_start_caches ();
+
+  if (redisplaying_p)
+    image_load_time_used
+      = timespec_add (image_load_time_used,
+		      timespec_sub (current_timespec (), start));
+}
+
+static Lisp_Object image_find_image_fd (Lisp_Object, int *);
+
+/* Read N bytes at offset POS of the data of an image into BUF.  The
+   data is in the SIZE bytes at DATA, or, if DATA is null, in the file
+   open as FD.  Return true if successful.  */
+
+static bool
+image_probe_read (int fd, unsigned char const *data, ptrdiff_t size,
+		  ptrdiff_t pos, unsigned char *buf, int n)
+{
+  if (data)
+    {
+      if (size < n || size - n < pos)
+	return false;
+      memcpy (buf, data + pos, n);
+      return true;
+    }
+  return (lseek (fd, pos, SEEK_SET) == pos
+	  && emacs_read (fd, buf, n) == n);
+}
+
+/* If the image data in the SIZE bytes at DATA, or if DATA is null, in
+   the file open as FD, is in PNG, GIF or JPEG format, store its width
+   and height in *WIDTH and *HEIGHT and return true.  Only look at the
+   headers, so that this is much faster than loading the image.  */
+
+static bool
+image_probe_native_size (int fd, unsigned char const *data, ptrdiff_t size,
+			 int *width, int *height)
+{
+  unsigned char b[24];
+  int w = 0, h = 0;
+
+  if (!image_probe_read (fd, data, size, 0, b, 10))
+    return false;
+
+  if (memcmp (b, "\x89PNG\r\n\x1a\n", 8) == 0)
+    {
+      /* The IHDR chunk comes first, and starts with the size.  */
+      if (image_probe_read (fd, data, size, 0, b, 24)
+	  && memcmp (b + 12, "IHDR", 4) == 0
+	  && b[16] == 0 && b[20] == 0)
+	{
+	  w = (b[17] << 16) | (b[18] << 8) | b[19];
+	  h = (b[21] << 16) | (b[22] << 8) | b[23];
+	}
+    }
+  else if (memcmp (b, "GIF8", 4) == 0)
+    {
+      /* The logical screen descriptor follows the signature.  */
+      w = b[6] | (b[7] << 8);
+      h = b[8] | (b[9] << 8);
+    }
+  else if (b[0] == 0xff && b[1] == 0xd8)
+    {
+      /* Skip JPEG segments until a start of frame marker.  Give up
+	 after a few, as the file may not be what it seems.  */
+      ptrdiff_t pos = 2;
+
+      for (int i = 0; i < 64; i++)
+	{
+	  if (!image_probe_read (fd, data, size, pos, b, 4)
+	      || b[0] != 0xff)
+	    break;
+	  if (b[1] == 0xff)
+	    {
+	      /* A fill byte.  */
+	      pos++;
+	      continue;
+	    }
+	  if (b[1] >= 0xc0 && b[1] <= 0xcf
+	      && b[1] != 0xc4 && b[1] != 0xc8 && b[1] != 0xcc)
+	    {
+	      if (image_probe_read (fd, data, size, pos, b, 9))
+		{
+		  h = (b[5] << 8) | b[6];
+		  w = (b[7] << 8) | b[8];
+		}
+	      break;
+	    }
+	  pos += 2 + ((b[2] << 8) | b[3]);
+	}
+    }
+
+  if (w <= 0 || h <= 0)
+    return false;
+  *width = w;
+  *height = h;
+  return true;
+}
+
+/* Load image IMG, which is in the image cache of frame F, later.
+   Until then, give it the size specified by its specification, or the
+   size that its data says it has, so that redisplay can make room for
+   it.  */
+
+static void
+defer_image_load (struct frame *f, struct image *img)
+{
+  Lisp_Object data = image_spec_value (img->spec, QCdata, NULL);
+  Lisp_Object frame;
+  int width = DEFAULT_IMAGE_WIDTH, height = DEFAULT_IMAGE_HEIGHT;
+
+  if (STRINGP (data))
+    image_probe_native_size (-1, SDATA (data), SBYTES (data),
+			     &width, &height);
+  else
+    {
+      Lisp_Object file = image_spec_value (img->spec, QCfile, NULL);
+      int fd;
+
+      if (STRINGP (file)
+	  && !NILP (image_find_image_fd (file, &fd)) && fd >= 0)
+	{
+	  image_probe_native_size (fd, NULL, 0, &width, &height);
+	  emacs_close (fd);
+	}
+    }
+
+#if defined HAVE_IMAGEMAGICK || defined HAVE_MACGUI || defined HAVE_NATIVE_TRANSFORMS
+  int desired_width, desired_height;
+  compute_image_size (width, height, img->spec,
+		      &desired_width, &desired_height);
+  if (desired_width > 0 && desired_height > 0)
+    {
+      width = desired_width;
+      height = desired_height;
+    }
+#else
+  Lisp_Object value = image_spec_value (img->spec, QCwidth, NULL);
+  if (FIXNATP (value))
+    width = min (XFIXNAT (value), INT_MAX);
+  value = image_spec_value (img->spec, QCheight, NULL);
+  if (FIXNATP (value))
+    height = min (XFIXNAT (value), INT_MAX);
+#endif
+
+  img->load_deferred_p = true;
+  img->width = width;
+  img->height = height;
+  image_set_spec_attributes (img);
 
-#endif /* HAVE_IMAGEMAGICK || HAVE_NATIVE_TRANSFORMS */
+  XSETFRAME (frame, f);
+  if (NILP (Fmemq (frame, Vimage_deferred_frames)))
+    Vimage_deferred_frames = Fcons (frame, Vimage_deferred_frames);
+}
 
 /* Return the id of image with Lisp specification SPEC on frame F.
-   SPEC must be a valid Lisp image specification (see valid_image_p).  */
+   SPEC must be a valid Lisp image specification (see valid_image_p).
+   If DEFER_P, and redisplay has used up image-load-time-budget, don't
+   load a new image now, but give it a placeholder and load it later;
+   see defer_image_load.  */
 
-ptrdiff_t
-lookup_image (struct frame *f, Lisp_Object spec)
+static ptrdiff_t
+lookup_image_1 (struct frame *f, Lisp_Object spec, bool defer_p)
 {
   struct image *img;
   EMACS_UINT hash;
@@ -2589,6 +3338,9 @@ lookup_image (struct frame *f, Lisp_Object spec)
   eassert (FRAME_WINDOW_P (f));
   eassert (valid_image_p (spec));
 
+  defer_p = (defer_p && redisplaying_p
+	     && image_load_budget_used_p (image_load_time_used));
+
   /* Look up SPEC in the hash table of the image cache.  */
   hash = sxhash (spec, 0);
   img = search_image_cache (f, spec, hash);
@@ -2597,6 +3349,18 @@ lookup_image (struct frame *f, Lisp_Object spec)
       free_image (f, img);
       img = NULL;
     }
+  if (img)
+    FRAME_IMAGE_CACHE (f)->hits++;
+
+  /* If loading the image was deferred, maybe load it now.  It keeps
+     its id, so image-load-deferred will still see to it that windows
+     showing its placeholder are redrawn.  */
+  if (img && img->load_deferred_p && !defer_p)
+    {
+      block_input ();
+      load_cached_image (f, img);
+      unblock_input ();
+    }
 
   /* If not found, create a new image and cache it.  */
   if (img == NULL)
@@ -2604,89 +3368,95 @@ lookup_image (struct frame *f, Lisp_Object spec)
       block_input ();
       img = make_image (spec, hash);
       cache_image (f, img);
-      img->load_failed_p = ! img->type->load (f, img);
+      FRAME_IMAGE_CACHE (f)->misses++;
       img->frame_foreground = FRAME_FOREGROUND_PIXEL (f);
       img->frame_background = FRAME_BACKGROUND_PIXEL (f);
+      if (defer_p)
+	defer_image_load (f, img);
+      else
+	load_cached_image (f, img);
+      unblock_input ();
+    }
 
-      /* If we can't load the image, and we don't have a width and
-	 height, use some arbitrary width and height so that we can
-	 draw a rectangle for it.  */
-      if (img->load_failed_p)
-	{
-	  Lisp_Object value;
+  /* We're using IMG, so set its timestamp to `now'.  */
+  img->timestamp = current_timespec ();
 
-	  value = image_spec_value (spec, QCwidth, NULL);
-	  img->width = (FIXNUMP (value)
-			? XFIXNAT (value) : DEFAULT_IMAGE_WIDTH);
-	  value = image_spec_value (spec, QCheight, NULL);
-	  img->height = (FIXNUMP (value)
-			 ? XFIXNAT (value) : DEFAULT_IMAGE_HEIGHT);
-	}
-      else
-	{
-	  /* Handle image type independent image attributes
-	     `:ascent ASCENT', `:margin MARGIN', `:relief RELIEF',
-	     `:background COLOR'.  */
-	  Lisp_Object ascent, margin, relief, bg;
-	  int relief_bound;
-
-	  ascent = image_spec_value (spec, QCascent, NULL);
-	  if (FIXNUMP (ascent))
-	    img->ascent = XFIXNUM (ascent);
-	  else if (EQ (ascent, Qcenter))
-	    img->ascent = CENTERED_IMAGE_ASCENT;
-
-	  margin = image_spec_value (spec, QCmargin, NULL);
-	  if (FIXNUMP (margin))
-	    img->vmargin = img->hmargin = XFIXNUM (margin);
-	  else if (CONSP (margin))
-	    {
-	      img->hmargin = XFIXNUM (XCAR (margin));
-	      img->vmargin = XFIXNUM (XCDR (margin));
-	    }
+  /* Value is the image id.  */
+  return img->id;
+}
 
-	  relief = image_spec_value (spec, QCrelief, NULL);
-	  relief_bound = INT_MAX - max (img->hmargin, img->vmargin);
-	  if (RANGED_FIXNUMP (- relief_bound, relief, relief_bound))
-	    {
-	      img->relief = XFIXNUM (relief);
-	      img->hmargin += eabs (img->relief);
-	      img->vmargin += eabs (img->relief);
-	    }
+/* Return the id of image with Lisp specification SPEC on frame F,
+   loading the image if needed.  */
 
-	  if (! img->background_valid)
-	    {
-	      bg = image_spec_value (img->spec, QCbackground, NULL);
-	      if (!NILP (bg))
-		{
-		  img->background
-		    = image_alloc_image_color (f, img, bg,
-                                               FRAME_BACKGROUND_PIXEL (f));
-		  img->background_valid = 1;
-		}
-	    }
+ptrdiff_t
+lookup_image (struct frame *f, Lisp_Object spec)
+{
+  return lookup_image_1 (f, spec, false);
+}
 
-	  /* Do image transformations and compute masks, unless we
-	     don't have the image yet.  */
-	  if (!EQ (builtin_lisp_symbol (img->type->type), Qpostscript))
-	    postprocess_image (f, img);
+/* Like lookup_image, but let redisplay defer loading the image if it
+   used up image-load-time-budget.  Use this for images that are
+   displayed as glyphs in a window, which are redrawn when the image
+   is loaded.  */
 
-          /* postprocess_image above may modify the image or the mask,
-             relying on the image's real width and height, so
-             image_set_transform must be called after it.  */
-#ifdef HAVE_NATIVE_TRANSFORMS
-          image_set_transform (f, img);
-#endif
-	}
+ptrdiff_t
+lookup_image_lazily (struct frame *f, Lisp_Object spec)
+{
+  return lookup_image_1 (f, spec, true);
+}
 
-      unblock_input ();
+DEFUN ("image-load-deferred", Fimage_load_deferred, Simage_load_deferred,
+       0, 1, 0,
+       doc: /* Load the images on FRAME whose loading redisplay deferred.
+FRAME defaults to the selected frame.  Stop loading images once this
+has taken `image-load-time-budget' seconds, but load at least one.
+Return non-nil if there are images left whose loading was deferred.
+
+Redisplay displays FRAME completely again afterwards, and so all other
+frames that share its images, so that they show the images loaded.  */)
+  (Lisp_Object frame)
+{
+  struct frame *f = decode_window_system_frame (frame);
+  struct image_cache *c = FRAME_IMAGE_CACHE (f);
+  struct timespec start = current_timespec ();
+  bool loaded = false, remaining = false;
+
+  if (!c)
+    return Qnil;
+
+  for (ptrdiff_t i = 0; i < c->used; i++)
+    {
+      struct image *img = c->images[i];
+
+      if (img && img->load_deferred_p)
+	{
+	  if (loaded
+	      && image_load_budget_used_p (timespec_sub (current_timespec (),
+							 start)))
+	    {
+	      remaining = true;
+	      break;
+	    }
+	  block_input ();
+	  load_cached_image (f, img);
+	  unblock_input ();
+	  loaded = true;
+	}
     }
 
-  /* We're using IMG, so set its timestamp to `now'.  */
-  img->timestamp = current_timespec ();
+  /* Images loaded here, or by lookup_image since they were deferred,
+     keep their ids, so glyphs showing their placeholders look like
+     glyphs showing them, and wouldn't be redrawn.  */
+  Lisp_Object tail;
+  FOR_EACH_FRAME (tail, frame)
+    {
+      struct frame *fr = XFRAME (frame);
+      if (FRAME_IMAGE_CACHE (fr) == c)
+	clear_current_matrices (fr);
+    }
+  windows_or_buffers_changed = 64;
 
-  /* Value is the image id.  */
-  return img->id;
+  return remaining ? Qt : Qnil;
 }
 
 
@@ -2754,6 +3524,20 @@ mark_image_cache (struct image_cache *c)
     }
 }
 
+/* Mark the image specifications of the animation frame caches.  The
+   caches are shared by all terminals and outlive their image caches,
+   so this is called once per garbage collection, not for each image
+   cache.  */
+
+void
+mark_anim_caches (void)
+{
+#ifdef HAVE_GIF
+  for (struct anim_cache *cache = anim_cache; cache; cache = cache->next)
+    mark_object (cache->spec);
+#endif
+}
+
 
 
 /***********************************************************************
@@ -6734,12 +7518,19 @@ image_from_emacs_colors (struct frame *f, struct image *img, Emacs_Color *colors
   image_clear_image_1 (f, img, CLEAR_IMAGE_PIXMAP | CLEAR_IMAGE_COLORS);
   image_create_x_image_and_pixmap (f, img, width, height, 0,
 				   &oimg, 0);
+  /* Converted images, such as those of disabled tool-bar buttons,
+     often have runs of pixels of the same color, so don't look up the
+     pixel color of a run more than once.  */
+  unsigned long pixel = 0;
   p = colors;
   for (y = 0; y < height; ++y)
     for (x = 0; x < width; ++x, ++p)
       {
-	unsigned long pixel;
-	pixel = lookup_rgb_color (f, p->red, p->green, p->blue);
+	if (p == colors
+	    || p->red != p[-1].red
+	    || p->green != p[-1].green
+	    || p->blue != p[-1].blue)
+	  pixel = lookup_rgb_color (f, p->red, p->green, p->blue);
 	PUT_PIXEL (oimg, x, y, pixel);
       }
 
@@ -6766,54 +7557,66 @@ image_detect_edges (struct frame *f, struct image *img,
                     int *matrix, int color_adjust)
 {
   Emacs_Color *colors = image_to_emacs_colors (f, img, 1);
+  int width = IMAGE_BITMAP_WIDTH (img), height = IMAGE_BITMAP_HEIGHT (img);
   Emacs_Color *new, *p;
   int x, y, i, sum;
   ptrdiff_t nbytes;
 
+  /* The nonzero elements of MATRIX, and the offsets of the pixels
+     they apply to, so that the loop over the pixels below doesn't
+     have to test or compute them.  */
+  int weights[9], nweights = 0;
+  ptrdiff_t offsets[9];
+
   for (i = sum = 0; i < 9; ++i)
-    sum += eabs (matrix[i]);
+    {
+      sum += eabs (matrix[i]);
+      if (matrix[i])
+	{
+	  weights[nweights] = matrix[i];
+	  offsets[nweights++] = (i / 3 - 1) * (ptrdiff_t) width + i % 3 - 1;
+	}
+    }
 
-#define COLOR(A, X, Y) ((A) + (Y) * IMAGE_BITMAP_WIDTH (img) + (X))
+#define COLOR(A, X, Y) ((A) + (Y) * width + (X))
 
-  if (INT_MULTIPLY_WRAPV (sizeof *new, IMAGE_BITMAP_WIDTH (img), &nbytes)
-      || INT_MULTIPLY_WRAPV (IMAGE_BITMAP_HEIGHT (img), nbytes, &nbytes))
+  if (INT_MULTIPLY_WRAPV (sizeof *new, width, &nbytes)
+      || INT_MULTIPLY_WRAPV (height, nbytes, &nbytes))
     memory_full (SIZE_MAX);
   new = xmalloc (nbytes);
 
-  for (y = 0; y < IMAGE_BITMAP_HEIGHT (img); ++y)
+  for (y = 0; y < height; ++y)
     {
       p = COLOR (new, 0, y);
       p->red = p->green = p->blue = 0xffff/2;
-      p = COLOR (new, IMAGE_BITMAP_WIDTH (img) - 1, y);
+      p = COLOR (new, width - 1, y);
       p->red = p->green = p->blue = 0xffff/2;
     }
 
-  for (x = 1; x < IMAGE_BITMAP_WIDTH (img) - 1; ++x)
+  for (x = 1; x < width - 1; ++x)
     {
       p = COLOR (new, x, 0);
       p->red = p->green = p->blue = 0xffff/2;
-      p = COLOR (new, x, IMAGE_BITMAP_HEIGHT (img) - 1);
+      p = COLOR (new, x, height - 1);
       p->red = p->green = p->blue = 0xffff/2;
     }
 
-  for (y = 1; y < IMAGE_BITMAP_HEIGHT (img) - 1; ++y)
+  for (y = 1; y < height - 1; ++y)
     {
+      Emacs_Color *c = COLOR (colors, 1, y);
       p = COLOR (new, 1, y);
 
-      for (x = 1; x < IMAGE_BITMAP_WIDTH (img) - 1; ++x, ++p)
+      for (x = 1; x < width - 1; ++x, ++c, ++p)
 	{
-	  int r, g, b, yy, xx;
+	  int r = 0, g = 0, b = 0;
 
-	  r = g = b = i = 0;
-	  for (yy = y - 1; yy < y + 2; ++yy)
-	    for (xx = x - 1; xx < x + 2; ++xx, ++i)
-	      if (matrix[i])
-	        {
-	          Emacs_Color *t = COLOR (colors, xx, yy);
-		  r += matrix[i] * t->red;
-		  g += matrix[i] * t->green;
-		  b += matrix[i] * t->blue;
-		}
+	  for (i = 0; i < nweights; ++i)
+	    {
+	      Emacs_Color *t = c + offsets[i];
+	      r += weights[i] * t->red;
+	      g += weights[i] * t->green;
+	      b += weights[i] * t->blue;
+	    }
 
 	  r = (r / sum + color_adjust) & 0xffff;
 	  g = (g / sum + color_adjust) & 0xffff;
@@ -9485,19 +10288,118 @@ gif_close (GifFileType *gif, int *err)
   return retval;
 }
 
-/* Load GIF image IMG for use on frame F.  Value is true if
-   successful.  */
+static void
+gif_destroy (void *gif)
+{
+  gif_close (gif, NULL);
+}
 
 static const int interlace_start[] = {0, 4, 2, 1};
 static const int interlace_increment[] = {8, 8, 4, 2};
 
 #define GIF_LOCAL_DESCRIPTOR_EXTENSION 249
 
+/* Composite frame INDEX of the GIF animation of CACHE on top of
+   PIXELS.  See struct anim_cache.  */
+
+static void
+gif_composite_frame (struct anim_cache *cache, int index, uint32_t *pixels)
+{
+  GifFileType *gif = cache->handle;
+  int x, y, i;
+  ColorMapObject *gif_color_map;
+
+  /* We use a local variable `raster' here because RasterBits is a
+     char *, which invites problems with bytes >= 0x80.  */
+  struct SavedImage *subimage = gif->SavedImages + index;
+  unsigned char *raster = (unsigned char *) subimage->RasterBits;
+  int transparency_color_index = -1;
+  int disposal = 0;
+  int subimg_width = subimage->ImageDesc.Width;
+  int subimg_height = subimage->ImageDesc.Height;
+  int subimg_top = subimage->ImageDesc.Top;
+  int subimg_left = subimage->ImageDesc.Left;
+
+  /* Find the Graphic Control Extension block for this sub-image.
+     Extract the disposal method and transparency color.  */
+  for (i = 0; i < subimage->ExtensionBlockCount; i++)
+    {
+      ExtensionBlock *extblock = subimage->ExtensionBlocks + i;
+
+      if ((extblock->Function == GIF_LOCAL_DESCRIPTOR_EXTENSION)
+	  && extblock->ByteCount == 4
+	  && extblock->Bytes[0] & 1)
+	{
+	  /* From gif89a spec: 1 = "keep in place", 2 = "restore
+	     to background".  Treat any other value like 2.  */
+	  disposal = (extblock->Bytes[0] >> 2) & 7;
+	  transparency_color_index = (unsigned char) extblock->Bytes[3];
+	  break;
+	}
+    }
+
+  /* We can't "keep in place" the first subimage.  */
+  if (index == 0)
+    disposal = 2;
+
+  /* For disposal == 0, the spec says "No disposal specified. The
+     decoder is not required to take any action."  In practice, it
+     seems we need to treat this like "keep in place", see e.g.
+     https://upload.wikimedia.org/wikipedia/commons/3/37/Clock.gif */
+  if (disposal == 0)
+    disposal = 1;
+
+  gif_color_map = subimage->ImageDesc.ColorMap;
+  if (!gif_color_map)
+    gif_color_map = gif->SColorMap;
+
+  /* The colors of the subimage.  */
+  uint32_t colors[256] = { 0, };
+
+  if (gif_color_map)
+    for (i = 0; i < gif_color_map->ColorCount; ++i)
+      colors[i] = (transparency_color_index == i
+		   ? ANIM_TRANSPARENT
+		   : ((gif_color_map->Colors[i].Red << 16)
+		      | (gif_color_map->Colors[i].Green << 8)
+		      | gif_color_map->Colors[i].Blue));
+
+  /* Apply the colors.  */
+  int row = interlace_start[0], pass = 0;
+  bool interlace = GIFLIB_MAJOR < 5 && subimage->ImageDesc.Interlace;
+
+  for (y = 0; y < subimg_height; y++)
+    {
+      if (interlace)
+	{
+	  while (subimg_height <= row)
+	    row = interlace_start[++pass];
+	}
+      else
+	row = y;
+
+      uint32_t *p = pixels + ((ptrdiff_t) (row + subimg_top) * cache->width
+			      + subimg_left);
+      unsigned char *c = raster + (ptrdiff_t) y * subimg_width;
+
+      for (x = 0; x < subimg_width; x++)
+	if (transparency_color_index != c[x] || disposal != 1)
+	  p[x] = colors[c[x]];
+
+      if (interlace)
+	row += interlace_increment[pass];
+    }
+}
+
+/* Load GIF image IMG for use on frame F.  Value is true if
+   successful.  Keep the frames of animated GIFs in an animation frame
+   cache, so that showing the next frame doesn't decode the file and
+   composite all the frames before it again.  */
+
 static bool
 gif_load (struct frame *f, struct image *img)
 {
-  int rc, width, height, x, y, i, j;
-  ColorMapObject *gif_color_map;
+  int width, height, x, y, i, j;
   GifFileType *gif;
   gif_memory_source memsrc;
   Lisp_Object specified_bg = image_spec_value (img->spec, QCbackground, NULL);
@@ -9505,88 +10407,121 @@ gif_load (struct frame *f, struct image *img)
   Lisp_Object specified_data = image_spec_value (img->spec, QCdata, NULL);
   EMACS_INT idx;
   int gif_err;
+  struct anim_cache *cache = anim_get_animation_cache (img->spec);
+  bool temporary_cache = false;
 
-  if (NILP (specified_data))
+  if (cache)
+    gif = cache->handle;
+  else
     {
-      Lisp_Object file = image_find_image_file (specified_file);
-      if (!STRINGP (file))
+      if (NILP (specified_data))
 	{
-	  image_error ("Cannot find image file `%s'", specified_file);
-	  return 0;
-	}
+	  Lisp_Object file = image_find_image_file (specified_file);
+	  if (!STRINGP (file))
+	    {
+	      image_error ("Cannot find image file `%s'", specified_file);
+	      return 0;
+	    }
 
-      Lisp_Object encoded_file = ENCODE_FILE (file);
+	  Lisp_Object encoded_file = ENCODE_FILE (file);
 #ifdef WINDOWSNT
-      encoded_file = ansi_encode_filename (encoded_file);
+	  encoded_file = ansi_encode_filename (encoded_file);
 #endif
 
-      /* Open the GIF file.  */
+	  /* Open the GIF file.  */
 #if GIFLIB_MAJOR < 5
-      gif = DGifOpenFileName (SSDATA (encoded_file));
+	  gif = DGifOpenFileName (SSDATA (encoded_file));
 #else
-      gif = DGifOpenFileName (SSDATA (encoded_file), &gif_err);
+	  gif = DGifOpenFileName (SSDATA (encoded_file), &gif_err);
 #endif
-      if (gif == NULL)
-	{
+	  if (gif == NULL)
+	    {
 #if HAVE_GIFERRORSTRING
-	  const char *errstr = GifErrorString (gif_err);
-	  if (errstr)
-	    image_error ("Cannot open `%s': %s", file, build_string (errstr));
-	  else
+	      const char *errstr = GifErrorString (gif_err);
+	      if (errstr)
+		image_error ("Cannot open `%s': %s",
+			     file, build_string (errstr));
+	      else
 #endif
-	  image_error ("Cannot open `%s'", file);
+	      image_error ("Cannot open `%s'", file);
 
-	  return 0;
+	      return 0;
+	    }
 	}
-    }
-  else
-    {
-      if (!STRINGP (specified_data))
+      else
 	{
-	  image_error ("Invalid image data `%s'", specified_data);
-	  return 0;
-	}
+	  if (!STRINGP (specified_data))
+	    {
+	      image_error ("Invalid image data `%s'", specified_data);
+	      return 0;
+	    }
 
-      /* Read from memory! */
-      current_gif_memory_src = &memsrc;
-      memsrc.bytes = SDATA (specified_data);
-      memsrc.len = SBYTES (specified_data);
-      memsrc.index = 0;
+	  /* Read from memory! */
+	  current_gif_memory_src = &memsrc;
+	  memsrc.bytes = SDATA (specified_data);
+	  memsrc.len = SBYTES (specified_data);
+	  memsrc.index = 0;
 
 #if GIFLIB_MAJOR < 5
-      gif = DGifOpen (&memsrc, gif_read_from_memory);
+	  gif = DGifOpen (&memsrc, gif_read_from_memory);
 #else
-      gif = DGifOpen (&memsrc, gif_read_from_memory, &gif_err);
+	  gif = DGifOpen (&memsrc, gif_read_from_memory, &gif_err);
 #endif
-      if (!gif)
-	{
+	  if (!gif)
+	    {
 #if HAVE_GIFERRORSTRING
-	  const char *errstr = GifErrorString (gif_err);
-	  if (errstr)
-	    image_error ("Cannot open memory source `%s': %s",
-			 img->spec, build_string (errstr));
-	  else
+	      const char *errstr = GifErrorString (gif_err);
+	      if (errstr)
+		image_error ("Cannot open memory source `%s': %s",
+			     img->spec, build_string (errstr));
+	      else
 #endif
-	  image_error ("Cannot open memory source `%s'", img->spec);
+	      image_error ("Cannot open memory source `%s'", img->spec);
+	      return 0;
+	    }
+	}
+
+      /* Before reading entire contents, check the declared image
+	 size. */
+      if (!check_image_size (f, gif->SWidth, gif->SHeight))
+	{
+	  image_size_error ();
+	  gif_close (gif, NULL);
 	  return 0;
 	}
-    }
 
-  /* Before reading entire contents, check the declared image size. */
-  if (!check_image_size (f, gif->SWidth, gif->SHeight))
-    {
-      image_size_error ();
-      gif_close (gif, NULL);
-      return 0;
-    }
+      /* Read entire contents.  This is the only time the data is
+	 read; after this, no reads from memsrc happen.  */
+      if (DGifSlurp (gif) == GIF_ERROR || gif->ImageCount <= 0)
+	{
+	  image_error ("Error reading `%s'", img->spec);
+	  gif_close (gif, NULL);
+	  return 0;
+	}
 
-  /* Read entire contents.  */
-  rc = DGifSlurp (gif);
-  if (rc == GIF_ERROR || gif->ImageCount <= 0)
-    {
-      image_error ("Error reading `%s'", img->spec);
-      gif_close (gif, NULL);
-      return 0;
+      /* Check which subimages fit.  It's not clear whether the GIF
+	 spec requires this, but Emacs can crash if they don't fit.  */
+      for (j = 0; j < gif->ImageCount; ++j)
+	{
+	  struct SavedImage *subimage = gif->SavedImages + j;
+	  int subimg_width = subimage->ImageDesc.Width;
+	  int subimg_height = subimage->ImageDesc.Height;
+	  int subimg_top = subimage->ImageDesc.Top;
+	  int subimg_left = subimage->ImageDesc.Left;
+	  if (! (subimg_width >= 0 && subimg_height >= 0
+		 && 0 <= subimg_top && subimg_top <= gif->SHeight - subimg_height
+		 && 0 <= subimg_left && subimg_left <= gif->SWidth - subimg_width))
+	    break;
+	}
+
+      /* Only keep the frames of animations.  */
+      temporary_cache = gif->ImageCount <= 1;
+      cache = anim_create_cache (img->spec, gif, gif_destroy,
+				 !temporary_cache);
+      cache->width = gif->SWidth;
+      cache->height = gif->SHeight;
+      cache->count = j;
+      cache->composite = gif_composite_frame;
     }
 
   /* Which sub-image are we to display?  */
@@ -9597,8 +10532,7 @@ gif_load (struct frame *f, struct image *img)
       {
 	image_error ("Invalid image number `%s' in image `%s'",
 		     image_number, img->spec);
-	gif_close (gif, NULL);
-	return 0;
+	goto fail;
       }
   }
 
@@ -9615,41 +10549,24 @@ gif_load (struct frame *f, struct image *img)
   if (!check_image_size (f, width, height))
     {
       image_size_error ();
-      gif_close (gif, NULL);
-      return 0;
+      goto fail;
     }
 
-  /* Check that the selected subimages fit.  It's not clear whether
-     the GIF spec requires this, but Emacs can crash if they don't fit.  */
-  for (j = 0; j <= idx; ++j)
+  /* Check that the selected subimages fit.  */
+  if (idx >= cache->count)
     {
-      struct SavedImage *subimage = gif->SavedImages + j;
-      int subimg_width = subimage->ImageDesc.Width;
-      int subimg_height = subimage->ImageDesc.Height;
-      int subimg_top = subimage->ImageDesc.Top;
-      int subimg_left = subimage->ImageDesc.Left;
-      if (! (subimg_width >= 0 && subimg_height >= 0
-	     && 0 <= subimg_top && subimg_top <= height - subimg_height
-	     && 0 <= subimg_left && subimg_left <= width - subimg_width))
-	{
-	  image_error ("Subimage does not fit in image");
-	  gif_close (gif, NULL);
-	  return 0;
-	}
+      image_error ("Subimage does not fit in image");
+      goto fail;
     }
 
   /* Create the X image and pixmap.  */
   Emacs_Pix_Container ximg;
   if (!image_create_x_image_and_pixmap (f, img, width, height, 0, &ximg, 0))
-    {
-      gif_close (gif, NULL);
-      return 0;
-    }
+    goto fail;
 
-  /* Clear the part of the screen image not covered by the image.
-     Full animated GIF support requires more here (see the gif89 spec,
-     disposal methods).  Let's simply assume that the part not covered
-     by a sub-image is in the frame's background color.  */
+  /* The part of the screen image not covered by the image is in the
+     frame's background color.  Full animated GIF support requires
+     more here (see the gif89 spec, disposal methods).  */
   unsigned long frame_bg;
 #ifndef USE_CAIRO
   frame_bg = FRAME_BACKGROUND_PIXEL (f);
@@ -9660,32 +10577,10 @@ gif_load (struct frame *f, struct image *img)
     frame_bg = lookup_rgb_color (f, color.red, color.green, color.blue);
   }
 #endif	/* USE_CAIRO */
-  for (y = 0; y < img->corners[TOP_CORNER]; ++y)
-    for (x = 0; x < width; ++x)
-      PUT_PIXEL (ximg, x, y, frame_bg);
-
-  for (y = img->corners[BOT_CORNER]; y < height; ++y)
-    for (x = 0; x < width; ++x)
-      PUT_PIXEL (ximg, x, y, frame_bg);
-
-  for (y = img->corners[TOP_CORNER]; y < img->corners[BOT_CORNER]; ++y)
-    {
-      for (x = 0; x < img->corners[LEFT_CORNER]; ++x)
-	PUT_PIXEL (ximg, x, y, frame_bg);
-      for (x = img->corners[RIGHT_CORNER]; x < width; ++x)
-	PUT_PIXEL (ximg, x, y, frame_bg);
-    }
-
-  /* Read the GIF image into the X image.   */
-
-  /* FIXME: With the current implementation, loading an animated gif
-     is quadratic in the number of animation frames, since each frame
-     is a separate struct image.  We must provide a way for a single
-     gif_load call to construct and save all animation frames.  */
 
   init_color_table ();
 
-  unsigned long bgcolor UNINIT;
+  unsigned long bgcolor = frame_bg;
   if (STRINGP (specified_bg))
     {
       bgcolor = image_alloc_image_color (f, img, specified_bg,
@@ -9697,107 +10592,27 @@ gif_load (struct frame *f, struct image *img)
 #endif
     }
 
-  for (j = 0; j <= idx; ++j)
-    {
-      /* We use a local variable `raster' here because RasterBits is a
-	 char *, which invites problems with bytes >= 0x80.  */
-      struct SavedImage *subimage = gif->SavedImages + j;
-      unsigned char *raster = (unsigned char *) subimage->RasterBits;
-      int transparency_color_index = -1;
-      int disposal = 0;
-      int subimg_width = subimage->ImageDesc.Width;
-      int subimg_height = subimage->ImageDesc.Height;
-      int subimg_top = subimage->ImageDesc.Top;
-      int subimg_left = subimage->ImageDesc.Left;
-
-      /* Find the Graphic Control Extension block for this sub-image.
-	 Extract the disposal method and transparency color.  */
-      for (i = 0; i < subimage->ExtensionBlockCount; i++)
-	{
-	  ExtensionBlock *extblock = subimage->ExtensionBlocks + i;
-
-	  if ((extblock->Function == GIF_LOCAL_DESCRIPTOR_EXTENSION)
-	      && extblock->ByteCount == 4
-	      && extblock->Bytes[0] & 1)
-	    {
-	      /* From gif89a spec: 1 = "keep in place", 2 = "restore
-		 to background".  Treat any other value like 2.  */
-	      disposal = (extblock->Bytes[0] >> 2) & 7;
-	      transparency_color_index = (unsigned char) extblock->Bytes[3];
-	      break;
-	    }
-	}
-
-      /* We can't "keep in place" the first subimage.  */
-      if (j == 0)
-	disposal = 2;
-
-      /* For disposal == 0, the spec says "No disposal specified. The
-	 decoder is not required to take any action."  In practice, it
-	 seems we need to treat this like "keep in place", see e.g.
-	 https://upload.wikimedia.org/wikipedia/commons/3/37/Clock.gif */
-      if (disposal == 0)
-	disposal = 1;
+  /* Read the composited frame into the X image.  Look up the pixel
+     color of a run of pixels of the same color only once.  */
+  uint32_t *pixels = anim_get_frame (cache, idx);
+  uint32_t color = ANIM_BACKGROUND;
+  unsigned long pixel = frame_bg;
 
-      gif_color_map = subimage->ImageDesc.ColorMap;
-      if (!gif_color_map)
-	gif_color_map = gif->SColorMap;
-
-      /* Allocate subimage colors.  */
-      unsigned long pixel_colors[256] = { 0, };
-
-      if (gif_color_map)
-	for (i = 0; i < gif_color_map->ColorCount; ++i)
+  for (y = 0; y < height; ++y)
+    for (x = 0; x < width; ++x)
+      {
+	if (*pixels != color)
 	  {
-	    if (transparency_color_index == i)
-	      pixel_colors[i] = STRINGP (specified_bg)
-		? bgcolor : frame_bg;
-	    else
-	      {
-		int r = gif_color_map->Colors[i].Red << 8;
-		int g = gif_color_map->Colors[i].Green << 8;
-		int b = gif_color_map->Colors[i].Blue << 8;
-		pixel_colors[i] = lookup_rgb_color (f, r, g, b);
-	      }
+	    color = *pixels;
+	    pixel = (color == ANIM_BACKGROUND ? frame_bg
+		     : color == ANIM_TRANSPARENT ? bgcolor
+		     : lookup_rgb_color (f, (color >> 16) << 8,
+					 (color >> 8 & 0xff) << 8,
+					 (color & 0xff) << 8));
 	  }
-
-      /* Apply the pixel values.  */
-      if (GIFLIB_MAJOR < 5 && gif->SavedImages[j].ImageDesc.Interlace)
-	{
-	  int row, pass;
-
-	  for (y = 0, row = interlace_start[0], pass = 0;
-	       y < subimg_height;
-	       y++, row += interlace_increment[pass])
-	    {
-	      while (subimg_height <= row)
-		row = interlace_start[++pass];
-
-	      for (x = 0; x < subimg_width; x++)
-		{
-		  int c = raster[y * subimg_width + x];
-		  if (transparency_color_index != c || disposal != 1)
-                    {
-                      PUT_PIXEL (ximg, x + subimg_left, row + subimg_top,
-                                 pixel_colors[c]);
-		    }
-		}
-	    }
-	}
-      else
-	{
-          for (y = 0; y < subimg_height; ++y)
-	    for (x = 0; x < subimg_width; ++x)
-	      {
-		int c = raster[y * subimg_width + x];
-		if (transparency_color_index != c || disposal != 1)
-                  {
-                    PUT_PIXEL (ximg, x + subimg_left, y + subimg_top,
-                               pixel_colors[c]);
-                  }
-	      }
-	}
-    }
+	PUT_PIXEL (ximg, x, y, pixel);
+	pixels++;
+      }
 
 #ifdef COLOR_TABLE_SUPPORT
   img->colors = colors_in_color_table (&img->ncolors);
@@ -9839,17 +10654,22 @@ gif_load (struct frame *f, struct image *img)
 			    Fcons (make_fixnum (gif->ImageCount),
 				   img->lisp_data));
 
-  if (gif_close (gif, &gif_err) == GIF_ERROR)
+  if (temporary_cache)
     {
+      cache->handle = NULL;
+      anim_free_cache (cache);
+      if (gif_close (gif, &gif_err) == GIF_ERROR)
+	{
 #if HAVE_GIFERRORSTRING
-      char const *error_text = GifErrorString (gif_err);
+	  char const *error_text = GifErrorString (gif_err);
 
-      if (error_text)
-	image_error ("Error closing `%s': %s",
-		     img->spec, build_string (error_text));
-      else
+	  if (error_text)
+	    image_error ("Error closing `%s': %s",
+			 img->spec, build_string (error_text));
+	  else
 #endif
-      image_error ("Error closing `%s'", img->spec);
+	  image_error ("Error closing `%s'", img->spec);
+	}
     }
 
   /* Maybe fill in the background field while we have ximg handy. */
@@ -9861,6 +10681,11 @@ gif_load (struct frame *f, struct image *img)
   image_put_x_image (f, img, ximg, 0);
 
   return 1;
+
+ fail:
+  if (temporary_cache)
+    anim_free_cache (cache);
+  return 0;
 }
 
 #else  /* !HAVE_GIF */
@@ -11921,6 +12746,10 @@ syms_of_image (void)
   DEFSYM (QCscale, ":scale");
   DEFSYM (QCcolor_adjustment, ":color-adjustment");
   DEFSYM (QCmask, ":mask");
+  DEFSYM (QCimages, ":images");
+  DEFSYM (QChits, ":hits");
+  DEFSYM (QCmisses, ":misses");
+  DEFSYM (QCevictions, ":evictions");
 
   /* Other symbols.  */
   DEFSYM (Qlaplace, "laplace");
@@ -12042,7 +12871,10 @@ syms_of_image (void)
   defsubr (&Simage_io_types);
 #endif
   defsubr (&Sclear_image_cache);
+  defsubr (&Simage_cache_size);
+  defsubr (&Simage_cache_statistics);
   defsubr (&Simage_flush);
+  defsubr (&Simage_load_deferred);
   defsubr (&Simage_size);
   defsubr (&Simage_mask_p);
   defsubr (&Simage_metadata);
@@ -12073,6 +12905,39 @@ syms_of_image (void)
 
 The function `clear-image-cache' disregards this variable.  */);
   Vimage_cache_eviction_delay = make_fixnum (300);
+
+  DEFVAR_LISP ("image-cache-size-limit", Vimage_cache_size_limit,
+    doc: /* Maximum size in bytes of the images in an image cache.
+If this is a number, redisplay frees the images that were displayed
+least recently when the images in the cache of a display take more
+than this many bytes, except for those that windows show.  The size of
+an image is the size of its pixmaps and other pixel data.
+If nil, images are only freed after `image-cache-eviction-delay'.
+
+The function `image-cache-statistics' says how many images were freed
+because of this limit.  */);
+  Vimage_cache_size_limit = Qnil;
+
+  DEFVAR_LISP ("image-load-time-budget", Vimage_load_time_budget,
+    doc: /* Maximum time, in seconds, a redisplay cycle spends loading images.
+If this is a number, redisplay stops loading images that it hasn't
+loaded before, once it has spent this much time loading images during
+one redisplay cycle.  It displays empty rectangles in place of the
+other images, adds the frames showing them to `image-deferred-frames',
+and goes on.  The size of such a rectangle is the size that the
+image's specification asks for, or, for PNG, GIF and JPEG images, the
+size in the image's header.  While this is a number, Emacs loads these
+images with `image-load-deferred' when it is idle, and redisplays the
+frames, until they have all been loaded or input arrives.
+If nil, redisplay always loads the images it displays.  */);
+  Vimage_load_time_budget = Qnil;
+
+  DEFVAR_LISP ("image-deferred-frames", Vimage_deferred_frames,
+    doc: /* Frames with images whose loading redisplay deferred.
+Redisplay adds a frame to this list when it displays placeholders for
+images because it used up `image-load-time-budget'.  Whoever loads the
+images with `image-load-deferred' should remove it from the list.  */);
+  Vimage_deferred_frames = Qnil;
 #ifdef HAVE_IMAGEMAGICK
   DEFVAR_INT ("imagemagick-render-type", imagemagick_render_type,
     doc: /* Integer indicating which ImageMagick rendering method to use.
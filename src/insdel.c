@@ -2063,6 +2063,10 @@ invalidate_buffer_caches (struct buffer *buf, ptrdiff_t start, ptrdiff_t end)
 			       buf->bidi_paragraph_cache,
 			       start - BUF_BEG (buf), BUF_Z (buf) - end);
     }
+  if (buf->bidi_ltr_cache)
+    invalidate_region_cache (buf,
+                             buf->bidi_ltr_cache,
+                             start - BUF_BEG (buf), BUF_Z (buf) - end);
   if (buf->newline_cache)
     invalidate_region_cache (buf,
                              buf->newline_cache,
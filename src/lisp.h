@@ -591,6 +591,7 @@ #define ENUM_BF(TYPE) enum TYPE
 /* Defined in chartab.c.  */
 extern Lisp_Object char_table_ref (Lisp_Object, int);
 extern void char_table_set (Lisp_Object, int, Lisp_Object);
+extern EMACS_INT char_table_modiff;
 
 /* Defined in data.c.  */
 extern AVOID wrong_type_argument (Lisp_Object, Lisp_Object);
@@ -1094,6 +1095,7 @@ DEFINE_GDB_SYMBOL_END (PSEUDOVECTOR_FLAG)
   PVEC_MUTEX,
   PVEC_CONDVAR,
   PVEC_MODULE_FUNCTION,
+  PVEC_REGEXP,
 
   /* These should be last, check internal_equal to see why.  */
   PVEC_COMPILED,
@@ -2061,7 +2063,10 @@ CHAR_TABLE_REF (Lisp_Object ct, int idx)
 CHAR_TABLE_SET (Lisp_Object ct, int idx, Lisp_Object val)
 {
   if (ASCII_CHAR_P (idx) && SUB_CHAR_TABLE_P (XCHAR_TABLE (ct)->ascii))
-    set_sub_char_table_contents (XCHAR_TABLE (ct)->ascii, idx, val);
+    {
+      set_sub_char_table_contents (XCHAR_TABLE (ct)->ascii, idx, val);
+      char_table_modiff++;
+    }
   else
     char_table_set (ct, idx, val);
 }
@@ -4330,7 +4335,46 @@ XMODULE_FUNCTION (Lisp_Object o)
 extern void init_fileio (void);
 extern void syms_of_fileio (void);
 
+/* A regexp compiled once by 'compile-regexp', as a Lisp object.  */
+struct Lisp_Regexp
+{
+  union vectorlike_header header;
+
+  /* The regexp source string, and the translate table, whitespace
+     regexp and syntax table it was compiled for.  These are copies of
+     the fields of CACHE, so that the garbage collector sees them.  */
+  Lisp_Object pattern;
+  Lisp_Object translate;
+  Lisp_Object whitespace_regexp;
+  Lisp_Object syntax_table;
+
+  /* The compiled pattern.  Unlike the entries of the regexp cache in
+     search.c, this is never reused for another regexp.  */
+  struct regexp_cache *cache;
+} GCALIGNED_STRUCT;
+
+INLINE bool
+REGEXPP (Lisp_Object x)
+{
+  return PSEUDOVECTORP (x, PVEC_REGEXP);
+}
+
+INLINE void
+CHECK_REGEXP (Lisp_Object x)
+{
+  CHECK_TYPE (REGEXPP (x), Qregexpp, x);
+}
+
+INLINE struct Lisp_Regexp *
+XREGEXP (Lisp_Object a)
+{
+  eassert (REGEXPP (a));
+  return XUNTAG (a, Lisp_Vectorlike, struct Lisp_Regexp);
+}
+
 /* Defined in search.c.  */
+extern Lisp_Object compile_regexp (Lisp_Object, Lisp_Object, bool);
+extern void finalize_one_regexp (struct Lisp_Regexp *);
 extern void shrink_regexp_cache (void);
 extern void restore_search_regs (void);
 extern void update_search_regs (ptrdiff_t oldstart,
@@ -4355,6 +4399,14 @@ fast_string_match_ignore_case (Lisp_Object regexp, Lisp_Object string)
 						  ptrdiff_t);
 extern ptrdiff_t fast_looking_at (Lisp_Object, ptrdiff_t, ptrdiff_t,
                                   ptrdiff_t, ptrdiff_t, Lisp_Object);
+/* The number of bytes skip_newlines_forward and skip_newlines_backward
+   examine at a time.  */
+enum { NEWLINE_BLOCK_SIZE = 4096 };
+extern ptrdiff_t count_newlines (unsigned char const *, ptrdiff_t);
+extern ptrdiff_t skip_newlines_forward (unsigned char const *, ptrdiff_t,
+					ptrdiff_t *);
+extern ptrdiff_t skip_newlines_backward (unsigned char const *, ptrdiff_t,
+					 ptrdiff_t *);
 extern ptrdiff_t find_newline (ptrdiff_t, ptrdiff_t, ptrdiff_t, ptrdiff_t,
 			       ptrdiff_t, ptrdiff_t *, ptrdiff_t *, bool);
 extern void scan_newline (ptrdiff_t, ptrdiff_t, ptrdiff_t, ptrdiff_t,
@@ -2769,7 +2769,7 @@ dump_hash_table (struct dump_context *ctx,
 static dump_off
 dump_buffer (struct dump_context *ctx, const struct buffer *in_buffer)
 {
-#if CHECK_STRUCTS && !defined HASH_buffer_375A10F5E5
+#if CHECK_STRUCTS && !defined HASH_buffer_FA58D1B7C8
 # error "buffer changed. See CHECK_STRUCTS comment in config.h."
 #endif
   struct buffer munged_buffer = *in_buffer;
@@ -2878,6 +2878,18 @@ dump_buffer (struct dump_context *ctx, const struct buffer *in_buffer)
   out->newline_cache = NULL;
   out->width_run_cache = NULL;
   out->bidi_paragraph_cache = NULL;
+  /* bidi_region_cache_on_off makes a new one on demand; until then,
+     the bidi iterator just scans for right-to-left text again.  */
+  out->bidi_ltr_cache = NULL;
+
+  /* Redisplay statistics belong to the session that counted them; the
+     session that loads the dump allocates its own on first display.  */
+  out->redisplay_stats = NULL;
+
+  /* `long-line-threshold' may be different in the session that loads
+     the dump, so have redisplay look for long lines afresh.  */
+  out->long_line_checked_size = 0;
+  out->long_line_optimizations_p = false;
 
   DUMP_FIELD_COPY (out, buffer, prevent_redisplay_optimizations_p);
   DUMP_FIELD_COPY (out, buffer, clip_changed);
@@ -2961,7 +2973,7 @@ dump_vectorlike (struct dump_context *ctx,
                  Lisp_Object lv,
                  dump_off offset)
 {
-#if CHECK_STRUCTS && !defined HASH_pvec_type_E55BD36F8E
+#if CHECK_STRUCTS && !defined HASH_pvec_type_EF38C6C9F9
 # error "pvec_type changed. See CHECK_STRUCTS comment in config.h."
 #endif
   const struct Lisp_Vector *v = XVECTOR (lv);
@@ -3036,6 +3048,11 @@ dump_vectorlike (struct dump_context *ctx,
       error_unsupported_dump_object (ctx, lv, "mutex");
     case PVEC_CONDVAR:
       error_unsupported_dump_object (ctx, lv, "condvar");
+    case PVEC_REGEXP:
+      /* The compiled pattern lives in malloc'ed memory that the dump
+         cannot carry; Lisp code preloaded into the dump should keep
+         the source string and compile it at run time.  */
+      error_unsupported_dump_object (ctx, lv, "regexp");
     case PVEC_MODULE_FUNCTION:
       error_unsupported_dump_object (ctx, lv, "module function");
     default:
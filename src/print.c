@@ -1709,6 +1709,12 @@ print_vectorlike (Lisp_Object obj, Lisp_Object printcharfun, bool escapeflag,
       printchar ('>', printcharfun);
       break;
 
+    case PVEC_REGEXP:
+      print_c_string ("#<regexp ", printcharfun);
+      print_object (XREGEXP (obj)->pattern, printcharfun, escapeflag);
+      printchar ('>', printcharfun);
+      break;
+
     case PVEC_RECORD:
       {
 	ptrdiff_t size = PVSIZE (obj);
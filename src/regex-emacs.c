@@ -892,6 +892,8 @@ #define INIT_FAILURE_ALLOC 20
   ptrdiff_t size;
   ptrdiff_t avail;	/* Offset of next open position.  */
   ptrdiff_t frame;	/* Offset of the cur constructed frame.  */
+  struct fail_stack_arena *arena; /* Where STACK lives, or null if on the
+				  C stack.  */
 } fail_stack_type;
 
 #define FAIL_STACK_EMPTY()     (fail_stack.frame == 0)
@@ -901,10 +903,14 @@ #define FAIL_STACK_EMPTY()     (fail_stack.frame == 0)
 
 #define INIT_FAIL_STACK()						\
   do {									\
-    fail_stack.stack =							\
-      SAFE_ALLOCA (INIT_FAILURE_ALLOC * TYPICAL_FAILURE_SIZE		\
-		   * sizeof (fail_stack_elt_t));			\
-    fail_stack.size = INIT_FAILURE_ALLOC;				\
+    if (!acquire_fail_arena (&fail_stack))				\
+      {									\
+	fail_stack.stack =						\
+	  SAFE_ALLOCA (INIT_FAILURE_ALLOC * TYPICAL_FAILURE_SIZE	\
+		       * sizeof (fail_stack_elt_t));			\
+	fail_stack.size = INIT_FAILURE_ALLOC;				\
+	fail_stack.arena = NULL;					\
+      }									\
     fail_stack.avail = 0;						\
     fail_stack.frame = 0;						\
   } while (false)
@@ -927,6 +933,11 @@ #define FAIL_STACK_GROWTH_FACTOR 4
 #define GROW_FAIL_STACK(fail_stack)					\
   (((fail_stack).size >= emacs_re_max_failures * TYPICAL_FAILURE_SIZE)        \
    ? 0									\
+   : (fail_stack).arena							\
+   ? (grow_fail_arena (&(fail_stack),					\
+		       min (emacs_re_max_failures * TYPICAL_FAILURE_SIZE,	\
+			    (fail_stack).size * FAIL_STACK_GROWTH_FACTOR)),	\
+      1)								\
    : ((fail_stack).stack						\
       = REGEX_REALLOCATE ((fail_stack).stack,				\
 	  (fail_stack).size * sizeof (fail_stack_elt_t),		\
@@ -966,10 +977,29 @@ #define NEXT_FAILURE_HANDLE(h) fail_stack.stack[(h) - 3].integer
 #define TOP_FAILURE_HANDLE() fail_stack.frame
 
 
+/* Record in the pattern buffer, and in its profile if any, how large
+   the failure stack got during this match.  The stack is at its
+   highest just before a failure point is popped off it, or when the
+   match ends.  Assumes the variables 'fail_stack_peak', 'bufp' and
+   'profile'.  */
+#define RECORD_FAIL_STACK_PEAK()					\
+do {									\
+  fail_stack_peak = max (fail_stack_peak, fail_stack.avail);		\
+  bufp->fail_stack_peak = max (bufp->fail_stack_peak, fail_stack_peak); \
+  if (profile)								\
+    profile->max_failure_stack = max (profile->max_failure_stack,	\
+				      fail_stack_peak);			\
+} while (false)
+
 #define ENSURE_FAIL_STACK(space)					\
 while (REMAINING_AVAIL_SLOTS <= space) {				\
   if (!GROW_FAIL_STACK (fail_stack))					\
-    return -2;								\
+    {									\
+      RECORD_FAIL_STACK_PEAK ();					\
+      unbind_to (count, Qnil);						\
+      SAFE_FREE ();							\
+      return -2;							\
+    }									\
   DEBUG_PRINT ("\n  Doubled stack; size now: %td\n", fail_stack.size);	\
   DEBUG_PRINT ("	 slots available: %td\n", REMAINING_AVAIL_SLOTS);\
 }
@@ -1089,6 +1119,70 @@ #define PUSH_FAILURE_POINT(pattern, string_place)			\
 /* BEWARE, the value `20' is hard-coded in emacs.c:main().  */
 #define TYPICAL_FAILURE_SIZE 20
 
+/* Size of the failure stack storage that a thread keeps between
+   matches, once a match has needed that much; see shrink_fail_arena.  */
+#define FAIL_ARENA_KEEP (INIT_FAILURE_ALLOC * TYPICAL_FAILURE_SIZE * 64)
+
+static void
+release_fail_arena (void *arena)
+{
+  ((struct fail_stack_arena *) arena)->busy = false;
+}
+
+/* Make FAIL_STACK use the storage of the current thread's arena,
+   allocating it if necessary.  Return false if another match is
+   using it.  */
+static bool
+acquire_fail_arena (fail_stack_type *fail_stack)
+{
+  struct fail_stack_arena *arena = &re_fail_arena;
+
+  if (arena->busy)
+    return false;
+  if (!arena->stack)
+    {
+      arena->size = INIT_FAILURE_ALLOC * TYPICAL_FAILURE_SIZE;
+      arena->stack = xmalloc (arena->size * sizeof *arena->stack);
+    }
+  arena->busy = true;
+  record_unwind_protect_ptr (release_fail_arena, arena);
+  fail_stack->stack = arena->stack;
+  fail_stack->size = arena->size;
+  fail_stack->arena = arena;
+  return true;
+}
+
+/* Grow the arena storage of FAIL_STACK to NSIZE elements.  */
+static void
+grow_fail_arena (fail_stack_type *fail_stack, ptrdiff_t nsize)
+{
+  struct fail_stack_arena *arena = fail_stack->arena;
+
+  arena->stack = xrealloc (arena->stack, nsize * sizeof *arena->stack);
+  arena->size = nsize;
+  fail_stack->stack = arena->stack;
+  fail_stack->size = nsize;
+}
+
+void
+shrink_fail_arena (struct fail_stack_arena *arena, bool release)
+{
+  if (arena->busy)
+    return;
+  if (release)
+    {
+      xfree (arena->stack);
+      arena->stack = NULL;
+      arena->size = 0;
+    }
+  else if (arena->size > FAIL_ARENA_KEEP)
+    {
+      arena->stack = xrealloc (arena->stack,
+			       FAIL_ARENA_KEEP * sizeof *arena->stack);
+      arena->size = FAIL_ARENA_KEEP;
+    }
+}
+
 /* How many items can still be added to the stack without overflowing it.  */
 #define REMAINING_AVAIL_SLOTS ((fail_stack).size - (fail_stack).avail)
 
@@ -1174,6 +1268,12 @@ #define PATFETCH(c)							\
 #define RE_TRANSLATE(TBL, C) char_table_translate (TBL, C)
 #define TRANSLATE(d) (!NILP (translate) ? RE_TRANSLATE (translate, d) : (d))
 
+/* Like TRANSLATE, but use the flat copy 'fold' of 'translate'.  The
+   searching and matching functions use this for the characters of
+   the strings they look at.  */
+#define FOLD_TRANSLATE(d) \
+  (!NILP (translate) ? fold_char (fold, translate, d) : (d))
+
 /* Macros for outputting the compiled pattern into 'buffer'.  */
 
 /* If the buffer isn't allocated when it comes in, use this.  */
@@ -3193,17 +3293,19 @@ #define POS_ADDR_VSTRING(POS)					\
    found, -1 if no match, or -2 if error (such as failure
    stack overflow).  */
 
-ptrdiff_t
-re_search_2 (struct re_pattern_buffer *bufp, const char *str1, ptrdiff_t size1,
-	     const char *str2, ptrdiff_t size2,
-	     ptrdiff_t startpos, ptrdiff_t range,
-	     struct re_registers *regs, ptrdiff_t stop)
+static ptrdiff_t
+re_search_2_internal (struct re_pattern_buffer *bufp,
+		      const char *str1, ptrdiff_t size1,
+		      const char *str2, ptrdiff_t size2,
+		      ptrdiff_t startpos, ptrdiff_t range,
+		      struct re_registers *regs, ptrdiff_t stop)
 {
   ptrdiff_t val;
   re_char *string1 = (re_char *) str1;
   re_char *string2 = (re_char *) str2;
   char *fastmap = bufp->fastmap;
   Lisp_Object translate = bufp->translate;
+  struct fold_table *fold = NILP (translate) ? NULL : get_fold_table (translate);
   ptrdiff_t total_size = size1 + size2;
   ptrdiff_t endpos = startpos + range;
   bool anchored_start;
@@ -3298,7 +3400,7 @@ re_search_2 (struct re_pattern_buffer *bufp, const char *str1, ptrdiff_t size1,
 			int buf_charlen;
 
 			buf_ch = STRING_CHAR_AND_LENGTH (d, buf_charlen);
-			buf_ch = RE_TRANSLATE (translate, buf_ch);
+			buf_ch = fold_char (fold, translate, buf_ch);
 			if (fastmap[CHAR_LEADING_CODE (buf_ch)])
 			  break;
 
@@ -3310,7 +3412,7 @@ re_search_2 (struct re_pattern_buffer *bufp, const char *str1, ptrdiff_t size1,
 		      {
 			buf_ch = *d;
 			int ch = RE_CHAR_TO_MULTIBYTE (buf_ch);
-			int translated = RE_TRANSLATE (translate, ch);
+			int translated = fold_char (fold, translate, ch);
 			if (translated != ch
 			    && (ch = RE_CHAR_TO_UNIBYTE (translated)) >= 0)
 			  buf_ch = ch;
@@ -3347,7 +3449,7 @@ re_search_2 (struct re_pattern_buffer *bufp, const char *str1, ptrdiff_t size1,
 	      if (multibyte)
 		{
 		  buf_ch = STRING_CHAR (d);
-		  buf_ch = TRANSLATE (buf_ch);
+		  buf_ch = FOLD_TRANSLATE (buf_ch);
 		  if (! fastmap[CHAR_LEADING_CODE (buf_ch)])
 		    goto advance;
 		}
@@ -3355,11 +3457,11 @@ re_search_2 (struct re_pattern_buffer *bufp, const char *str1, ptrdiff_t size1,
 		{
 		  buf_ch = *d;
 		  int ch = RE_CHAR_TO_MULTIBYTE (buf_ch);
-		  int translated = TRANSLATE (ch);
+		  int translated = FOLD_TRANSLATE (ch);
 		  if (translated != ch
 		      && (ch = RE_CHAR_TO_UNIBYTE (translated)) >= 0)
 		    buf_ch = ch;
-		  if (! fastmap[TRANSLATE (buf_ch)])
+		  if (! fastmap[FOLD_TRANSLATE (buf_ch)])
 		    goto advance;
 		}
 	    }
@@ -3424,7 +3526,54 @@ re_search_2 (struct re_pattern_buffer *bufp, const char *str1, ptrdiff_t size1,
 	}
     }
   return -1;
-} /* re_search_2 */
+} /* re_search_2_internal */
+
+/* The farthest offset that re_match_2_internal looked at in the
+   current profiled search or match.  The callers of
+   re_match_2_internal count the bytes looked at from it, so that
+   bytes looked at by several match attempts only count once.  */
+
+static ptrdiff_t re_profile_farthest;
+
+/* Record in PROFILE a search or match that began at time START and
+   looked at BYTES bytes.  */
+
+static void
+re_profile_call (struct re_match_profile *profile, struct timespec start,
+		 ptrdiff_t bytes)
+{
+  profile->calls++;
+  profile->bytes += bytes;
+  profile->time = timespec_add (profile->time,
+				timespec_sub (current_timespec (), start));
+}
+
+ptrdiff_t
+re_search_2 (struct re_pattern_buffer *bufp, const char *str1, ptrdiff_t size1,
+	     const char *str2, ptrdiff_t size2,
+	     ptrdiff_t startpos, ptrdiff_t range,
+	     struct re_registers *regs, ptrdiff_t stop)
+{
+  struct re_match_profile *profile = bufp->profile;
+
+  if (!profile)
+    return re_search_2_internal (bufp, str1, size1, str2, size2,
+				 startpos, range, regs, stop);
+
+  struct timespec start = current_timespec ();
+  re_profile_farthest = startpos;
+  ptrdiff_t val = re_search_2_internal (bufp, str1, size1, str2, size2,
+					startpos, range, regs, stop);
+  /* Account for the positions the search moved across, whether or
+     not a match was attempted at each of them, and for the text after
+     them that match attempts looked at.  */
+  ptrdiff_t endpos = (val >= 0 ? val
+		      : max (0, min (startpos + range, size1 + size2)));
+  re_profile_call (profile, start,
+		   (max (re_profile_farthest, max (startpos, endpos))
+		    - min (startpos, endpos)));
+  return val;
+}
 
 /* Declarations and macros for re_match_2.  */
 
@@ -3841,6 +3990,14 @@ re_match_2 (struct re_pattern_buffer *bufp,
 	    ptrdiff_t pos, struct re_registers *regs, ptrdiff_t stop)
 {
   ptrdiff_t result;
+  struct re_match_profile *profile = bufp->profile;
+  struct timespec start UNINIT;
+
+  if (profile)
+    {
+      start = current_timespec ();
+      re_profile_farthest = pos;
+    }
 
   ptrdiff_t charpos;
   gl_state.object = re_match_object; /* Used by SYNTAX_TABLE_BYTE_TO_CHAR. */
@@ -3850,6 +4007,8 @@ re_match_2 (struct re_pattern_buffer *bufp,
   result = re_match_2_internal (bufp, (re_char *) string1, size1,
 				(re_char *) string2, size2,
 				pos, regs, stop);
+  if (profile)
+    re_profile_call (profile, start, re_profile_farthest - pos);
   return result;
 }
 
@@ -3893,6 +4052,7 @@ re_match_2_internal (struct re_pattern_buffer *bufp,
 
   /* We use this to map every character in the string.	*/
   Lisp_Object translate = bufp->translate;
+  struct fold_table *fold = NILP (translate) ? NULL : get_fold_table (translate);
 
   /* True if BUFP is setup from a multibyte regex.  */
   bool multibyte = RE_MULTIBYTE_P (bufp);
@@ -3900,6 +4060,14 @@ re_match_2_internal (struct re_pattern_buffer *bufp,
   /* True if STRING1/STRING2 are multibyte.  */
   bool target_multibyte = RE_TARGET_MULTIBYTE_P (bufp);
 
+  /* Counters to update, if any, and the farthest offset reached so
+     far by this match attempt.  */
+  struct re_match_profile *profile = bufp->profile;
+  ptrdiff_t farthest = pos;
+
+  /* Largest number of failure stack slots in use so far.  */
+  ptrdiff_t fail_stack_peak = 0;
+
   /* Failure point stack.  Each place that can handle a failure further
      down the line pushes a failure point on this stack.  It consists of
      regstart, and regend for all registers corresponding to
@@ -3953,10 +4121,10 @@ re_match_2_internal (struct re_pattern_buffer *bufp,
 
   REGEX_USE_SAFE_ALLOCA;
 
-  INIT_FAIL_STACK ();
-
   ptrdiff_t count = SPECPDL_INDEX ();
 
+  INIT_FAIL_STACK ();
+
   /* Prevent shrinking and relocation of buffer text if GC happens
      while we are inside this function.  The calls to
      UPDATE_SYNTAX_TABLE_* macros can call Lisp (via
@@ -4201,6 +4369,11 @@ re_match_2_internal (struct re_pattern_buffer *bufp,
 
 	  DEBUG_PRINT ("Returning %td from re_match_2.\n", dcnt);
 
+	  if (profile)
+	    re_profile_farthest = max (re_profile_farthest,
+				       max (farthest, pos + dcnt));
+	  RECORD_FAIL_STACK_PEAK ();
+
 	  unbind_to (count, Qnil);
 	  SAFE_FREE ();
 	  return dcnt;
@@ -4246,7 +4419,7 @@ re_match_2_internal (struct re_pattern_buffer *bufp,
 		  }
 		buf_ch = STRING_CHAR_AND_LENGTH (d, buf_charlen);
 
-		if (TRANSLATE (buf_ch) != pat_ch)
+		if (FOLD_TRANSLATE (buf_ch) != pat_ch)
 		  {
 		    d = dfail;
 		    goto fail;
@@ -4277,7 +4450,7 @@ re_match_2_internal (struct re_pattern_buffer *bufp,
 		buf_ch = RE_CHAR_TO_MULTIBYTE (*d);
 		if (! CHAR_BYTE8_P (buf_ch))
 		  {
-		    buf_ch = TRANSLATE (buf_ch);
+		    buf_ch = FOLD_TRANSLATE (buf_ch);
 		    buf_ch = RE_CHAR_TO_UNIBYTE (buf_ch);
 		    if (buf_ch < 0)
 		      buf_ch = *d;
@@ -4309,7 +4482,7 @@ re_match_2_internal (struct re_pattern_buffer *bufp,
 	    PREFETCH ();
 	    buf_ch = RE_STRING_CHAR_AND_LENGTH (d, buf_charlen,
 						target_multibyte);
-	    buf_ch = TRANSLATE (buf_ch);
+	    buf_ch = FOLD_TRANSLATE (buf_ch);
 	    if (buf_ch == '\n')
 	      goto fail;
 
@@ -4336,7 +4509,7 @@ re_match_2_internal (struct re_pattern_buffer *bufp,
 	      {
 		int c1;
 
-		c = TRANSLATE (c);
+		c = FOLD_TRANSLATE (c);
 		c1 = RE_CHAR_TO_UNIBYTE (c);
 		if (c1 >= 0)
 		  {
@@ -4350,7 +4523,7 @@ re_match_2_internal (struct re_pattern_buffer *bufp,
 
 		if (! CHAR_BYTE8_P (c1))
 		  {
-		    c1 = TRANSLATE (c1);
+		    c1 = FOLD_TRANSLATE (c1);
 		    c1 = RE_CHAR_TO_UNIBYTE (c1);
 		    if (c1 >= 0)
 		      {
@@ -5003,11 +5176,16 @@ re_match_2_internal (struct re_pattern_buffer *bufp,
     /* We goto here if a matching operation fails. */
     fail:
       maybe_quit ();
+      fail_stack_peak = max (fail_stack_peak, fail_stack.avail);
+      if (profile)
+	farthest = max (farthest, POINTER_TO_OFFSET (d));
       if (!FAIL_STACK_EMPTY ())
 	{
 	  re_char *str, *pat;
 	  /* A restart point is known.  Restore to that state.  */
 	  DEBUG_PRINT ("\nFAIL:\n");
+	  if (profile)
+	    profile->backtracks++;
 	  POP_FAILURE_POINT (str, pat);
 	  switch (*pat++)
 	    {
@@ -5048,6 +5226,10 @@ re_match_2_internal (struct re_pattern_buffer *bufp,
   if (best_regs_set)
     goto restore_best_regs;
 
+  if (profile)
+    re_profile_farthest = max (re_profile_farthest, farthest);
+  RECORD_FAIL_STACK_PEAK ();
+
   unbind_to (count, Qnil);
   SAFE_FREE ();
 
@@ -5104,6 +5286,7 @@ re_compile_pattern (const char *pattern, ptrdiff_t length,
 		    struct re_pattern_buffer *bufp)
 {
   bufp->regs_allocated = REGS_UNALLOCATED;
+  bufp->fail_stack_peak = 0;
 
   reg_errcode_t ret
       = regex_compile ((re_char *) pattern, length,
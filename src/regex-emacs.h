@@ -20,6 +20,7 @@
 #define EMACS_REGEX_H 1
 
 #include <stddef.h>
+#include <timespec.h>
 
 /* This is the structure we store register match data in.
    Declare this before including lisp.h, since lisp.h (via thread.h)
@@ -31,6 +32,23 @@ #define EMACS_REGEX_H 1
   ptrdiff_t *end;
 };
 
+/* Storage for the failure stack of the matcher, kept from one match
+   to the next so that hot matches need not allocate and grow a new
+   stack each time.  Declare this before including lisp.h,
+   since each thread has one; see thread.h.  */
+struct fail_stack_arena
+{
+  /* The storage, an array of SIZE elements of the matcher's
+     'union fail_stack_elt', or null if none is allocated yet.  */
+  union fail_stack_elt *stack;
+  ptrdiff_t size;
+
+  /* True while a match is using the storage.  A match started while
+     another one is in progress, for instance by Lisp code run from
+     'syntax-propertize', uses a stack of its own.  */
+  bool busy;
+};
+
 #include "lisp.h"
 
 /* The string or buffer being matched.
@@ -55,6 +73,28 @@ #define EMACS_REGEX_H 1
 /* Amount of memory that we can safely stack allocate.  */
 extern ptrdiff_t emacs_re_safe_alloca;
 
+/* Counters for the work done by searches and matches with one compiled
+   pattern.  They are updated only through the 'profile' field of a
+   pattern buffer, which is null unless 'regexp-profiling' is on.  */
+struct re_match_profile
+{
+  /* Number of calls to re_search_2 and re_match_2.  */
+  intmax_t calls;
+
+  /* Number of bytes looked at, both while looking for a place to
+     start a match and while matching.  */
+  intmax_t bytes;
+
+  /* Number of times the matcher backtracked to a failure point.  */
+  intmax_t backtracks;
+
+  /* Largest number of failure stack slots in use at once.  */
+  ptrdiff_t max_failure_stack;
+
+  /* Time spent searching and matching.  */
+  struct timespec time;
+};
+
 /* This data structure represents a compiled pattern.  Before calling
    the pattern compiler, the fields 'buffer', 'allocated', 'fastmap',
    and 'translate' can be set.  After the pattern has been
@@ -118,10 +158,23 @@ #define EMACS_REGEX_H 1
   /* If true, multi-byte form in the target of match should be
      recognized as a multibyte character.  */
   bool_bf target_multibyte : 1;
+
+  /* If non-null, the counters to update for each search and match
+     with this pattern.  */
+  struct re_match_profile *profile;
+
+  /* Largest number of failure stack slots that matching this pattern
+     has used since it was compiled.  */
+  ptrdiff_t fail_stack_peak;
 };
 
 /* Declarations for routines.  */
 
+/* Shrink the storage of ARENA, unless a match is using it.  If
+   RELEASE, free it altogether; otherwise, just give back what exceeds
+   the amount worth keeping between matches.  */
+extern void shrink_fail_arena (struct fail_stack_arena *arena, bool release);
+
 /* Compile the regular expression PATTERN, with length LENGTH
    and syntax given by the global 're_syntax_options', into the buffer
    BUFFER.  Return NULL if successful, and an error string if not.  */
@@ -21,6 +21,8 @@ Copyright (C) 1985-1987, 1993-1994, 1997-1999, 2001-2021 Free Software
 
 #include <config.h>
 
+#include <count-one-bits.h>
+
 #include "lisp.h"
 #include "character.h"
 #include "buffer.h"
@@ -51,6 +53,12 @@ #define REGEXP_CACHE_SIZE 20
   bool posix;
   /* True means we're inside a buffer match.  */
   bool busy;
+  /* Work done with this regexp since it was last added to
+     regexp_profile_log; see 'regexp-profiling'.  */
+  struct re_match_profile profile;
+  /* For the pattern of a regexp object, the value of
+     regexp_syntax_tick when it was compiled.  */
+  EMACS_INT syntax_tick;
 };
 
 /* The instances of that struct.  */
@@ -59,6 +67,16 @@ #define REGEXP_CACHE_SIZE 20
 /* The head of the linked list; points to the most recently used buffer.  */
 static struct regexp_cache *searchbuf_head;
 
+/* A hash table mapping regexps to vectors of the counters in their
+   profile, for regexps no longer in the cache.  Nil if there are
+   none.  */
+static Lisp_Object regexp_profile_log;
+
+/* Incremented whenever a syntax table changes, so that regexp objects
+   whose compiled pattern depends on the syntax table can tell when
+   they need to be recompiled.  */
+static EMACS_INT regexp_syntax_tick;
+
 static void set_search_regs (ptrdiff_t, ptrdiff_t);
 static void save_search_regs (void);
 static EMACS_INT simple_search (EMACS_INT, unsigned char *, ptrdiff_t,
@@ -90,6 +108,41 @@ freeze_buffer_relocation (void)
 #endif
 }
 
+/* Add the profile counters of CP to regexp_profile_log, and clear
+   them.  */
+
+static void
+regexp_profile_flush (struct regexp_cache *cp)
+{
+  struct re_match_profile *profile = &cp->profile;
+
+  if (profile->calls == 0 || !STRINGP (cp->regexp))
+    return;
+
+  if (NILP (regexp_profile_log))
+    regexp_profile_log = CALLN (Fmake_hash_table, QCtest, Qequal);
+
+  Lisp_Object old = Fgethash (cp->regexp, regexp_profile_log, Qnil);
+  Lisp_Object calls = make_int (profile->calls);
+  Lisp_Object bytes = make_int (profile->bytes);
+  Lisp_Object backtracks = make_int (profile->backtracks);
+  Lisp_Object max_stack = make_int (profile->max_failure_stack);
+  double seconds = timespectod (profile->time);
+  if (!NILP (old))
+    {
+      calls = CALLN (Fplus, AREF (old, 0), calls);
+      bytes = CALLN (Fplus, AREF (old, 1), bytes);
+      backtracks = CALLN (Fplus, AREF (old, 2), backtracks);
+      max_stack = CALLN (Fmax, AREF (old, 3), max_stack);
+      seconds += XFLOAT_DATA (AREF (old, 4));
+    }
+  Fputhash (cp->regexp,
+	    CALLN (Fvector, calls, bytes, backtracks, max_stack,
+		   make_float (seconds)),
+	    regexp_profile_log);
+  memset (profile, 0, sizeof *profile);
+}
+
 /* Compile a regexp and signal a Lisp error if anything goes wrong.
    PATTERN is the pattern to compile.
    CP is the place to put the result.
@@ -107,6 +160,7 @@ compile_pattern_1 (struct regexp_cache *cp, Lisp_Object pattern,
   char *val;
 
   eassert (!cp->busy);
+  regexp_profile_flush (cp);
   cp->regexp = Qnil;
   cp->buf.translate = translate;
   cp->posix = posix;
@@ -160,12 +214,16 @@ clear_regexp_cache (void)
 {
   int i;
 
+  regexp_syntax_tick++;
   for (i = 0; i < REGEXP_CACHE_SIZE; ++i)
     /* It's tempting to compare with the syntax-table we've actually changed,
        but it's not sufficient because char-table inheritance means that
        modifying one syntax-table can change others at the same time.  */
     if (!searchbufs[i].busy && !EQ (searchbufs[i].syntax_table, Qt))
-      searchbufs[i].regexp = Qnil;
+      {
+	regexp_profile_flush (&searchbufs[i]);
+	searchbufs[i].regexp = Qnil;
+      }
 }
 
 static void
@@ -194,12 +252,66 @@ freeze_pattern (struct regexp_cache *searchbuf)
    POSIX is true if we want full backtracking (POSIX style) for this pattern.
    False means backtrack only enough to get a valid match.  */
 
+/* Return true if the pattern compiled in CP can be used as is for a
+   search in the current buffer with translation table TRANSLATE and,
+   if POSIX, with full POSIX backtracking.  */
+
+static bool
+compiled_pattern_usable_p (struct regexp_cache *cp, Lisp_Object translate,
+			   bool posix)
+{
+  return (!cp->busy
+	  && EQ (cp->buf.translate, translate)
+	  && cp->posix == posix
+	  && (EQ (cp->syntax_table, Qt)
+	      || EQ (cp->syntax_table, BVAR (current_buffer, syntax_table)))
+	  && !NILP (Fequal (cp->f_whitespace_regexp, Vsearch_spaces_regexp))
+	  && cp->buf.charset_unibyte == charset_unibyte);
+}
+
+/* Compile PATTERN into the pattern of the regexp object R, for
+   translation table TRANSLATE and, if POSIX, full POSIX
+   backtracking.  */
+
+static void
+compile_regexp_object (struct Lisp_Regexp *r, Lisp_Object pattern,
+		       Lisp_Object translate, bool posix)
+{
+  struct regexp_cache *cp = r->cache;
+
+  compile_pattern_1 (cp, pattern, translate, posix);
+  cp->syntax_tick = regexp_syntax_tick;
+  r->pattern = cp->regexp;
+  r->translate = cp->buf.translate;
+  r->whitespace_regexp = cp->f_whitespace_regexp;
+  r->syntax_table = cp->syntax_table;
+}
+
 static struct regexp_cache *
 compile_pattern (Lisp_Object pattern, struct re_registers *regp,
 		 Lisp_Object translate, bool posix, bool multibyte)
 {
   struct regexp_cache *cp, **cpp, **lru_nonbusy;
 
+  /* A regexp object carries its own compiled pattern, which is used
+     if it was compiled for the same circumstances.  Otherwise, and
+     while profiling, which keeps its counters in the cache, fall
+     back on the cache for the regexp's source string.  */
+  if (REGEXPP (pattern))
+    {
+      struct Lisp_Regexp *r = XREGEXP (pattern);
+      cp = r->cache;
+      if (!regexp_profiling && compiled_pattern_usable_p (cp, translate, posix))
+	{
+	  if (!EQ (cp->syntax_table, Qt)
+	      && cp->syntax_tick != regexp_syntax_tick)
+	    compile_regexp_object (r, r->pattern, translate, posix);
+	  cp->buf.profile = NULL;
+	  goto found;
+	}
+      pattern = r->pattern;
+    }
+
   for (cpp = &searchbuf_head, lru_nonbusy = NULL; ; cpp = &cp->next)
     {
       cp = *cpp;
@@ -213,15 +325,9 @@ compile_pattern (Lisp_Object pattern, struct re_registers *regp,
       if (NILP (cp->regexp))
 	goto compile_it;
       if (SCHARS (cp->regexp) == SCHARS (pattern)
-          && !cp->busy
 	  && STRING_MULTIBYTE (cp->regexp) == STRING_MULTIBYTE (pattern)
 	  && !NILP (Fstring_equal (cp->regexp, pattern))
-	  && EQ (cp->buf.translate, translate)
-	  && cp->posix == posix
-	  && (EQ (cp->syntax_table, Qt)
-	      || EQ (cp->syntax_table, BVAR (current_buffer, syntax_table)))
-	  && !NILP (Fequal (cp->f_whitespace_regexp, Vsearch_spaces_regexp))
-	  && cp->buf.charset_unibyte == charset_unibyte)
+	  && compiled_pattern_usable_p (cp, translate, posix))
 	break;
 
       /* If we're at the end of the cache, compile into the last
@@ -245,7 +351,9 @@ compile_pattern (Lisp_Object pattern, struct re_registers *regp,
   *cpp = cp->next;
   cp->next = searchbuf_head;
   searchbuf_head = cp;
+  cp->buf.profile = regexp_profiling ? &cp->profile : NULL;
 
+ found:
   /* Advise the searching functions about the space we have allocated
      for register data.  */
   if (regp)
@@ -258,6 +366,15 @@ compile_pattern (Lisp_Object pattern, struct re_registers *regp,
 }
 
 
+/* Signal an error unless REGEXP is a regexp string or a regexp
+   object.  */
+
+static void
+check_regexp (Lisp_Object regexp)
+{
+  CHECK_TYPE (STRINGP (regexp) || REGEXPP (regexp), Qstringp, regexp);
+}
+
 static Lisp_Object
 looking_at_1 (Lisp_Object string, bool posix)
 {
@@ -274,7 +391,7 @@ looking_at_1 (Lisp_Object string, bool posix)
   set_char_table_extras (BVAR (current_buffer, case_canon_table), 2,
 			 BVAR (current_buffer, case_eqv_table));
 
-  CHECK_STRING (string);
+  check_regexp (string);
 
   /* Snapshot in case Lisp changes the value.  */
   bool preserve_match_data = NILP (Vinhibit_changing_match_data);
@@ -375,7 +492,7 @@ string_match_1 (Lisp_Object regexp, Lisp_Object string, Lisp_Object start,
   if (running_asynch_code)
     save_search_regs ();
 
-  CHECK_STRING (regexp);
+  check_regexp (regexp);
   CHECK_STRING (string);
 
   if (NILP (start))
@@ -493,7 +610,12 @@ fast_c_string_match_ignore_case (Lisp_Object regexp,
   ptrdiff_t val;
   struct re_pattern_buffer *bufp;
 
-  regexp = string_make_unibyte (regexp);
+  /* A regexp object compiled from a multibyte source can't be used
+     to match the unibyte STRING; match its source made unibyte.  */
+  if (REGEXPP (regexp) && STRING_MULTIBYTE (XREGEXP (regexp)->pattern))
+    regexp = XREGEXP (regexp)->pattern;
+  if (STRINGP (regexp))
+    regexp = string_make_unibyte (regexp);
   bufp = &compile_pattern (regexp, 0,
                            Vascii_canon_table, 0,
                            0)->buf;
@@ -620,6 +742,84 @@ newline_cache_on_off (struct buffer *buf)
 }
 
 
+/* Return the number of newlines in the N bytes at P.
+
+   This compares a word at a time against a word full of newlines,
+   turns each matching byte into a single set bit, and counts the set
+   bits.  For text with short lines this is much faster than calling
+   memchr once per line.  */
+
+ptrdiff_t
+count_newlines (unsigned char const *p, ptrdiff_t n)
+{
+  unsigned long const ones = ULONG_MAX / UCHAR_MAX;
+  unsigned long const low7 = ones * 0x7f, high = ones * 0x80;
+  unsigned long const newlines = ones * '\n';
+  unsigned char const *lim = p + n;
+  ptrdiff_t count = 0;
+
+  for (; lim - p >= sizeof (unsigned long); p += sizeof (unsigned long))
+    {
+      unsigned long w;
+      memcpy (&w, p, sizeof w);
+      w ^= newlines;
+      /* The high bit of each byte of the mask is set iff that byte
+	 of W is zero, i.e. iff the original byte was a newline.  No
+	 carry can cross a byte boundary, so the count is exact.  */
+      count += count_one_bits_l (~(((w & low7) + low7) | w) & high);
+    }
+  for (; p < lim; p++)
+    count += *p == '\n';
+  return count;
+}
+
+/* Skip forward over the N bytes at P in blocks of NEWLINE_BLOCK_SIZE
+   bytes, as long as each block has some newlines but fewer than
+   *COUNT of them.  Decrement *COUNT by the number of newlines skipped
+   and return the number of bytes skipped.  The caller must locate
+   the remaining newlines individually, starting at the returned
+   offset; it need not call this function again before it is past
+   the block that stopped the skipping.  */
+
+ptrdiff_t
+skip_newlines_forward (unsigned char const *p, ptrdiff_t n,
+		       ptrdiff_t *count)
+{
+  ptrdiff_t skipped = 0;
+
+  while (skipped < n)
+    {
+      ptrdiff_t block = min (n - skipped, NEWLINE_BLOCK_SIZE);
+      ptrdiff_t found = count_newlines (p + skipped, block);
+      if (found == 0 || found >= *count)
+	break;
+      *count -= found;
+      skipped += block;
+    }
+  return skipped;
+}
+
+/* Like skip_newlines_forward, but skip backward over the N bytes
+   before LIM.  */
+
+ptrdiff_t
+skip_newlines_backward (unsigned char const *lim, ptrdiff_t n,
+			ptrdiff_t *count)
+{
+  ptrdiff_t skipped = 0;
+
+  while (skipped < n)
+    {
+      ptrdiff_t block = min (n - skipped, NEWLINE_BLOCK_SIZE);
+      ptrdiff_t found = count_newlines (lim - skipped - block, block);
+      if (found == 0 || found >= *count)
+	break;
+      *count -= found;
+      skipped += block;
+    }
+  return skipped;
+}
+
 /* Search for COUNT newlines between START/START_BYTE and END/END_BYTE.
 
    If COUNT is positive, search forwards; END must be >= START.
@@ -769,11 +969,34 @@ find_newline (ptrdiff_t start, ptrdiff_t start_byte, ptrdiff_t end,
 	     of the base, the cursor, and the next line.  */
 	  ptrdiff_t base = start_byte - lim_byte;
 	  ptrdiff_t cursor, next;
+	  /* Offset below which block skipping is known not to help.  */
+	  ptrdiff_t noskip = base;
 
 	  for (cursor = base; cursor < 0; cursor = next)
 	    {
+	      unsigned char *nl;
+
+	      /* When many newlines remain to be found, count them a
+		 block at a time instead of locating each one.  The
+		 newline-free stretches inside the skipped blocks are
+		 not entered into the newline cache, but such
+		 stretches are shorter than a block anyway.  */
+	      if (count > 1 && cursor >= noskip)
+		{
+		  cursor += skip_newlines_forward (lim_addr + cursor,
+						   - cursor, &count);
+		  noskip = cursor + NEWLINE_BLOCK_SIZE;
+		  if (allow_quit)
+		    maybe_quit ();
+		  if (cursor == 0)
+		    {
+		      next = 0;
+		      break;
+		    }
+		}
+
               /* The dumb loop.  */
-	      unsigned char *nl = memchr (lim_addr + cursor, '\n', - cursor);
+	      nl = memchr (lim_addr + cursor, '\n', - cursor);
 	      next = nl ? nl - lim_addr : 0;
 
               /* If we're using the newline cache, cache the fact that
@@ -878,10 +1101,32 @@ find_newline (ptrdiff_t start, ptrdiff_t start_byte, ptrdiff_t end,
 	     offsets are at least -1.  */
 	  ptrdiff_t base = start_byte - ceiling_byte;
 	  ptrdiff_t cursor, prev;
+	  /* Offset above which block skipping is known not to help.  */
+	  ptrdiff_t noskip = base;
 
 	  for (cursor = base; 0 < cursor; cursor = prev)
             {
-	      unsigned char *nl = memrchr (ceiling_addr, '\n', cursor);
+	      unsigned char *nl;
+
+	      /* Count newlines a block at a time while many remain to
+		 be found, as in the forward case above.  */
+	      if (count < -1 && cursor <= noskip)
+		{
+		  ptrdiff_t want = - count;
+		  cursor -= skip_newlines_backward (ceiling_addr + cursor,
+						    cursor, &want);
+		  count = - want;
+		  noskip = cursor - NEWLINE_BLOCK_SIZE;
+		  if (allow_quit)
+		    maybe_quit ();
+		  if (cursor == 0)
+		    {
+		      prev = -1;
+		      break;
+		    }
+		}
+
+	      nl = memrchr (ceiling_addr, '\n', cursor);
 	      prev = nl ? nl - ceiling_addr : -1;
 
               /* If we're looking for newlines, cache the fact that
@@ -1018,7 +1263,10 @@ search_command (Lisp_Object string, Lisp_Object bound, Lisp_Object noerror,
       n *= XFIXNUM (count);
     }
 
-  CHECK_STRING (string);
+  if (RE)
+    check_regexp (string);
+  else
+    CHECK_STRING (string);
   if (NILP (bound))
     {
       if (n > 0)
@@ -1141,6 +1389,11 @@ #define TRANSLATE(out, trt, d)			\
   }						\
 while (0)
 
+/* Like TRANSLATE, but use the flat copy 'fold' of TRT; see
+   get_fold_table.  */
+#define FOLD_TRANSLATE(out, trt, d)			\
+  ((out) = NILP (trt) ? (d) : fold_char (fold, trt, d))
+
 /* Only used in search_buffer, to record the end position of the match
    when searching regexps and SEARCH_REGS should not be changed
    (i.e. Vinhibit_changing_match_data is non-nil).  */
@@ -1496,13 +1749,15 @@ search_buffer (Lisp_Object string, ptrdiff_t pos, ptrdiff_t pos_byte,
 
   /* Searching 0 times means don't move.  */
   /* Null string is found at starting position.  */
-  if (n == 0 || SCHARS (string) == 0)
+  if (n == 0 || SCHARS (REGEXPP (string) ? XREGEXP (string)->pattern
+			: string) == 0)
     {
       set_search_regs (pos_byte, 0);
       return pos;
     }
 
-  if (RE && !(trivial_regexp_p (string) && NILP (Vsearch_spaces_regexp)))
+  if (REGEXPP (string)
+      || (RE && !(trivial_regexp_p (string) && NILP (Vsearch_spaces_regexp))))
     pos = search_buffer_re (string, pos, pos_byte, lim, lim_byte,
                             n, trt, inverse_trt, posix);
   else
@@ -1532,6 +1787,7 @@ simple_search (EMACS_INT n, unsigned char *pat,
 {
   bool multibyte = ! NILP (BVAR (current_buffer, enable_multibyte_characters));
   bool forward = n > 0;
+  struct fold_table *fold = NILP (trt) ? NULL : get_fold_table (trt);
   /* Number of buffer bytes matched.  Note that this may be different
      from len_byte in a multibyte buffer.  */
   ptrdiff_t match_byte = PTRDIFF_MIN;
@@ -1557,7 +1813,7 @@ simple_search (EMACS_INT n, unsigned char *pat,
 		pat_ch = STRING_CHAR_AND_LENGTH (p, charlen);
 		buf_ch = STRING_CHAR_AND_LENGTH (BYTE_POS_ADDR (this_pos_byte),
 						 buf_charlen);
-		TRANSLATE (buf_ch, trt, buf_ch);
+		FOLD_TRANSLATE (buf_ch, trt, buf_ch);
 
 		if (buf_ch != pat_ch)
 		  break;
@@ -1599,7 +1855,7 @@ simple_search (EMACS_INT n, unsigned char *pat,
 	      {
 		int pat_ch = *p++;
 		int buf_ch = FETCH_BYTE (this_pos);
-		TRANSLATE (buf_ch, trt, buf_ch);
+		FOLD_TRANSLATE (buf_ch, trt, buf_ch);
 
 		if (buf_ch != pat_ch)
 		  break;
@@ -1643,7 +1899,7 @@ simple_search (EMACS_INT n, unsigned char *pat,
 		PREV_CHAR_BOUNDARY (p, pat);
 		pat_ch = STRING_CHAR (p);
 		buf_ch = STRING_CHAR (BYTE_POS_ADDR (this_pos_byte));
-		TRANSLATE (buf_ch, trt, buf_ch);
+		FOLD_TRANSLATE (buf_ch, trt, buf_ch);
 
 		if (buf_ch != pat_ch)
 		  break;
@@ -1681,7 +1937,7 @@ simple_search (EMACS_INT n, unsigned char *pat,
 	      {
 		int pat_ch = *p++;
 		int buf_ch = FETCH_BYTE (this_pos);
-		TRANSLATE (buf_ch, trt, buf_ch);
+		FOLD_TRANSLATE (buf_ch, trt, buf_ch);
 
 		if (buf_ch != pat_ch)
 		  break;
@@ -3326,6 +3582,161 @@ DEFUN ("newline-cache-check", Fnewline_cache_check, Snewline_cache_check,
 }
 
 
+/* Return a regexp object for PATTERN, compiled for translation table
+   TRANSLATE and, if POSIX, full POSIX backtracking.  C code can keep
+   the result in a staticpro'd variable and pass it instead of PATTERN
+   to the fast_* functions above, so as not to compete for the regexp
+   cache on hot paths.  */
+
+Lisp_Object
+compile_regexp (Lisp_Object pattern, Lisp_Object translate, bool posix)
+{
+  struct Lisp_Regexp *r
+    = ALLOCATE_ZEROED_PSEUDOVECTOR (struct Lisp_Regexp, syntax_table,
+				    PVEC_REGEXP);
+  Lisp_Object val = make_lisp_ptr (r, Lisp_Vectorlike);
+  struct regexp_cache *cp = xzalloc (sizeof *cp);
+
+  cp->regexp = cp->f_whitespace_regexp = cp->syntax_table = Qnil;
+  cp->buf.allocated = 100;
+  cp->buf.buffer = xmalloc (100);
+  cp->buf.fastmap = cp->fastmap;
+  /* From here on, finalize_one_regexp frees CP if compiling fails.  */
+  r->cache = cp;
+  compile_regexp_object (r, pattern, translate, posix);
+  return val;
+}
+
+void
+finalize_one_regexp (struct Lisp_Regexp *r)
+{
+  if (r->cache)
+    {
+      xfree (r->cache->buf.buffer);
+      xfree (r->cache);
+    }
+}
+
+DEFUN ("compile-regexp", Fcompile_regexp, Scompile_regexp, 1, 2, 0,
+       doc: /* Compile REGEXP into a regexp object for repeated use.
+A regexp object can be used in place of REGEXP in `looking-at',
+`string-match', `re-search-forward', `re-search-backward' and their
+POSIX variants, and in `file-name-handler-alist'.  It is compiled
+once and for all, and does not compete with other regexps for the
+limited space in the cache of recently used regexps.
+
+The regexp is compiled for the current values of `case-fold-search'
+and `search-spaces-regexp' and, if it uses syntax classes, for the
+current syntax table.  Using the object in other circumstances gives
+the same results as using REGEXP, but is no faster.
+
+Optional second argument POSIX non-nil means compile for the POSIX
+functions, such as `posix-string-match'.  */)
+  (Lisp_Object regexp, Lisp_Object posix)
+{
+  CHECK_STRING (regexp);
+
+  /* This is so set_image_of_range_1 in regex-emacs.c can find the EQV
+     table.  */
+  set_char_table_extras (BVAR (current_buffer, case_canon_table), 2,
+			 BVAR (current_buffer, case_eqv_table));
+
+  return compile_regexp (regexp,
+			 (!NILP (BVAR (current_buffer, case_fold_search))
+			  ? BVAR (current_buffer, case_canon_table) : Qnil),
+			 !NILP (posix));
+}
+
+DEFUN ("regexpp", Fregexpp, Sregexpp, 1, 1, 0,
+       doc: /* Return t if OBJECT is a regexp object made by `compile-regexp'.  */)
+  (Lisp_Object object)
+{
+  return REGEXPP (object) ? Qt : Qnil;
+}
+
+DEFUN ("regexp-source", Fregexp_source, Sregexp_source, 1, 1, 0,
+       doc: /* Return the regexp string that REGEXP was compiled from.  */)
+  (Lisp_Object regexp)
+{
+  CHECK_REGEXP (regexp);
+  return XREGEXP (regexp)->pattern;
+}
+
+DEFUN ("regexp-failure-stack-peak", Fregexp_failure_stack_peak,
+       Sregexp_failure_stack_peak, 1, 1, 0,
+       doc: /* Return how much backtracking state matching REGEXP has needed.
+The value is the largest number of slots of the matcher's failure
+stack in use at once while searching or matching with REGEXP.  Each
+point the matcher may backtrack to takes a few slots, so a large value
+means a regexp that backtracks a lot, and may be slow or even overflow
+the stack on long text.
+
+REGEXP can be a regexp object made by `compile-regexp', or a string.
+For a string, the value comes from the cache of recently used regexps,
+and is nil if REGEXP is not in it.  */)
+  (Lisp_Object regexp)
+{
+  if (REGEXPP (regexp))
+    return make_int (XREGEXP (regexp)->cache->buf.fail_stack_peak);
+  CHECK_STRING (regexp);
+
+  Lisp_Object val = Qnil;
+  for (struct regexp_cache *cp = searchbuf_head; cp; cp = cp->next)
+    if (STRINGP (cp->regexp) && !NILP (Fstring_equal (cp->regexp, regexp)))
+      val = make_int (max (FIXNUMP (val) ? XFIXNUM (val) : 0,
+			   cp->buf.fail_stack_peak));
+  return val;
+}
+
+DEFUN ("regexp-profile-data", Fregexp_profile_data, Sregexp_profile_data,
+       0, 0, 0,
+       doc: /* Return the statistics gathered while `regexp-profiling' was on.
+The value is a list with an element for each regexp that was used,
+of the form (REGEXP CALLS BYTES BACKTRACKS MAX-STACK SECONDS).
+
+CALLS is the number of searches and matches that used REGEXP.  BYTES
+is the number of bytes they looked at, and BACKTRACKS the number of
+times the matcher backtracked.  MAX-STACK is the largest number of
+slots in use at once in the backtracking stack; a regexp whose
+MAX-STACK approaches the limit risks a "Stack overflow in regexp
+matcher" error.  SECONDS is the total time spent.  */)
+  (void)
+{
+  Lisp_Object val = Qnil;
+
+  for (int i = 0; i < REGEXP_CACHE_SIZE; ++i)
+    regexp_profile_flush (&searchbufs[i]);
+
+  if (NILP (regexp_profile_log))
+    return Qnil;
+
+  struct Lisp_Hash_Table *h = XHASH_TABLE (regexp_profile_log);
+  for (ptrdiff_t i = 0; i < HASH_TABLE_SIZE (h); ++i)
+    {
+      Lisp_Object key = HASH_KEY (h, i);
+      if (!EQ (key, Qunbound))
+	{
+	  Lisp_Object v = HASH_VALUE (h, i);
+	  val = Fcons (list (key, AREF (v, 0), AREF (v, 1), AREF (v, 2),
+			     AREF (v, 3), AREF (v, 4)),
+		       val);
+	}
+    }
+  return val;
+}
+
+DEFUN ("regexp-profile-reset", Fregexp_profile_reset, Sregexp_profile_reset,
+       0, 0, 0,
+       doc: /* Discard the statistics gathered while `regexp-profiling' was on.  */)
+  (void)
+{
+  for (int i = 0; i < REGEXP_CACHE_SIZE; ++i)
+    memset (&searchbufs[i].profile, 0, sizeof searchbufs[i].profile);
+  regexp_profile_log = Qnil;
+  return Qnil;
+}
+
+
 static void syms_of_search_for_pdumper (void);
 
 void
@@ -3348,6 +3759,8 @@ syms_of_search (void)
   /* Error condition signaled when regexp compile_pattern fails.  */
   DEFSYM (Qinvalid_regexp, "invalid-regexp");
 
+  DEFSYM (Qregexpp, "regexpp");
+
   Fput (Qsearch_failed, Qerror_conditions,
 	pure_list (Qsearch_failed, Qerror));
   Fput (Qsearch_failed, Qerror_message,
@@ -3366,6 +3779,9 @@ syms_of_search (void)
   re_match_object = Qnil;
   staticpro (&re_match_object);
 
+  regexp_profile_log = Qnil;
+  staticpro (&regexp_profile_log);
+
   DEFVAR_LISP ("search-spaces-regexp", Vsearch_spaces_regexp,
       doc: /* Regexp to substitute for bunches of spaces in regexp search.
 Some commands use this for user-specified regexps.
@@ -3385,6 +3801,14 @@ syms_of_search (void)
 is to bind it with `let' around a small expression.  */);
   Vinhibit_changing_match_data = Qnil;
 
+  DEFVAR_BOOL ("regexp-profiling", regexp_profiling,
+    doc: /* Non-nil means gather statistics about regexp searches and matches.
+The statistics are kept separately for each regexp, and can be
+retrieved with `regexp-profile-data'.  Gathering them makes each
+search and match slightly slower, so this is normally nil.
+See also `regexp-profile-report'.  */);
+  regexp_profiling = false;
+
   defsubr (&Slooking_at);
   defsubr (&Sposix_looking_at);
   defsubr (&Sstring_match);
@@ -3402,6 +3826,12 @@ syms_of_search (void)
   defsubr (&Sset_match_data);
   defsubr (&Sregexp_quote);
   defsubr (&Snewline_cache_check);
+  defsubr (&Scompile_regexp);
+  defsubr (&Sregexpp);
+  defsubr (&Sregexp_source);
+  defsubr (&Sregexp_failure_stack_peak);
+  defsubr (&Sregexp_profile_data);
+  defsubr (&Sregexp_profile_reset);
 
   pdumper_do_now_and_after_load (syms_of_search_for_pdumper);
 }
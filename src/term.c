@@ -64,7 +64,7 @@
 
 static void tty_set_scroll_region (struct frame *f, int start, int stop);
 static void turn_on_face (struct frame *, int face_id);
-static void turn_off_face (struct frame *, int face_id);
+static void turn_off_face (struct tty_display_info *);
 static void tty_turn_off_highlight (struct tty_display_info *);
 static void tty_show_cursor (struct tty_display_info *);
 static void tty_hide_cursor (struct tty_display_info *);
@@ -214,6 +214,7 @@ tty_reset_terminal_modes (struct terminal *terminal)
   if (tty->output)
     {
       tty_send_additional_strings (terminal, Qtty_mode_reset_strings);
+      turn_off_face (tty);
       tty_turn_off_highlight (tty);
       tty_turn_off_insert (tty);
       OUTPUT_IF (tty, tty->TS_end_keypad_mode);
@@ -241,6 +242,67 @@ tty_update_end (struct frame *f)
   fflush (tty->output);
 }
 
+/* Bytes of output per glyph that the output buffer of a terminal
+   makes room for: a character encoded in UTF-8, and a share of the
+   escape sequences for faces and cursor motion.  */
+
+enum { TTY_OUTPUT_BYTES_PER_GLYPH = 8 };
+
+/* Give the output stream of TTY a buffer large enough for a complete
+   update of its frames, so that update_frame sends each update to
+   the terminal in a single write.  Install the buffer in the stream
+   even if it is large enough if REINSTALL, for a stream that was
+   opened again.
+
+   The stream has usually been written to already, and setvbuf is
+   only well-defined before any output; flush the stream first, so
+   that no buffered output is lost when its buffer changes.  */
+
+void
+tty_set_output_buffer (struct tty_display_info *tty, bool reinstall)
+{
+  ptrdiff_t size;
+  char *buffer;
+
+  if (!tty->output)
+    return;
+
+  /* stdout outlives TTY, so it can't use a buffer TTY frees.  */
+  if (tty->output == stdout)
+    {
+      if (reinstall)
+	{
+	  fflush (tty->output);
+	  setvbuf (tty->output, NULL, _IOFBF, BUFSIZ);
+	}
+      return;
+    }
+
+  size = max (BUFSIZ, ((ptrdiff_t) FrameRows (tty) * FrameCols (tty)
+		       * TTY_OUTPUT_BYTES_PER_GLYPH));
+  if (size <= tty->output_buffer_size)
+    {
+      if (reinstall)
+	{
+	  fflush (tty->output);
+	  setvbuf (tty->output, tty->output_buffer, _IOFBF,
+		   tty->output_buffer_size);
+	}
+      return;
+    }
+
+  fflush (tty->output);
+  buffer = xmalloc (size);
+  if (setvbuf (tty->output, buffer, _IOFBF, size) != 0)
+    {
+      xfree (buffer);
+      return;
+    }
+  xfree (tty->output_buffer);
+  tty->output_buffer = buffer;
+  tty->output_buffer_size = size;
+}
+
 /* The implementation of set_terminal_window for termcap frames. */
 
 static void
@@ -362,6 +424,7 @@ tty_show_cursor (struct tty_display_info *tty)
 static void
 tty_background_highlight (struct tty_display_info *tty)
 {
+  turn_off_face (tty);
   if (inverse_video)
     tty_turn_on_highlight (tty);
   else
@@ -763,8 +826,8 @@ tty_write_glyphs (struct frame *f, struct glyph *string, int len)
 	if (string[n].face_id != face_id)
 	  break;
 
-      /* Turn appearance modes of the face of the run on.  */
-      tty_highlight_if_desired (tty);
+      /* Turn appearance modes of the face of the run on.  They stay
+	 on for the next run, until something else is output.  */
       turn_on_face (f, face_id);
 
       if (n == stringlen)
@@ -776,15 +839,12 @@ tty_write_glyphs (struct frame *f, struct glyph *string, int len)
 	  block_input ();
 	  fwrite (conversion_buffer, 1, coding->produced, tty->output);
 	  clearerr (tty->output);
+	  tty->bytes_output += coding->produced;
 	  if (tty->termscript)
 	    fwrite (conversion_buffer, 1, coding->produced, tty->termscript);
 	  unblock_input ();
 	}
       string += n;
-
-      /* Turn appearance modes off.  */
-      turn_off_face (f, face_id);
-      tty_turn_off_highlight (tty);
     }
 
   cmcheckmagic (tty);
@@ -826,7 +886,6 @@ tty_write_glyphs_with_face (register struct frame *f, register struct glyph *str
   coding->mode &= ~CODING_MODE_LAST_BLOCK;
 
   /* Turn appearance modes of the face.  */
-  tty_highlight_if_desired (tty);
   turn_on_face (f, face_id);
 
   coding->mode |= CODING_MODE_LAST_BLOCK;
@@ -836,15 +895,12 @@ tty_write_glyphs_with_face (register struct frame *f, register struct glyph *str
       block_input ();
       fwrite (conversion_buffer, 1, coding->produced, tty->output);
       clearerr (tty->output);
+      tty->bytes_output += coding->produced;
       if (tty->termscript)
 	fwrite (conversion_buffer, 1, coding->produced, tty->termscript);
       unblock_input ();
     }
 
-  /* Turn appearance modes off.  */
-  turn_off_face (f, face_id);
-  tty_turn_off_highlight (tty);
-
   cmcheckmagic (tty);
 }
 #endif
@@ -862,6 +918,9 @@ tty_insert_glyphs (struct frame *f, struct glyph *start, int len)
 
   struct tty_display_info *tty = FRAME_TTY (f);
 
+  /* Inserting may fill with the current background color.  */
+  turn_off_face (tty);
+
   if (tty->TS_ins_multi_chars)
     {
       buf = tparam (tty->TS_ins_multi_chars, 0, 0, len, 0, 0, 0);
@@ -897,7 +956,6 @@ tty_insert_glyphs (struct frame *f, struct glyph *start, int len)
 	}
       else
 	{
-	  tty_highlight_if_desired (tty);
 	  turn_on_face (f, start->face_id);
 	  glyph = start;
 	  ++start;
@@ -921,6 +979,7 @@ tty_insert_glyphs (struct frame *f, struct glyph *start, int len)
 	  block_input ();
 	  fwrite (conversion_buffer, 1, coding->produced, tty->output);
 	  clearerr (tty->output);
+	  tty->bytes_output += coding->produced;
 	  if (tty->termscript)
 	    fwrite (conversion_buffer, 1, coding->produced, tty->termscript);
 	  unblock_input ();
@@ -928,10 +987,7 @@ tty_insert_glyphs (struct frame *f, struct glyph *start, int len)
 
       OUTPUT1_IF (tty, tty->TS_pad_inserted_char);
       if (start)
-	{
-	  turn_off_face (f, glyph->face_id);
-	  tty_turn_off_highlight (tty);
-	}
+	turn_off_face (tty);
     }
 
   cmcheckmagic (tty);
@@ -947,6 +1003,9 @@ tty_delete_glyphs (struct frame *f, int n)
 
   struct tty_display_info *tty = FRAME_TTY (f);
 
+  /* Deleting may fill with the current background color.  */
+  turn_off_face (tty);
+
   if (tty->delete_in_insert_mode)
     {
       tty_turn_on_insert (tty);
@@ -1894,105 +1953,197 @@ #define MAY_USE_WITH_COLORS_P(tty, ATTR)                \
    ? (tty->TN_no_color_video & (ATTR)) == 0             \
    : 1)
 
-/* Turn appearances of face FACE_ID on tty frame F on.
-   FACE_ID is a realized face ID number, in the face cache.  */
+/* Compute in *MODES the appearance modes and colors that
+   turn_on_face turns on in TTY for FACE.  */
 
 static void
-turn_on_face (struct frame *f, int face_id)
+tty_face_modes (struct tty_display_info *tty, struct face *face,
+		struct tty_face_modes *modes)
 {
-  struct face *face = FACE_FROM_ID (f, face_id);
   unsigned long fg = face->foreground;
   unsigned long bg = face->background;
+  bool colors_p = tty->TN_max_colors > 0;
+
+  modes->on = true;
+  modes->reverse
+    = (MAY_USE_WITH_COLORS_P (tty, NC_REVERSE)
+       && (inverse_video
+	   ? fg == FACE_TTY_DEFAULT_FG_COLOR || bg == FACE_TTY_DEFAULT_BG_COLOR
+	   : fg == FACE_TTY_DEFAULT_BG_COLOR || bg == FACE_TTY_DEFAULT_FG_COLOR));
+  modes->bold = face->tty_bold_p && MAY_USE_WITH_COLORS_P (tty, NC_BOLD);
+  modes->italic = (face->tty_italic_p
+		   && MAY_USE_WITH_COLORS_P (tty, NC_ITALIC));
+  modes->underline = (face->tty_underline_p
+		      && MAY_USE_WITH_COLORS_P (tty, NC_UNDERLINE));
+  modes->fg = (colors_p && face_tty_specified_color (fg)
+	       ? fg : FACE_TTY_DEFAULT_COLOR);
+  modes->bg = (colors_p && face_tty_specified_color (bg)
+	       ? bg : FACE_TTY_DEFAULT_COLOR);
+  modes->exit_attribute_mode = (face->tty_bold_p
+				|| face->tty_italic_p
+				|| face->tty_reverse_p
+				|| face->tty_underline_p);
+  modes->orig_pair = (colors_p
+		      && ((fg != FACE_TTY_DEFAULT_COLOR
+			   && fg != FACE_TTY_DEFAULT_FG_COLOR)
+			  || (bg != FACE_TTY_DEFAULT_COLOR
+			      && bg != FACE_TTY_DEFAULT_BG_COLOR)));
+}
+
+static void
+tty_turn_on_italic (struct tty_display_info *tty)
+{
+  if (tty->TS_enter_italic_mode)
+    OUTPUT1 (tty, tty->TS_enter_italic_mode);
+  else
+    /* Italics mode is unavailable on many terminals.  In that case,
+       map slant to dimmed text; we want italic text to appear
+       different and dimming is not otherwise used.  */
+    OUTPUT1 (tty, tty->TS_enter_dim_mode);
+}
+
+/* Set the foreground color of TTY to COLOR if FOREGROUND_P, else the
+   background color.  Do nothing if COLOR is the default color.  */
+
+static void
+tty_set_color (struct tty_display_info *tty, unsigned long color,
+	       bool foreground_p)
+{
+  /* In standout mode, the terminal swaps the colors.  */
+  const char *ts = (tty->standout_mode == foreground_p
+		    ? tty->TS_set_background : tty->TS_set_foreground);
+
+  if (color != FACE_TTY_DEFAULT_COLOR && ts)
+    {
+      char *p = tparam (ts, NULL, 0, color, 0, 0, 0);
+      OUTPUT (tty, p);
+      xfree (p);
+    }
+}
+
+/* Turn appearances of face FACE_ID on tty frame F on.
+   FACE_ID is a realized face ID number, in the face cache.
+
+   The face stays on until turn_off_face is called.  If another face
+   is still on, output only the modes and colors that differ, unless
+   some of its modes must be turned off, which is only possible by
+   turning all of them off.  */
+
+static void
+turn_on_face (struct frame *f, int face_id)
+{
   struct tty_display_info *tty = FRAME_TTY (f);
+  struct tty_face_modes *on = &tty->face_modes;
+  struct tty_face_modes modes;
+
+  tty_face_modes (tty, FACE_FROM_ID (f, face_id), &modes);
+
+  if (on->on)
+    {
+      bool reset_colors_p
+	= ((on->fg != FACE_TTY_DEFAULT_COLOR
+	    && modes.fg == FACE_TTY_DEFAULT_COLOR)
+	   || (on->bg != FACE_TTY_DEFAULT_COLOR
+	       && modes.bg == FACE_TTY_DEFAULT_COLOR));
+
+      if (modes.reverse == on->reverse
+	  && modes.bold >= on->bold
+	  && modes.italic >= on->italic
+	  && modes.underline >= on->underline
+	  && (!reset_colors_p || tty->TS_orig_pair))
+	{
+	  if (modes.bold && !on->bold)
+	    OUTPUT1_IF (tty, tty->TS_enter_bold_mode);
+	  if (modes.italic && !on->italic)
+	    tty_turn_on_italic (tty);
+	  if (modes.underline && !on->underline)
+	    OUTPUT1_IF (tty, tty->TS_enter_underline_mode);
+
+	  if (reset_colors_p)
+	    {
+	      OUTPUT1 (tty, tty->TS_orig_pair);
+	      tty_set_color (tty, modes.fg, true);
+	      tty_set_color (tty, modes.bg, false);
+	    }
+	  else
+	    {
+	      if (modes.fg != on->fg)
+		tty_set_color (tty, modes.fg, true);
+	      if (modes.bg != on->bg)
+		tty_set_color (tty, modes.bg, false);
+	    }
+
+	  modes.exit_attribute_mode |= on->exit_attribute_mode;
+	  modes.orig_pair |= on->orig_pair;
+	  *on = modes;
+	  return;
+	}
+
+      turn_off_face (tty);
+    }
+
+  tty_highlight_if_desired (tty);
 
   /* Use reverse video if the face specifies that.
      Do this first because TS_end_standout_mode may be the same
      as TS_exit_attribute_mode, which turns all appearances off. */
-  if (MAY_USE_WITH_COLORS_P (tty, NC_REVERSE)
-      && (inverse_video
-	  ? fg == FACE_TTY_DEFAULT_FG_COLOR || bg == FACE_TTY_DEFAULT_BG_COLOR
-	  : fg == FACE_TTY_DEFAULT_BG_COLOR || bg == FACE_TTY_DEFAULT_FG_COLOR))
+  if (modes.reverse)
     tty_toggle_highlight (tty);
 
-  if (face->tty_bold_p && MAY_USE_WITH_COLORS_P (tty, NC_BOLD))
+  if (modes.bold)
     OUTPUT1_IF (tty, tty->TS_enter_bold_mode);
 
-  if (face->tty_italic_p && MAY_USE_WITH_COLORS_P (tty, NC_ITALIC))
-    {
-      if (tty->TS_enter_italic_mode)
-	OUTPUT1 (tty, tty->TS_enter_italic_mode);
-      else
-	/* Italics mode is unavailable on many terminals.  In that
-	   case, map slant to dimmed text; we want italic text to
-	   appear different and dimming is not otherwise used.  */
-	OUTPUT1 (tty, tty->TS_enter_dim_mode);
-    }
+  if (modes.italic)
+    tty_turn_on_italic (tty);
 
-  if (face->tty_underline_p && MAY_USE_WITH_COLORS_P (tty, NC_UNDERLINE))
+  if (modes.underline)
     OUTPUT1_IF (tty, tty->TS_enter_underline_mode);
 
-  if (tty->TN_max_colors > 0)
-    {
-      const char *ts;
-      char *p;
-
-      ts = tty->standout_mode ? tty->TS_set_background : tty->TS_set_foreground;
-      if (face_tty_specified_color (fg) && ts)
-	{
-          p = tparam (ts, NULL, 0, fg, 0, 0, 0);
-	  OUTPUT (tty, p);
-	  xfree (p);
-	}
+  tty_set_color (tty, modes.fg, true);
+  tty_set_color (tty, modes.bg, false);
 
-      ts = tty->standout_mode ? tty->TS_set_foreground : tty->TS_set_background;
-      if (face_tty_specified_color (bg) && ts)
-	{
-          p = tparam (ts, NULL, 0, bg, 0, 0, 0);
-	  OUTPUT (tty, p);
-	  xfree (p);
-	}
-    }
+  *on = modes;
 }
 
 
-/* Turn off appearances of face FACE_ID on tty frame F.  */
+/* Turn off the appearances of the face that turn_on_face turned on
+   in TTY, including standout mode, if a face is on.  */
 
 static void
-turn_off_face (struct frame *f, int face_id)
+turn_off_face (struct tty_display_info *tty)
 {
-  struct face *face = FACE_FROM_ID (f, face_id);
-  struct tty_display_info *tty = FRAME_TTY (f);
+  struct tty_face_modes *on = &tty->face_modes;
 
-  if (tty->TS_exit_attribute_mode)
+  if (on->on)
     {
-      /* Capability "me" will turn off appearance modes double-bright,
-	 half-bright, reverse-video, standout, underline.  It may or
-	 may not turn off alt-char-mode.  */
-      if (face->tty_bold_p
-	  || face->tty_italic_p
-	  || face->tty_reverse_p
-	  || face->tty_underline_p)
+      if (tty->TS_exit_attribute_mode)
 	{
-	  OUTPUT1_IF (tty, tty->TS_exit_attribute_mode);
-	  if (strcmp (tty->TS_exit_attribute_mode, tty->TS_end_standout_mode) == 0)
-	    tty->standout_mode = 0;
+	  /* Capability "me" will turn off appearance modes
+	     double-bright, half-bright, reverse-video, standout,
+	     underline.  It may or may not turn off alt-char-mode.  */
+	  if (on->exit_attribute_mode)
+	    {
+	      OUTPUT1_IF (tty, tty->TS_exit_attribute_mode);
+	      if (strcmp (tty->TS_exit_attribute_mode,
+			  tty->TS_end_standout_mode) == 0)
+		tty->standout_mode = 0;
+	    }
+	}
+      else
+	{
+	  /* If we don't have "me" we can only have those appearances
+	     that have exit sequences defined.  */
+	  if (on->underline)
+	    OUTPUT_IF (tty, tty->TS_exit_underline_mode);
 	}
-    }
-  else
-    {
-      /* If we don't have "me" we can only have those appearances
-	 that have exit sequences defined.  */
-      if (face->tty_underline_p)
-	OUTPUT_IF (tty, tty->TS_exit_underline_mode);
-    }
 
-  /* Switch back to default colors.  */
-  if (tty->TN_max_colors > 0
-      && ((face->foreground != FACE_TTY_DEFAULT_COLOR
-	   && face->foreground != FACE_TTY_DEFAULT_FG_COLOR)
-	  || (face->background != FACE_TTY_DEFAULT_COLOR
-	      && face->background != FACE_TTY_DEFAULT_BG_COLOR)))
-    OUTPUT1_IF (tty, tty->TS_orig_pair);
+      /* Switch back to default colors.  */
+      if (on->orig_pair)
+	OUTPUT1_IF (tty, tty->TS_orig_pair);
+
+      tty_turn_off_highlight (tty);
+      on->on = false;
+    }
 }
 
 
@@ -2414,6 +2565,9 @@ tty_draw_row_with_mouse_face (struct window *w, struct glyph_row *row,
     write_glyphs (f, row->glyphs[TEXT_AREA] + start_hpos, nglyphs);
 
   cursor_to (f, save_y, save_x);
+  /* This isn't part of a display update, whose end would turn the
+     face off.  */
+  turn_off_face (tty);
 }
 
 static bool
@@ -4493,6 +4647,7 @@ delete_tty (struct terminal *terminal)
   if (tty->termscript)
     fclose (tty->termscript);
 
+  xfree (tty->output_buffer);
   xfree (tty->old_tty);
   xfree (tty->Wcm);
   xfree (tty);
@@ -36,6 +36,32 @@ #define EMACS_TERMCHAR_H
 
 enum { TERMCAP_BUFFER_SIZE = 4096 };
 
+/* The appearance modes and colors that turn_on_face turned on in a
+   terminal.  They stay on after the glyphs of a face are written, so
+   that switching to the face of the next run of glyphs only needs to
+   output what differs.  */
+
+struct tty_face_modes
+{
+  /* The foreground and background colors as passed to tparam, or
+     FACE_TTY_DEFAULT_COLOR if the face uses the terminal's default.  */
+  unsigned long fg, bg;
+
+  /* True if a face is turned on at all.  */
+  bool_bf on : 1;
+
+  /* True if the face toggled standout mode for reverse video.  */
+  bool_bf reverse : 1;
+
+  bool_bf bold : 1;
+  bool_bf italic : 1;
+  bool_bf underline : 1;
+
+  /* True if turning the face off needs "me" resp. "op".  */
+  bool_bf exit_attribute_mode : 1;
+  bool_bf orig_pair : 1;
+};
+
 /* Parameters that are shared between frames on the same tty device. */
 
 struct tty_display_info
@@ -56,6 +82,14 @@ #define EMACS_TERMCHAR_H
   FILE *termscript;             /* If nonzero, send all terminal output
                                    characters to this stream also.  */
 
+  char *output_buffer;          /* The buffer of OUTPUT, or NULL if it
+                                   still uses the one stdio allocated.  */
+  ptrdiff_t output_buffer_size; /* The size of OUTPUT_BUFFER.  */
+
+  intmax_t bytes_output;        /* Number of bytes written to OUTPUT,
+                                   not counting raw strings sent with
+                                   send-string-to-terminal and the like.  */
+
   struct emacs_tty *old_tty;    /* The initial tty mode bits */
 
   bool_bf term_initted : 1;	/* True if we have been through
@@ -174,6 +208,9 @@ #define EMACS_TERMCHAR_H
   bool_bf insert_mode : 1;	/* True when in insert mode.  */
   bool_bf standout_mode : 1;	/* True when in standout mode.  */
 
+  /* The face turned on by turn_on_face, if any.  */
+  struct tty_face_modes face_modes;
+
   /* 1 if should obey 0200 bit in input chars as "Meta", 2 if should
      keep 0200 bit in input chars.  0 to ignore the 0200 bit.  */
 
@@ -750,6 +750,8 @@ run_thread (void *state)
   self->m_specpdl_ptr = NULL;
   self->m_specpdl_size = 0;
 
+  shrink_fail_arena (&self->m_re_fail_arena, true);
+
   {
     struct handler *c, *c_next;
     for (c = handlerlist_sentinel; c; c = c_next)
@@ -787,11 +789,22 @@ free_search_regs (struct re_registers *regs)
     }
 }
 
+/* Shrink the regexp failure stack storage of every thread; see
+   shrink_fail_arena.  */
+
+void
+shrink_fail_arenas (bool release)
+{
+  for (struct thread_state *iter = all_threads; iter; iter = iter->next_thread)
+    shrink_fail_arena (&iter->m_re_fail_arena, release);
+}
+
 void
 finalize_one_thread (struct thread_state *state)
 {
   free_search_regs (&state->m_search_regs);
   free_search_regs (&state->m_saved_search_regs);
+  xfree (state->m_re_fail_arena.stack);
   sys_cond_destroy (&state->thread_condvar);
 }
 
@@ -134,6 +134,10 @@ #define search_regs (current_thread->m_search_regs)
   struct re_registers m_saved_search_regs;
 #define saved_search_regs (current_thread->m_saved_search_regs)
 
+  /* The failure stack storage of the regexp matcher.  */
+  struct fail_stack_arena m_re_fail_arena;
+#define re_fail_arena (current_thread->m_re_fail_arena)
+
   /* This member is different from waiting_for_input.
      It is used to communicate to a lisp process-filter/sentinel (via the
      function Fwaiting_for_user_input_p) whether Emacs was waiting
@@ -288,6 +292,7 @@ XCONDVAR (Lisp_Object a)
 extern void finalize_one_thread (struct thread_state *state);
 extern void finalize_one_mutex (struct Lisp_Mutex *);
 extern void finalize_one_condvar (struct Lisp_CondVar *);
+extern void shrink_fail_arenas (bool);
 extern void maybe_reacquire_global_lock (void);
 
 extern void init_threads (void);
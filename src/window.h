@@ -209,6 +209,11 @@ #define WINDOW_H_INCLUDED
     /* An alist with parameters.  */
     Lisp_Object window_parameters;
 
+    /* A weak hash table mapping (:memo DEPS FORM) mode line elements
+       to what they last displayed in this window, or nil.  See
+       mode_line_memo in xdisp.c.  */
+    Lisp_Object mode_line_memo;
+
     /* The help echo text for this window.  Qnil if there's none.  */
     Lisp_Object mode_line_help_echo;
 
@@ -278,6 +283,14 @@ #define WINDOW_H_INCLUDED
        window (set up by set_horizontal_scroll_bar).  */
     ptrdiff_t hscroll_whole;
 
+    /* What it took to redisplay this window; see
+       `redisplay-statistics'.  */
+    struct redisplay_stats redisplay_stats;
+
+    /* Lines move_it_to moved over, or NULL; see line_start_cache_for
+       in xdisp.c.  */
+    struct line_start_cache *line_start_cache;
+
     /* Displayed buffer's text modification events counter as of last time
        display completed.  */
     modiff_count last_modified;
@@ -518,6 +531,12 @@ wset_mode_line_help_echo (struct window *w, Lisp_Object val)
   w->mode_line_help_echo = val;
 }
 
+INLINE void
+wset_mode_line_memo (struct window *w, Lisp_Object val)
+{
+  w->mode_line_memo = val;
+}
+
 INLINE void
 wset_new_pixel (struct window *w, Lisp_Object val)
 {
@@ -1203,6 +1222,7 @@ #define CHECK_LIVE_WINDOW(WINDOW)				\
 extern bool window_wants_header_line (struct window *);
 extern bool window_wants_tab_line (struct window *);
 extern int window_internal_height (struct window *);
+extern int window_body_height (struct window *w, bool);
 extern int window_body_width (struct window *w, bool);
 enum margin_unit { MARGIN_IN_LINES, MARGIN_IN_PIXELS };
 extern int window_scroll_margin (struct window *, enum margin_unit);
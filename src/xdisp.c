@@ -550,6 +550,10 @@ fill_column_indicator_column (struct it *it, int char_width)
 static Lisp_Object message_dolog_marker1;
 static Lisp_Object message_dolog_marker2;
 static Lisp_Object message_dolog_marker3;
+
+/* The regexp that Fcurrent_bidi_paragraph_direction uses to skip
+   trailing whitespace, compiled the first time it is needed.  */
+static Lisp_Object trailing_white_space_regexp;
 
 /* The buffer position of the first character appearing entirely or
    partially on the line of the selected window which contains the
@@ -709,6 +713,13 @@ #define MAX_SCRATCH_GLYPHS 100
 
 static int last_height;
 
+/* Incremented when something changes that may change the layout of
+   text without changing the buffer, like face definitions or the
+   variables watched by set-buffer-redisplay.  This invalidates the
+   line start caches of all windows; see line_start_cache_for.  */
+
+static EMACS_INT line_start_cache_generation;
+
 /* True if there's a help-echo in the echo area.  */
 
 bool help_echo_showing_p;
@@ -802,6 +813,7 @@ DEFUN ("set-buffer-redisplay", Fset_buffer_redisplay,
 {
   bset_update_mode_line (current_buffer);
   current_buffer->prevent_redisplay_optimizations_p = true;
+  line_start_cache_generation++;
   return Qnil;
 }
 
@@ -948,6 +960,11 @@ #define CLEAR_IMAGE_CACHE_COUNT	101
 
 bool redisplaying_p;
 
+/* Time spent in fontification-functions during the current
+   redisplay cycle; see fontification-time-budget.  */
+
+static struct timespec fontification_time_used;
+
 /* If a string, XTread_socket generates an event to display that string.
    (The display is done in read_char.)  */
 
@@ -1029,6 +1046,7 @@ #define THIN_SPACE_WIDTH 1
 static void maybe_produce_line_number (struct it *);
 static bool should_produce_line_number (struct it *);
 static bool display_line (struct it *, int);
+static bool display_line_1 (struct it *, int);
 static int display_mode_lines (struct window *);
 static int display_mode_line (struct window *, enum face_id, Lisp_Object);
 static int display_mode_element (struct it *, int, int, int, Lisp_Object,
@@ -3013,6 +3031,234 @@ CHECK_WINDOW_END (struct window *w)
 #endif
 }
 
+/***********************************************************************
+			      Long lines
+ ***********************************************************************/
+
+/* When a buffer has a line longer than `long-line-threshold'
+   characters (see redisplay_window), finding the start of the line
+   around some position, which the iterator does whenever it starts
+   displaying a window or moves back over text, takes time
+   proportional to the length of that line, and so does running the
+   fontification functions, which usually want to look at whole lines.
+   In such a buffer, the iterator therefore pretends that a line starts
+   at most a few windowfuls of text before the position it starts from,
+   and runs the fontification functions with the buffer narrowed to a
+   region of that size.  The boundaries of these regions are multiples
+   of the value of get_narrowed_len, so that they don't move as long as
+   the window size doesn't change.  */
+
+/* Return the number of characters that a screen line of W can show,
+   erring on the large side.  */
+
+static ptrdiff_t
+get_narrowed_width (struct window *w)
+{
+  /* Fonts used on GUI frames can be narrower than the frame's
+     canonical font.  */
+  int fact = FRAME_WINDOW_P (XFRAME (w->frame)) ? 3 : 2;
+  return fact * max (1, window_body_width (w, false));
+}
+
+/* Return the length of the regions of text the iterator looks at in a
+   buffer shown in W that has long lines.  */
+
+static ptrdiff_t
+get_narrowed_len (struct window *w)
+{
+  return get_narrowed_width (w) * max (1, window_body_height (w, false));
+}
+
+/* Return the start of the region around POS in which the iterator
+   looks at the text of W's buffer.  */
+
+static ptrdiff_t
+get_narrowed_begv (struct window *w, ptrdiff_t pos)
+{
+  ptrdiff_t len = get_narrowed_len (w);
+  return max ((pos / len - 1) * len, BEGV);
+}
+
+/* Return the end of the region around POS in which the iterator looks
+   at the text of W's buffer.  */
+
+static ptrdiff_t
+get_narrowed_zv (struct window *w, ptrdiff_t pos)
+{
+  ptrdiff_t len = get_narrowed_len (w);
+  return min ((pos / len + 1) * len, ZV);
+}
+
+/* Return the position before which IT must not look for the start of
+   the line it is in.  */
+
+static ptrdiff_t
+line_start_limit (struct it *it)
+{
+  return (it->narrowed_begv
+	  ? get_narrowed_begv (it->w, IT_CHARPOS (*it))
+	  : BEGV);
+}
+
+DEFUN ("long-line-optimizations-p", Flong_line_optimizations_p,
+       Slong_line_optimizations_p, 0, 0, 0,
+       doc: /* Return non-nil if long-line optimizations are in effect.
+This is so in buffers where redisplay found a line longer than
+`long-line-threshold' characters.  */)
+  (void)
+{
+  return current_buffer->long_line_optimizations_p ? Qt : Qnil;
+}
+
+
+
+/***********************************************************************
+			 Redisplay statistics
+ ***********************************************************************/
+
+/* The statistics summed over all windows.  */
+
+static struct redisplay_stats redisplay_stats_total;
+
+/* Return the statistics of the buffer shown in window W, or NULL if W
+   is NULL or doesn't show a buffer.  */
+
+static struct redisplay_stats *
+buffer_redisplay_stats (struct window *w)
+{
+  struct buffer *b;
+
+  if (!w || !BUFFERP (w->contents))
+    return NULL;
+  b = XBUFFER (w->contents);
+  if (!b->redisplay_stats)
+    b->redisplay_stats = xzalloc (sizeof *b->redisplay_stats);
+  return b->redisplay_stats;
+}
+
+/* Count N events of kind WHICH for window W, for the buffer it shows,
+   and in the totals.  W null means the events can't be attributed to
+   a window, and are only counted in the totals.  */
+
+void
+redisplay_stats_count (struct window *w, enum redisplay_count which, int n)
+{
+  struct redisplay_stats *bstats = buffer_redisplay_stats (w);
+
+  redisplay_stats_total.count[which] += n;
+  if (w)
+    w->redisplay_stats.count[which] += n;
+  if (bstats)
+    bstats->count[which] += n;
+}
+
+/* Add the time elapsed since START to the timer WHICH of window W, of
+   the buffer it shows, and of the totals.  W may be null as for
+   redisplay_stats_count.  */
+
+void
+redisplay_stats_time (struct window *w, enum redisplay_timer which,
+		      struct timespec start)
+{
+  struct timespec elapsed = timespec_sub (current_timespec (), start);
+  struct redisplay_stats *bstats = buffer_redisplay_stats (w);
+
+  redisplay_stats_total.time[which]
+    = timespec_add (redisplay_stats_total.time[which], elapsed);
+  if (w)
+    w->redisplay_stats.time[which]
+      = timespec_add (w->redisplay_stats.time[which], elapsed);
+  if (bstats)
+    bstats->time[which] = timespec_add (bstats->time[which], elapsed);
+}
+
+DEFUN ("redisplay-statistics", Fredisplay_statistics,
+       Sredisplay_statistics, 0, 2, 0,
+       doc: /* Return statistics about the work redisplay did for OBJECT.
+OBJECT can be a live window, a buffer, or t for the totals over all
+windows, and defaults to the selected window.  The statistics of a
+buffer add up those of the windows while they showed it.
+
+The value is a property list with the following properties:
+
+ `:cursor-movement' is the number of times redisplay only had to
+   move the cursor in the window.
+ `:reused-matrix' is the number of times it could reuse the previous
+   display of the window, possibly scrolling it.
+ `:window-id' is the number of times it redisplayed only the lines
+   that changed.
+ `:full' is the number of times it redisplayed the whole window.
+ `:lines' is the number of screen lines it produced.
+ `:lines-reused' is the number of screen lines it didn't have to
+   produce again because their text didn't change.
+ `:rows-updated' is the number of rows it wrote to the screen.
+ `:rows-reused' is the number of rows it didn't have to write because
+   it could copy them from elsewhere on the screen.
+ `:draw-requests' is the number of requests it sent to the X server
+   while writing rows to the screen.  It is always zero on other
+   kinds of frames.
+ `:exposures' is the number of times it redrew a part of the window
+   because that part was exposed, for instance by moving another
+   frame away from it.
+ `:exposed-area' is the area in pixels of the glyphs it redrew then.
+ `:faces-merged' is the number of times it needed the face for text
+   or overlay properties.
+ `:faces-memoized' is the number of those faces it found in the face
+   memo, without merging the properties again.
+ `:bytes-output' is the number of bytes it wrote to text terminals,
+   including escape sequences.  It is always zero on other kinds of
+   frames.
+ `:display-line-time' is the time in seconds it spent producing
+   screen lines, including the time spent in fontification.
+ `:fontification-time' is the time it spent running
+   `fontification-functions'.
+ `:update-time' is the time it spent writing rows to the screen.
+
+On text terminals, frames are written to the screen as a whole, so
+`:rows-updated', `:bytes-output' and `:update-time' only count in the
+totals there, and `:rows-reused' is always zero.  Resetting the totals
+before an update shows how many bytes it sent to the terminal.
+
+If RESET is non-nil, reset the statistics of OBJECT to zero after
+returning them.  */)
+  (Lisp_Object object, Lisp_Object reset)
+{
+  Lisp_Object const count_keys[RSTAT_COUNT_MAX] =
+    {
+      QCcursor_movement, QCreused_matrix, QCwindow_id, QCfull,
+      QClines, QClines_reused, QCrows_updated, QCrows_reused,
+      QCdraw_requests, QCexposures, QCexposed_area, QCfaces_merged,
+      QCfaces_memoized, QCbytes_output
+    };
+  Lisp_Object const time_keys[RSTAT_TIMER_MAX] =
+    {
+      QCdisplay_line_time, QCfontification_time, QCupdate_time
+    };
+  static struct redisplay_stats const no_stats;
+  struct redisplay_stats *stats;
+  Lisp_Object val = Qnil;
+
+  if (EQ (object, Qt))
+    stats = &redisplay_stats_total;
+  else if (BUFFERP (object))
+    stats = XBUFFER (object)->redisplay_stats;
+  else
+    stats = &decode_live_window (object)->redisplay_stats;
+
+  struct redisplay_stats const *s = stats ? stats : &no_stats;
+  for (int i = RSTAT_TIMER_MAX - 1; i >= 0; i--)
+    val = Fcons (time_keys[i],
+		 Fcons (make_float (timespectod (s->time[i])), val));
+  for (int i = RSTAT_COUNT_MAX - 1; i >= 0; i--)
+    val = Fcons (count_keys[i], Fcons (make_int (s->count[i]), val));
+
+  if (!NILP (reset) && stats)
+    memset (stats, 0, sizeof *stats);
+  return val;
+}
+
+
+
 /***********************************************************************
 		       Iterator initialization
  ***********************************************************************/
@@ -3060,11 +3306,13 @@ init_iterator (struct it *it, struct window *w,
 	  face_change = false;
 	  XFRAME (w->frame)->face_change = 0;
 	  free_all_realized_faces (Qnil);
+	  line_start_cache_generation++;
 	}
       else if (XFRAME (w->frame)->face_change)
 	{
 	  XFRAME (w->frame)->face_change = 0;
 	  free_all_realized_faces (w->frame);
+	  line_start_cache_generation++;
 	}
     }
 
@@ -3305,6 +3553,14 @@ init_iterator (struct it *it, struct window *w,
       IT_CHARPOS (*it) = charpos;
       IT_BYTEPOS (*it) = bytepos;
 
+      /* redisplay_window moves point of the current buffer to that
+	 of the window it displays.  */
+      if (current_buffer->long_line_optimizations_p)
+	{
+	  it->narrowed_begv = get_narrowed_begv (w, PT);
+	  it->narrowed_zv = get_narrowed_zv (w, PT);
+	}
+
       /* We will rely on `reseat' to set this up properly, via
 	 handle_face_prop.  */
       it->face_id = it->base_face_id;
@@ -4172,6 +4428,30 @@ handle_fontified_prop (struct it *it)
   if (!NILP (Vmemory_full))
     return handled;
 
+  /* If this redisplay cycle already spent its time budget for
+     fontification, display the text as it is, and let Lisp know that
+     the window needs to be redisplayed again.  A budget that isn't
+     positive would never let anything be fontified, so it means no
+     budget.  Since the time used starts at zero, every cycle calls
+     fontification-functions at least once, and so makes progress.  */
+  if (redisplaying_p
+      && NUMBERP (Vfontification_time_budget)
+      && XFLOATINT (Vfontification_time_budget) > 0
+      && (timespectod (fontification_time_used)
+	  >= XFLOATINT (Vfontification_time_budget))
+      && !STRINGP (it->string)
+      && it->s == NULL
+      && !NILP (Vfontification_functions)
+      && IT_CHARPOS (*it) < Z
+      && NILP (Fget_char_property (make_fixnum (IT_CHARPOS (*it)),
+				   Qfontified, Qnil)))
+    {
+      if (NILP (Fmemq (it->window, Vfontification_deferred_windows)))
+	Vfontification_deferred_windows
+	  = Fcons (it->window, Vfontification_deferred_windows);
+      return handled;
+    }
+
   /* Get the value of the `fontified' property at IT's current buffer
      position.  (The `fontified' property doesn't have a special
      meaning in strings.)  If the value is nil, call functions from
@@ -4191,12 +4471,35 @@ handle_fontified_prop (struct it *it)
       struct buffer *obuf = current_buffer;
       ptrdiff_t begv = BEGV, zv = ZV;
       bool old_clip_changed = current_buffer->clip_changed;
+      struct timespec start = current_timespec ();
 
       val = Vfontification_functions;
       specbind (Qfontification_functions, Qnil);
 
       eassert (it->end_charpos == ZV);
 
+      /* In a buffer with long lines, don't let the fontification
+	 functions look at more than the part of the line around POS
+	 that redisplay looks at.  */
+      if (it->narrowed_begv)
+	{
+	  ptrdiff_t charpos = IT_CHARPOS (*it);
+	  ptrdiff_t narrowed_begv = it->narrowed_begv;
+	  ptrdiff_t narrowed_zv = it->narrowed_zv;
+
+	  if (charpos < narrowed_begv || charpos >= narrowed_zv)
+	    {
+	      narrowed_begv = get_narrowed_begv (it->w, charpos);
+	      narrowed_zv = get_narrowed_zv (it->w, charpos);
+	    }
+	  record_unwind_protect_excursion ();
+	  record_unwind_protect (save_restriction_restore,
+				 save_restriction_save ());
+	  Fnarrow_to_region (make_fixnum (narrowed_begv),
+			     make_fixnum (narrowed_zv));
+	  specbind (Qfont_lock_dont_widen, Qt);
+	}
+
       if (!CONSP (val) || EQ (XCAR (val), Qlambda))
 	safe_call1 (val, pos);
       else
@@ -4231,6 +4534,11 @@ handle_fontified_prop (struct it *it)
 	}
 
       unbind_to (count, Qnil);
+      redisplay_stats_time (it->w, RSTAT_FONTIFICATION_TIME, start);
+      if (redisplaying_p)
+	fontification_time_used
+	  = timespec_add (fontification_time_used,
+			  timespec_sub (current_timespec (), start));
 
       /* Fontification functions routinely call `save-restriction'.
 	 Normally, this tags clip_changed, which can confuse redisplay
@@ -5686,7 +5994,7 @@ handle_single_display_spec (struct it *it, Lisp_Object spec, Lisp_Object object,
       else
 	{
 	  it->what = IT_IMAGE;
-	  it->image_id = lookup_image (it->f, value);
+	  it->image_id = lookup_image_lazily (it->f, value);
 	  it->position = start_pos;
 	  it->object = NILP (object) ? it->w->contents : object;
 	  it->method = GET_FROM_IMAGE;
@@ -6629,15 +6937,17 @@ pop_it (struct it *it)
 			  Moving over lines
  ***********************************************************************/
 
-/* Set IT's current position to the previous line start.  */
+/* Set IT's current position to the previous line start, but not
+   before LIMIT.  */
 
 static void
-back_to_previous_line_start (struct it *it)
+back_to_previous_line_start (struct it *it, ptrdiff_t limit)
 {
   ptrdiff_t cp = IT_CHARPOS (*it), bp = IT_BYTEPOS (*it);
 
   DEC_BOTH (cp, bp);
-  IT_CHARPOS (*it) = find_newline_no_quit (cp, bp, -1, &IT_BYTEPOS (*it));
+  IT_CHARPOS (*it) = find_newline (cp, bp, limit, -1, -1, NULL,
+				   &IT_BYTEPOS (*it), false);
 }
 
 
@@ -6781,11 +7091,13 @@ forward_to_next_line_start (struct it *it, bool *skipped_p,
 static void
 back_to_previous_visible_line_start (struct it *it)
 {
-  while (IT_CHARPOS (*it) > BEGV)
+  ptrdiff_t begv = line_start_limit (it);
+
+  while (IT_CHARPOS (*it) > begv)
     {
-      back_to_previous_line_start (it);
+      back_to_previous_line_start (it, begv);
 
-      if (IT_CHARPOS (*it) <= BEGV)
+      if (IT_CHARPOS (*it) <= begv)
 	break;
 
       /* If selective > 0, then lines indented more than its value are
@@ -6804,7 +7116,7 @@ back_to_previous_visible_line_start (struct it *it)
 	  continue;
       }
 
-      if (IT_CHARPOS (*it) <= BEGV)
+      if (IT_CHARPOS (*it) <= begv)
 	break;
 
       {
@@ -6845,8 +7157,8 @@ back_to_previous_visible_line_start (struct it *it)
 	break;
 
       replaced:
-	if (beg < BEGV)
-	  beg = BEGV;
+	if (beg < begv)
+	  beg = begv;
 	IT_CHARPOS (*it) = beg;
 	IT_BYTEPOS (*it) = buf_charpos_to_bytepos (current_buffer, beg);
       }
@@ -6854,8 +7166,8 @@ back_to_previous_visible_line_start (struct it *it)
 
   it->continuation_lines_width = 0;
 
-  eassert (IT_CHARPOS (*it) >= BEGV);
-  eassert (IT_CHARPOS (*it) == BEGV
+  eassert (IT_CHARPOS (*it) >= begv);
+  eassert (IT_CHARPOS (*it) == begv
 	   || FETCH_BYTE (IT_BYTEPOS (*it) - 1) == '\n');
   CHECK_IT (it);
 }
@@ -8301,9 +8613,11 @@ get_visually_first_element (struct it *it)
       if (string_p)
 	it->bidi_it.charpos = it->bidi_it.bytepos = 0;
       else
-	it->bidi_it.charpos = find_newline_no_quit (IT_CHARPOS (*it),
-						    IT_BYTEPOS (*it), -1,
-						    &it->bidi_it.bytepos);
+	it->bidi_it.charpos = find_newline (IT_CHARPOS (*it),
+					    IT_BYTEPOS (*it),
+					    line_start_limit (it), -1, -1,
+					    NULL, &it->bidi_it.bytepos,
+					    false);
       bidi_paragraph_init (it->paragraph_embedding, &it->bidi_it, true);
       do
 	{
@@ -9712,6 +10026,259 @@ move_it_in_display_line (struct it *it,
 }
 
 
+/* move_it_to remembers the lines it moves over in a cache attached
+   to the iterator's window, so that moving over the same text again,
+   as when paging back and forth through a buffer, doesn't need to lay
+   out those lines again.  An entry describes a line that begins at
+   the start of a line in the buffer, and spans all the screen lines
+   up to the start of the next line in the buffer.  The cache is only
+   valid as long as nothing changes that affects the layout of the
+   text; see line_start_cache_for.  */
+
+/* The base 2 logarithms of the number of entries a cache starts
+   with, and of the most it grows to.  A cache only grows when 3/4 of
+   its entries are used, so windows that don't move over many lines
+   keep a small one.  */
+
+#define LINE_START_CACHE_MIN_BITS 6
+#define LINE_START_CACHE_MAX_BITS 12
+
+struct line_start_cache_entry
+{
+  /* Buffer position where the line starts, or zero if the entry is
+     unused.  */
+  ptrdiff_t charpos;
+
+  /* Position where the next line starts.  */
+  ptrdiff_t end_charpos, end_bytepos;
+
+  /* Total height of the screen lines, the height of the last one of
+     them, and the maximum X coordinate move_it_to reached in them.  */
+  int height, last_height, max_x;
+
+  /* Number of screen lines.  */
+  int nrows;
+};
+
+struct line_start_cache
+{
+  /* What the entries were computed for.  BUFFER is only compared with
+     EQ, and the display table only by address, so
+     mark_line_start_cache keeps them alive, lest another object
+     allocated at the same address looks the same.  Their contents are
+     covered by MODIFF, OVERLAY_MODIFF and CHAR_TABLE_MODIFF.
+     INVISIBILITY_SPEC is a copy of the buffer's, because
+     `remove-from-invisibility-spec' and others change it in place.  */
+  Lisp_Object buffer;
+  modiff_count modiff, overlay_modiff;
+  ptrdiff_t begv, zv;
+  EMACS_INT generation, char_table_modiff;
+  int first_visible_x, last_visible_x, extra_line_spacing, tab_width;
+  enum line_wrap_method line_wrap;
+  bool ctl_arrow_p;
+  struct Lisp_Char_Table *dp;
+  Lisp_Object invisibility_spec;
+
+  /* There are 2**BITS entries, USED of which are in use.  */
+  int bits, used;
+  struct line_start_cache_entry *entries;
+};
+
+/* Return a copy of the invisibility spec SPEC, whose elements are
+   atoms or conses, that doesn't share structure with SPEC.  */
+
+static Lisp_Object
+copy_invisibility_spec (Lisp_Object spec)
+{
+  Lisp_Object copy = Qnil;
+
+  FOR_EACH_TAIL_SAFE (spec)
+    {
+      Lisp_Object elt = XCAR (spec);
+      copy = Fcons (CONSP (elt) ? Fcons (XCAR (elt), XCDR (elt)) : elt,
+		    copy);
+    }
+  return CONSP (copy) ? Fnreverse (copy) : spec;
+}
+
+/* Return the line start cache move_it_to can use for IT, after
+   emptying it if its entries are out of date.  Return NULL if IT
+   lays out text in a way the cache doesn't support.  */
+
+static struct line_start_cache *
+line_start_cache_for (struct it *it)
+{
+  struct window *w = it->w;
+  struct line_start_cache *c;
+  Lisp_Object spec = BVAR (current_buffer, invisibility_spec);
+
+  /* Face remapping can change the size of faces without changing the
+     buffer or the alist's identity, e.g. through `setcdr', so don't
+     use the cache while any is in effect.  */
+  if (!w
+      || !BUFFERP (w->contents)
+      || XBUFFER (w->contents) != current_buffer
+      || current_buffer->long_line_optimizations_p
+      || it->base_face_id != DEFAULT_FACE_ID
+      || it->selective != 0
+      || (it->bidi_p && it->paragraph_embedding != L2R)
+      || !NILP (Vdisplay_line_numbers)
+      || !NILP (Vface_remapping_alist)
+      || face_change
+      || it->f->face_change)
+    return NULL;
+
+  c = w->line_start_cache;
+  if (!c)
+    {
+      c = w->line_start_cache = xzalloc (sizeof *c);
+      c->bits = LINE_START_CACHE_MIN_BITS;
+      c->entries = xzalloc (sizeof *c->entries << c->bits);
+    }
+  else if (EQ (c->buffer, w->contents)
+	   && c->modiff == MODIFF
+	   && c->overlay_modiff == OVERLAY_MODIFF
+	   && c->begv == BEGV
+	   && c->zv == ZV
+	   && c->generation == line_start_cache_generation
+	   && c->char_table_modiff == char_table_modiff
+	   && c->first_visible_x == it->first_visible_x
+	   && c->last_visible_x == it->last_visible_x
+	   && c->extra_line_spacing == it->extra_line_spacing
+	   && c->tab_width == it->tab_width
+	   && c->line_wrap == it->line_wrap
+	   && c->ctl_arrow_p == it->ctl_arrow_p
+	   && c->dp == it->dp
+	   && (EQ (c->invisibility_spec, spec)
+	       || (CONSP (spec)
+		   && !NILP (Fequal (c->invisibility_spec, spec)))))
+    return c;
+  else
+    {
+      memset (c->entries, 0, sizeof *c->entries << c->bits);
+      c->used = 0;
+    }
+
+  c->buffer = w->contents;
+  c->modiff = MODIFF;
+  c->overlay_modiff = OVERLAY_MODIFF;
+  c->begv = BEGV;
+  c->zv = ZV;
+  c->generation = line_start_cache_generation;
+  c->char_table_modiff = char_table_modiff;
+  c->first_visible_x = it->first_visible_x;
+  c->last_visible_x = it->last_visible_x;
+  c->extra_line_spacing = it->extra_line_spacing;
+  c->tab_width = it->tab_width;
+  c->line_wrap = it->line_wrap;
+  c->ctl_arrow_p = it->ctl_arrow_p;
+  c->dp = it->dp;
+  c->invisibility_spec = copy_invisibility_spec (spec);
+  return c;
+}
+
+/* Mark the Lisp objects the line start cache of window W was
+   computed for.  Called from mark_window.  */
+
+void
+mark_line_start_cache (struct window *w)
+{
+  struct line_start_cache *c = w->line_start_cache;
+
+  if (c)
+    {
+      mark_object (c->buffer);
+      mark_object (c->invisibility_spec);
+      if (c->dp)
+	mark_object (make_lisp_ptr (c->dp, Lisp_Vectorlike));
+    }
+}
+
+/* Free the line start cache of window W, if it has one.  */
+
+void
+free_line_start_cache (struct window *w)
+{
+  if (w->line_start_cache)
+    {
+      xfree (w->line_start_cache->entries);
+      xfree (w->line_start_cache);
+      w->line_start_cache = NULL;
+    }
+}
+
+/* Make the line start caches of all windows out of date, because
+   something changed that affects the layout of text, but doesn't
+   modify buffers, like the size of an image.  */
+
+void
+invalidate_line_start_caches (void)
+{
+  line_start_cache_generation++;
+}
+
+/* Return the entry of cache C for a line starting at CHARPOS.
+   Fibonacci hashing spreads lines of equal length over the cache.  */
+
+static struct line_start_cache_entry *
+line_start_cache_entry (struct line_start_cache *c, ptrdiff_t charpos)
+{
+  uint_least32_t h = (uint_least32_t) charpos * 2654435769u;
+  return &c->entries[(h & 0xffffffff) >> (32 - c->bits)];
+}
+
+/* Return the entry of cache C to store a line starting at CHARPOS
+   in, after growing C if it is getting full.  */
+
+static struct line_start_cache_entry *
+line_start_cache_entry_for_store (struct line_start_cache *c,
+				  ptrdiff_t charpos)
+{
+  struct line_start_cache_entry *entry;
+
+  if (c->bits < LINE_START_CACHE_MAX_BITS
+      && c->used >= 3 << (c->bits - 2))
+    {
+      struct line_start_cache_entry *old = c->entries;
+      int i, old_size = 1 << c->bits;
+
+      c->bits++;
+      c->entries = xzalloc (sizeof *c->entries << c->bits);
+      c->used = 0;
+      for (i = 0; i < old_size; i++)
+	if (old[i].charpos)
+	  {
+	    entry = line_start_cache_entry (c, old[i].charpos);
+	    if (!entry->charpos)
+	      c->used++;
+	    *entry = old[i];
+	  }
+      xfree (old);
+    }
+
+  entry = line_start_cache_entry (c, charpos);
+  if (!entry->charpos)
+    c->used++;
+  return entry;
+}
+
+/* Value is true if IT is at the start of a line in the buffer, in
+   the state move_it_to leaves it in after moving over a newline.  */
+
+static bool
+move_it_at_line_start_p (struct it *it)
+{
+  return (it->method == GET_FROM_BUFFER
+	  && it->sp == 0
+	  && it->current_x == 0
+	  && it->hpos == 0
+	  && it->continuation_lines_width == 0
+	  && it->max_ascent == 0
+	  && it->max_descent == 0
+	  && (IT_CHARPOS (*it) == BEGV
+	      || FETCH_BYTE (IT_BYTEPOS (*it) - 1) == '\n'));
+}
+
 /* Move IT forward until it satisfies one or more of the criteria in
    TO_CHARPOS, TO_X, TO_Y, and TO_VPOS.
 
@@ -9724,7 +10291,10 @@ move_it_in_display_line (struct it *it,
    displayed to the right of TO_CHARPOS on the screen.
 
    Return the maximum pixel length of any line scanned but never more
-   than it.last_visible_x.  */
+   than it.last_visible_x.
+
+   Lines that lie completely before the position to move to are looked
+   up in, and added to, the line start cache of IT's window.  */
 
 int
 move_it_to (struct it *it, ptrdiff_t to_charpos, int to_x, int to_y, int to_vpos, int op)
@@ -9734,8 +10304,61 @@ move_it_to (struct it *it, ptrdiff_t to_charpos, int to_x, int to_y, int to_vpos
   int max_current_x = 0;
   void *backup_data = NULL;
 
+  /* The start of the line being moved over, if it is to be added to
+     the line start cache, and where that line began on the display.  */
+  ptrdiff_t line_charpos = -1;
+  int line_y = 0, line_vpos = 0;
+  modiff_count line_modiff = 0, line_overlay_modiff = 0;
+  EMACS_INT line_generation = 0;
+  /* The maximum of MAX_CURRENT_X over lines before that line.  */
+  int max_x_before_line = 0;
+
   for (;;)
     {
+      if ((op & (MOVE_TO_POS | MOVE_TO_Y | MOVE_TO_VPOS)) != 0
+	  && move_it_at_line_start_p (it))
+	{
+	  struct line_start_cache *cache = line_start_cache_for (it);
+	  struct line_start_cache_entry *entry
+	    = (cache
+	       ? line_start_cache_entry (cache, IT_CHARPOS (*it))
+	       : NULL);
+
+	  line_charpos = -1;
+	  if (entry
+	      && entry->charpos == IT_CHARPOS (*it)
+	      /* Leave the last line before the one to stop in to
+		 move_it_in_display_line_to, so that IT describes
+		 the last display element as callers expect.  */
+	      && (!(op & MOVE_TO_POS) || to_charpos > entry->end_charpos)
+	      && ((op & MOVE_TO_VPOS)
+		  ? it->vpos + entry->nrows < to_vpos
+		  : (!(op & MOVE_TO_Y)
+		     || to_y >= it->current_y + entry->height)))
+	    {
+	      struct text_pos pos;
+
+	      SET_TEXT_POS (pos, entry->end_charpos, entry->end_bytepos);
+	      reseat (it, pos, true);
+	      it->current_y += entry->height;
+	      it->vpos += entry->nrows;
+	      last_height = entry->last_height;
+	      max_x_before_line = max (max_x_before_line, entry->max_x);
+	      continue;
+	    }
+	  else if (entry)
+	    {
+	      line_charpos = IT_CHARPOS (*it);
+	      line_y = it->current_y;
+	      line_vpos = it->vpos;
+	      line_modiff = MODIFF;
+	      line_overlay_modiff = OVERLAY_MODIFF;
+	      line_generation = line_start_cache_generation;
+	      max_x_before_line = max (max_x_before_line, max_current_x);
+	      max_current_x = 0;
+	    }
+	}
+
       if (op & MOVE_TO_VPOS)
 	{
 	  /* If no TO_CHARPOS and no TO_X specified, stop at the
@@ -9979,6 +10602,10 @@ move_it_to (struct it *it, ptrdiff_t to_charpos, int to_x, int to_y, int to_vpos
       /* Reset/increment for the next run.  */
       recenter_overlay_lists (current_buffer, IT_CHARPOS (*it));
       it->current_x = line_start_x;
+      /* A line whose screen lines start at a nonzero X can't be
+	 cached, as that depends on OP.  */
+      if (line_start_x != 0)
+	line_charpos = -1;
       line_start_x = 0;
       it->hpos = 0;
       it->line_number_produced_p = false;
@@ -9986,6 +10613,32 @@ move_it_to (struct it *it, ptrdiff_t to_charpos, int to_x, int to_y, int to_vpos
       ++it->vpos;
       last_height = it->max_ascent + it->max_descent;
       it->max_ascent = it->max_descent = 0;
+
+      /* Remember the line just moved over if it ended in a newline,
+	 unless something that affects the layout of the line changed
+	 meanwhile, e.g. because moving over it fontified text.  */
+      if (line_charpos >= 0 && move_it_at_line_start_p (it))
+	{
+	  struct line_start_cache *cache = line_start_cache_for (it);
+
+	  if (cache
+	      && line_modiff == MODIFF
+	      && line_overlay_modiff == OVERLAY_MODIFF
+	      && line_generation == line_start_cache_generation)
+	    {
+	      struct line_start_cache_entry *entry
+		= line_start_cache_entry_for_store (cache, line_charpos);
+
+	      entry->charpos = line_charpos;
+	      entry->end_charpos = IT_CHARPOS (*it);
+	      entry->end_bytepos = IT_BYTEPOS (*it);
+	      entry->height = it->current_y - line_y;
+	      entry->last_height = last_height;
+	      entry->max_x = max_current_x;
+	      entry->nrows = it->vpos - line_vpos;
+	    }
+	  line_charpos = -1;
+	}
     }
 
  out:
@@ -10019,7 +10672,7 @@ move_it_to (struct it *it, ptrdiff_t to_charpos, int to_x, int to_y, int to_vpos
 
   move_trace ("move_it_to: reached %d\n", reached);
 
-  return max_current_x;
+  return max (max_current_x, max_x_before_line);
 }
 
 
@@ -15368,6 +16021,10 @@ redisplay_internal (void)
   count = SPECPDL_INDEX ();
   record_unwind_protect_void (unwind_redisplay);
   redisplaying_p = true;
+  fontification_time_used = make_timespec (0, 0);
+#ifdef HAVE_WINDOW_SYSTEM
+  image_load_time_used = make_timespec (0, 0);
+#endif
   block_buffer_flips ();
   specbind (Qinhibit_free_realized_faces, Qnil);
 
@@ -15678,6 +16335,8 @@ #define AINC(a,i)							\
 	      *w->desired_matrix->method = 0;
 	      debug_method_add (w, "optimization 1");
 #endif
+	      /* Only the line with point was redisplayed.  */
+	      redisplay_stats_count (w, RSTAT_WINDOW_ID, 1);
 #ifdef HAVE_WINDOW_SYSTEM
 	      update_window_fringes (w, false);
 #endif
@@ -15744,6 +16403,7 @@ #define AINC(a,i)							\
 		  *w->desired_matrix->method = 0;
 		  debug_method_add (w, "optimization 3");
 #endif
+		  redisplay_stats_count (w, RSTAT_CURSOR_MOVEMENT, 1);
 		  goto update;
 		}
 	      else
@@ -16112,8 +16772,15 @@ #define AINC(a,i)							\
       clear_image_caches (Qnil);
       clear_image_cache_count = 0;
     }
+
+  /* Keep image caches within image-cache-size-limit.  The current
+     matrices now say which images are displayed.  */
+  limit_image_caches ();
 #endif /* HAVE_WINDOW_SYSTEM */
 
+  /* Likewise for the composition cache.  */
+  limit_composition_cache ();
+
  end_of_redisplay:
 #ifdef HAVE_NS
   ns_set_doc_edited ();
@@ -16325,7 +16992,18 @@ buffer_flipping_blocked_p (void)
 			   Window Redisplay
  ***********************************************************************/
 
-/* Redisplay all leaf windows in the window tree rooted at WINDOW.  */
+/* Redisplay all leaf windows in the window tree rooted at WINDOW.
+
+   The windows are redisplayed one after the other, even when they
+   show different buffers.  Producing glyphs for a window is not
+   independent of other windows: it can run Lisp (fontification
+   functions, :eval mode line elements, window-scroll-functions), it
+   allocates Lisp objects, which the garbage collector doesn't allow
+   from other threads, it realizes faces into the frame's face cache
+   and opens fonts through font backends that are not thread-safe,
+   and it uses global state such as the mode line buffers and
+   displayed_buffer below.  See fontification-time-budget for keeping
+   slow fontification off this path.  */
 
 static void
 redisplay_windows (Lisp_Object window)
@@ -18120,6 +18798,9 @@ redisplay_window (Lisp_Object window, bool just_this_one_p)
   int frame_line_height, margin;
   bool use_desired_matrix;
   void *itdata = NULL;
+  /* How the window was redisplayed, if not by try_window or by
+     reusing the current matrix.  */
+  enum redisplay_count method = RSTAT_FULL;
 
   SET_TEXT_POS (lpoint, PT, PT_BYTE);
   opoint = lpoint;
@@ -18201,6 +18882,34 @@ redisplay_window (Lisp_Object window, bool just_this_one_p)
      variables.  */
   set_buffer_internal_1 (XBUFFER (w->contents));
 
+  /* If the size of the buffer changed by more than a few characters
+     since we last looked, see whether it now has a line that is too
+     long for redisplay to handle in full.  */
+  if (FIXNATP (Vlong_line_threshold)
+      && !current_buffer->long_line_optimizations_p
+      && eabs (Z - current_buffer->long_line_checked_size) > 8)
+    {
+      EMACS_INT threshold = XFIXNAT (Vlong_line_threshold);
+      ptrdiff_t cur = BEG, cur_byte = BEG_BYTE, found;
+
+      /* CUR is a line start.  Look back for a newline from the
+	 character THRESHOLD characters after it; if there is none,
+	 the line is too long, otherwise the next line to check starts
+	 after that newline.  This takes a jump of about THRESHOLD
+	 characters at a time through text with short lines.  */
+      while (Z - cur > threshold)
+	{
+	  cur = find_newline (cur + threshold + 1, -1, cur, cur_byte, -1,
+			      &found, &cur_byte, false);
+	  if (!found)
+	    {
+	      current_buffer->long_line_optimizations_p = true;
+	      break;
+	    }
+	}
+    }
+  current_buffer->long_line_checked_size = Z;
+
   current_matrix_up_to_date_p
     = (w->window_end_valid
        && !current_buffer->clip_changed
@@ -18544,6 +19253,7 @@ redisplay_window (Lisp_Object window, bool just_this_one_p)
 	{
 	case CURSOR_MOVEMENT_SUCCESS:
 	  used_current_matrix_p = true;
+	  method = RSTAT_CURSOR_MOVEMENT;
 	  goto done;
 
 	case CURSOR_MOVEMENT_MUST_SCROLL:
@@ -18577,7 +19287,10 @@ redisplay_window (Lisp_Object window, bool just_this_one_p)
       if (f->fonts_changed)
 	goto need_larger_matrices;
       if (tem > 0)
-	goto done;
+	{
+	  method = RSTAT_WINDOW_ID;
+	  goto done;
+	}
 
       /* Otherwise try_window_id has returned -1 which means that we
 	 don't want the alternative below this comment to execute.  */
@@ -19007,6 +19720,10 @@ redisplay_window (Lisp_Object window, bool just_this_one_p)
 
  done:
 
+  if (method == RSTAT_FULL && used_current_matrix_p)
+    method = RSTAT_REUSED_MATRIX;
+  redisplay_stats_count (w, method, 1);
+
   SET_TEXT_POS_FROM_MARKER (startp, w->start);
   w->start_at_line_beg = (CHARPOS (startp) == BEGV
 			  || FETCH_BYTE (BYTEPOS (startp) - 1) == '\n');
@@ -19210,6 +19927,118 @@ redisplay_window (Lisp_Object window, bool just_this_one_p)
 }
 
 
+/* Copy rows at the top of the current matrix of window W whose text
+   didn't change since W was last displayed to the desired matrix,
+   and move IT, which must be at the start of the display of W, past
+   them.  This saves producing their glyphs again, for instance when
+   only the highlighting of the region changed further down.  Value
+   is the last row copied, or NULL if none could be copied.
+
+   Only rows that end before the first change to the buffer's text,
+   text properties and overlays are copied, and not the last one
+   before that, because line wrapping or the display of text at its
+   end could depend on what follows.  The row containing point isn't
+   copied either, so that display_line sets the cursor.  */
+
+static struct glyph_row *
+copy_unchanged_rows (struct it *it, struct window *w)
+{
+  struct frame *f = XFRAME (w->frame);
+  struct glyph_matrix *matrix = w->current_matrix;
+  struct glyph_row *first_row = MATRIX_FIRST_TEXT_ROW (matrix);
+  struct glyph_row *bottom_row = MATRIX_BOTTOM_TEXT_ROW (matrix, w);
+  struct glyph_row *row, *last_row = NULL;
+  struct buffer *b = current_buffer;
+  ptrdiff_t first_changed_charpos;
+  int nrows;
+
+  if (MINI_WINDOW_P (w)
+      || windows_or_buffers_changed
+      || f->cursor_type_changed
+      || f->fonts_changed
+      || !w->window_end_valid
+      || w->hscroll != 0
+      || w->vscroll != 0
+      || hscrolling_current_line_p (w)
+      || b->clip_changed
+      || b->prevent_redisplay_optimizations_p
+      /* Only the changes since W was last displayed are recorded in
+	 the buffer's unchanged prefix.  */
+      || w->last_modified != BUF_UNCHANGED_MODIFIED (b)
+      || w->last_overlay_modified != BUF_OVERLAY_UNCHANGED_MODIFIED (b)
+      || !NILP (Vshow_trailing_whitespace)
+      || !NILP (Vdisplay_line_numbers)
+      || overlay_arrow_in_current_buffer_p ()
+      || overlay_arrows_changed_p (false)
+      || !NILP (BVAR (b, word_wrap))
+      || !NILP (BVAR (b, extra_line_spacing))
+      /* The paragraph direction could depend on changed text.  */
+      || (!NILP (BVAR (b, bidi_display_reordering))
+	  && NILP (BVAR (b, bidi_paragraph_direction)))
+      || (window_wants_tab_line (w)
+	  != MATRIX_TAB_LINE_ROW (matrix)->mode_line_p)
+      || (window_wants_header_line (w)
+	  != MATRIX_HEADER_LINE_ROW (matrix)->mode_line_p))
+    return NULL;
+
+  /* The first row must start exactly where IT is.  */
+  if (!first_row->enabled_p
+      || MATRIX_ROW_PARTIALLY_VISIBLE_P (w, first_row)
+      || first_row->y != it->current_y
+      || !TEXT_POS_EQUAL_P (first_row->start.pos, it->current.pos)
+      || first_row->start.overlay_string_index >= 0
+      || it->current.overlay_string_index >= 0
+      || first_row->start.dpvec_index >= 0
+      || it->current.dpvec_index >= 0
+      || CHARPOS (first_row->start.string_pos) >= 0
+      || CHARPOS (it->current.string_pos) >= 0
+      || first_row->continuation_lines_width != it->continuation_lines_width
+      || in_ellipses_for_invisible_text_p (&first_row->start, w))
+    return NULL;
+
+  /* Insertions and deletions happen at the gap, so text before it
+     didn't change.  */
+  first_changed_charpos = BEG + min (BEG_UNCHANGED, GPT - BEG);
+
+  for (row = first_row; row + 1 < bottom_row; row++)
+    if (!row->enabled_p
+	|| !MATRIX_ROW_DISPLAYS_TEXT_P (row)
+	|| row->reversed_p
+	|| row->ends_at_zv_p
+	|| MATRIX_ROW_BOTTOM_Y (row) >= it->last_visible_y
+	|| MATRIX_ROW_END_CHARPOS (row) >= PT
+	|| !row[1].enabled_p
+	|| MATRIX_ROW_END_CHARPOS (row + 1) >= first_changed_charpos)
+      break;
+    else
+      last_row = row;
+
+  if (!last_row)
+    return NULL;
+
+  /* Copy the rows, and continue after the last one.  If that's not
+     possible, forget about the rows copied so far.  */
+  struct glyph_row *glyph_row = it->glyph_row;
+  int vpos = it->vpos;
+  for (nrows = 0, row = first_row; row <= last_row; nrows++, row++)
+    if (!copy_glyph_row (glyph_row + nrows, row))
+      break;
+  if (row <= last_row || !init_to_row_end (it, w, last_row))
+    {
+      while (nrows > 0)
+	glyph_row[--nrows].enabled_p = false;
+      start_display (it, w, first_row->start.pos);
+      return NULL;
+    }
+  it->glyph_row = glyph_row + nrows;
+  it->glyph_row->reversed_p = false;
+  it->vpos = vpos + nrows;
+  it->current_y = MATRIX_ROW_BOTTOM_Y (last_row);
+  redisplay_stats_count (w, RSTAT_LINES_REUSED, nrows);
+  return glyph_row + nrows - 1;
+}
+
+
 /* Build the complete desired matrix of WINDOW with a window start
    buffer position POS.
 
@@ -19240,6 +20069,9 @@ try_window (Lisp_Object window, struct text_pos pos, int flags)
   start_display (&it, w, pos);
   it.glyph_row->reversed_p = false;
 
+  /* Reuse what we can of the previous display of W.  */
+  last_text_row = copy_unchanged_rows (&it, w);
+
   /* Display all lines of W.  */
   while (it.current_y < it.last_visible_y)
     {
@@ -22460,7 +23292,7 @@ push_prefix_prop (struct it *it, Lisp_Object prop)
   else if (IMAGEP (prop))
     {
       it->what = IT_IMAGE;
-      it->image_id = lookup_image (it->f, prop);
+      it->image_id = lookup_image_lazily (it->f, prop);
       it->method = GET_FROM_IMAGE;
     }
 #endif /* HAVE_WINDOW_SYSTEM */
@@ -23117,6 +23949,19 @@ row_text_area_empty (struct glyph_row *row)
 
 static bool
 display_line (struct it *it, int cursor_vpos)
+{
+  struct timespec start = current_timespec ();
+  bool val = display_line_1 (it, cursor_vpos);
+
+  redisplay_stats_count (it->w, RSTAT_LINES, 1);
+  redisplay_stats_time (it->w, RSTAT_DISPLAY_LINE_TIME, start);
+  return val;
+}
+
+/* The guts of display_line.  */
+
+static bool
+display_line_1 (struct it *it, int cursor_vpos)
 {
   struct glyph_row *row = it->glyph_row;
   Lisp_Object overlay_arrow_string;
@@ -24099,8 +24944,10 @@ DEFUN ("current-bidi-paragraph-direction", Fcurrent_bidi_paragraph_direction,
 	 the previous non-empty line.  */
       if (pos >= ZV && pos > BEGV)
 	DEC_BOTH (pos, bytepos);
-      AUTO_STRING (trailing_white_space, "[\f\t ]*\n");
-      if (fast_looking_at (trailing_white_space,
+      if (NILP (trailing_white_space_regexp))
+	trailing_white_space_regexp
+	  = compile_regexp (build_string ("[\f\t ]*\n"), Qnil, false);
+      if (fast_looking_at (trailing_white_space_regexp,
 			   pos, bytepos, ZV, ZV_BYTE, Qnil) > 0)
 	{
 	  while ((c = FETCH_BYTE (bytepos)) == '\n'
@@ -25334,6 +26181,69 @@ safe_set_text_properties (ptrdiff_t nargs, Lisp_Object *args)
   return Fset_text_properties (args[0], args[1], args[2], args[3]);
 }
 
+/* Incremented whenever all memoized mode line elements should be
+   recomputed; see Fforce_mode_line_update.  */
+
+EMACS_INT mode_line_memo_tick;
+
+/* Return the mode line element that the element ELT, of the form
+   (:memo DEPS FORM), stands for in window IT->w.  That is the value
+   of FORM, which is evaluated only if there's no value saved for ELT
+   in the window, or if the value of DEPS, the buffer displayed, its
+   text or text properties, whether it is modified, the width of the
+   window or whether it is selected changed since the value was saved.
+
+   The buffer's text is keyed on BUF_MODIFF rather than
+   BUF_CHARS_MODIFF, because mode line code commonly looks at text
+   properties, and at the modified flag, which a change of only text
+   properties can set.  */
+
+static Lisp_Object
+mode_line_memo (struct it *it, Lisp_Object elt)
+{
+  struct window *w = it->w;
+  Lisp_Object deps = safe__eval (true, XCAR (XCDR (elt)));
+  Lisp_Object table = w->mode_line_memo;
+  Lisp_Object state[7];
+
+  if (!FRAME_LIVE_P (it->f))
+    return Qnil;
+
+  state[0] = deps;
+  state[1] = Fcurrent_buffer ();
+  state[2] = make_int (BUF_MODIFF (current_buffer));
+  state[3] = make_int (BUF_SAVE_MODIFF (current_buffer));
+  state[4] = make_fixnum (WINDOW_TOTAL_COLS (w));
+  state[5] = EQ (it->window, selected_window) ? Qt : Qnil;
+  state[6] = make_int (mode_line_memo_tick);
+
+  if (HASH_TABLE_P (table))
+    {
+      Lisp_Object old = Fgethash (elt, table, Qnil);
+      int i;
+
+      if (VECTORP (old))
+	{
+	  for (i = 0; i < ARRAYELTS (state); i++)
+	    if (NILP (Fequal (AREF (old, i), state[i])))
+	      break;
+	  if (i == ARRAYELTS (state))
+	    return AREF (old, i);
+	}
+    }
+  else
+    {
+      table = CALLN (Fmake_hash_table, QCtest, Qeq, QCweakness, Qkey);
+      wset_mode_line_memo (w, table);
+    }
+
+  Lisp_Object value = safe__eval (true, XCAR (XCDR (XCDR (elt))));
+  Fputhash (elt, CALLN (Fvector, state[0], state[1], state[2], state[3],
+			state[4], state[5], state[6], value),
+	    table);
+  return value;
+}
+
 /* Contribute ELT to the mode line for window IT->w.  How it
    translates into text depends on its data type.
 
@@ -25697,6 +26607,26 @@ display_mode_element (struct it *it, int depth, int field_width, int precision,
 					   risky);
 	      }
 	  }
+	else if (EQ (car, QCmemo))
+	  {
+	    /* An element of the form (:memo DEPS FORM) is like
+	       (:eval FORM), but reuses the value of FORM while DEPS
+	       and the state of the window don't change.  */
+
+	    if (risky)
+	      break;
+
+	    if (CONSP (XCDR (elt)) && CONSP (XCDR (XCDR (elt))))
+	      {
+		Lisp_Object spec = mode_line_memo (it, elt);
+		if (!FRAME_LIVE_P (it->f))
+		  signal_error (":memo deleted the frame being displayed",
+				elt);
+		n += display_mode_element (it, depth, field_width - n,
+					   precision - n, spec, props,
+					   risky);
+	      }
+	  }
 	else if (EQ (car, QCpropertize))
 	  {
 	    /* An element of the form (:propertize ELT PROPS...)
@@ -26726,6 +27656,8 @@ display_count_lines (ptrdiff_t start_byte,
 {
   register unsigned char *cursor;
   unsigned char *base;
+  /* Block skipping is known not to help on this side of NOSKIP.  */
+  unsigned char *noskip;
 
   register ptrdiff_t ceiling;
   register unsigned char *ceiling_addr;
@@ -26745,6 +27677,7 @@ display_count_lines (ptrdiff_t start_byte,
 	  ceiling = min (limit_byte - 1, ceiling);
 	  ceiling_addr = BYTE_POS_ADDR (ceiling) + 1;
 	  base = (cursor = BYTE_POS_ADDR (start_byte));
+	  noskip = cursor;
 
 	  do
 	    {
@@ -26758,6 +27691,18 @@ display_count_lines (ptrdiff_t start_byte,
 		}
 	      else
 		{
+		  /* Count whole blocks of newlines when that can't
+		     take us past the COUNTth one.  */
+		  if (count > 1 && cursor >= noskip)
+		    {
+		      cursor += skip_newlines_forward (cursor,
+						       ceiling_addr - cursor,
+						       &count);
+		      noskip = cursor + min (ceiling_addr - cursor,
+					     NEWLINE_BLOCK_SIZE);
+		      if (cursor == ceiling_addr)
+			break;
+		    }
 		  cursor = memchr (cursor, '\n', ceiling_addr - cursor);
 		  if (! cursor)
 		    break;
@@ -26785,6 +27730,7 @@ display_count_lines (ptrdiff_t start_byte,
 	  ceiling = max (limit_byte, ceiling);
 	  ceiling_addr = BYTE_POS_ADDR (ceiling);
 	  base = (cursor = BYTE_POS_ADDR (start_byte - 1) + 1);
+	  noskip = cursor;
 	  while (true)
 	    {
 	      if (selective_display)
@@ -26797,6 +27743,18 @@ display_count_lines (ptrdiff_t start_byte,
 		}
 	      else
 		{
+		  if (count < -1 && cursor <= noskip)
+		    {
+		      ptrdiff_t want = - count;
+		      cursor -= skip_newlines_backward (cursor,
+							cursor - ceiling_addr,
+							&want);
+		      count = - want;
+		      noskip = cursor - min (cursor - ceiling_addr,
+					     NEWLINE_BLOCK_SIZE);
+		      if (cursor == ceiling_addr)
+			break;
+		    }
 		  cursor = memrchr (ceiling_addr, '\n', cursor - ceiling_addr);
 		  if (! cursor)
 		    break;
@@ -27590,7 +28548,7 @@ get_char_face_and_encoding (struct frame *f, int c, int face_id,
 
   if (face->font)
     {
-      code = face->font->driver->encode_char (face->font, c);
+      code = font_glyph_code (face->font, c);
 
       if (code == FONT_INVALID_CODE)
 	code = 0;
@@ -27633,7 +28591,7 @@ get_glyph_face_and_encoding (struct frame *f, struct glyph *glyph,
       if (CHAR_BYTE8_P (glyph->u.ch))
 	code = CHAR_TO_BYTE8 (glyph->u.ch);
       else
-	code = face->font->driver->encode_char (face->font, glyph->u.ch);
+	code = font_glyph_code (face->font, glyph->u.ch);
 
       if (code == FONT_INVALID_CODE)
 	code = 0;
@@ -27656,7 +28614,7 @@ get_char_glyph_code (int c, struct font *font, unsigned *char2b)
   if (CHAR_BYTE8_P (c))
     code = CHAR_TO_BYTE8 (c);
   else
-    code = font->driver->encode_char (font, c);
+    code = font_glyph_code (font, c);
 
   if (code == FONT_INVALID_CODE)
     return false;
@@ -27964,7 +28922,7 @@ get_per_char_metric (struct font *font, const unsigned *char2b)
   if (*char2b == FONT_INVALID_CODE)
     return NULL;
 
-  font->driver->text_extents (font, char2b, 1, &metrics);
+  font_glyph_metrics (font, *char2b, &metrics);
   return &metrics;
 }
 
@@ -33758,9 +34716,10 @@ cancel_mouse_face (struct frame *f)
 #ifdef HAVE_WINDOW_SYSTEM
 
 /* Redraw the part of glyph row area AREA of glyph row ROW on window W
-   which intersects rectangle R.  R is in window-relative coordinates.  */
+   which intersects rectangle R.  R is in window-relative coordinates.
+   Value is the width in pixels of the glyphs redrawn.  */
 
-static void
+static int
 expose_area (struct window *w, struct glyph_row *row, const Emacs_Rectangle *r,
 	     enum glyph_row_area area)
 {
@@ -33769,29 +34728,37 @@ expose_area (struct window *w, struct glyph_row *row, const Emacs_Rectangle *r,
   struct glyph *last;
   int first_x, start_x, x;
 
-  if (area == TEXT_AREA && row->fill_line_p)
-    /* If row extends face to end of line write the whole line.  */
-    draw_glyphs (w, row->x, row, area,
-		 0, row->used[area],
-		 DRAW_NORMAL_TEXT, 0);
-  else
+  /* Set START_X to the window-relative start position for drawing
+     glyphs of AREA.  The first glyph of the text area can be partially
+     visible.  The first glyphs of other areas cannot.  */
+  start_x = window_box_left_offset (w, area);
+  x = start_x;
+  if (area == TEXT_AREA)
+    x += row->x;
+
+  /* Find the first glyph that must be redrawn.  */
+  while (first < end
+	 && x + first->pixel_width < r->x)
     {
-      /* Set START_X to the window-relative start position for drawing glyphs of
-	 AREA.  The first glyph of the text area can be partially visible.
-	 The first glyphs of other areas cannot.  */
-      start_x = window_box_left_offset (w, area);
-      x = start_x;
-      if (area == TEXT_AREA)
-	x += row->x;
+      x += first->pixel_width;
+      ++first;
+    }
 
-      /* Find the first glyph that must be redrawn.  */
-      while (first < end
-	     && x + first->pixel_width < r->x)
+  if (area == TEXT_AREA && row->fill_line_p)
+    {
+      /* If row extends face to end of line, the face is drawn along
+	 with the last glyph, so redraw the glyphs up to the end.  */
+      if (first == end)
 	{
-	  x += first->pixel_width;
-	  ++first;
+	  --first;
+	  x -= first->pixel_width;
 	}
-
+      first_x = x;
+      for (last = first; last < end; ++last)
+	x += last->pixel_width;
+    }
+  else
+    {
       /* Find the last one.  */
       last = first;
       first_x = x;
@@ -33804,13 +34771,14 @@ expose_area (struct window *w, struct glyph_row *row, const Emacs_Rectangle *r,
 	  x += last->pixel_width;
 	  ++last;
 	}
-
-      /* Repaint.  */
-      if (last > first)
-	draw_glyphs (w, first_x - start_x, row, area,
-		     first - row->glyphs[area], last - row->glyphs[area],
-		     DRAW_NORMAL_TEXT, 0);
     }
+
+  /* Repaint.  */
+  if (last > first)
+    draw_glyphs (w, first_x - start_x, row, area,
+		 first - row->glyphs[area], last - row->glyphs[area],
+		 DRAW_NORMAL_TEXT, 0);
+  return x - first_x;
 }
 
 
@@ -33821,22 +34789,28 @@ expose_area (struct window *w, struct glyph_row *row, const Emacs_Rectangle *r,
 static bool
 expose_line (struct window *w, struct glyph_row *row, const Emacs_Rectangle *r)
 {
+  int width = 0;
+
   eassert (row->enabled_p);
 
   if (row->mode_line_p || w->pseudo_window_p)
-    draw_glyphs (w, 0, row, TEXT_AREA,
-		 0, row->used[TEXT_AREA],
-		 DRAW_NORMAL_TEXT, 0);
+    {
+      draw_glyphs (w, 0, row, TEXT_AREA,
+		   0, row->used[TEXT_AREA],
+		   DRAW_NORMAL_TEXT, 0);
+      width = row->pixel_width;
+    }
   else
     {
       if (row->used[LEFT_MARGIN_AREA])
-	expose_area (w, row, r, LEFT_MARGIN_AREA);
+	width += expose_area (w, row, r, LEFT_MARGIN_AREA);
       if (row->used[TEXT_AREA])
-	expose_area (w, row, r, TEXT_AREA);
+	width += expose_area (w, row, r, TEXT_AREA);
       if (row->used[RIGHT_MARGIN_AREA])
-	expose_area (w, row, r, RIGHT_MARGIN_AREA);
+	width += expose_area (w, row, r, RIGHT_MARGIN_AREA);
       draw_row_fringe_bitmaps (w, row);
     }
+  redisplay_stats_count (w, RSTAT_EXPOSED_AREA, width * row->visible_height);
 
   return row->mouse_face_p;
 }
@@ -34082,6 +35056,7 @@ expose_window (struct window *w, const Emacs_Rectangle *fr)
 
       redisplay_trace ("expose_window (%d, %d, %u, %u)\n",
 		       r.x, r.y, r.width, r.height);
+      redisplay_stats_count (w, RSTAT_EXPOSURES, 1);
 
       /* Convert to window coordinates.  */
       r.x -= WINDOW_LEFT_EDGE_X (w);
@@ -34320,6 +35295,118 @@ expose_frame (struct frame *f, int x, int y, int w, int h)
 }
 
 
+/* Return the area of rectangle R.  */
+
+static intmax_t
+rectangle_area (const Emacs_Rectangle *r)
+{
+  return (intmax_t) r->width * r->height;
+}
+
+/* Store the smallest rectangle containing rectangles R1 and R2 in
+   RESULT.  */
+
+static void
+union_rectangles (const Emacs_Rectangle *r1, const Emacs_Rectangle *r2,
+		  Emacs_Rectangle *result)
+{
+  int x = min (r1->x, r2->x), y = min (r1->y, r2->y);
+
+  result->width = max (r1->x + r1->width, r2->x + r2->width) - x;
+  result->height = max (r1->y + r1->height, r2->y + r2->height) - y;
+  result->x = x;
+  result->y = y;
+}
+
+
+/* EXPORT:
+   Note that the area of frame F at X, Y with width W and height H was
+   exposed, without redrawing it yet.  All are pixel values.  W or H
+   zero means the entire frame.
+
+   F's damage region remembers the exposed areas as a few rectangles,
+   clipped to the frame.  A rectangle that overlaps one already there
+   is merged with it, unless their union would cover more than the two
+   rectangles do; if there are too many rectangles, the two whose
+   union adds the least area are merged.  A burst of exposures, as
+   when a child frame moves over F, thus redraws each part of F only
+   once when flush_frame_damage is called.  */
+
+void
+expose_frame_damage (struct frame *f, int x, int y, int w, int h)
+{
+  Emacs_Rectangle frame_rect, r;
+
+  frame_rect.x = frame_rect.y = 0;
+  frame_rect.width = FRAME_PIXEL_WIDTH (f);
+  frame_rect.height = FRAME_PIXEL_HEIGHT (f);
+  if (w == 0 || h == 0)
+    r = frame_rect;
+  else
+    {
+      Emacs_Rectangle exposed;
+
+      exposed.x = x;
+      exposed.y = y;
+      exposed.width = w;
+      exposed.height = h;
+      if (!gui_intersect_rectangles (&exposed, &frame_rect, &r))
+	return;
+    }
+
+  for (;;)
+    {
+      int i, best = -1;
+      intmax_t best_growth = INTMAX_MAX;
+      Emacs_Rectangle u;
+
+      for (i = 0; i < f->n_damage; i++)
+	{
+	  union_rectangles (&r, &f->damage[i], &u);
+	  intmax_t growth = (rectangle_area (&u) - rectangle_area (&r)
+			     - rectangle_area (&f->damage[i]));
+	  if (growth <= 0 || (f->n_damage == ARRAYELTS (f->damage)
+			      && growth < best_growth))
+	    {
+	      best = i;
+	      best_growth = growth;
+	      if (growth <= 0)
+		break;
+	    }
+	}
+
+      if (best < 0)
+	break;
+
+      /* Merge R with the rectangle at BEST and try again, as the
+	 union may now overlap other rectangles.  */
+      union_rectangles (&r, &f->damage[best], &r);
+      f->damage[best] = f->damage[--f->n_damage];
+    }
+
+  f->damage[f->n_damage++] = r;
+}
+
+
+/* EXPORT:
+   Redraw the parts of frame F that expose_frame_damage noted as
+   exposed.  */
+
+void
+flush_frame_damage (struct frame *f)
+{
+  Emacs_Rectangle damage[ARRAYELTS (f->damage)];
+  int n = f->n_damage;
+
+  /* Empty the region first, in case redrawing adds to it.  */
+  memcpy (damage, f->damage, n * sizeof *damage);
+  f->n_damage = 0;
+  for (int i = 0; i < n && !FRAME_GARBAGED_P (f); i++)
+    expose_frame (f, damage[i].x, damage[i].y,
+		  damage[i].width, damage[i].height);
+}
+
+
 /* EXPORT:
    Determine the intersection of two rectangles R1 and R2.  Return
    the intersection in *RESULT.  Value is true if RESULT is not
@@ -34412,6 +35499,9 @@ syms_of_xdisp (void)
   message_dolog_marker3 = Fmake_marker ();
   staticpro (&message_dolog_marker3);
 
+  trailing_white_space_regexp = Qnil;
+  staticpro (&trailing_white_space_regexp);
+
   defsubr (&Sset_buffer_redisplay);
 #ifdef GLYPH_DEBUG
   defsubr (&Sdump_frame_glyph_matrix);
@@ -34429,6 +35519,8 @@ syms_of_xdisp (void)
 #endif
   defsubr (&Sline_pixel_height);
   defsubr (&Sformat_mode_line);
+  defsubr (&Slong_line_optimizations_p);
+  defsubr (&Sredisplay_statistics);
   defsubr (&Sinvisible_p);
   defsubr (&Scurrent_bidi_paragraph_direction);
   defsubr (&Swindow_text_pixel_size);
@@ -34460,10 +35552,31 @@ syms_of_xdisp (void)
   DEFSYM (QCrelative_width, ":relative-width");
   DEFSYM (QCrelative_height, ":relative-height");
   DEFSYM (QCeval, ":eval");
+  DEFSYM (QCmemo, ":memo");
   DEFSYM (QCpropertize, ":propertize");
   DEFSYM (QCfile, ":file");
   DEFSYM (Qfontified, "fontified");
   DEFSYM (Qfontification_functions, "fontification-functions");
+  DEFSYM (Qfont_lock_dont_widen, "font-lock-dont-widen");
+
+  /* Properties returned by `redisplay-statistics'.  */
+  DEFSYM (QCcursor_movement, ":cursor-movement");
+  DEFSYM (QCreused_matrix, ":reused-matrix");
+  DEFSYM (QCwindow_id, ":window-id");
+  DEFSYM (QCfull, ":full");
+  DEFSYM (QClines, ":lines");
+  DEFSYM (QClines_reused, ":lines-reused");
+  DEFSYM (QCrows_updated, ":rows-updated");
+  DEFSYM (QCrows_reused, ":rows-reused");
+  DEFSYM (QCdraw_requests, ":draw-requests");
+  DEFSYM (QCexposures, ":exposures");
+  DEFSYM (QCexposed_area, ":exposed-area");
+  DEFSYM (QCfaces_merged, ":faces-merged");
+  DEFSYM (QCfaces_memoized, ":faces-memoized");
+  DEFSYM (QCbytes_output, ":bytes-output");
+  DEFSYM (QCdisplay_line_time, ":display-line-time");
+  DEFSYM (QCfontification_time, ":fontification-time");
+  DEFSYM (QCupdate_time, ":update-time");
 
   /* Name of the symbol which disables Lisp evaluation in 'display'
      properties.  This is used by enriched.el.  */
@@ -34915,6 +36028,48 @@ syms_of_xdisp (void)
   Vfontification_functions = Qnil;
   Fmake_variable_buffer_local (Qfontification_functions);
 
+  DEFVAR_LISP ("fontification-time-budget", Vfontification_time_budget,
+    doc: /* Maximum time, in seconds, a redisplay cycle spends fontifying.
+If this is a number, redisplay stops running `fontification-functions'
+once it has spent this much time in them during one redisplay cycle.
+It displays the rest of the text that still needs fontification as it
+is, usually in the default face, and adds the windows showing such text
+to `fontification-deferred-windows'.  JIT Lock mode then redisplays
+these windows when Emacs is idle, one redisplay cycle at a time, until
+they are completely fontified or input arrives; set this variable before
+turning on JIT Lock mode, which only arranges for that when this is a
+positive number.
+If nil, or not a positive number, redisplay always fontifies the text it
+displays.  */);
+  Vfontification_time_budget = Qnil;
+
+  DEFVAR_LISP ("fontification-deferred-windows",
+	       Vfontification_deferred_windows,
+    doc: /* Windows whose fontification redisplay deferred.
+Redisplay adds a window to this list when it displays the window
+without fontifying all of its text because it used up
+`fontification-time-budget'.  Whoever redisplays the window again
+should remove it from the list.  */);
+  Vfontification_deferred_windows = Qnil;
+
+  DEFVAR_LISP ("long-line-threshold", Vlong_line_threshold,
+    doc: /* Line length above which redisplay bounds the work it does per line.
+When redisplay finds a line longer than this many characters in a
+buffer, it turns on long-line optimizations in that buffer: it no
+longer looks for the real start of a line more than a few windowfuls
+of text before the text it displays, and runs `fontification-functions'
+with the buffer narrowed to a region of that size and with
+`font-lock-dont-widen' bound to t.  The function
+`long-line-optimizations-p' tells whether this happened.
+
+This can make continuation lines of a long line start at different
+positions, and fontification that depends on distant text less
+accurate.  The optimizations stay on until the buffer is erased or
+killed.
+
+Nil means never turn on long-line optimizations.  */);
+  Vlong_line_threshold = make_fixnum (10000);
+
   DEFVAR_BOOL ("unibyte-display-via-language-environment",
                unibyte_display_via_language_environment,
     doc: /* Non-nil means display unibyte text according to language environment.
@@ -2297,6 +2297,12 @@ merge_named_face (struct window *w,
     return false;
 }
 
+/* The number of face filters evaluated so far.  Faces that depend on
+   a filter, and thus on the window, aren't remembered in the face
+   memo.  */
+
+static uintmax_t face_filters_evaluated;
+
 /* Determine whether the face filter FILTER evaluated in window W
    matches.  W can be NULL if the window context is unknown.
 
@@ -2314,6 +2320,8 @@ evaluate_face_filter (Lisp_Object filter, struct window *w,
 {
   Lisp_Object orig_filter = filter;
 
+  face_filters_evaluated++;
+
   /* Inner braces keep compiler happy about the goto skipping variable
      initialization.  */
   {
@@ -4508,6 +4516,8 @@ make_face_cache (struct frame *f)
   c->used = 0;
   c->faces_by_id = xmalloc (c->size * sizeof *c->faces_by_id);
   c->f = f;
+  c->memo = NULL;
+  c->memo_generation = 1;
   c->menu_face_changed_p = menu_face_changed_default;
   return c;
 }
@@ -4555,6 +4565,9 @@ free_realized_faces (struct face_cache *c)
       int i, size;
       struct frame *f = c->f;
 
+      /* Forget the faces remembered in the face memo.  */
+      c->memo_generation++;
+
       /* We must block input here because we can't process X events
 	 safely while only some faces are freed, or when the frame's
 	 current matrix still references freed faces.  */
@@ -4616,6 +4629,7 @@ free_face_cache (struct face_cache *c)
       free_realized_faces (c);
       xfree (c->buckets);
       xfree (c->faces_by_id);
+      xfree (c->memo);
       xfree (c);
     }
 }
@@ -4714,6 +4728,9 @@ uncache_face (struct face_cache *c, struct face *face)
   c->faces_by_id[face->id] = NULL;
   if (face->id == c->used)
     --c->used;
+
+  /* The face memo might remember FACE.  */
+  c->memo_generation++;
 }
 
 
@@ -6253,6 +6270,143 @@ compute_char_face (struct frame *f, int ch, Lisp_Object prop)
   return face_id;
 }
 
+/* Return true if the face property REF can be remembered in the face
+   memo.  That is the case for face names and for lists of face names
+   and attributes that don't contain lists or vectors, which could be
+   changed in place.  */
+
+static bool
+face_memo_ref_p (Lisp_Object ref)
+{
+  if (SYMBOLP (ref))
+    return true;
+
+  Lisp_Object tail = ref;
+  FOR_EACH_TAIL_SAFE (tail)
+    if (CONSP (XCAR (tail)) || VECTORLIKEP (XCAR (tail)))
+      return false;
+  return CONSP (ref) && NILP (tail);
+}
+
+/* Return true if the face property REF is the same as MEMO_REF, which
+   is remembered in the face memo.  */
+
+static bool
+face_memo_ref_equal (Lisp_Object memo_ref, Lisp_Object ref)
+{
+  if (SYMBOLP (memo_ref))
+    return EQ (memo_ref, ref);
+
+  for (; CONSP (memo_ref) && CONSP (ref);
+       memo_ref = XCDR (memo_ref), ref = XCDR (ref))
+    if (!EQ (XCAR (memo_ref), XCAR (ref)))
+      return false;
+  return NILP (memo_ref) && NILP (ref);
+}
+
+/* Return the entry of the face memo of frame F for merging the NREFS
+   face properties REFS into the face with ID BASE_FACE_ID, using
+   ATTR_FILTER.  Return NULL if the resulting face can't be
+   remembered.  */
+
+static struct face_memo_entry *
+face_memo_entry (struct frame *f, Lisp_Object const *refs, ptrdiff_t nrefs,
+		 int base_face_id, enum lface_attribute_index attr_filter)
+{
+  struct face_cache *c = FRAME_FACE_CACHE (f);
+  EMACS_UINT hash = sxhash_combine (base_face_id, attr_filter);
+  ptrdiff_t i;
+
+  /* Faces that were changed are freed by the next init_iterator.
+     Until then, merging them gives other faces than the ones
+     remembered.  `face-remapping-alist' is usually changed in place,
+     so faces aren't remembered while it is in effect.  */
+  if (nrefs > FACE_MEMO_REFS
+      || face_change
+      || f->face_change
+      || !NILP (Vface_remapping_alist))
+    return NULL;
+
+  for (i = 0; i < nrefs; i++)
+    {
+      if (!face_memo_ref_p (refs[i]))
+	return NULL;
+      if (SYMBOLP (refs[i]))
+	hash = sxhash_combine (hash, XHASH (refs[i]));
+      else
+	{
+	  Lisp_Object tail;
+	  for (tail = refs[i]; CONSP (tail); tail = XCDR (tail))
+	    hash = sxhash_combine (hash, XHASH (XCAR (tail)));
+	}
+    }
+
+  if (!c->memo)
+    c->memo = xzalloc (FACE_MEMO_SIZE * sizeof *c->memo);
+  return &c->memo[hash % FACE_MEMO_SIZE];
+}
+
+/* Return the ID of the face for merging the NREFS face properties
+   REFS into BASE_FACE in window W, using ATTR_FILTER.  Nil elements
+   of REFS are ignored.  Look the face up in the face memo of W's
+   frame first, and remember it there if possible.  */
+
+static int
+lookup_merged_face (struct window *w, Lisp_Object const *refs,
+		    ptrdiff_t nrefs, struct face *base_face,
+		    enum lface_attribute_index attr_filter)
+{
+  struct frame *f = XFRAME (w->frame);
+  struct face_cache *c = FRAME_FACE_CACHE (f);
+  Lisp_Object attrs[LFACE_VECTOR_SIZE];
+  struct face_memo_entry *e
+    = face_memo_entry (f, refs, nrefs, base_face->id, attr_filter);
+  uintmax_t filters_evaluated = face_filters_evaluated;
+  ptrdiff_t i;
+  int face_id;
+
+  redisplay_stats_count (w, RSTAT_FACES_MERGED, 1);
+
+  if (e
+      && e->generation == c->memo_generation
+      && e->base_face_id == base_face->id
+      && e->attr_filter == attr_filter
+      && e->nrefs == nrefs
+      && FACE_FROM_ID_OR_NULL (f, e->face_id))
+    {
+      for (i = 0; i < nrefs; i++)
+	if (!face_memo_ref_equal (e->refs[i], refs[i]))
+	  break;
+      if (i == nrefs)
+	{
+	  redisplay_stats_count (w, RSTAT_FACES_MEMOIZED, 1);
+	  return e->face_id;
+	}
+    }
+
+  memcpy (attrs, base_face->lface, sizeof attrs);
+  for (i = 0; i < nrefs; i++)
+    if (!NILP (refs[i]))
+      merge_face_ref (w, f, refs[i], attrs, true, NULL, attr_filter);
+
+  /* Look up a realized face with the given face attributes,
+     or realize a new one for ASCII characters.  */
+  face_id = lookup_face (f, attrs);
+
+  if (e && face_filters_evaluated == filters_evaluated)
+    {
+      for (i = 0; i < nrefs; i++)
+	e->refs[i] = CONSP (refs[i]) ? Fcopy_sequence (refs[i]) : refs[i];
+      e->nrefs = nrefs;
+      e->base_face_id = base_face->id;
+      e->attr_filter = attr_filter;
+      e->face_id = face_id;
+      e->generation = c->memo_generation;
+    }
+
+  return face_id;
+}
+
 /* Return the face ID associated with buffer position POS for
    displaying ASCII characters.  Return in *ENDPTR the position at
    which a different face is needed, as far as text properties and
@@ -6348,19 +6502,18 @@ face_at_buffer_position (struct window *w, ptrdiff_t pos,
       return default_face->id;
     }
 
-  /* Begin with attributes from the default face.  */
-  memcpy (attrs, default_face->lface, sizeof(attrs));
-
-  /* Merge in attributes specified via text properties.  */
-  if (!NILP (prop))
-    merge_face_ref (w, f, prop, attrs, true, NULL, attr_filter);
-
-  /* Now merge the overlay data.  */
   noverlays = sort_overlays (overlay_vec, noverlays, w);
   /* For mouse-face, we need only the single highest-priority face
      from the overlays, if any.  */
   if (mouse)
     {
+      /* Begin with attributes from the default face.  */
+      memcpy (attrs, default_face->lface, sizeof attrs);
+
+      /* Merge in attributes specified via text properties.  */
+      if (!NILP (prop))
+	merge_face_ref (w, f, prop, attrs, true, NULL, attr_filter);
+
       for (prop = Qnil, i = noverlays - 1; i >= 0 && NILP (prop); --i)
 	{
 	  Lisp_Object oend;
@@ -6384,6 +6537,16 @@ face_at_buffer_position (struct window *w, ptrdiff_t pos,
     }
   else
     {
+      /* Collect the text property and the overlay properties in the
+	 order they are merged.  */
+      Lisp_Object *props;
+      ptrdiff_t nprops = 0;
+      int face_id;
+
+      SAFE_NALLOCA (props, 1, noverlays + 1);
+      if (!NILP (prop))
+	props[nprops++] = prop;
+
       for (i = 0; i < noverlays; i++)
 	{
 	  Lisp_Object oend;
@@ -6392,13 +6555,20 @@ face_at_buffer_position (struct window *w, ptrdiff_t pos,
 	  prop = Foverlay_get (overlay_vec[i], propname);
 
 	  if (!NILP (prop))
-	    merge_face_ref (w, f, prop, attrs, true, NULL, attr_filter);
+	    props[nprops++] = prop;
 
 	  oend = OVERLAY_END (overlay_vec[i]);
 	  oendpos = OVERLAY_POSITION (oend);
 	  if (oendpos < endpos)
 	    endpos = oendpos;
 	}
+
+      *endptr = endpos;
+
+      face_id = lookup_merged_face (w, props, nprops, default_face,
+				    attr_filter);
+      SAFE_FREE ();
+      return face_id;
     }
 
   *endptr = endpos;
@@ -6423,7 +6593,6 @@ face_for_overlay_string (struct window *w, ptrdiff_t pos,
 			 enum lface_attribute_index attr_filter)
 {
   struct frame *f = XFRAME (w->frame);
-  Lisp_Object attrs[LFACE_VECTOR_SIZE];
   Lisp_Object prop, position;
   ptrdiff_t endpos;
   Lisp_Object propname = mouse ? Qmouse_face : Qface;
@@ -6453,19 +6622,10 @@ face_for_overlay_string (struct window *w, ptrdiff_t pos,
       && NILP (Vface_remapping_alist))
     return DEFAULT_FACE_ID;
 
-  /* Begin with attributes from the default face.  */
+  /* Merge the text property into the default face.  */
   default_face = FACE_FROM_ID (f, lookup_basic_face (w, f, DEFAULT_FACE_ID));
-  memcpy (attrs, default_face->lface, sizeof attrs);
-
-  /* Merge in attributes specified via text properties.  */
-  if (!NILP (prop))
-    merge_face_ref (w, f, prop, attrs, true, NULL, attr_filter);
-
-  *endptr = endpos;
-
-  /* Look up a realized face with the given face attributes,
-     or realize a new one for ASCII characters.  */
-  return lookup_face (f, attrs);
+  return lookup_merged_face (w, &prop, !NILP (prop), default_face,
+			     attr_filter);
 }
 
 
@@ -6499,7 +6659,6 @@ face_at_string_position (struct window *w, Lisp_Object string,
 {
   Lisp_Object prop, position, end, limit;
   struct frame *f = XFRAME (WINDOW_FRAME (w));
-  Lisp_Object attrs[LFACE_VECTOR_SIZE];
   struct face *base_face;
   bool multibyte_p = STRING_MULTIBYTE (string);
   Lisp_Object prop_name = mouse_p ? Qmouse_face : Qface;
@@ -6534,16 +6693,8 @@ face_at_string_position (struct window *w, Lisp_Object string,
 	  || FACE_SUITABLE_FOR_ASCII_CHAR_P (base_face)))
     return base_face->id;
 
-  /* Begin with attributes from the base face.  */
-  memcpy (attrs, base_face->lface, sizeof attrs);
-
-  /* Merge in attributes specified via text properties.  */
-  if (!NILP (prop))
-    merge_face_ref (w, f, prop, attrs, true, NULL, attr_filter);
-
-  /* Look up a realized face with the given face attributes,
-     or realize a new one for ASCII characters.  */
-  return lookup_face (f, attrs);
+  /* Merge the text property into the base face.  */
+  return lookup_merged_face (w, &prop, !NILP (prop), base_face, attr_filter);
 }
 
 
@@ -767,10 +767,36 @@ x_cr_export_frames (Lisp_Object frames, cairo_surface_type_t surface_type)
 
 #endif	/* USE_CAIRO */
 
+#ifndef USE_CAIRO
+/* The GC whose clip rectangles x_set_glyph_string_clipping set last,
+   and these rectangles, or a null GC if its clipping changed since.
+   x_draw_glyph_string leaves the clipping of a glyph string in place
+   if the next glyph string is drawn with the same GC, so that drawing
+   the next one doesn't need to send the same rectangles to the X
+   server again.  That also lets Xlib merge the background fills of
+   both into one request.  */
+static GC glyph_string_clip_gc;
+static XRectangle glyph_string_clip_rects[2];
+static int glyph_string_clip_n;
+
+/* Note that the clipping of GC changed other than by
+   x_set_glyph_string_clipping.  */
+
+static void
+x_forget_glyph_string_clipping (GC gc)
+{
+  if (gc == glyph_string_clip_gc)
+    glyph_string_clip_gc = 0;
+}
+#endif
+
 static void
 x_set_clip_rectangles (struct frame *f, GC gc, XRectangle *rectangles, int n)
 {
   XSetClipRectangles (FRAME_X_DISPLAY (f), gc, 0, 0, rectangles, n, Unsorted);
+#ifndef USE_CAIRO
+  x_forget_glyph_string_clipping (gc);
+#endif
 #ifdef USE_CAIRO
   eassert (n >= 0 && n <= MAX_CLIP_RECTS);
 
@@ -787,6 +813,9 @@ x_set_clip_rectangles (struct frame *f, GC gc, XRectangle *rectangles, int n)
 x_reset_clip_rectangles (struct frame *f, GC gc)
 {
   XSetClipMask (FRAME_X_DISPLAY (f), gc, None);
+#ifndef USE_CAIRO
+  x_forget_glyph_string_clipping (gc);
+#endif
 #ifdef USE_CAIRO
   {
     struct x_gc_ext_data *gc_ext = x_gc_get_ext_data (f, gc, 0);
@@ -1111,6 +1140,38 @@ x_update_begin (struct frame *f)
   /* Nothing to do.  */
 }
 
+/* The serial number of the first request to the X server sent while
+   updating the current window.  */
+
+static unsigned long update_window_request_serial;
+
+/* Start update of window W.  This function is installed as a hook
+   for update_window_begin.  */
+
+static void
+x_update_window_begin (struct window *w)
+{
+  struct frame *f = XFRAME (WINDOW_FRAME (w));
+
+  update_window_request_serial = NextRequest (FRAME_X_DISPLAY (f));
+}
+
+/* End update of window W.  This function is installed as a hook for
+   update_window_end.  Count the requests sent to the X server while
+   updating W, for `redisplay-statistics'.  Xlib only buffers these,
+   and sends them as a batch when Emacs next reads input.  */
+
+static void
+x_update_window_end (struct window *w, bool cursor_on_p,
+		     bool mouse_face_overwritten_p)
+{
+  struct frame *f = XFRAME (WINDOW_FRAME (w));
+
+  redisplay_stats_count (w, RSTAT_DRAW_REQUESTS,
+			 (NextRequest (FRAME_X_DISPLAY (f))
+			  - update_window_request_serial));
+}
+
 /* Draw a vertical window border from (x,y0) to (x,y1)  */
 
 static void
@@ -1466,6 +1527,7 @@ x_draw_fringe_bitmap (struct window *w, struct glyph_row *row, struct draw_fring
 	  gcv.clip_x_origin = p->x;
 	  gcv.clip_y_origin = p->y;
 	  XChangeGC (display, gc, GCClipMask | GCClipXOrigin | GCClipYOrigin, &gcv);
+	  x_forget_glyph_string_clipping (gc);
 	}
 
       XCopyArea (display, pixmap, drawable, gc, 0, 0,
@@ -1663,8 +1725,31 @@ x_set_glyph_string_clipping (struct glyph_string *s)
   XRectangle *r = s->clip;
   int n = get_glyph_string_clip_rects (s, r, 2);
 
+#ifndef USE_CAIRO
+  /* The previous glyph string may have left the same clipping in
+     place for us.  */
+  if (s->gc == glyph_string_clip_gc)
+    {
+      if (n > 0
+	  && n == glyph_string_clip_n
+	  && !memcmp (r, glyph_string_clip_rects, n * sizeof *r))
+	{
+	  s->num_clips = n;
+	  return;
+	}
+      x_reset_clip_rectangles (s->f, s->gc);
+    }
+#endif
+
   if (n > 0)
-    x_set_clip_rectangles (s->f, s->gc, r, n);
+    {
+      x_set_clip_rectangles (s->f, s->gc, r, n);
+#ifndef USE_CAIRO
+      glyph_string_clip_gc = s->gc;
+      memcpy (glyph_string_clip_rects, r, n * sizeof *r);
+      glyph_string_clip_n = n;
+#endif
+    }
   s->num_clips = n;
 }
 
@@ -3136,6 +3221,7 @@ x_draw_image_foreground (struct glyph_string *s)
 	  xgcv.clip_y_origin = y;
 	  xgcv.function = GXcopy;
 	  XChangeGC (FRAME_X_DISPLAY (s->f), s->gc, mask, &xgcv);
+	  x_forget_glyph_string_clipping (s->gc);
 
 	  get_glyph_string_clip_rect (s, &clip_rect);
 	  image_rect.x = x;
@@ -3318,11 +3404,12 @@ x_draw_image_foreground_1 (struct glyph_string *s, Pixmap pixmap)
 	  xgcv.clip_y_origin = y - s->slice.y;
 	  xgcv.function = GXcopy;
 	  XChangeGC (display, s->gc, mask, &xgcv);
+	  x_forget_glyph_string_clipping (s->gc);
 
 	  x_composite_image (s, pixmap,
                              s->slice.x, s->slice.y,
                              x, y, s->slice.width, s->slice.height);
-	  XSetClipMask (display, s->gc, None);
+	  x_reset_clip_rectangles (s->f, s->gc);
 	}
       else
 	{
@@ -3431,7 +3518,7 @@ x_draw_image_glyph_string (struct glyph_string *s)
 
 	  /* Don't clip in the following because we're working on the
 	     pixmap.  */
-	  XSetClipMask (display, s->gc, None);
+	  x_reset_clip_rectangles (s->f, s->gc);
 
 	  /* Fill the pixmap with the background color/stipple.  */
 	  if (s->stippled_p)
@@ -3670,7 +3757,7 @@ x_draw_underwave (struct glyph_string *s)
   if (!gui_intersect_rectangles (&wave_clip, &string_clip, &final_clip))
     return;
 
-  XSetClipRectangles (display, s->gc, 0, 0, &final_clip, 1, Unsorted);
+  x_set_clip_rectangles (s->f, s->gc, &final_clip, 1);
 
   /* Draw the waves */
 
@@ -3698,7 +3785,7 @@ x_draw_underwave (struct glyph_string *s)
     }
 
   /* Restore previous clipping rectangle(s) */
-  XSetClipRectangles (display, s->gc, 0, 0, s->clip, s->num_clips, Unsorted);
+  x_set_clip_rectangles (s->f, s->gc, s->clip, s->num_clips);
 #endif	/* not USE_CAIRO */
 }
 
@@ -4017,8 +4104,19 @@ x_draw_glyph_string (struct glyph_string *s)
 	}
     }
 
-  /* Reset clipping.  */
-  x_reset_clip_rectangles (s->f, s->gc);
+  /* Reset clipping, unless the next glyph string will be drawn with
+     the same GC, and so likely with the same clipping.  */
+#ifndef USE_CAIRO
+  if (!(s->gc == glyph_string_clip_gc
+	&& s->next
+	&& s->next->face == s->face
+	&& s->next->hl == DRAW_NORMAL_TEXT
+	&& s->hl == DRAW_NORMAL_TEXT
+	&& !s->for_overlaps
+	&& (s->first_glyph->type == CHAR_GLYPH
+	    || s->first_glyph->type == STRETCH_GLYPH)))
+#endif
+    x_reset_clip_rectangles (s->f, s->gc);
   s->num_clips = 0;
 }
 
@@ -8242,14 +8340,20 @@ handle_one_xevent (struct x_display_info *dpyinfo,
                             event->xexpose.x, event->xexpose.y,
                             event->xexpose.width, event->xexpose.height);
 #endif
-              expose_frame (f, event->xexpose.x, event->xexpose.y,
-			    event->xexpose.width, event->xexpose.height);
+              /* COUNT is the number of Expose events that follow
+                 this one for the same window, so redraw once the
+                 last of them arrives.  */
+              expose_frame_damage (f, event->xexpose.x, event->xexpose.y,
+                                   event->xexpose.width,
+                                   event->xexpose.height);
+              if (event->xexpose.count == 0)
+                flush_frame_damage (f);
 #ifdef USE_GTK
 	      x_clear_under_internal_border (f);
 #endif
             }
 
-          if (!FRAME_GARBAGED_P (f))
+          if (event->xexpose.count == 0 && !FRAME_GARBAGED_P (f))
             show_back_buffer (f);
         }
       else
@@ -8291,14 +8395,18 @@ handle_one_xevent (struct x_display_info *dpyinfo,
       f = x_window_to_frame (dpyinfo, event->xgraphicsexpose.drawable);
       if (f)
         {
-          expose_frame (f, event->xgraphicsexpose.x,
-                        event->xgraphicsexpose.y,
-                        event->xgraphicsexpose.width,
-                        event->xgraphicsexpose.height);
+          expose_frame_damage (f, event->xgraphicsexpose.x,
+                               event->xgraphicsexpose.y,
+                               event->xgraphicsexpose.width,
+                               event->xgraphicsexpose.height);
+          if (event->xgraphicsexpose.count == 0)
+            {
+              flush_frame_damage (f);
 #ifdef USE_GTK
-	  x_clear_under_internal_border (f);
+	      x_clear_under_internal_border (f);
 #endif
-	  show_back_buffer (f);
+	      show_back_buffer (f);
+            }
         }
 #ifdef USE_X_TOOLKIT
       else
@@ -13363,8 +13471,8 @@ x_activate_timeout_atimer (void)
     gui_clear_end_of_line,
     x_scroll_run,
     x_after_update_window_line,
-    NULL, /* update_window_begin */
-    NULL, /* update_window_end   */
+    x_update_window_begin,
+    x_update_window_end,
     x_flip_and_flush,
     gui_clear_window_mouse_face,
     gui_get_glyph_overhangs,
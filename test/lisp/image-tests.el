@@ -76,4 +76,126 @@ image-rotate
     (image-rotate -154.5)
     (should (equal image '(image :rotation 91.0)))))
 
+(ert-deftest image-load-deferred-timer ()
+  "Test that `image-load-deferred-timer' runs while there is a budget."
+  (skip-unless (fboundp 'image-load-deferred))
+  (let ((image-load-time-budget nil))
+    (should-not image-load-deferred-timer)
+    (let ((image-load-time-budget 0.1))
+      (should (memq image-load-deferred-timer timer-idle-list)))
+    (should-not image-load-deferred-timer)))
+
+(ert-deftest image-load-deferred ()
+  "Test that redisplay defers loading images beyond its budget."
+  (skip-unless (and (display-images-p) (image-type-available-p 'png)))
+  (let ((image (create-image (expand-file-name
+                              "data/image/blank-200x100.png"
+                              (getenv "EMACS_TEST_DIRECTORY"))
+                             nil nil :ascent 99))
+        (image-deferred-frames nil))
+    ;; Don't find the image in the cache.
+    (image-flush image)
+    (with-temp-buffer
+      (switch-to-buffer (current-buffer))
+      (insert-image image)
+      (let ((image-load-time-budget 0))
+        (redisplay t)
+        (should (memq (selected-frame) image-deferred-frames))
+        (should-not (image-load-deferred)))
+      (should (equal (image-size image t) '(200 . 100))))))
+
+(ert-deftest image-load-deferred-size ()
+  "Test that a deferred image is laid out with its size once loaded."
+  (skip-unless (display-images-p))
+  ;; Redisplay can't probe the size of PBM images, so it gives them a
+  ;; placeholder of a default size.
+  (let ((image (create-image (concat "P1\n30 10\n" (make-string 300 ?0))
+                             'pbm t))
+        (image-deferred-frames nil))
+    (image-flush image)
+    (with-temp-buffer
+      (switch-to-buffer (current-buffer))
+      (dotimes (_ 10)
+        (insert-image image)
+        (insert "\n"))
+      (goto-char (point-min))
+      (let ((image-load-time-budget 0))
+        (redisplay t)
+        (should (memq (selected-frame) image-deferred-frames))
+        (should-not (image-load-deferred)))
+      (should (equal (image-size image t) '(30 . 10)))
+      (should (< (cdr (window-text-pixel-size nil (point-min) (point-max)))
+                 (* 10 (+ 10 (* 2 (default-line-height)))))))))
+
+(ert-deftest image-cache-size-limit ()
+  "Test that redisplay keeps the image cache within its size limit."
+  (skip-unless (and (display-images-p) (image-type-available-p 'png)))
+  (let ((file (expand-file-name "data/image/blank-200x100.png"
+                                (getenv "EMACS_TEST_DIRECTORY"))))
+    (with-temp-buffer
+      (switch-to-buffer (current-buffer))
+      ;; Cache images that aren't displayed any more.
+      (dotimes (i 3)
+        (insert-image (create-image file nil nil :ascent (+ 10 i)))
+        (redisplay t)
+        (erase-buffer))
+      (let ((stats (image-cache-statistics)))
+        (should (>= (plist-get stats :size) (* 3 200 100)))
+        (should (>= (image-cache-size) (plist-get stats :size)))
+        (let ((image-cache-size-limit 0))
+          (insert-image (create-image file nil nil :ascent 50))
+          (redisplay t))
+        (let ((new-stats (image-cache-statistics)))
+          (should (>= (plist-get new-stats :evictions)
+                      (+ (plist-get stats :evictions) 3)))
+          (should (> (plist-get new-stats :misses)
+                     (plist-get stats :misses)))
+          ;; The displayed image stays in the cache.
+          (should (> (plist-get new-stats :size) 0)))))))
+
+(ert-deftest image-animated-gif-frames ()
+  "Test showing the frames of an animated GIF in any order."
+  (skip-unless (and (display-images-p) (image-type-available-p 'gif)))
+  (let ((image (create-image (expand-file-name
+                              "data/image/animated.gif"
+                              (getenv "EMACS_TEST_DIRECTORY")))))
+    (should (= (plist-get (image-metadata image) 'count) 3))
+    (dolist (index '(0 1 2 1 0 2 2))
+      (setf (image-property image :index) index)
+      (should (equal (image-size image t) '(4 . 4))))
+    (setf (image-property image :index) 3)
+    (should (equal (image-size image t) '(30 . 30)))))
+
+;;; The following is for benchmark testing of image conversions, not
+;;; for regression testing.
+
+(defun image-tests--ppm-data (width height)
+  "Return the data of a WIDTH by HEIGHT PPM image of color gradients."
+  (with-temp-buffer
+    (set-buffer-multibyte nil)
+    (insert (format "P6\n%d %d\n255\n" width height))
+    (dotimes (y height)
+      (dotimes (x width)
+        (insert (% x 256) (% y 256) (% (+ x y) 256))))
+    (buffer-string)))
+
+(defun image-tests-benchmark-conversions (&optional size)
+  "Benchmark `:conversion' of a SIZE by SIZE (default 1000) image.
+Report the throughput of loading the image with each conversion, in
+megapixels per second.  This needs a graphical display."
+  (let ((size (or size 1000))
+        (repetitions 5)
+        (results nil))
+    (let ((data (image-tests--ppm-data size size)))
+      (dolist (conversion '(nil disabled laplace emboss
+                            (edge-detection :matrix (1 1 1 1 -8 1 1 1 1))))
+        (let* ((image (create-image data 'pbm t :conversion conversion))
+               (time (car (benchmark-run repetitions
+                            (image-flush image)
+                            (image-size image t)))))
+          (push (list conversion
+                      (/ (* repetitions size size) time 1e6))
+                results))))
+    (message "%S" (nreverse results))))
+
 ;;; image-tests.el ends here
@@ -0,0 +1,58 @@
+;;; composite-tests.el --- tests for composite.c functions  -*- lexical-binding: t -*-
+
+;; Copyright (C) 2021 Free Software Foundation, Inc.
+
+;; This file is part of GNU Emacs.
+
+;; GNU Emacs is free software: you can redistribute it and/or modify
+;; it under the terms of the GNU General Public License as published by
+;; the Free Software Foundation, either version 3 of the License, or
+;; (at your option) any later version.
+
+;; GNU Emacs is distributed in the hope that it will be useful,
+;; but WITHOUT ANY WARRANTY; without even the implied warranty of
+;; MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+;; GNU General Public License for more details.
+
+;; You should have received a copy of the GNU General Public License
+;; along with GNU Emacs.  If not, see <https://www.gnu.org/licenses/>.
+
+;;; Code:
+
+(require 'ert)
+
+(ert-deftest composite-tests-cache-size-limit ()
+  "Test that redisplay keeps the composition cache within its limit."
+  (clear-composition-cache)
+  (composition-cache-statistics t)
+  (let ((stats (composition-cache-statistics)))
+    (dolist (prop '(:size :hits :misses :evictions))
+      (should (eql (plist-get stats prop) 0))))
+  ;; Redisplay does nothing in batch mode.
+  (skip-unless (not noninteractive))
+  (with-temp-buffer
+    (switch-to-buffer (current-buffer))
+    ;; Each letter followed by a combining accent is composed.
+    (dotimes (i 200)
+      (insert (+ ?a (% i 26)) (+ #x300 (% i 40)) " "))
+    (redisplay t)
+    (let ((size (plist-get (composition-cache-statistics) :size)))
+      (should (> size 10))
+      (let ((composition-cache-size-limit 10))
+        (erase-buffer)
+        (insert ?z #x327)
+        (redisplay t)
+        (let ((stats (composition-cache-statistics)))
+          ;; Eviction leaves room for new glyph-strings.
+          (should (<= (plist-get stats :size) 7))
+          (should (> (plist-get stats :evictions) 0)))
+        ;; The displayed composition was kept.
+        (composition-cache-statistics t)
+        (force-window-update)
+        (redisplay t)
+        (let ((stats (composition-cache-statistics)))
+          (should (> (plist-get stats :hits) 0))
+          (should (= (plist-get stats :misses) 0)))))))
+
+(provide 'composite-tests)
+;;; composite-tests.el ends here
@@ -112,6 +112,30 @@ font-parse-tests
       (should (font-parse-check name :slant  (nth 4 test)))
       (should (font-parse-check name :spacing (nth 5 test))))))
 
+(ert-deftest font-cache-statistics ()
+  "Test that fonts listed once are found in the font cache."
+  (font-cache-statistics t)
+  (let ((stats (font-cache-statistics)))
+    (dolist (prop '(:lists :list-hits :matches :match-hits :opens :open-hits
+                    :glyph-codes :glyph-code-hits
+                    :glyph-metrics :glyph-metrics-hits))
+      (should (eql (plist-get stats prop) 0))))
+  ;; Fonts can only be listed on graphical frames.
+  (skip-unless (display-graphic-p))
+  (let ((spec (font-spec :family (face-attribute 'default :family))))
+    (list-fonts spec)
+    (list-fonts spec)
+    (let ((stats (font-cache-statistics)))
+      (should (>= (plist-get stats :lists) 2))
+      (should (> (plist-get stats :list-hits) 0))))
+  (with-temp-buffer
+    (switch-to-buffer (current-buffer))
+    (insert "abcabc\n")
+    (redisplay t)
+    (let ((stats (font-cache-statistics)))
+      (should (> (plist-get stats :glyph-code-hits) 0))
+      (should (> (plist-get stats :glyph-metrics-hits) 0)))))
+
 
 (defun test-font-parse ()
   "Test font name parsing."
@@ -159,6 +183,39 @@ test-font-parse
 	(insert "\n"))))
   (goto-char (point-min)))
 
+(defun font-tests-benchmark-glyph-cache (&optional lines)
+  "Benchmark displaying LINES (default 2000) lines of CJK text.
+Report the number of calls to the font driver with the glyph cache,
+and the number there would have been without it.  This needs a
+graphical session."
+  (let ((buf (generate-new-buffer "*font-tests-glyph-cache*")))
+    (unwind-protect
+        (progn
+          (switch-to-buffer buf)
+          (dotimes (i (or lines 2000))
+            (dotimes (j 40)
+              (insert (+ #x4e00 (% (* (+ i j) 37) 3000))))
+            (insert "\n"))
+          (goto-char (point-min))
+          (redisplay t)
+          (font-cache-statistics t)
+          (let ((time (benchmark-run 1
+                        (condition-case nil
+                            (while t
+                              (scroll-up)
+                              (redisplay t))
+                          (end-of-buffer nil))))
+                (stats (font-cache-statistics)))
+            (message "%S: %d driver calls, %d without the glyph cache"
+                     time
+                     (- (+ (plist-get stats :glyph-codes)
+                           (plist-get stats :glyph-metrics))
+                        (plist-get stats :glyph-code-hits)
+                        (plist-get stats :glyph-metrics-hits))
+                     (+ (plist-get stats :glyph-codes)
+                        (plist-get stats :glyph-metrics)))))
+      (kill-buffer buf))))
+
 ;; Local Variables:
 ;; no-byte-compile: t
 ;; End:
@@ -803,4 +803,97 @@ regexp-multibyte-unibyte
   (should-not (string-match "å" "\xe5"))
   (should-not (string-match "[å]" "\xe5")))
 
+(ert-deftest regexp-profile ()
+  "Test the statistics gathered while `regexp-profiling' is on."
+  (regexp-profile-reset)
+  (let ((regexp (concat "\\(?:a*\\)*b" (make-string 1 ?x)))
+        (string (make-string 20 ?a)))
+    (let ((regexp-profiling nil))
+      (should-not (string-match regexp string)))
+    (should-not (assoc regexp (regexp-profile-data)))
+    (let ((regexp-profiling t))
+      (should-not (string-match regexp string))
+      (should-not (string-match regexp string)))
+    (let ((data (cdr (assoc regexp (regexp-profile-data)))))
+      (should data)
+      (pcase-let ((`(,calls ,bytes ,backtracks ,stack ,seconds) data))
+        (should (= calls 2))
+        ;; Each search looked at the whole string once.
+        (should (= bytes 40))
+        (should (> backtracks 0))
+        (should (> stack 0))
+        (should (floatp seconds))))
+    ;; The statistics survive the regexp's eviction from the cache.
+    (dotimes (i 30)
+      (string-match (format "x%d" i) ""))
+    (should (= (nth 1 (assoc regexp (regexp-profile-data))) 2))
+    (regexp-profile-reset)
+    (should-not (assoc regexp (regexp-profile-data)))))
+
+;; Test regexp objects made by `compile-regexp'.
+(ert-deftest regexp-compile-regexp ()
+  (let ((re (compile-regexp "\\(fo+\\)\\(?:bar\\)?")))
+    (should (regexpp re))
+    (should-not (regexpp "foo"))
+    (should (eq (type-of re) 'regexp))
+    (should (equal (regexp-source re) "\\(fo+\\)\\(?:bar\\)?"))
+    (should (equal (prin1-to-string re) "#<regexp \"\\\\(fo+\\\\)\\\\(?:bar\\\\)?\">"))
+    (should (= (string-match re "xxfoooo") 2))
+    (should (equal (match-string 1 "xxfoooo") "foooo"))
+    (should-not (string-match re "bar"))
+    (with-temp-buffer
+      (insert "a foobar b fo")
+      (goto-char (point-min))
+      (should-not (looking-at re))
+      (should (re-search-forward re nil t))
+      (should (equal (match-string 0) "foobar"))
+      (should (re-search-forward re nil t))
+      (should (equal (match-string 1) "fo"))
+      (should (= (re-search-backward re nil t) 12))
+      (should-error (search-forward re) :type 'wrong-type-argument))
+    ;; Evicting everything from the regexp cache does not affect it.
+    (dotimes (i 30)
+      (string-match (format "y%d" i) ""))
+    (should (= (string-match re "foo") 0))))
+
+(ert-deftest regexp-compile-regexp-case-fold ()
+  "Test that a regexp object obeys the current `case-fold-search'."
+  (let* ((case-fold-search nil)
+         (re (compile-regexp "abc")))
+    (should-not (string-match re "ABC"))
+    (let ((case-fold-search t))
+      (should (= (string-match re "xABC") 1)))
+    (should (= (string-match re "abc") 0))))
+
+(ert-deftest regexp-compile-regexp-syntax-table ()
+  "Test that a regexp object follows changes to the syntax table."
+  (with-temp-buffer
+    (set-syntax-table (make-syntax-table))
+    (let ((re (compile-regexp "[[:word:]]+")))
+      (insert "ab-cd")
+      (goto-char (point-min))
+      (should (looking-at re))
+      (should (equal (match-string 0) "ab"))
+      (modify-syntax-entry ?- "w")
+      (should (looking-at re))
+      (should (equal (match-string 0) "ab-cd")))))
+
+;; Test that the failure stack survives overflows and reports its peak.
+(ert-deftest regexp-failure-stack-peak ()
+  (let ((regexp (concat "\\(?:a\\|b\\)*c" (make-string 1 ?y)))
+        (re (compile-regexp "\\(?:x\\|y\\)*z")))
+    (should-not (string-match regexp (make-string 10 ?a)))
+    (let ((small (regexp-failure-stack-peak regexp)))
+      (should (> small 0))
+      (should-not (string-match regexp (make-string 1000 ?a)))
+      (should (> (regexp-failure-stack-peak regexp) small)))
+    (should (zerop (regexp-failure-stack-peak re)))
+    (should-error (string-match re (make-string 1000000 ?x)))
+    (should (> (regexp-failure-stack-peak re) 100000))
+    ;; Matching still works after the overflow and a garbage collection.
+    (garbage-collect)
+    (should (= (string-match re "xyxyz") 0))
+    (should-not (string-match regexp (make-string 1000 ?b)))
+    (should-not (regexp-failure-stack-peak "no such regexp in the cache"))))
+
 ;;; regex-emacs-tests.el ends here
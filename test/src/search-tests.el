@@ -0,0 +1,153 @@
+;;; search-tests.el --- tests for search.c -*- lexical-binding: t -*-
+
+;; Copyright (C) 2021 Free Software Foundation, Inc.
+
+;; This file is part of GNU Emacs.
+
+;; GNU Emacs is free software: you can redistribute it and/or modify
+;; it under the terms of the GNU General Public License as published by
+;; the Free Software Foundation, either version 3 of the License, or
+;; (at your option) any later version.
+
+;; GNU Emacs is distributed in the hope that it will be useful,
+;; but WITHOUT ANY WARRANTY; without even the implied warranty of
+;; MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+;; GNU General Public License for more details.
+
+;; You should have received a copy of the GNU General Public License
+;; along with GNU Emacs.  If not, see <https://www.gnu.org/licenses/>.
+
+;;; Code:
+
+(require 'ert)
+
+(defun search-tests--insert-lines (n)
+  "Insert N lines of varying length, some of them empty or multibyte."
+  (dotimes (i n)
+    (insert-char (if (zerop (% i 7)) ?é ?x) (% (* i 37) 301))
+    (insert "\n")))
+
+(defun search-tests--count-newlines (from to)
+  "Count the newlines between FROM and TO the slow way."
+  (let ((n 0))
+    (save-excursion
+      (goto-char from)
+      (while (search-forward "\n" to t)
+        (setq n (1+ n))))
+    n))
+
+(ert-deftest search-tests-forward-line-counts ()
+  "Test that `forward-line' counts every newline, with and without
+the newline cache, and across the buffer gap."
+  (dolist (cache '(t nil))
+    (with-temp-buffer
+      (setq cache-long-scans cache)
+      (search-tests--insert-lines 5000)
+      ;; Put the gap in the middle of the text.
+      (goto-char (/ (point-max) 2))
+      (insert "gap")
+      (let ((lines (search-tests--count-newlines (point-min) (point-max))))
+        (goto-char (point-min))
+        (should (= (forward-line (+ lines 10)) 10))
+        (should (= (point) (point-max)))
+        (should (= (forward-line (- (+ lines 10))) -10))
+        (should (= (point) (point-min)))
+        (should (= (count-lines (point-min) (point-max)) lines))
+        (dolist (n '(1 2 3 100 1000 2999 3000 4999))
+          (goto-char (point-min))
+          (should (= (forward-line n) 0))
+          (should (= (line-number-at-pos) (1+ n)))
+          (should (bolp))
+          (let ((pos (point)))
+            (goto-char (point-max))
+            (should (= (forward-line (- n lines)) 0))
+            (should (= (point) pos))))))))
+
+(ert-deftest search-tests-count-lines-long-lines ()
+  "Test `count-lines' on text whose lines are longer than a block."
+  (with-temp-buffer
+    (dotimes (i 20)
+      (insert-char ?a (* i 1000))
+      (insert "\n"))
+    (should (= (count-lines (point-min) (point-max)) 20))
+    (should (= (count-lines 5000 (point-max))
+               (search-tests--count-newlines 5000 (point-max))))))
+
+(ert-deftest search-tests-case-fold ()
+  "Test case-insensitive searches of ASCII and non-ASCII text."
+  (with-temp-buffer
+    (insert "Straße ÉCOLE école Ωμέγα ΩΜΈΓΑ 𐐀𐐨\n")
+    (let ((case-fold-search t))
+      (dolist (fn '(search-forward re-search-forward))
+        (goto-char (point-min))
+        (should (funcall fn "strasse" nil t 0))
+        (goto-char (point-min))
+        (should (funcall fn "STRAßE" nil t))
+        (should (funcall fn "école" nil t))
+        (should (equal (match-string 0) "ÉCOLE"))
+        (should (funcall fn "ÉCOLE" nil t))
+        (should (equal (match-string 0) "école"))
+        (should (funcall fn "ωμέγα" nil t))
+        (should (funcall fn "ωμέγα" nil t))
+        (should (equal (match-string 0) "ΩΜΈΓΑ"))
+        (should (funcall fn "𐐨𐐨" nil t))
+        (goto-char (point-max))
+        (should (= (funcall (if (eq fn 'search-forward)
+                                'search-backward
+                              're-search-backward)
+                            "éCoLe" nil t)
+                   14))))
+    (let ((case-fold-search nil))
+      (goto-char (point-min))
+      (should-not (re-search-forward "école.*ÉCOLE" nil t)))))
+
+(ert-deftest search-tests-case-fold-table-change ()
+  "Test that case-insensitive matching sees changes to the case table."
+  (with-temp-buffer
+    (set-case-table (copy-case-table (standard-case-table)))
+    (let ((case-fold-search t)
+          (canon (char-table-extra-slot (current-case-table) 1)))
+      (should canon)
+      (should-not (string-match "q" "Z"))
+      (should-not (string-match "[q]" "Z"))
+      (aset canon ?Z ?q)
+      (should (eql (string-match "q" "Z") 0))
+      (should (eql (string-match "[q]" "Z") 0)))))
+
+
+;;; The following is for benchmark testing of newline counting, not
+;;; for regression testing.
+
+(defun search-tests-benchmark-count-lines (&optional megabytes)
+  "Benchmark `count-lines' on a buffer of MEGABYTES (default 100) MB."
+  (with-temp-buffer
+    (let ((size (* (or megabytes 100) 1024 1024)))
+      (while (< (buffer-size) size)
+        (insert-char ?a (random 120))
+        (insert "\n")))
+    (dolist (cache '(nil t))
+      (setq cache-long-scans cache)
+      (message "cache-long-scans %s: forward %s, backward %s"
+               cache
+               (benchmark-run 10 (count-lines (point-min) (point-max)))
+               (benchmark-run 10 (progn (goto-char (point-max))
+                                        (forward-line
+                                         (- (buffer-size)))))))))
+
+(defun search-tests-benchmark-case-fold (&optional megabytes)
+  "Benchmark searches of a MEGABYTES (default 10) MB buffer with and
+without `case-fold-search'."
+  (with-temp-buffer
+    (let ((size (* (or megabytes 10) 1024 1024)))
+      (while (< (buffer-size) size)
+        (insert "Lorem ipsum dolor sit amet, ÇONSECTETUR adipiscing élit\n")))
+    (dolist (regexp '("élite" "ipsum.*amet," "[Ç]onsectetur adipiscing zz"))
+      (dolist (case-fold-search '(nil t))
+        (message "%S case-fold-search %s: %s"
+                 regexp case-fold-search
+                 (benchmark-run 3
+                   (goto-char (point-min))
+                   (while (re-search-forward regexp nil t))))))))
+
+(provide 'search-tests)
+;;; search-tests.el ends here
@@ -0,0 +1,358 @@
+;;; xdisp-tests.el --- tests for xdisp.c functions  -*- lexical-binding: t -*-
+
+;; Copyright (C) 2021 Free Software Foundation, Inc.
+
+;; This file is part of GNU Emacs.
+
+;; GNU Emacs is free software: you can redistribute it and/or modify
+;; it under the terms of the GNU General Public License as published by
+;; the Free Software Foundation, either version 3 of the License, or
+;; (at your option) any later version.
+
+;; GNU Emacs is distributed in the hope that it will be useful,
+;; but WITHOUT ANY WARRANTY; without even the implied warranty of
+;; MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+;; GNU General Public License for more details.
+
+;; You should have received a copy of the GNU General Public License
+;; along with GNU Emacs.  If not, see <https://www.gnu.org/licenses/>.
+
+;;; Code:
+
+(require 'ert)
+
+(defun xdisp-tests--insert-long-line (chars)
+  "Insert a line of at least CHARS characters with some punctuation."
+  (let ((start (point)))
+    (while (< (- (point) start) chars)
+      (insert "abcdefghij (klmnop) qrstuvwxyz 0123456789 "))))
+
+(ert-deftest xdisp-tests-long-line-optimizations ()
+  "Test that redisplay turns on long-line optimizations when it should,
+and that motion by screen lines still works then."
+  ;; Redisplay does nothing in batch mode.
+  (skip-unless (not noninteractive))
+  (let ((long-line-threshold 10000))
+    (with-temp-buffer
+      (switch-to-buffer (current-buffer))
+      (dotimes (_ 100)
+        (insert (make-string 70 ?x) "\n"))
+      (redisplay)
+      (should-not (long-line-optimizations-p))
+      (xdisp-tests--insert-long-line 200000)
+      (goto-char (/ (point-max) 2))
+      (redisplay)
+      (should (long-line-optimizations-p))
+      (vertical-motion 0)
+      (let ((pos (point)))
+        (should (> pos (/ (point-max) 4)))
+        (should (= (vertical-motion 1) 1))
+        (should (> (point) pos))
+        (should (= (vertical-motion -1) -1))
+        (should (= (point) pos)))
+      (erase-buffer)
+      (should-not (long-line-optimizations-p)))))
+
+(ert-deftest xdisp-tests-redisplay-statistics ()
+  "Test the value of `redisplay-statistics' and resetting it."
+  (dolist (object (list nil (selected-window) (current-buffer) t))
+    (let ((stats (redisplay-statistics object)))
+      (dolist (prop '(:cursor-movement :reused-matrix :window-id :full
+                      :lines :lines-reused :rows-updated :rows-reused
+                      :draw-requests :exposures :exposed-area
+                      :faces-merged :faces-memoized :bytes-output))
+        (should (natnump (plist-get stats prop))))
+      (dolist (prop '(:display-line-time :fontification-time :update-time))
+        (should (floatp (plist-get stats prop))))))
+  (should-error (redisplay-statistics 'foo) :type 'wrong-type-argument)
+  (with-temp-buffer
+    (switch-to-buffer (current-buffer))
+    (insert "foo\n")
+    (redisplay-statistics nil t)
+    (should (= (plist-get (redisplay-statistics) :lines) 0))
+    ;; Redisplay does nothing in batch mode.
+    (unless noninteractive
+      (redisplay t)
+      (should (> (plist-get (redisplay-statistics) :lines) 0))
+      (should (> (plist-get (redisplay-statistics (current-buffer)) :lines)
+                 0)))))
+
+(ert-deftest xdisp-tests-tty-face-runs ()
+  "Test that faces which look the same on a terminal cost no output."
+  ;; Only text terminals count the bytes they output.
+  (skip-unless (and (not noninteractive) (not (display-graphic-p))))
+  (let ((bytes
+         (lambda (string)
+           (with-temp-buffer
+             (switch-to-buffer (current-buffer))
+             (redisplay t)
+             (redisplay-statistics t t)
+             (insert string)
+             (redisplay t)
+             (plist-get (redisplay-statistics t) :bytes-output))))
+        (plain (make-string 40 ?x))
+        (mixed (make-string 40 ?x)))
+    (put-text-property 0 40 'face '(:foreground "red") plain)
+    ;; The family makes these different faces, which terminals
+    ;; display the same way.
+    (dotimes (i 20)
+      (put-text-property (* 2 i) (1+ (* 2 i))
+                         'face '(:foreground "red" :family "foo") mixed)
+      (put-text-property (1+ (* 2 i)) (+ 2 (* 2 i))
+                         'face '(:foreground "red") mixed))
+    (let ((plain-bytes (funcall bytes plain)))
+      (should (> plain-bytes 40))
+      (should (= (funcall bytes mixed) plain-bytes)))))
+
+(ert-deftest xdisp-tests-reuse-unchanged-lines ()
+  "Test that redisplay reuses the lines before the first change."
+  ;; Redisplay does nothing in batch mode.
+  (skip-unless (not noninteractive))
+  (with-temp-buffer
+    (switch-to-buffer (current-buffer))
+    ;; Overlay changes make redisplay display the whole window again.
+    (setq bidi-paragraph-direction 'left-to-right)
+    (dotimes (i 100)
+      (insert (format "line %d\n" i)))
+    (goto-char (point-min))
+    (forward-line (/ (window-body-height) 2))
+    (redisplay t)
+    (redisplay-statistics nil t)
+    (overlay-put (make-overlay (line-beginning-position 2)
+                               (line-end-position 2))
+                 'face 'bold)
+    (redisplay t)
+    (should (> (plist-get (redisplay-statistics) :lines-reused) 0))))
+
+(ert-deftest xdisp-tests-face-memo ()
+  "Test that redisplay remembers the faces of text and overlay properties."
+  ;; Redisplay does nothing in batch mode.
+  (skip-unless (not noninteractive))
+  (with-temp-buffer
+    (switch-to-buffer (current-buffer))
+    (dotimes (i 20)
+      (insert (propertize "foo" 'face (if (= (% i 2) 1) 'bold 'italic))
+              (propertize " bar" 'face '(:weight bold :slant italic))
+              "\n"))
+    (let ((ov (make-overlay (point-min) (point-max))))
+      (overlay-put ov 'face 'underline))
+    (redisplay-statistics nil t)
+    (redisplay t)
+    (let ((stats (redisplay-statistics)))
+      (should (> (plist-get stats :faces-merged) 0))
+      (should (> (plist-get stats :faces-memoized) 0))
+      (should (< (plist-get stats :faces-memoized)
+                 (plist-get stats :faces-merged))))))
+
+(ert-deftest xdisp-tests-line-start-cache ()
+  "Test that motion by screen lines is the same with the lines cached."
+  (with-temp-buffer
+    (switch-to-buffer (current-buffer))
+    (setq bidi-paragraph-direction 'left-to-right)
+    (dotimes (i 300)
+      (insert (make-string (* (% i 7) 30) ?x) "\n"))
+    (let ((motions (lambda ()
+                     (goto-char (point-max))
+                     (list (vertical-motion -250) (point)
+                           (vertical-motion 200) (point)))))
+      (let ((wrapped (funcall motions)))
+        (should (equal (funcall motions) wrapped))
+        ;; Changing how lines are displayed invalidates the cache.
+        (setq truncate-lines t)
+        (let ((truncated (funcall motions)))
+          (should-not (equal truncated wrapped))
+          (should (equal (funcall motions) truncated))
+          (insert "y")
+          (delete-char -1)
+          (should (equal (funcall motions) truncated)))
+        (setq truncate-lines nil)
+        (should (equal (funcall motions) wrapped))
+        ;; So does changing the invisibility spec in place...
+        (save-excursion
+          (goto-char (point-min))
+          (forward-line 280)
+          (dotimes (_ 20)
+            (put-text-property (min (1+ (point)) (line-end-position))
+                               (line-end-position) 'invisible 'foo)
+            (forward-line 1)))
+        (setq buffer-invisibility-spec (list 'foo))
+        (let ((invisible (funcall motions)))
+          (should-not (equal invisible wrapped))
+          (setq buffer-invisibility-spec (list 'bar))
+          (should (equal (funcall motions) wrapped))
+          (setcar buffer-invisibility-spec 'foo)
+          (should (equal (funcall motions) invisible))
+          (setcar buffer-invisibility-spec 'bar))
+        ;; ...and the display table.
+        (setq buffer-display-table (make-display-table))
+        (aset buffer-display-table ?x [?x ?x])
+        (let ((doubled (funcall motions)))
+          (should-not (equal doubled wrapped))
+          (setq buffer-display-table (make-display-table))
+          (should (equal (funcall motions) wrapped))
+          (aset buffer-display-table ?x [?x ?x])
+          (should (equal (funcall motions) doubled))
+          (aset buffer-display-table ?x nil))
+        (should (equal (funcall motions) wrapped))))))
+
+(ert-deftest xdisp-tests-bidi-ltr-lines ()
+  "Test the resolved levels of lines with and without right-to-left text."
+  ;; Redisplay does nothing in batch mode.
+  (skip-unless (not noninteractive))
+  (with-temp-buffer
+    (switch-to-buffer (current-buffer))
+    (setq truncate-lines t)
+    (insert "ab (cd) 12\n"
+            "ab אב 12 cd\n"
+            "x ١٢ y\n")
+    (goto-char (point-min))
+    (redisplay t)
+    (should (equal (bidi-resolved-levels 0) [0 0 0 0 0 0 0 0 0 0]))
+    (should (equal (bidi-resolved-levels 1) [0 0 0 2 2 1 1 1 0 0 0]))
+    (should (equal (bidi-resolved-levels 2) [0 0 2 2 0 0]))
+    ;; Text that was known to have no right-to-left characters gets
+    ;; some.
+    (goto-char 3)
+    (insert "א")
+    (redisplay t)
+    (should (equal (bidi-resolved-levels 0) [0 0 1 0 0 0 0 0 0 0 0]))
+    (delete-char -1)
+    (redisplay t)
+    (should (equal (bidi-resolved-levels 0) [0 0 0 0 0 0 0 0 0 0]))))
+
+(defvar xdisp-tests--memo-deps nil)
+(defvar xdisp-tests--memo-evals 0)
+
+(ert-deftest xdisp-tests-mode-line-memo ()
+  "Test that (:memo DEPS FORM) reevaluates FORM only when needed."
+  ;; `format-mode-line' does nothing in batch mode.
+  (skip-unless (not noninteractive))
+  (with-temp-buffer
+    (switch-to-buffer (current-buffer))
+    (setq xdisp-tests--memo-deps 1
+          xdisp-tests--memo-evals 0)
+    (let ((format '("<" (:memo xdisp-tests--memo-deps
+                               (progn
+                                 (setq xdisp-tests--memo-evals
+                                       (1+ xdisp-tests--memo-evals))
+                                 (format "%s-%%b" xdisp-tests--memo-deps)))
+                    ">")))
+      (should (equal (format-mode-line format)
+                     (format "<1-%s>" (buffer-name))))
+      (should (= xdisp-tests--memo-evals 1))
+      (should (equal (format-mode-line format)
+                     (format "<1-%s>" (buffer-name))))
+      (should (= xdisp-tests--memo-evals 1))
+      (setq xdisp-tests--memo-deps 2)
+      (should (equal (format-mode-line format)
+                     (format "<2-%s>" (buffer-name))))
+      (should (= xdisp-tests--memo-evals 2))
+      (insert "foo")
+      (format-mode-line format)
+      (should (= xdisp-tests--memo-evals 3))
+      (force-mode-line-update)
+      (format-mode-line format)
+      (should (= xdisp-tests--memo-evals 4))
+      (format-mode-line format)
+      (should (= xdisp-tests--memo-evals 4))
+      (put-text-property 1 2 'face 'bold)
+      (format-mode-line format)
+      (should (= xdisp-tests--memo-evals 5)))))
+
+(ert-deftest xdisp-tests-fontification-time-budget ()
+  "Test that redisplay defers fontification that exceeds its budget."
+  ;; Redisplay does nothing in batch mode.
+  (skip-unless (not noninteractive))
+  (require 'jit-lock)
+  (with-temp-buffer
+    (switch-to-buffer (current-buffer))
+    (dotimes (i 20)
+      (insert (format "line %d\n" i)))
+    (goto-char (point-min))
+    (setq-local fontification-functions
+                (list (lambda (pos)
+                        ;; Use up 0.01 seconds of the budget.
+                        (let ((end (+ (float-time) 0.01)))
+                          (while (< (float-time) end)))
+                        (save-excursion
+                          (goto-char pos)
+                          (put-text-property pos (line-beginning-position 2)
+                                             'fontified t)))))
+    (let ((fontification-time-budget 0.03)
+          (fontification-deferred-windows nil))
+      (redisplay t)
+      (should (memq (selected-window) fontification-deferred-windows))
+      (should (text-property-any (point-min) (point-max) 'fontified nil))
+      ;; Don't let input, such as a terminal's reply to a query, stop
+      ;; the deferred redisplay.
+      (jit-lock-redisplay-deferred-windows t)
+      (should-not fontification-deferred-windows)
+      (should-not (text-property-any (point-min) (point-max)
+                                     'fontified nil)))
+    ;; A budget that isn't positive means no budget.
+    (put-text-property (point-min) (point-max) 'fontified nil)
+    (let ((fontification-time-budget 0)
+          (fontification-deferred-windows nil))
+      (redisplay t)
+      (should-not fontification-deferred-windows)
+      (should-not (text-property-any (window-start) (window-end nil t)
+                                     'fontified nil)))))
+
+
+;;; The following is for benchmark testing of redisplay, not for
+;;; regression testing.
+
+(defun xdisp-tests-benchmark-long-line (&optional megabytes)
+  "Benchmark cursor motion in a line of MEGABYTES (default 10) MB.
+This needs an interactive session, as redisplay does nothing in
+batch mode."
+  (let ((buf (generate-new-buffer "*xdisp-tests-long-line*")))
+    (unwind-protect
+        (progn
+          (switch-to-buffer buf)
+          (emacs-lisp-mode)
+          (xdisp-tests--insert-long-line (* (or megabytes 10) 1024 1024))
+          (goto-char (/ (point-max) 2))
+          (redisplay)
+          (message "long-line-optimizations-p %s: %S"
+                   (long-line-optimizations-p)
+                   (list (benchmark-run 50 (forward-char 7) (redisplay))
+                         (benchmark-run 20 (next-line 1) (redisplay))
+                         (benchmark-run 20 (previous-line 1) (redisplay))
+                         (benchmark-run 5 (scroll-up 1) (redisplay))
+                         (benchmark-run 5 (scroll-down 1) (redisplay))
+                         (benchmark-run 1 (goto-char (point-max))
+                                        (redisplay)))))
+      (kill-buffer buf))))
+
+(defun xdisp-tests-benchmark-paging (&optional lines)
+  "Benchmark paging through a buffer of LINES (default 100000) lines.
+This needs an interactive session, as redisplay does nothing in
+batch mode."
+  (let ((buf (generate-new-buffer "*xdisp-tests-paging*"))
+        (pages 50))
+    (unwind-protect
+        (progn
+          (switch-to-buffer buf)
+          (setq bidi-paragraph-direction 'left-to-right)
+          (dotimes (i (or lines 100000))
+            (insert (make-string (% (* i 37) 200) ?x) "\n"))
+          (goto-char (/ (point-max) 2))
+          (recenter)
+          (redisplay)
+          (message "%S"
+                   (list (benchmark-run 1
+                           (dotimes (_ pages) (scroll-up) (redisplay)))
+                         (benchmark-run 1
+                           (dotimes (_ pages) (scroll-down) (redisplay)))
+                         (benchmark-run 1
+                           (dotimes (_ pages) (scroll-up) (redisplay)))
+                         (benchmark-run 1
+                           (dotimes (_ pages) (scroll-down) (redisplay)))
+                         (benchmark-run 10
+                           (vertical-motion (* pages 10))
+                           (vertical-motion (* pages -10))))))
+      (kill-buffer buf))))
+
+(provide 'xdisp-tests)
+;;; xdisp-tests.el ends here